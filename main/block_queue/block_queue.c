@@ -1,7 +1,6 @@
 #include "block_queue.h"
 
 #include "FreeRTOS.h"
-#include "queue.h"
 #include "task.h"
 
 #include "block_queue.h"
@@ -28,106 +27,87 @@
 
 #ifdef QUEUE_DEBUG
 #  define QUEUE_LOG                    DBG
-#  define QUEUE_LOG_AVAILABLE(q)                               \
-          do                                                   \
-          {                                                    \
-            UBaseType_t available = uxQueueSpacesAvailable(q); \
-            QUEUE_LOG("  OS Queue Free  = %d\r\n", available); \
-          }                                                    \
+#  define QUEUE_LOG_AVAILABLE(q)                                      \
+          do                                                          \
+          {                                                           \
+            U32 available = BlockQueue_GetCountOfFree(q);             \
+            QUEUE_LOG("  Queue Free     = %d\r\n", available);         \
+          }                                                           \
           while (0);
 #else
 #  define QUEUE_LOG(...)
 #  define QUEUE_LOG_AVAILABLE(q)
 #endif
 
+/* The positions must be stored in memory in the program order: the block
+   data before the input position and the read out before the output one */
+#if defined(__XTENSA__)
+#  define QUEUE_MEMORY_BARRIER()       __asm__ __volatile__ ("memw" ::: "memory")
+#else
+#  define QUEUE_MEMORY_BARRIER()       __sync_synchronize()
+#endif
+
 //-----------------------------------------------------------------------------
 
+/* Every block in the buffer is preceded by the size of its payload */
 typedef struct BlockItem_s
 {
     U32  Size;    /* Size of the Block */
-    U8 * Data;    /* Pointer to the Block payload */
+    U8   Data[];  /* The Block payload */
 } BlockItem_t;
 
+/* Single producer (task or ISR) / single consumer (task) lock-free queue:
+ *  - I is written by the producer only, when the block is enqueued
+ *  - O is written by the consumer only, when the block is released
+ */
 typedef struct BlockQueue_s
 {
-    S32           I;                 /* Input position in the Queue */
-    S32           O;                 /* Output position in the Queue */
+    volatile S32  I;                 /* Input position in the Queue */
+    volatile S32  O;                 /* Output position in the Queue */
     U32           Capacity;          /* Max count of Items in the Queue */
     U32           BlockSize;         /* Size of the Item */
     U8 *          BlocksBuffer;      /* Pointer to the Queue Buffer */
     U8 *          Produced;          /* Allocated Item */
     U8 *          Consumed;          /* Item that should be released */
     /* OS specific fields */
-    QueueHandle_t osQueue;           /* OS Queue handle */
+    volatile TaskHandle_t osTask;    /* Consumer waiting for the blocks or NULL */
     TickType_t    osTimeout;         /* OS queue receive timeout */
 } BlockQueue_t;
 
 //-----------------------------------------------------------------------------
-/** @brief Wrapper for RTOS queue create function
- *  @param[in] aCapacity - Count of the Items in the Queue
- *  @param[in] aItemSize - The size of the Item
- *  @return Pointer to the created Queue or NULL
- */
-
-static QueueHandle_t osal_QueueCreate(U32 aCapacity, U32 aItemSize)
-{
-    QueueHandle_t result = NULL;
-
-    result = xQueueCreate(aCapacity, (unsigned portBASE_TYPE)aItemSize);
-
-    QUEUE_LOG_AVAILABLE(result);
-
-    return result;
-}
-
-//-----------------------------------------------------------------------------
-/** @brief Wrapper for RTOS queue reset function
+/** @brief Returns the block item by its position in the queue
  *  @param[in] pQueue - Pointer to the Block Queue
- *  @return None
+ *  @param[in] aPosition - Position of the block
+ *  @return Pointer to the block item
  */
 
-static void osal_QueueReset(BlockQueue_p pQueue)
+static BlockItem_t * queue_GetItem(BlockQueue_p pQueue, S32 aPosition)
 {
-    QUEUE_LOG_AVAILABLE(pQueue->osQueue);
-
-    QUEUE_LOG("  OS Queue Reset\r\n");
-
-    xQueueReset(pQueue->osQueue);
-
-    QUEUE_LOG_AVAILABLE(pQueue->osQueue);
+    return (BlockItem_t *)(pQueue->BlocksBuffer +
+                           aPosition * (sizeof(BlockItem_t) + pQueue->BlockSize));
 }
 
 //-----------------------------------------------------------------------------
-/** @brief Wrapper for RTOS queue put function
+/** @brief Wakes up the consumer waiting for the blocks
  *  @param[in] pQueue - Pointer to the Block Queue
- *  @param[in] pBlock - Pointer to the allocated block
- *  @param[in] aBlockSize - Size of the Block
- *  @return FW_TRUE if no error
+ *  @return None
  */
 
-static FW_BOOLEAN osal_QueuePut(BlockQueue_p pQueue, U8* pBlock, U32 aBlockSize)
+static void osal_QueueNotify(BlockQueue_p pQueue)
 {
-    BaseType_t status = pdFAIL;
-    BlockItem_t item = {0};
-
-    QUEUE_LOG_AVAILABLE(pQueue->osQueue);
+    TaskHandle_t task = pQueue->osTask;
 
-    /* Fill the item fields */
-    item.Data = pBlock;
-    item.Size = aBlockSize;
+    if (NULL == task)
+    {
+        return;
+    }
 
-    /* Put the item to the queue */
     if (FW_TRUE == IRQ_IsInExceptionMode())
     {
         /* We have not woken a task at the start of the ISR */
         BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
-        status = xQueueSendToBackFromISR
-                 (
-                     pQueue->osQueue,
-                     (void *)&item,
-                     &xHigherPriorityTaskWoken
-                 );
+        vTaskNotifyGiveFromISR(task, &xHigherPriorityTaskWoken);
 
         /* Now we can request to switch context if necessary */
         if( xHigherPriorityTaskWoken )
@@ -137,59 +117,44 @@ static FW_BOOLEAN osal_QueuePut(BlockQueue_p pQueue, U8* pBlock, U32 aBlockSize)
     }
     else
     {
-        status = xQueueSendToBack
-                 (
-                     pQueue->osQueue,
-                     (void *)&item,
-                     (TickType_t)0
-                 );
+        (void)xTaskNotifyGive(task);
     }
-
-    QUEUE_LOG_AVAILABLE(pQueue->osQueue);
-
-    if (pdPASS != status)
-    {
-        return FW_FALSE;
-    }
-
-    return FW_TRUE;
 }
 
 //-----------------------------------------------------------------------------
-/** @brief Wrapper for RTOS queue get function
+/** @brief Waits until the producer enqueues the block
  *  @param[in] pQueue - Pointer to the Block Queue
- *  @param[out] ppBlock - Pointer to the block
- *  @param[out] pSize - Size of the Block
- *  @return FW_TRUE if no error, FW_FALSE - in case of timeout or error
+ *  @return FW_TRUE if the block is available, FW_FALSE - in case of timeout
  */
 
-static FW_BOOLEAN osal_QueueGet(BlockQueue_p pQueue, U8** ppBlock, U32 * pSize)
+static FW_BOOLEAN osal_QueueWait(BlockQueue_p pQueue)
 {
-    BaseType_t status = pdFAIL;
-    BlockItem_t item = {0};
+    TimeOut_t  timeout;
+    TickType_t ticks = pQueue->osTimeout;
 
-    QUEUE_LOG_AVAILABLE(pQueue->osQueue);
-
-    /* Get the item from the queue */
-    status = xQueueReceive
-             (
-                 pQueue->osQueue,
-                 (void *)&item,
-                 (TickType_t)pQueue->osTimeout
-             );
-
-    QUEUE_LOG_AVAILABLE(pQueue->osQueue);
-
-    if (pdTRUE != status)
+    vTaskSetTimeOutState(&timeout);
+    while (pQueue->I == pQueue->O)
     {
-        *ppBlock = NULL;
-        *pSize = 0;
-        return FW_FALSE;
+        /* Register the consumer and check again, so the block enqueued
+           in between leaves the notification pending */
+        pQueue->osTask = xTaskGetCurrentTaskHandle();
+        QUEUE_MEMORY_BARRIER();
+        if (pQueue->I != pQueue->O)
+        {
+            break;
+        }
+
+        if (pdFALSE != xTaskCheckForTimeOut(&timeout, &ticks))
+        {
+            pQueue->osTask = NULL;
+            return FW_FALSE;
+        }
+        (void)ulTaskNotifyTake(pdTRUE, ticks);
     }
 
-    /* Fill the item fields */
-    *ppBlock = item.Data;
-    *pSize = item.Size;
+    /* The producer does not need to notify while the consumer is busy */
+    pQueue->osTask = NULL;
+    QUEUE_MEMORY_BARRIER();
 
     return FW_TRUE;
 }
@@ -205,8 +170,8 @@ static FW_BOOLEAN osal_QueueGet(BlockQueue_p pQueue, U8** ppBlock, U32 * pSize)
 BlockQueue_p BlockQueue_Init(U8 * pBuffer, U32 aBufferSize, U32 aBlockSize)
 {
     BlockQueue_p pQueue       = NULL;
-    U32          queueAddress = 0;
-    U32          blockAddress = 0;
+    uintptr_t    queueAddress = 0;
+    uintptr_t    blockAddress = 0;
     U32          blockCount   = 0;
     U32          i            = 0;
 
@@ -227,7 +192,7 @@ BlockQueue_p BlockQueue_Init(U8 * pBuffer, U32 aBufferSize, U32 aBlockSize)
     aBlockSize = (aBlockSize + 3) / 4 * 4;
 
     /* Calculate the queue structure address, aligned to 4 bytes */
-    queueAddress = ((U32)pBuffer + 3) & 0xFFFFFFFC;
+    queueAddress = ((uintptr_t)pBuffer + 3) & ~(uintptr_t)3;
 
     /* Calculate the first block address, aligned to 4 bytes */
     blockAddress = queueAddress + ((sizeof(BlockQueue_t) + 3) / 4 * 4);
@@ -238,7 +203,8 @@ BlockQueue_p BlockQueue_Init(U8 * pBuffer, U32 aBufferSize, U32 aBlockSize)
     QUEUE_LOG("  Queue Str Size = %d\r\n", sizeof(BlockQueue_t));
 
     /* At least two elements should be fit into the buffer */
-    if ( (blockAddress + 2 * aBlockSize) > ((U32)pBuffer + aBufferSize) )
+    if ( (blockAddress + 2 * (sizeof(BlockItem_t) + aBlockSize)) >
+         ((uintptr_t)pBuffer + aBufferSize) )
     {
         return NULL;
     }
@@ -247,21 +213,18 @@ BlockQueue_p BlockQueue_Init(U8 * pBuffer, U32 aBufferSize, U32 aBlockSize)
     pQueue = (BlockQueue_p)queueAddress;
 
     /* Calculate the capacity of the queue */
-    blockCount = ((U32)pBuffer + aBufferSize - blockAddress) / aBlockSize;
+    blockCount = ((uintptr_t)pBuffer + aBufferSize - blockAddress) /
+                                           (sizeof(BlockItem_t) + aBlockSize);
 
-    /* Initialize the RTOS queue */
-    pQueue->osQueue = osal_QueueCreate(blockCount - 1, sizeof(BlockItem_t));
-    if (NULL == pQueue->osQueue)
-    {
-        return NULL;
-    }
+    /* The consumer is registered only while it waits */
+    pQueue->osTask = NULL;
     pQueue->osTimeout = portMAX_DELAY;
 
     QUEUE_LOG("  pQueue         = %08X\r\n", pQueue);
-    QUEUE_LOG("  osQueue        = %08X\r\n", pQueue->osQueue);
     QUEUE_LOG("  Block Count    = %d\r\n", blockCount);
     QUEUE_LOG("  Used Size      = %d\r\n",
-                   ((blockAddress - queueAddress) + blockCount * aBlockSize));
+                   ((blockAddress - queueAddress) +
+                    blockCount * (sizeof(BlockItem_t) + aBlockSize)));
 
     /* Initialize the Block Queue */
     pQueue->I = 0;
@@ -273,7 +236,7 @@ BlockQueue_p BlockQueue_Init(U8 * pBuffer, U32 aBufferSize, U32 aBlockSize)
     pQueue->Consumed = NULL;
 
     /* Clear the Block buffer */
-    for(i = 0; i < blockCount * aBlockSize; i++)
+    for(i = 0; i < blockCount * (sizeof(BlockItem_t) + aBlockSize); i++)
     {
         ((U8 *)blockAddress)[i] = 0;
     }
@@ -285,7 +248,8 @@ BlockQueue_p BlockQueue_Init(U8 * pBuffer, U32 aBufferSize, U32 aBlockSize)
 /** @brief Resets the queue
  *  @param[in] pQueue - Pointer to the Block Queue
  *  @return None
- *  @note Should be called carefully due to it isn't thread safe
+ *  @note Should be called carefully due to it isn't thread safe:
+ *        neither the producer nor the consumer may use the queue meanwhile
  */
 
 void BlockQueue_Reset(BlockQueue_p pQueue)
@@ -304,9 +268,6 @@ void BlockQueue_Reset(BlockQueue_p pQueue)
         return;
     }
 
-    /* Reset the RTOS queue */
-    osal_QueueReset(pQueue);
-
     /* Reset the Block Queue */
     pQueue->I = 0;
     pQueue->O = 0;
@@ -344,7 +305,9 @@ U32 BlockQueue_GetCountOfAllocated(BlockQueue_p pQueue)
 {
     if (NULL != pQueue)
     {
-        return (pQueue->Capacity + pQueue->I - pQueue->O) % pQueue->Capacity;
+        /* The block being filled is not enqueued yet, but it is allocated */
+        return ((pQueue->Capacity + pQueue->I - pQueue->O) % pQueue->Capacity) +
+               ((NULL != pQueue->Produced) ? 1 : 0);
     }
     return 0;
 }
@@ -359,8 +322,9 @@ U32 BlockQueue_GetCountOfFree(BlockQueue_p pQueue)
 {
     if (NULL != pQueue)
     {
-        return (pQueue->Capacity + pQueue->O - pQueue->I - 1) %
-                                                             pQueue->Capacity;
+        return ((pQueue->Capacity + pQueue->O - pQueue->I - 1) %
+                                                            pQueue->Capacity) -
+               ((NULL != pQueue->Produced) ? 1 : 0);
     }
     return 0;
 }
@@ -393,7 +357,8 @@ FW_RESULT BlockQueue_Allocate(BlockQueue_p pQueue, U8** ppBlock, U32 * pSize)
     }
 
     /* No space for allocation */
-    if (pQueue->I == ((pQueue->O - 1 + pQueue->Capacity) % pQueue->Capacity))
+    if ((NULL == pQueue->Produced) &&
+        (pQueue->I == ((pQueue->O - 1 + pQueue->Capacity) % pQueue->Capacity)))
     {
         *ppBlock = NULL;
         *pSize = 0;
@@ -419,15 +384,12 @@ FW_RESULT BlockQueue_Allocate(BlockQueue_p pQueue, U8** ppBlock, U32 * pSize)
         return FW_ERROR;
     }
 
-    /* Allocate the block */
-    block = pQueue->BlocksBuffer + pQueue->I * pQueue->BlockSize;
+    /* Allocate the block, the input position is moved on enqueue */
+    block = queue_GetItem(pQueue, pQueue->I)->Data;
     pQueue->Produced = block;
     *ppBlock = block;
     *pSize = pQueue->BlockSize;
 
-    /* Move the input position to the next block */
-    pQueue->I = (pQueue->I + 1) % pQueue->Capacity;
-
     QUEUE_LOG("  I Position     = %d\r\n", pQueue->I);
     QUEUE_LOG("  Capacity       = %d\r\n", BlockQueue_GetCapacity(pQueue));
     QUEUE_LOG("  Produced       = %08X\r\n", pQueue->Produced);
@@ -442,13 +404,12 @@ FW_RESULT BlockQueue_Allocate(BlockQueue_p pQueue, U8** ppBlock, U32 * pSize)
  *  @param[in] pQueue - Pointer to the Block Queue
  *  @param[in] aSize - Size of the block payload
  *  @return FW_SUCCESS - in no errors
- *          FW_ERROR - in case of block is not allocated or RTOS error
+ *          FW_ERROR - in case of block is not allocated
+ *  @note Can be called from the ISR
  */
 
 FW_RESULT BlockQueue_Enqueue(BlockQueue_p pQueue, U32 aSize)
 {
-    FW_BOOLEAN status = FW_FALSE;
-
     QUEUE_LOG("- BlockQueue_Enqueue() -\r\n");
     QUEUE_LOG("--- Input\r\n");
     QUEUE_LOG("  Size          = %d\r\n", aSize);
@@ -476,24 +437,26 @@ FW_RESULT BlockQueue_Enqueue(BlockQueue_p pQueue, U32 aSize)
         return FW_ERROR;
     }
 
-    /* Enqueue the block */
-    status = osal_QueuePut(pQueue, pQueue->Produced, aSize);
-    if (FW_FALSE == status)
-    {
-        QUEUE_LOG("  RTOS Queue Put error!\r\n");
-        return FW_ERROR;
-    }
+    /* Publish the block: the size must be visible before the position */
+    queue_GetItem(pQueue, pQueue->I)->Size = aSize;
+    QUEUE_MEMORY_BARRIER();
+    pQueue->I = (pQueue->I + 1) % pQueue->Capacity;
+    QUEUE_MEMORY_BARRIER();
 
     /* Indicate that the next block can be allocated */
     pQueue->Produced = NULL;
 
+    /* Wake up the consumer */
+    osal_QueueNotify(pQueue);
+
+    QUEUE_LOG("  I Position     = %d\r\n", pQueue->I);
     QUEUE_LOG("  Produced       = %08X\r\n", pQueue->Produced);
 
     return FW_SUCCESS;
 }
 
 //-----------------------------------------------------------------------------
-/** @brief Enqueues the block
+/** @brief Dequeues the block
  *  @param[in] pQueue - Pointer to the Block Queue
  *  @param[out] ppBlock - Pointer to the block
  *  @param[out] pSize - Size of the Block
@@ -504,7 +467,8 @@ FW_RESULT BlockQueue_Enqueue(BlockQueue_p pQueue, U32 aSize)
 
 FW_RESULT BlockQueue_Dequeue(BlockQueue_p pQueue, U8** ppBlock, U32 * pSize)
 {
-    FW_BOOLEAN status = FW_FALSE;
+    FW_BOOLEAN    status = FW_FALSE;
+    BlockItem_t * item   = NULL;
 
     QUEUE_LOG("- BlockQueue_Dequeue() -\r\n");
     QUEUE_LOG("--- State\r\n");
@@ -526,14 +490,22 @@ FW_RESULT BlockQueue_Dequeue(BlockQueue_p pQueue, U8** ppBlock, U32 * pSize)
         return FW_ERROR;
     }
 
-    /* Dequeue the block */
-    status = osal_QueueGet(pQueue, ppBlock, pSize);
+    /* Wait for the block */
+    status = osal_QueueWait(pQueue);
     if (FW_FALSE == status)
     {
-        QUEUE_LOG("  RTOS Queue Get timeout or error!\r\n");
+        *ppBlock = NULL;
+        *pSize = 0;
+
+        QUEUE_LOG("  Queue Get timeout!\r\n");
         return FW_TIMEOUT;
     }
 
+    /* Dequeue the block */
+    item = queue_GetItem(pQueue, pQueue->O);
+    *ppBlock = item->Data;
+    *pSize = item->Size;
+
     /* Sanity check */
     if (*pSize > pQueue->BlockSize)
     {
@@ -597,7 +569,8 @@ FW_RESULT BlockQueue_Release(BlockQueue_p pQueue)
     /* Release the block */
     pQueue->Consumed = NULL;
 
-    /* Move the output position to the next block */
+    /* Move the output position to the next block when the block is read out */
+    QUEUE_MEMORY_BARRIER();
     pQueue->O = (pQueue->O + 1) % pQueue->Capacity;
 
     QUEUE_LOG("  O Position     = %d\r\n", pQueue->O);
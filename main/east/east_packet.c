@@ -5,7 +5,11 @@
    Size:   1            2           N     1           2
    Descr: [Start Token][Length = N][Data][Stop Token][Control Sum]
 
-   Control Sum = XOR of N Data bytes. Initial value = 0.
+   The Start Token is also the protocol version byte:
+   #24 - Version 1: Control Sum = XOR of N Data bytes. Initial value = 0.
+   #25 - Version 2: Control Sum = CRC-16/CCITT of N Data bytes
+                    (poly = 0x1021, initial value = 0xFFFF).
+   The response is sent with the version of the last received request.
 
   Test Packets
   #24 #05#00 #01#02#03#04#05 #42 #01#00
@@ -26,6 +30,7 @@
 
 #define EAST_PACKET_START_TOKEN           ( 0x24 )
 #define EAST_PACKET_STOP_TOKEN            ( 0x42 )
+#define EAST_PACKET_CRC16_INIT            ( 0xFFFF )
 #define EAST_PACKET_WRAPPER_SIZE          ( 6 )
 #define EAST_PACKET_MODE_INPUT            ( 0 )
 #define EAST_PACKET_MODE_OUTPUT           ( 1 )
@@ -43,6 +48,23 @@
 #define EAST_PACKET_STAGE_CSH(i,a)        (i == (a + 5))
 #define EAST_PACKET_STAGE_COMPLETE(i,a)   ((5 < i) && (i == (a + 6)))
 
+#define EAST_PACKET_START(v)              (EAST_PACKET_START_TOKEN + (v))
+#define EAST_PACKET_CS_INIT(v)            \
+          ((EAST_VERSION_CRC16 == (v)) ? EAST_PACKET_CRC16_INIT : 0)
+#define EAST_PACKET_CRC16(c,b)            \
+          ((U16)(((c) << 8) ^ gCrc16Table[(((c) >> 8) ^ (b)) & 0xFF]))
+#define EAST_PACKET_CS(v,c,b)             \
+          ((EAST_VERSION_CRC16 == (v)) ? EAST_PACKET_CRC16(c,b) : ((c) ^ (b)))
+
+/* Input parser stages */
+#define EAST_STAGE_START                  ( 0 )
+#define EAST_STAGE_LENGTHL                ( 1 )
+#define EAST_STAGE_LENGTHH                ( 2 )
+#define EAST_STAGE_DATA                   ( 3 )
+#define EAST_STAGE_STOP                   ( 4 )
+#define EAST_STAGE_CSL                    ( 5 )
+#define EAST_STAGE_CSH                    ( 6 )
+
 //-----------------------------------------------------------------------------
 
 typedef struct EAST_s
@@ -57,10 +79,184 @@ typedef struct EAST_s
       U16           OK : 1;       /* Packet correctness */
       U16           Mode : 1;     /* Packet mode: in/out */
       U16           Complete : 1; /* Packet completeness */
+      U16           Version : 1;  /* Protocol version: XOR/CRC-16 */
     };
     U8            * Buffer;       /* Pointer to the data buffer */
+    U8              Wrapper[3];   /* Header/trailer of the outgoing packet */
+    U8              Stage;        /* Input parser stage */
 } EAST_t;
 
+typedef FW_BOOLEAN (* EAST_Stage_t)(EAST_p pEAST, U8 aValue);
+
+//-----------------------------------------------------------------------------
+
+/* CRC-16/CCITT lookup table, poly = 0x1021 */
+static const U16 gCrc16Table[256] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+//-----------------------------------------------------------------------------
+/** @brief Calculates the control sum of the data span
+ *  @param[in] aVersion - Protocol version
+ *  @param[in] aCS - Running control sum
+ *  @param[in] pData - Pointer to the data
+ *  @param[in] aSize - Size of the data
+ *  @return Updated control sum
+ */
+
+static U16 east_Checksum(U16 aVersion, U16 aCS, const U8 * pData, U16 aSize)
+{
+    U32 acc = 0;
+
+    if (EAST_VERSION_CRC16 == aVersion)
+    {
+        while (0 < aSize--)
+        {
+            aCS = EAST_PACKET_CRC16(aCS, *pData++);
+        }
+        return aCS;
+    }
+
+    /* XOR is calculated a word at a time after the unaligned head */
+    while ((0 < aSize) && (0 != ((U32)pData & 0x3)))
+    {
+        aCS ^= *pData++;
+        aSize--;
+    }
+    while (4 <= aSize)
+    {
+        acc ^= *(const U32 *)pData;
+        pData += 4;
+        aSize -= 4;
+    }
+    while (0 < aSize--)
+    {
+        aCS ^= *pData++;
+    }
+
+    /* Fold the word into the byte */
+    acc ^= (acc >> 16);
+    acc ^= (acc >> 8);
+
+    return (aCS ^ (U16)(acc & 0xFF));
+}
+
+//-----------------------------------------------------------------------------
+/* Input parser stage handlers.
+ * Every handler checks the byte, moves the parser to the next stage and
+ * returns the packet correctness. */
+
+static FW_BOOLEAN east_PutStart(EAST_p pEAST, U8 aValue)
+{
+    if ((EAST_PACKET_START(EAST_VERSION_XOR) != aValue) &&
+        (EAST_PACKET_START(EAST_VERSION_CRC16) != aValue))
+    {
+        return FW_FALSE;
+    }
+    pEAST->Version = (aValue - EAST_PACKET_START_TOKEN);
+    pEAST->Stage = EAST_STAGE_LENGTHL;
+    return FW_TRUE;
+}
+
+static FW_BOOLEAN east_PutLengthL(EAST_p pEAST, U8 aValue)
+{
+    pEAST->ActSize = aValue;
+    pEAST->Stage = EAST_STAGE_LENGTHH;
+    return FW_TRUE;
+}
+
+static FW_BOOLEAN east_PutLengthH(EAST_p pEAST, U8 aValue)
+{
+    pEAST->ActSize = (pEAST->ActSize + (aValue << 8));
+    pEAST->RCS = EAST_PACKET_CS_INIT(pEAST->Version);
+    pEAST->Stage = EAST_STAGE_DATA;
+
+    EAST_LOG("  Length         = %d\r\n", pEAST->ActSize);
+
+    return EAST_PACKET_CHECK_LENGTH(pEAST->ActSize, pEAST->MaxSize);
+}
+
+static FW_BOOLEAN east_PutData(EAST_p pEAST, U8 aValue)
+{
+    EAST_PACKET_POSITION(pEAST->Buffer, pEAST->Index) = aValue;
+    pEAST->RCS = EAST_PACKET_CS(pEAST->Version, pEAST->RCS, aValue);
+
+    /* The last data byte */
+    if (pEAST->Index == (pEAST->ActSize + 2))
+    {
+        pEAST->Stage = EAST_STAGE_STOP;
+    }
+    return FW_TRUE;
+}
+
+static FW_BOOLEAN east_PutStop(EAST_p pEAST, U8 aValue)
+{
+    pEAST->Stage = EAST_STAGE_CSL;
+    return (FW_BOOLEAN)(aValue == EAST_PACKET_STOP_TOKEN);
+}
+
+static FW_BOOLEAN east_PutCSL(EAST_p pEAST, U8 aValue)
+{
+    pEAST->FCS = aValue;
+    pEAST->Stage = EAST_STAGE_CSH;
+    return FW_TRUE;
+}
+
+static FW_BOOLEAN east_PutCSH(EAST_p pEAST, U8 aValue)
+{
+    pEAST->FCS = (pEAST->FCS + (aValue << 8));
+    pEAST->Stage = EAST_STAGE_START;
+
+    EAST_LOG("  Factual CS     = %04X\r\n", pEAST->FCS);
+    EAST_LOG("  Running CS     = %04X\r\n", pEAST->RCS);
+
+    return (FW_BOOLEAN)(pEAST->FCS == pEAST->RCS);
+}
+
+/* Jump table of the input parser, indexed by the stage */
+static const EAST_Stage_t gPutStages[] =
+{
+    east_PutStart,
+    east_PutLengthL,
+    east_PutLengthH,
+    east_PutData,
+    east_PutStop,
+    east_PutCSL,
+    east_PutCSH,
+};
+
 //-----------------------------------------------------------------------------
 /** @brief Initializes the EAST component
  *  @param[in] pContainer - Pointer to the container for EAST placement
@@ -117,6 +313,8 @@ EAST_p EAST_Init(U8 * pContainer, U32 aSize, U8 * pBuffer, U32 aBufferSize)
 
 FW_RESULT EAST_SetBuffer(EAST_p pEAST, U8 * pBuffer, U32 aSize)
 {
+    U16 version = EAST_VERSION_XOR;
+
     EAST_LOG("-*- EAST_SetBuffer() -*-\r\n");
     EAST_LOG("--- Inputs\r\n");
     EAST_LOG("  Buffer Address = %08X\r\n", pBuffer);
@@ -129,8 +327,10 @@ FW_RESULT EAST_SetBuffer(EAST_p pEAST, U8 * pBuffer, U32 aSize)
         return FW_ERROR;
     }
 
-    /* Reset the state */
+    /* Reset the state, the negotiated version is kept */
+    version = pEAST->Version;
     memset(pEAST, 0, sizeof(EAST_t));
+    pEAST->Version = version;
 
     /* Set the buffer */
     pEAST->Buffer = pBuffer;
@@ -156,7 +356,6 @@ FW_RESULT EAST_SetBuffer(EAST_p pEAST, U8 * pBuffer, U32 aSize)
 FW_RESULT EAST_PutByte(EAST_p pEAST, U8 aValue)
 {
     FW_RESULT result = FW_INPROGRESS;
-    pEAST->OK = FW_TRUE;
 
     EAST_LOG("-*- EAST_PutByte -*-\r\n");
     EAST_LOG("--- Inputs\r\n");
@@ -173,47 +372,15 @@ FW_RESULT EAST_PutByte(EAST_p pEAST, U8 aValue)
     pEAST->Mode = EAST_PACKET_MODE_INPUT;
     pEAST->Complete = FW_FALSE;
 
-    /* Data Stage */
-    if EAST_PACKET_STAGE_DATA(pEAST->Index, pEAST->ActSize)
-    {
-        EAST_PACKET_POSITION(pEAST->Buffer, pEAST->Index) = aValue;
-        pEAST->RCS ^= aValue;
-    }
-    /* Packet Start Token Stage */
-    else if EAST_PACKET_STAGE_START(pEAST->Index)
+    /* Process the byte by the current stage, the data bytes are the most
+       frequent so they skip the indirect call */
+    if (EAST_STAGE_DATA == pEAST->Stage)
     {
-        pEAST->OK = (FW_BOOLEAN)(aValue == EAST_PACKET_START_TOKEN);
+        pEAST->OK = east_PutData(pEAST, aValue);
     }
-    /* Packet Size Stage */
-    else if EAST_PACKET_STAGE_LENGTHL(pEAST->Index)
-    {
-        pEAST->ActSize = aValue;
-    }
-    else if EAST_PACKET_STAGE_LENGTHH(pEAST->Index)
-    {
-        pEAST->ActSize = (pEAST->ActSize + (aValue << 8));
-        pEAST->OK = EAST_PACKET_CHECK_LENGTH(pEAST->ActSize, pEAST->MaxSize);
-        pEAST->RCS = 0;
-
-        EAST_LOG("  Length         = %d\r\n", pEAST->ActSize);
-    }
-    /* Packet Stop Token Stage */
-    else if EAST_PACKET_STAGE_STOP(pEAST->Index, pEAST->ActSize)
-    {
-        pEAST->OK = (FW_BOOLEAN)(aValue == EAST_PACKET_STOP_TOKEN);
-    }
-    /* Packet Control Sum Stage */
-    else if EAST_PACKET_STAGE_CSL(pEAST->Index, pEAST->ActSize)
-    {
-        pEAST->FCS = aValue;
-    }
-    else if EAST_PACKET_STAGE_CSH(pEAST->Index, pEAST->ActSize)
+    else
     {
-        pEAST->FCS = (pEAST->FCS + (aValue << 8));
-        pEAST->OK = (FW_BOOLEAN)(pEAST->FCS == pEAST->RCS);
-
-        EAST_LOG("  Factual CS     = %04X\r\n", pEAST->FCS);
-        EAST_LOG("  Running CS     = %04X\r\n", pEAST->RCS);
+        pEAST->OK = gPutStages[pEAST->Stage](pEAST, aValue);
     }
 
     /* Packet Index Incrementing Stage */
@@ -225,6 +392,7 @@ FW_RESULT EAST_PutByte(EAST_p pEAST, U8 aValue)
     {
         pEAST->Index = 0;
         pEAST->ActSize = 0;
+        pEAST->Stage = EAST_STAGE_START;
 
         EAST_LOG("  Wrong packet format!\r\n");
     }
@@ -244,6 +412,64 @@ FW_RESULT EAST_PutByte(EAST_p pEAST, U8 aValue)
     return result;
 }
 
+//-----------------------------------------------------------------------------
+/** @brief Puts the span of bytes into the EAST data packet
+ *  @param[in] pEAST - Pointer to the EAST
+ *  @param[in] pData - Pointer to the bytes
+ *  @param[in] aSize - Count of the bytes
+ *  @param[out] pCount - Count of the bytes consumed
+ *  @return FW_INPROGRESS / FW_COMPLETE / FW_ERROR
+ *  @note Consuming stops right after the packet completion, so the caller
+ *        can take the packet and continue with the rest of the bytes.
+ */
+
+FW_RESULT EAST_PutBytes(EAST_p pEAST, U8 * pData, U16 aSize, U16 * pCount)
+{
+    FW_RESULT result = FW_INPROGRESS;
+    U16 size = 0;
+    U16 i = 0;
+
+    if ((NULL == pEAST) || (NULL == pEAST->Buffer) ||
+        (NULL == pData) || (NULL == pCount))
+    {
+        EAST_LOG("  Input parameters error!\r\n");
+        return FW_ERROR;
+    }
+
+    while ((i < aSize) && (FW_INPROGRESS == result))
+    {
+        if (EAST_STAGE_DATA == pEAST->Stage)
+        {
+            /* Copy the whole data part available at once */
+            size = (pEAST->ActSize + 3 - pEAST->Index);
+            if (size > (aSize - i))
+            {
+                size = (aSize - i);
+            }
+            memcpy(&EAST_PACKET_POSITION(pEAST->Buffer, pEAST->Index), &pData[i], size);
+            pEAST->RCS = east_Checksum(pEAST->Version, pEAST->RCS, &pData[i], size);
+
+            pEAST->Mode = EAST_PACKET_MODE_INPUT;
+            pEAST->Complete = FW_FALSE;
+            pEAST->Index += size;
+            if (pEAST->Index == (pEAST->ActSize + 3))
+            {
+                pEAST->Stage = EAST_STAGE_STOP;
+            }
+            i += size;
+        }
+        else
+        {
+            /* The wrapper bytes are parsed one by one */
+            result = EAST_PutByte(pEAST, pData[i++]);
+        }
+    }
+
+    *pCount = i;
+
+    return result;
+}
+
 //-----------------------------------------------------------------------------
 /** @brief Gets Byte from the EAST packet
  *  @param[in] pEAST - Pointer to the EAST
@@ -266,12 +492,12 @@ FW_RESULT EAST_GetByte(EAST_p pEAST, U8 * pValue)
     if EAST_PACKET_STAGE_DATA(pEAST->Index, pEAST->ActSize)
     {
         *pValue = EAST_PACKET_POSITION(pEAST->Buffer, pEAST->Index);
-        pEAST->RCS ^= *pValue;
+        pEAST->RCS = EAST_PACKET_CS(pEAST->Version, pEAST->RCS, *pValue);
     }
     /* Packet Start Token Stage */
     else if EAST_PACKET_STAGE_START(pEAST->Index)
     {
-        *pValue = EAST_PACKET_START_TOKEN;
+        *pValue = EAST_PACKET_START(pEAST->Version);
         pEAST->ActSize = pEAST->MaxSize;
     }
     /* Packet Size Stage */
@@ -282,7 +508,7 @@ FW_RESULT EAST_GetByte(EAST_p pEAST, U8 * pValue)
     else if EAST_PACKET_STAGE_LENGTHH(pEAST->Index)
     {
         *pValue = (pEAST->ActSize >> 8) & 0xFF;
-        pEAST->RCS = 0;
+        pEAST->RCS = EAST_PACKET_CS_INIT(pEAST->Version);
     }
     /* Packet Stop Byte Stage */
     else if EAST_PACKET_STAGE_STOP(pEAST->Index, pEAST->ActSize)
@@ -320,6 +546,127 @@ FW_RESULT EAST_GetByte(EAST_p pEAST, U8 * pValue)
     return result;
 }
 
+//-----------------------------------------------------------------------------
+/** @brief Gets the next contiguous span of the EAST packet
+ *  @param[in] pEAST - Pointer to the EAST
+ *  @param[out] ppData - Pointer to the placeholder for the span address
+ *  @param[in] aMax - Maximum size of the span
+ *  @return Size of the span, 0 - if the packet is complete
+ *  @note The data stage is returned directly from the EAST buffer, so the
+ *        buffer must be kept untouched until the packet is complete.
+ */
+
+U16 EAST_GetSpan(EAST_p pEAST, U8 ** ppData, U16 aMax)
+{
+    U16 size = 0;
+
+    if ((NULL == pEAST) || (NULL == ppData) || (0 == aMax))
+    {
+        return 0;
+    }
+
+    pEAST->Mode = EAST_PACKET_MODE_OUTPUT;
+
+    /* The packet is sent - the buffer should be set again */
+    if (FW_TRUE == pEAST->Complete)
+    {
+        return 0;
+    }
+
+    /* Packet Start Token and Size Stage */
+    if (EAST_PACKET_WRAPPER_SIZE / 2 > pEAST->Index)
+    {
+        if EAST_PACKET_STAGE_START(pEAST->Index)
+        {
+            pEAST->ActSize = pEAST->MaxSize;
+            pEAST->RCS = EAST_PACKET_CS_INIT(pEAST->Version);
+            pEAST->Wrapper[0] = EAST_PACKET_START(pEAST->Version);
+            pEAST->Wrapper[1] = (pEAST->ActSize & 0xFF);
+            pEAST->Wrapper[2] = (pEAST->ActSize >> 8) & 0xFF;
+        }
+        size = (EAST_PACKET_WRAPPER_SIZE / 2 - pEAST->Index);
+        *ppData = &pEAST->Wrapper[pEAST->Index];
+    }
+    /* Data Stage */
+    else if EAST_PACKET_STAGE_DATA(pEAST->Index, pEAST->ActSize)
+    {
+        size = (pEAST->ActSize + 3 - pEAST->Index);
+        *ppData = &EAST_PACKET_POSITION(pEAST->Buffer, pEAST->Index);
+    }
+    /* Packet Stop Token and Control Sum Stage */
+    else
+    {
+        if EAST_PACKET_STAGE_STOP(pEAST->Index, pEAST->ActSize)
+        {
+            pEAST->Wrapper[0] = EAST_PACKET_STOP_TOKEN;
+            pEAST->Wrapper[1] = (pEAST->RCS & 0xFF);
+            pEAST->Wrapper[2] = (pEAST->RCS >> 8) & 0xFF;
+        }
+        size = (pEAST->ActSize + EAST_PACKET_WRAPPER_SIZE - pEAST->Index);
+        *ppData = &pEAST->Wrapper[pEAST->Index - pEAST->ActSize - 3];
+    }
+
+    if (size > aMax)
+    {
+        size = aMax;
+    }
+
+    /* Control sum of the data span */
+    if EAST_PACKET_STAGE_DATA(pEAST->Index, pEAST->ActSize)
+    {
+        pEAST->RCS = east_Checksum(pEAST->Version, pEAST->RCS, *ppData, size);
+    }
+
+    /* Packet Index Incrementing Stage */
+    pEAST->Index += size;
+
+    /* Packet Completed Stage */
+    if EAST_PACKET_STAGE_COMPLETE(pEAST->Index, pEAST->ActSize)
+    {
+        /* Indicate packet completion */
+        pEAST->Complete = FW_TRUE;
+        /* Reset the packet position */
+        pEAST->Index = 0;
+
+        EAST_LOG("  Packet complete!\r\n");
+    }
+
+    return size;
+}
+
+//-----------------------------------------------------------------------------
+/** @brief Gets the span of bytes from the EAST packet
+ *  @param[in] pEAST - Pointer to the EAST
+ *  @param[out] pData - Pointer to the placeholder for the bytes
+ *  @param[in] aSize - Size of the placeholder
+ *  @return Count of the bytes copied, 0 - if the packet is complete
+ */
+
+U16 EAST_GetBytes(EAST_p pEAST, U8 * pData, U16 aSize)
+{
+    U8 * span = NULL;
+    U16 size = 0;
+    U16 count = 0;
+
+    if (NULL == pData)
+    {
+        return 0;
+    }
+
+    while (count < aSize)
+    {
+        size = EAST_GetSpan(pEAST, &span, (aSize - count));
+        if (0 == size)
+        {
+            break;
+        }
+        memcpy(&pData[count], span, size);
+        count += size;
+    }
+
+    return count;
+}
+
 //-----------------------------------------------------------------------------
 /** @brief Gets the size of the currently collected data
  *  @param[in] pEAST - Pointer to the EAST
@@ -372,3 +719,33 @@ U16 EAST_GetPacketSize(EAST_p pEAST)
 
     return result;
 }
+
+//-----------------------------------------------------------------------------
+/** @brief Gets the protocol version of the last received packet
+ *  @param[in] pEAST - Pointer to the EAST
+ *  @return EAST_VERSION_XOR / EAST_VERSION_CRC16
+ */
+
+U8 EAST_GetVersion(EAST_p pEAST)
+{
+    return (U8)pEAST->Version;
+}
+
+//-----------------------------------------------------------------------------
+/** @brief Sets the protocol version of the packets produced
+ *  @param[in] pEAST - Pointer to the EAST
+ *  @param[in] aVersion - EAST_VERSION_XOR / EAST_VERSION_CRC16
+ *  @return FW_SUCCESS / FW_ERROR
+ */
+
+FW_RESULT EAST_SetVersion(EAST_p pEAST, U8 aVersion)
+{
+    if ((NULL == pEAST) || (EAST_VERSION_CRC16 < aVersion))
+    {
+        return FW_ERROR;
+    }
+
+    pEAST->Version = aVersion;
+
+    return FW_SUCCESS;
+}
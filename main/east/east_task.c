@@ -18,6 +18,8 @@
 #define EAST_HEADER_LENGTH     (6)
 #define EAST_MAX_PACKET_LENGTH (EAST_HEADER_LENGTH + EAST_MAX_DATA_LENGTH)
 #define EVT_EAST_TX_COMPLETE   (1 << 0)
+/* Power of two, not less than the count of blocks in the queue */
+#define EAST_QUEUE_VERSIONS    (8)
 
 //-----------------------------------------------------------------------------
 
@@ -25,60 +27,62 @@ EventGroupHandle_t eastEvents;
 static BlockQueue_p iQueue;
 static EAST_p iEast = NULL;
 static EAST_p oEast = NULL;
-static U8 iEastCtnr[16] = {0};
-static U8 oEastCtnr[16] = {0};
+static U8 iEastCtnr[20] = {0};
+static U8 oEastCtnr[20] = {0};
 static U8 iBuffer[EAST_MAX_DATA_LENGTH * 8] = {0};
-static U8 oBuffer[EAST_MAX_PACKET_LENGTH] = {0};
+/* Protocol version of every queued request, in the order of the queue:
+   iEast already parses the next packet while a request is processed */
+static U8 iVersions[EAST_QUEUE_VERSIONS] = {0};
+static U8 iVersionsIn = 0;   /* Written by the UART ISR only */
+static U8 iVersionsOut = 0;  /* Written by the EAST task only */
 
 //-----------------------------------------------------------------------------
 
-static FW_BOOLEAN oEAST_GetByte(U8 * pValue)
+static U32 oEAST_GetSpan(U8 ** ppData, U32 aMax)
 {
-    FW_BOOLEAN result = FW_FALSE;
-
-    /* If there are some data in EAST the packet */
-    if (0 < EAST_GetPacketSize(oEast))
-    {
-        /* Send the data */
-        (void)EAST_GetByte(oEast, pValue);
-        result = FW_TRUE;
-    }
-
-    return result;
+    /* Send the next part of the packet directly from its buffer */
+    return EAST_GetSpan(oEast, ppData, (U16)aMax);
 }
 
 //-----------------------------------------------------------------------------
 
-static FW_BOOLEAN iEAST_PutByte(U8 * pValue)
+static void iEAST_PutBytes(U8 * pData, U32 aSize)
 {
     FW_RESULT r = FW_ERROR;
     U8 * buffer = NULL;
     U32 size = 0;
+    U16 count = 0;
 
-    /* Fill the EAST block */
-    r = EAST_PutByte(iEast, *pValue);
-    if (FW_COMPLETE == r)
+    while (0 < aSize)
     {
-        /* If the block queue is full - ignore */
-        if (0 == BlockQueue_GetCountOfFree(iQueue))
+        /* Fill the EAST block with as many bytes as possible */
+        r = EAST_PutBytes(iEast, pData, (U16)aSize, &count);
+        if (FW_ERROR == r)
         {
-            return FW_FALSE;
+            return;
         }
+        pData += count;
+        aSize -= count;
 
-        /* Put the block into the queue */
-        r = BlockQueue_Enqueue(iQueue, EAST_GetDataSize(iEast));
-        if (FW_SUCCESS == r)
+        /* If the block queue is full - ignore the packet */
+        if ((FW_COMPLETE == r) && (0 < BlockQueue_GetCountOfFree(iQueue)))
         {
-            /* Allocate the memory for the next block */
-            r = BlockQueue_Allocate(iQueue, &buffer, &size);
+            /* The version goes with the block, the enqueue publishes both */
+            iVersions[iVersionsIn % EAST_QUEUE_VERSIONS] = EAST_GetVersion(iEast);
+            /* Put the block into the queue */
+            r = BlockQueue_Enqueue(iQueue, EAST_GetDataSize(iEast));
             if (FW_SUCCESS == r)
             {
-                (void)EAST_SetBuffer(iEast, buffer, size);
+                iVersionsIn++;
+                /* Allocate the memory for the next block */
+                r = BlockQueue_Allocate(iQueue, &buffer, &size);
+                if (FW_SUCCESS == r)
+                {
+                    (void)EAST_SetBuffer(iEast, buffer, size);
+                }
             }
         }
     }
-
-    return FW_TRUE;
 }
 
 //-----------------------------------------------------------------------------
@@ -142,12 +146,12 @@ void vEAST_SendResponse(U8 * pRsp, U16 size)
 
 static void vEAST_Task(void * pvParameters)
 {
-    U8 * req = NULL, * rsp = oBuffer;
+    U8 * req = NULL;
     U32 size = 0;
 
     printf("EAST Task started...\n");
     printf("EAST Task init the UART...\n");
-    EAST_UART_Init(921600, iEAST_PutByte, iEAST_Complete, oEAST_GetByte, oEAST_Complete);
+    EAST_UART_Init(921600, iEAST_PutBytes, iEAST_Complete, oEAST_GetSpan, oEAST_Complete);
     EAST_UART_RxStart();
 
     printf("EAST Task enter iteration...\n");
@@ -157,14 +161,15 @@ static void vEAST_Task(void * pvParameters)
         (void)BlockQueue_Dequeue(iQueue, (U8 **)&req, &size);
         printf("EAST Task received the packet. Len = %d\n", size);
 
-        /* Prepare the response */
-        memcpy(rsp, req, size);
-        /* Process the request */
-        /* Send the response */
-        vEAST_SendResponse(rsp, size);
+        /* Process the request - the response is built in place of it */
+        /* Answer with the protocol version of this request */
+        (void)EAST_SetVersion(oEast, iVersions[iVersionsOut % EAST_QUEUE_VERSIONS]);
+        iVersionsOut++;
+        /* Send the response directly from the block */
+        vEAST_SendResponse(req, size);
         printf("EAST Task the packet sent. Len = %d\n", size);
 
-        /* Release the block */
+        /* The block is not referenced after the transmitting complete */
         (void)BlockQueue_Release(iQueue);
     }
     //vTaskDelete(NULL);
@@ -179,9 +184,10 @@ void EAST_Task_Init(void)
 
     /* Initialize EAST packet containers */
     iEast = EAST_Init(iEastCtnr, sizeof(iEastCtnr), NULL, 0);
-    oEast = EAST_Init(oEastCtnr, sizeof(oEastCtnr), oBuffer, sizeof(oBuffer));
+    oEast = EAST_Init(oEastCtnr, sizeof(oEastCtnr), NULL, 0);
     /* Initialize the EAST packet queue */
     iQueue = BlockQueue_Init(iBuffer, sizeof(iBuffer), EAST_MAX_DATA_LENGTH);
+    configASSERT(EAST_QUEUE_VERSIONS >= BlockQueue_GetCapacity(iQueue));
     /* Allocate the memory for the first input EAST packet */
     (void)BlockQueue_Allocate(iQueue, &buffer, &size);
     /* Setup/Reset the input EAST packet */
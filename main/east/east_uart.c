@@ -28,10 +28,12 @@
 /* DRAM_ATTR is required to avoid UART array placed in flash,
    due to accessed from ISR */
 static DRAM_ATTR uart_dev_t * const EAST_UART = &uart0;
-static EAST_UART_CbByte gRxByteCb  = NULL;
+static EAST_UART_CbData gRxDataCb  = NULL;
 static EAST_UART_CbByte gRxCmpltCb = NULL;
-static EAST_UART_CbByte gTxByteCb  = NULL;
+static EAST_UART_CbSpan gTxSpanCb  = NULL;
 static EAST_UART_CbByte gTxCmpltCb = NULL;
+/* FIFO drain buffer, passed to the upper layer in one call */
+static uint8_t          gRxBuffer[UART_FIFO_LEN];
 
 //-----------------------------------------------------------------------------
 /** @brief The internal IRQ handler for the UART peripheral
@@ -41,8 +43,8 @@ static EAST_UART_CbByte gTxCmpltCb = NULL;
 
 static void EAST_UART_IrqHandler(void * param)
 {
-    FW_BOOLEAN result = FW_FALSE;
-    uint8_t data = 0;
+    uint8_t * span = NULL;
+    uint32_t span_len = 0;
     int rx_fifo_len = EAST_UART->status.rxfifo_cnt;
     uint8_t buf_idx = 0;
     uint32_t uart_intr_status = EAST_UART->int_st.val;
@@ -59,24 +61,22 @@ static void EAST_UART_IrqHandler(void * param)
             /* Get the size of space in FIFO */
             int tx_fifo_rem = UART_FIFO_LEN - EAST_UART->status.txfifo_cnt;
 
-            /* Write all the available bytes to FIFO */
-            while (0 < tx_fifo_rem)
+            /* Write all the available bytes to FIFO span by span */
+            while ((0 < tx_fifo_rem) && (NULL != gTxSpanCb))
             {
-                if (NULL != gTxByteCb)
-                {
-                    result = gTxByteCb(&data);
-                }
+                span_len = gTxSpanCb(&span, tx_fifo_rem);
 
                 /* If there is no more bytes - break */
-                if (FW_TRUE == result)
+                if (0 == span_len)
                 {
-                    EAST_UART->fifo.rw_byte = data;
+                    break;
                 }
-                else
+                tx_fifo_rem -= span_len;
+
+                while (0 < span_len--)
                 {
-                    break;
+                    EAST_UART->fifo.rw_byte = *span++;
                 }
-                tx_fifo_rem--;
             }
 
             /* If all the bytes were sent - complete and disable the IRQ */
@@ -98,12 +98,13 @@ static void EAST_UART_IrqHandler(void * param)
             /* Read out all the bytes from FIFO to clear the interrupt flag */
             while (buf_idx < rx_fifo_len)
             {
-                data = EAST_UART->fifo.rw_byte;
-                if (NULL != gRxByteCb)
-                {
-                    (void)gRxByteCb(&data);
-                }
-                buf_idx++;
+                gRxBuffer[buf_idx++] = EAST_UART->fifo.rw_byte;
+            }
+
+            /* Pass the whole FIFO drain to the upper layer */
+            if ((NULL != gRxDataCb) && (0 < buf_idx))
+            {
+                gRxDataCb(gRxBuffer, buf_idx);
             }
             
             /* Reading is complete */
@@ -147,9 +148,9 @@ static void EAST_UART_IrqHandler(void * param)
 void EAST_UART_Init
 (
   U32              aBaudRate,
-  EAST_UART_CbByte pRxByteCb,
+  EAST_UART_CbData pRxDataCb,
   EAST_UART_CbByte pRxCmpltCb,
-  EAST_UART_CbByte pTxByteCb,
+  EAST_UART_CbSpan pTxSpanCb,
   EAST_UART_CbByte pTxCmpltCb
 )
 {
@@ -161,9 +162,9 @@ void EAST_UART_Init
     UART_ENTER_CRITICAL();
 
     /* Set the callbacks */
-    gRxByteCb  = pRxByteCb;
+    gRxDataCb  = pRxDataCb;
     gRxCmpltCb = pRxCmpltCb;
-    gTxByteCb  = pTxByteCb;
+    gTxSpanCb  = pTxSpanCb;
     gTxCmpltCb = pTxCmpltCb;
 
     /* Disable the hardware flow control */
@@ -3,13 +3,22 @@
 
 #include "types.h"
 
+/* Protocol versions - differ by the packet control sum */
+#define EAST_VERSION_XOR    (0)
+#define EAST_VERSION_CRC16  (1)
+
 typedef struct EAST_s * EAST_p;
 
 EAST_p    EAST_Init(U8 * pContainer, U32 aSize, U8 * pBuffer, U32 aBufferSize);
 FW_RESULT   EAST_SetBuffer      (EAST_p pEAST, U8 * pBuffer, U32 aSize);
 FW_RESULT   EAST_PutByte        (EAST_p pEAST, U8 aValue);
+FW_RESULT   EAST_PutBytes       (EAST_p pEAST, U8 * pData, U16 aSize, U16 * pCount);
 FW_RESULT   EAST_GetByte        (EAST_p pEAST, U8 * pValue);
+U16         EAST_GetBytes       (EAST_p pEAST, U8 * pData, U16 aSize);
+U16         EAST_GetSpan        (EAST_p pEAST, U8 ** ppData, U16 aMax);
 U16         EAST_GetDataSize    (EAST_p pEAST);
 U16         EAST_GetPacketSize  (EAST_p pEAST);
+U8          EAST_GetVersion     (EAST_p pEAST);
+FW_RESULT   EAST_SetVersion     (EAST_p pEAST, U8 aVersion);
 
 #endif /* __EAST_H__ */
@@ -5,20 +5,23 @@
 
 /* Callback Function Declarations */
 typedef FW_BOOLEAN (* EAST_UART_CbByte)(U8 * pByte);
+typedef U32        (* EAST_UART_CbSpan)(U8 ** ppData, U32 aMax);
+typedef void       (* EAST_UART_CbData)(U8 * pData, U32 aSize);
 
 /* Function Declarations */
 
 //-----------------------------------------------------------------------------
 /** @brief Initializes the UART peripheral
  *  @param aBaudRate - Baud Rate.
- *  @param pRxByteCb - Callback, called when the byte is received.
- *                     Result is ignored. Called in IRQ context.
+ *  @param pRxDataCb - Callback, called with all the bytes read out of
+ *                     Rx FIFO at once. Called in IRQ context.
  *  @param pRxCmpltCb - Callback, called when the Rx timeout happened.
  *                      Called in IRQ context.
- *  @param pTxByteCb - Callback, called to get byte that need to be transmitted
+ *  @param pTxSpanCb - Callback, called to get the contiguous span of bytes
+ *                     (up to aMax) that need to be transmitted.
  *                     Called in IRQ context
- *                     If returns FW_TRUE - continue transmiting
- *                     If returns FW_FALSE - transmiting stops
+ *                     If returns non zero size - continue transmiting
+ *                     If returns 0 - transmiting stops
  *  @param pTxCmpltCb - Callback, called when all the bytes were sent.
  *                      Called in IRQ context.
  * 
@@ -27,9 +30,9 @@ typedef FW_BOOLEAN (* EAST_UART_CbByte)(U8 * pByte);
 void EAST_UART_Init
 (
   U32              aBaudRate,
-  EAST_UART_CbByte pRxByteCb,
+  EAST_UART_CbData pRxDataCb,
   EAST_UART_CbByte pRxCmpltCb,
-  EAST_UART_CbByte pTxByteCb,
+  EAST_UART_CbSpan pTxSpanCb,
   EAST_UART_CbByte pTxCmpltCb
 );
 //-----------------------------------------------------------------------------
@@ -42,16 +45,16 @@ void EAST_UART_DeInit(void);
 /** @brief Enables transmiting via UART using Interrupts
  *  @param None
  *  @return None
- *  @note When Tx Data Register empty - callback function is called to get
- *        the next byte to transmit
+ *  @note When Tx FIFO is empty - callback function is called to get
+ *        the next bytes to transmit
  */
 void EAST_UART_TxStart(void);
 //-----------------------------------------------------------------------------
 /** @brief Enables receiving via UART using Interrupts
  *  @param None
  *  @return None
- *  @note When Rx Data Register is not empty - callback function is called
- *        to put the received byte to higher layer
+ *  @note When Rx FIFO is filled or timed out - callback function is called
+ *        to put the received bytes to higher layer
  */
 void EAST_UART_RxStart(void);
 //-----------------------------------------------------------------------------
@@ -59,8 +59,60 @@ u8_t fs_wait_read_custom(struct fs_file *file, fs_wait_cb callback_fn, void *cal
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
 /*-----------------------------------------------------------------------------------*/
-err_t
-fs_open(struct fs_file *file, const char *name)
+#ifdef FS_HASH_SIZE
+/** FNV-1a hash of the file name, must match fs_hash_name() in makefsdata.py */
+static u32_t
+fs_hash_name(const char *name)
+{
+  u32_t h = 0x811C9DC5UL;
+
+  while (*name != 0) {
+    h = (h ^ (u8_t)*name++) * 0x01000193UL;
+  }
+  return h;
+}
+
+/** Mixes the bucket seed into the name hash, must match fs_hash_mix() in makefsdata.py */
+static u32_t
+fs_hash_mix(u32_t h, u32_t seed)
+{
+  h ^= seed;
+  h ^= h >> 16;
+  h *= 0x85EBCA6BUL;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35UL;
+  h ^= h >> 16;
+  return h;
+}
+#endif /* FS_HASH_SIZE */
+
+/*-----------------------------------------------------------------------------------*/
+static const struct fsdata_file *
+fs_find(const char *name)
+{
+  const struct fsdata_file *f;
+#ifdef FS_HASH_SIZE
+  /* Minimal perfect hash generated by makefsdata.py: one strcmp per lookup */
+  u32_t h = fs_hash_name(name);
+
+  f = fs_hash_table[fs_hash_mix(h, fs_hash_seed[h % FS_HASH_SIZE]) % FS_HASH_SIZE];
+  if (!strcmp(name, (const char *)f->name)) {
+    return f;
+  }
+#else /* FS_HASH_SIZE */
+  /* Custom file systems may come without the index */
+  for (f = FS_ROOT; f != NULL; f = f->next) {
+    if (!strcmp(name, (const char *)f->name)) {
+      return f;
+    }
+  }
+#endif /* FS_HASH_SIZE */
+  return NULL;
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+fs_open_encoded(struct fs_file *file, const char *name, u8_t accept_gzip)
 {
   const struct fsdata_file *f;
 
@@ -71,31 +123,64 @@ fs_open(struct fs_file *file, const char *name)
 #if LWIP_HTTPD_CUSTOM_FILES
   if (fs_open_custom(file, name)) {
     file->is_custom_file = 1;
+#if LWIP_HTTPD_SUPPORT_ETAG
+    file->etag = NULL;
+#endif /* LWIP_HTTPD_SUPPORT_ETAG */
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+    file->ssi_tags = NULL;
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
     return ERR_OK;
   }
   file->is_custom_file = 0;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
-  for (f = FS_ROOT; f != NULL; f = f->next) {
-    if (!strcmp(name, (char *)f->name)) {
-      file->data = (const char *)f->data;
-      file->len = f->len;
-      file->index = f->len;
-      file->pextension = NULL;
-      file->http_header_included = f->http_header_included;
+  f = fs_find(name);
+  if (f == NULL) {
+    /* file not found */
+    return ERR_VAL;
+  }
+  if (accept_gzip && (f->gzip != NULL)) {
+    /* the variant carries its own Content-Encoding and Content-Length headers */
+    f = f->gzip;
+  }
+
+  file->data = (const char *)f->data;
+  file->len = f->len;
+  file->index = f->len;
+  file->pextension = NULL;
+  file->http_header_included = f->http_header_included;
+#if LWIP_HTTPD_SUPPORT_ETAG
+  file->etag = f->etag;
+#endif /* LWIP_HTTPD_SUPPORT_ETAG */
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+  file->ssi_tags = f->ssi_tags;
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
 #if HTTPD_PRECALCULATED_CHECKSUM
-      file->chksum_count = f->chksum_count;
-      file->chksum = f->chksum;
+  file->chksum_count = f->chksum_count;
+  file->chksum = f->chksum;
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
 #if LWIP_HTTPD_FILE_STATE
-      file->state = fs_state_init(file, name);
+  file->state = fs_state_init(file, name);
 #endif /* #if LWIP_HTTPD_FILE_STATE */
-      return ERR_OK;
-    }
-  }
-  /* file not found */
-  return ERR_VAL;
+  return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+err_t
+fs_open(struct fs_file *file, const char *name)
+{
+  return fs_open_encoded(file, name, 0);
+}
+
+#if LWIP_HTTPD_SUPPORT_GZIP
+/*-----------------------------------------------------------------------------------*/
+/** Same as fs_open() but prefers the gzip encoded variant of the file */
+err_t
+fs_open_gzip(struct fs_file *file, const char *name)
+{
+  return fs_open_encoded(file, name, 1);
 }
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
 
 /*-----------------------------------------------------------------------------------*/
 void
@@ -64,11 +64,18 @@
  *    the tag name and between the tag name and the leadout string "-->".
  * 3. The maximum tag name length is LWIP_HTTPD_MAX_TAG_NAME_LEN, currently 8 characters.
  *
+ * makefsdata.py finds the tags of the SSI files when the file system image is
+ * generated (using the same rules) and stores them in a tag table per file.
+ * Such files are sent without scanning them (LWIP_HTTPD_SUPPORT_SSI_TAGS),
+ * the other SSI files are still scanned while they are sent.
+ *
  * Notes on CGI usage
  * ------------------
  *
- * The simple CGI support offered here works with GET method requests only
- * and can handle up to 16 parameters encoded into the URI. The handler
+ * The simple CGI support offered here works with GET method requests (or the
+ * methods listed by the CGI) and can handle up to 16 parameters encoded into
+ * the URI. The CGI URIs are compiled into a hash table when they are set,
+ * a URI ending with '*' registers a prefix. The handler
  * function may not write directly to the HTTP output but must return a
  * filename that the HTTP server will send to the browser as a response to
  * the incoming CGI request.
@@ -89,6 +96,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <ctype.h>
 
 #if LWIP_TCP
 
@@ -105,6 +113,18 @@
 #    define HTTPD_USE_MEM_POOL    0
 #endif
 
+/** Number of struct http_state in the slab (HTTPD_USE_SLAB_POOL), this is the
+ * maximum number of connections served at once, WebSockets included. */
+#ifndef HTTPD_SLAB_NUM_STATES
+#    define HTTPD_SLAB_NUM_STATES     8
+#endif
+
+/** Number of struct http_ssi_state in the slab (HTTPD_USE_SLAB_POOL), this is
+ * the maximum number of SSI files sent at once. */
+#ifndef HTTPD_SLAB_NUM_SSI_STATES
+#    define HTTPD_SLAB_NUM_SSI_STATES 2
+#endif
+
 /** The server port for HTTPD to use */
 #ifndef HTTPD_SERVER_PORT
 #    define HTTPD_SERVER_PORT     80
@@ -130,6 +150,12 @@
 #    define HTTPD_TCP_PRIO        TCP_PRIO_MIN
 #endif
 
+/** Set this to 0 to write the responses as they come and leave Nagle on,
+ * instead of planning the writes on segment boundaries (http_send_plan) */
+#ifndef HTTPD_SEND_PLANNER
+#    define HTTPD_SEND_PLANNER    1
+#endif
+
 /** Set this to 1 to enabled timing each file sent */
 #ifndef LWIP_HTTPD_TIMING
 #    define LWIP_HTTPD_TIMING     0
@@ -154,14 +180,35 @@
 #    define LWIP_HTTPD_SUPPORT_V09          1
 #endif
 
-/** Set this to 1 to enable HTTP/1.1 persistent connections.
+/** Set this to 1 to enable HTTP/1.1 persistent connections and pipelined requests.
  * ATTENTION: If the generated file system includes HTTP headers, these must
- * include the "Connection: keep-alive" header (pass argument "-11" to makefsdata).
+ * include the "Content-Length" header and no "Connection" header (makefsdata.py
+ * generates them this way): httpd adds "Connection: close" when the connection
+ * is closed after the response. SSI files are sent in chunks instead, see
+ * LWIP_HTTPD_SUPPORT_CHUNKED.
  */
 #ifndef LWIP_HTTPD_SUPPORT_11_KEEPALIVE
 #    define LWIP_HTTPD_SUPPORT_11_KEEPALIVE 0
 #endif
 
+/** Number of pbufs a persistent connection queues with the requests received
+ * while a response is being sent. More are refused until the queue is served
+ * (lwIP passes them again later). The queued bytes are taken from the TCP
+ * receive window only when they are parsed, so the window bounds them.
+ */
+#ifndef LWIP_HTTPD_PIPELINE_QUEUELEN
+#    define LWIP_HTTPD_PIPELINE_QUEUELEN    8
+#endif
+
+/** Set this to 1 to send SSI files to HTTP/1.1 clients with chunked transfer
+ * encoding, so that their connections persist as well. The headers of the
+ * SSI files must end with "Connection: close", which is replaced (makefsdata.py
+ * writes them this way); SSI files with other headers close the connection.
+ */
+#ifndef LWIP_HTTPD_SUPPORT_CHUNKED
+#    define LWIP_HTTPD_SUPPORT_CHUNKED      (LWIP_HTTPD_SUPPORT_11_KEEPALIVE && LWIP_HTTPD_SSI)
+#endif
+
 /** Set this to 1 to support HTTP request coming in in multiple packets/pbufs */
 #ifndef LWIP_HTTPD_SUPPORT_REQUESTLIST
 #    define LWIP_HTTPD_SUPPORT_REQUESTLIST  1
@@ -216,6 +263,12 @@
 #    define LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED 0
 #endif
 
+#if HTTPD_USE_SLAB_POOL
+/* The slab pool keeps the connections on its own LRU list for eviction */
+#    undef LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
+#    define LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED 0
+#endif /* HTTPD_USE_SLAB_POOL */
+
 #define HTTPD_LOG  0
 #define WS_LOG     0
 
@@ -251,11 +304,27 @@ static const char * g_tagWS = "WS";
 #    define WS_LOGV(...)
 #endif
 
-/** Minimum length for a valid HTTP/0.9 request: "GET /\r\n" -> 7 bytes */
-#define MIN_REQ_LEN 7
-
 #define CRLF                       "\r\n"
-#define HTTP11_CONNECTIONKEEPALIVE "Connection: keep-alive"
+#define HTTP_CONNECTION            "Connection:"
+#define HTTP_ACCEPT_ENCODING       "Accept-Encoding:"
+#define HTTP_IF_NONE_MATCH         "If-None-Match:"
+#define HTTP_UPGRADE               "Upgrade:"
+#define HTTP_WS_KEY                "Sec-WebSocket-Key:"
+#define HTTP_RANGE                 "Range:"
+#define HTTP_IF_RANGE              "If-Range:"
+
+/* Request headers recorded by the request parser */
+enum http_req_hdr
+{
+    HTTP_HDR_CONNECTION,
+    HTTP_HDR_ACCEPT_ENCODING,
+    HTTP_HDR_IF_NONE_MATCH,
+    HTTP_HDR_UPGRADE,
+    HTTP_HDR_WS_KEY,
+    HTTP_HDR_RANGE,
+    HTTP_HDR_IF_RANGE,
+    HTTP_NUM_REQ_HDRS
+};
 
 #if LWIP_HTTPD_SSI
 #    define LWIP_HTTPD_IS_SSI(hs) ((hs)->ssi)
@@ -268,7 +337,10 @@ static const char * g_tagWS = "WS";
 /** This was TI's check whether to let TCP copy data or not
 #define HTTP_IS_DATA_VOLATILE(hs) ((hs->file < (char *)0x20000000) ? 0 : TCP_WRITE_FLAG_COPY)*/
 #ifndef HTTP_IS_DATA_VOLATILE
-#if LWIP_HTTPD_SSI
+#if LWIP_HTTPD_SSI && LWIP_HTTPD_SUPPORT_SSI_TAGS
+/* Copy for scanned SSI files, no copy for SSI files with a tag table and non-SSI files */
+#    define HTTP_IS_DATA_VOLATILE(hs) (((hs)->ssi && !(hs)->ssi->next_tag) ? TCP_WRITE_FLAG_COPY : 0)
+#elif LWIP_HTTPD_SSI
 /* Copy for SSI files, no copy for non-SSI files */
 #    define HTTP_IS_DATA_VOLATILE(hs) ((hs)->ssi ? TCP_WRITE_FLAG_COPY : 0)
 #else /* LWIP_HTTPD_SSI */
@@ -293,26 +365,37 @@ static const char * g_tagWS = "WS";
 #endif
 #endif /* LWIP_HTTPD_SSI */
 
+/** TCP_WRITE_FLAG_MORE while the file continues after the next len bytes,
+ * so that PSH is only set on the last segment of a response */
+#define HTTP_MORE_DATA(hs, len) (((hs)->left > (u32_t)(len)) ? TCP_WRITE_FLAG_MORE : 0)
+
 /* Return values for http_send_*() */
 #define HTTP_DATA_TO_SEND_BREAK             2
 #define HTTP_DATA_TO_SEND_CONTINUE          1
 #define HTTP_NO_DATA_TO_SEND                0
 
-#if HTTPD_USE_MEM_POOL
-#    define HTTP_ALLOC_SSI_STATE()  (struct http_ssi_state *)memp_malloc(MEMP_HTTPD_SSI_STATE)
-#    define HTTP_ALLOC_HTTP_STATE() (struct http_state *)memp_malloc(MEMP_HTTPD_STATE)
+#if HTTPD_USE_SLAB_POOL
+#    define HTTP_ALLOC_SSI_STATE()    (struct http_ssi_state *)http_slab_alloc(&http_ssi_state_slab)
+#    define HTTP_ALLOC_HTTP_STATE()   (struct http_state *)http_slab_alloc(&http_state_slab)
+#    define HTTP_FREE_SSI_STATE(ssi)  http_slab_free(&http_ssi_state_slab, (ssi))
+#    define HTTP_FREE_HTTP_STATE(hs)  http_slab_free(&http_state_slab, (hs))
+#elif HTTPD_USE_MEM_POOL
+#    define HTTP_ALLOC_SSI_STATE()    (struct http_ssi_state *)memp_malloc(MEMP_HTTPD_SSI_STATE)
+#    define HTTP_ALLOC_HTTP_STATE()   (struct http_state *)memp_malloc(MEMP_HTTPD_STATE)
+#    define HTTP_FREE_SSI_STATE(ssi)  memp_free(MEMP_HTTPD_SSI_STATE, (ssi))
+#    define HTTP_FREE_HTTP_STATE(hs)  memp_free(MEMP_HTTPD_STATE, (hs))
 #else /* HTTPD_USE_MEM_POOL */
-#    define HTTP_ALLOC_SSI_STATE()  (struct http_ssi_state *)mem_malloc(sizeof(struct http_ssi_state))
-#    define HTTP_ALLOC_HTTP_STATE() (struct http_state *)mem_malloc(sizeof(struct http_state))
+#    define HTTP_ALLOC_SSI_STATE()    (struct http_ssi_state *)mem_malloc(sizeof(struct http_ssi_state))
+#    define HTTP_ALLOC_HTTP_STATE()   (struct http_state *)mem_malloc(sizeof(struct http_state))
+#    define HTTP_FREE_SSI_STATE(ssi)  mem_free(ssi)
+#    define HTTP_FREE_HTTP_STATE(hs)  mem_free(hs)
 #endif /* HTTPD_USE_MEM_POOL */
 
 #include <mbedtls/sha1.h>
 #include <mbedtls/base64.h>
 #include "strcasestr.h"
 
-static const char WS_HEADER[] = "Upgrade: websocket\r\n";
 static const char WS_GUID[]   = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
-static const char WS_KEY[]    = "Sec-WebSocket-Key: ";
 static const char WS_RSP[]    = "HTTP/1.1 101 Switching Protocols\r\n"
                                 "Upgrade: websocket\r\n"
                                 "Connection: Upgrade\r\n"
@@ -324,6 +407,41 @@ static const char WS_RSP[]    = "HTTP/1.1 101 Switching Protocols\r\n"
 /* Response buffer length */
 #define WS_RSP_LEN (sizeof(WS_RSP) + sizeof(CRLF CRLF) - 2 + WS_BASE64_LEN)
 
+/* Longest payload of a frame with the 2 byte header */
+#define WS_SHORT_PAYLOAD_LEN                125
+/* Frame header length with the 16 bit extended payload length */
+#define WS_EXTENDED_HEADER_LEN              4
+
+/* Longest frame header: 2 bytes, 64 bit extended payload length, masking key */
+#define WS_MAX_HEADER_LEN                   14
+
+/* Frame header bits */
+#define WS_FIN                              0x80
+#define WS_RSV                              0x70
+#define WS_OPCODE                           0x0F
+#define WS_MASK                             0x80
+#define WS_PAYLOAD_LEN                      0x7F
+
+/* Opcodes besides WS_TEXT_MODE and WS_BIN_MODE */
+#define WS_OP_CONTINUATION                  0x00
+#define WS_OP_CLOSE                         0x08
+#define WS_OP_PING                          0x09
+#define WS_OP_PONG                          0x0A
+
+/* Longest message passed to the callback when it has to be reassembled:
+ * fragmented messages and frames split between pbufs */
+#ifndef WS_MAX_MESSAGE_LEN
+#    define WS_MAX_MESSAGE_LEN              2048
+#endif
+#if WS_MAX_MESSAGE_LEN > 0xFFFF
+#    error "WS_MAX_MESSAGE_LEN must fit the u16_t length of tWsHandler"
+#endif
+
+/* Maximum number of websockets receiving websocket_broadcast() */
+#ifndef WS_MAX_SUBSCRIBERS
+#    define WS_MAX_SUBSCRIBERS              4
+#endif
+
 /* WebSocket timeout: X*(HTTPD_POLL_INTERVAL), default is 10*4*500ms = 20s */
 #ifndef WS_TIMEOUT
 #    define WS_TIMEOUT                      300
@@ -333,6 +451,14 @@ static const char WS_RSP[]    = "HTTP/1.1 101 Switching Protocols\r\n"
 static tWsHandler     websocket_cb      = NULL;
 static tWsOpenHandler websocket_open_cb = NULL;
 
+/* Websockets subscribed to websocket_broadcast() */
+static struct http_state * websocket_subscribers[WS_MAX_SUBSCRIBERS];
+static u8_t                websocket_subscriber_count;
+/* Websocket whose callback is running: websocket_broadcast() leaves dropping
+ * it to the caller of the callback, which still uses its state */
+static struct http_state * websocket_cb_hs;
+static u8_t                websocket_cb_drop;
+
 typedef struct
 {
     const char * name;
@@ -370,6 +496,13 @@ static default_filenames_t g_psDefaultFilenames =
 static char httpd_req_buf[LWIP_HTTPD_MAX_REQ_LENGTH + 1];
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
 
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Connection whose pipelined requests http_eof() is serving: a response
+ * finished from within leaves the next request to that loop */
+static struct http_state * http_pipelined_hs;
+static struct pbuf *       http_pipelined_next;
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
 #if LWIP_HTTPD_SUPPORT_POST
 /** Filename for response file to send when POST is finished */
 static char http_post_response_filename[LWIP_HTTPD_POST_MAX_RESPONSE_URI_LEN + 1];
@@ -402,6 +535,9 @@ struct http_ssi_state
     const char * tag_started;    /* Pointer to the first opening '<' of the tag. */
 #endif /* !LWIP_HTTPD_SSI_INCLUDE_TAG */
     const char * tag_end;        /* Pointer to char after the closing '>' of the tag. */
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+    const struct fsdata_ssi_tag * next_tag; /* Next tag of the file tag table, NULL to scan the file */
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
     u32_t        parse_left;     /* Number of unparsed bytes in buf. */
     u16_t        tag_index;      /* Counter used by tag parsing state machine */
     u16_t        tag_insert_len; /* Length of insert in string tag_insert */
@@ -414,18 +550,98 @@ struct http_ssi_state
     char                 tag_insert[LWIP_HTTPD_MAX_TAG_INSERT_LEN + 1]; /* Insert string for tag_name */
     enum tag_check_state tag_state;                                     /* State of the tag processor */
 };
+
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+/* The insert of a tag at the very end of the file is sent after hs->left reached 0 */
+#define HTTP_SSI_INSERT_PENDING(hs) (((hs)->ssi != NULL) && ((hs)->ssi->next_tag != NULL) && \
+                                     ((hs)->ssi->tag_state == TAG_SENDING))
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
 #endif /* LWIP_HTTPD_SSI */
 
+#ifndef HTTP_SSI_INSERT_PENDING
+#define HTTP_SSI_INSERT_PENDING(hs) 0
+#endif
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/* Connection lines: the static headers have none, see http_write_connection().
+ * The close line also ends the headers of an SSI file. */
+#define HTTP_CONN_CLOSE_LINE     "Connection: close" CRLF
+#define HTTP_CONN_KEEPALIVE_LINE "Connection: keep-alive" CRLF
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+#if LWIP_HTTPD_SUPPORT_CHUNKED
+#if !LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+#    error "LWIP_HTTPD_SUPPORT_CHUNKED needs LWIP_HTTPD_SUPPORT_11_KEEPALIVE"
+#endif
+/** Progress of a chunked response, see http_write_chunk() */
+enum http_chunk_state
+{
+    HTTP_CHUNK_NONE,    /* Not chunked */
+    HTTP_CHUNK_HEADERS, /* Sending the headers up to the Connection line */
+    HTTP_CHUNK_LINES,   /* Sending HTTP_CHUNKED_LINES in place of that line */
+    HTTP_CHUNK_SKIP,    /* Passing over the Connection line and the empty line */
+    HTTP_CHUNK_BODY     /* Sending the body in chunks */
+};
+#define HTTP_IS_CHUNKED(hs)  ((hs)->chunked != HTTP_CHUNK_NONE)
+/* Room for the CRLF ending a chunk and the size line of the next one */
+#define HTTP_CHUNK_HDR_LEN   8
+/* Replace HTTP_CONN_CLOSE_LINE, the last header line of an SSI file */
+#define HTTP_CHUNKED_LINES   HTTP_CONN_KEEPALIVE_LINE "Transfer-Encoding: chunked" CRLF CRLF
+#else /* LWIP_HTTPD_SUPPORT_CHUNKED */
+#define HTTP_IS_CHUNKED(hs) 0
+#endif /* LWIP_HTTPD_SUPPORT_CHUNKED */
+
+/** Frame decoder state of a WebSocket connection. Frames are decoded as
+ * they arrive: a header or a payload may be split between pbufs and
+ * one pbuf may carry several frames. */
+struct websocket_state
+{
+    u8_t   hdr[WS_MAX_HEADER_LEN]; /* Header of the current frame */
+    u8_t   hdr_len;                /* Number of header bytes received */
+    u8_t   hdr_size;               /* Header length, 0 until the first 2 bytes are in */
+    u8_t   msg_opcode;             /* Opcode of the message being received, 0 if none */
+    u16_t  msg_len;                /* Number of bytes reassembled in msg */
+    u8_t * msg;                    /* Reassembly buffer (WS_MAX_MESSAGE_LEN), allocated on demand */
+    u32_t  payload_len;            /* Payload length of the current frame */
+    u32_t  payload_pos;            /* Number of payload bytes of the current frame received */
+};
+
+/** Progress of the request parser. It is kept between the pbufs of a request
+ * so that every byte is examined once, offsets are from the request start. */
+struct http_req_parse
+{
+    u16_t scanned;    /* Number of request bytes examined */
+    u16_t line_start; /* Offset of the line being received */
+    u16_t method_end; /* Offset of the space after the method, 0 if none */
+    u16_t uri_end;    /* Offset of the space after the URI, 0 if none */
+    u16_t line_end;   /* Offset of the CRLF ending the request line, 0 until received */
+    u16_t hdr_end;    /* Length of the request up to CRLFCRLF, 0 until received */
+    u16_t value[HTTP_NUM_REQ_HDRS];     /* Value offset of each recorded header, 0 if absent */
+    u16_t value_len[HTTP_NUM_REQ_HDRS]; /* Value length of each recorded header */
+    u8_t  found;      /* Recorded headers, one bit each */
+    u8_t  candidates; /* Recorded headers still matching the name of the line, one bit each */
+    u8_t  name_pos;   /* Number of header name characters matched */
+    u8_t  current;    /* 1 + header whose value is being received, 0 if none */
+    u8_t  method;     /* HTTPD_METHOD_* of the request, 0 until parsed */
+    char  last;       /* Last byte examined */
+};
+
 struct http_state
 {
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
     struct http_state * next;
 #endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
+#if HTTPD_USE_SLAB_POOL
+    struct http_state * lru_prev; /* More recently active connection */
+    struct http_state * lru_next; /* Less recently active connection */
+#endif /* HTTPD_USE_SLAB_POOL */
     struct fs_file   file_handle;
     struct fs_file * handle;
     char *           file; /* Pointer to first unsent byte in buf. */
     u8_t             is_websocket;
     struct tcp_pcb * pcb;
+    struct websocket_state * ws; /* Frame decoder, allocated with the first frame */
+    struct http_req_parse    parse;
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
     struct pbuf * req;
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
@@ -436,11 +652,22 @@ struct http_state
     u32_t left;     /* Number of unsent bytes in buf. */
     u8_t  retries;
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-    u8_t keepalive;
+    u8_t          keepalive;
+    struct pbuf * pipelined;     /* Requests received after the one being answered */
+    u16_t         pipelined_off; /* Bytes at the start of pipelined already parsed */
+    u16_t         pipelined_wnd; /* Bytes of pipelined not yet taken from the receive window */
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if LWIP_HTTPD_SUPPORT_GZIP
+    u8_t accept_gzip; /* The client accepts gzip encoded files */
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
 #if LWIP_HTTPD_SSI
     struct http_ssi_state * ssi;
 #endif /* LWIP_HTTPD_SSI */
+#if LWIP_HTTPD_SUPPORT_CHUNKED
+    u8_t  chunked;    /* enum http_chunk_state of the response */
+    u8_t  chunk_open; /* A chunk has been started, its CRLF is still due */
+    u16_t chunk_left; /* Bytes of the current chunk (or headers) not written yet */
+#endif /* LWIP_HTTPD_SUPPORT_CHUNKED */
 #if LWIP_HTTPD_CGI
     char * params[LWIP_HTTPD_MAX_CGI_PARAMETERS];     /* Params extracted from the request URI */
     char * param_vals[LWIP_HTTPD_MAX_CGI_PARAMETERS]; /* Values for each extracted param */
@@ -469,8 +696,13 @@ static err_t http_close_or_abort_conn(struct tcp_pcb * pcb, struct http_state *
 static err_t http_find_file(struct http_state * hs, const char * uri, int is_09);
 static err_t http_init_file(struct http_state * hs, struct fs_file * file, int is_09, const char * uri, u8_t tag_check);
 static err_t http_poll(void * arg, struct tcp_pcb * pcb);
+static void  http_handle_request(struct tcp_pcb * pcb, struct http_state * hs, struct pbuf * p);
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+static struct pbuf * http_pbuf_free_header(struct pbuf * p, u16_t size);
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 
 static err_t websocket_send_close(struct tcp_pcb * pcb);
+static void  websocket_unsubscribe(struct http_state * hs);
 
 #if LWIP_HTTPD_FS_ASYNC_READ
 static void http_continue(void * connection);
@@ -490,9 +722,33 @@ const char * const g_pcTagLeadOut = "-->";
 #endif /* LWIP_HTTPD_SSI */
 
 #if LWIP_HTTPD_CGI
+#if (LWIP_HTTPD_MAX_CGI_ROUTES & (LWIP_HTTPD_MAX_CGI_ROUTES - 1)) || (LWIP_HTTPD_MAX_CGI_ROUTES > 128)
+#    error "LWIP_HTTPD_MAX_CGI_ROUTES must be a power of 2 up to 128"
+#endif
+
+/** Open addressing, kept at most half full so that the probes stay short */
+#define HTTP_CGI_HASH_SIZE (2 * LWIP_HTTPD_MAX_CGI_ROUTES)
+
+/** A CGI compiled by http_set_cgi_handlers */
+struct http_cgi_route
+{
+    const char * name;    /* URI, a prefix route ends with '*' */
+    tCGIHandler  handler; /* Handler of the CGI */
+    u32_t        hash;    /* http_cgi_hash() of the URI */
+    u16_t        len;     /* Length of the URI, without the '*' of a prefix route */
+    u8_t         methods; /* HTTPD_METHOD_* handled */
+    u8_t         index;   /* Index in the array given to http_set_cgi_handlers */
+    u8_t         prefix;  /* 1 if the route handles the URIs starting with name */
+};
+
 /* CGI handler information */
-const tCGI * g_pCGIs;
-int          g_iNumCGIs;
+static struct http_cgi_route http_cgi_routes[LWIP_HTTPD_MAX_CGI_ROUTES];
+static u8_t                  http_cgi_num_routes;
+/* 1 + index in http_cgi_routes of each exact route, 0 for a free slot */
+static u8_t http_cgi_slots[HTTP_CGI_HASH_SIZE];
+/* Index in http_cgi_routes of each prefix route, the longest first */
+static u8_t http_cgi_prefixes[LWIP_HTTPD_MAX_CGI_ROUTES];
+static u8_t http_cgi_num_prefixes;
 #endif /* LWIP_HTTPD_CGI */
 
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
@@ -501,6 +757,27 @@ int          g_iNumCGIs;
 static struct http_state * http_connections;
 #endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
 
+#if HTTPD_USE_SLAB_POOL
+/** Fixed-size objects reserved at startup, the free ones are linked through
+    their first word */
+struct http_slab
+{
+    void *                  free;
+    struct httpd_pool_stats stats;
+};
+
+static struct http_state http_state_objs[HTTPD_SLAB_NUM_STATES];
+static struct http_slab  http_state_slab;
+#if LWIP_HTTPD_SSI
+static struct http_ssi_state http_ssi_state_objs[HTTPD_SLAB_NUM_SSI_STATES];
+static struct http_slab      http_ssi_state_slab;
+#endif /* LWIP_HTTPD_SSI */
+
+/** Connections from the most (head) to the least (tail) recently active */
+static struct http_state * http_lru_head;
+static struct http_state * http_lru_tail;
+#endif /* HTTPD_USE_SLAB_POOL */
+
 #if LWIP_HTTPD_STRNSTR_PRIVATE
 /** Like strstr but does not need 'buffer' to be NULL-terminated */
 static char * strnstr(const char * buffer, const char * token, size_t n)
@@ -554,6 +831,126 @@ static void http_kill_oldest_connection(u8_t ssi_required)
 }
 #endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
 
+#if HTTPD_USE_SLAB_POOL
+/** Carve a slab out of the given objects. */
+static void http_slab_init(struct http_slab * slab, void * objs, size_t obj_size, u16_t count)
+{
+    u16_t loop;
+
+    LWIP_ASSERT("obj_size >= sizeof(void *)", obj_size >= sizeof(void *));
+    slab->free = NULL;
+    for (loop = count; loop > 0; loop--)
+    {
+        void * obj = (u8_t *)objs + (loop - 1) * obj_size;
+        *(void **)obj = slab->free;
+        slab->free    = obj;
+    }
+    memset(&slab->stats, 0, sizeof(slab->stats));
+    slab->stats.size = count;
+}
+
+/** Take an object from a slab, NULL if all of them are in use. */
+static void * http_slab_alloc(struct http_slab * slab)
+{
+    void * obj = slab->free;
+    if (obj != NULL)
+    {
+        slab->free = *(void **)obj;
+        slab->stats.used++;
+        if (slab->stats.peak < slab->stats.used)
+        {
+            slab->stats.peak = slab->stats.used;
+        }
+    }
+    return obj;
+}
+
+/** Return an object to its slab. */
+static void http_slab_free(struct http_slab * slab, void * obj)
+{
+    LWIP_ASSERT("slab->stats.used > 0", slab->stats.used > 0);
+    *(void **)obj = slab->free;
+    slab->free    = obj;
+    slab->stats.used--;
+}
+
+/** Take a connection off the LRU list. */
+static void http_lru_unlink(struct http_state * hs)
+{
+    if (hs->lru_prev != NULL)
+    {
+        hs->lru_prev->lru_next = hs->lru_next;
+    }
+    else
+    {
+        http_lru_head = hs->lru_next;
+    }
+    if (hs->lru_next != NULL)
+    {
+        hs->lru_next->lru_prev = hs->lru_prev;
+    }
+    else
+    {
+        http_lru_tail = hs->lru_prev;
+    }
+    hs->lru_prev = NULL;
+    hs->lru_next = NULL;
+}
+
+/** Mark a connection as the most recently active one. */
+static void http_lru_touch(struct http_state * hs)
+{
+    if (http_lru_head == hs)
+    {
+        return;
+    }
+    if ((hs->lru_prev != NULL) || (http_lru_tail == hs))
+    {
+        http_lru_unlink(hs);
+    }
+    hs->lru_next = http_lru_head;
+    if (http_lru_head != NULL)
+    {
+        http_lru_head->lru_prev = hs;
+    }
+    else
+    {
+        http_lru_tail = hs;
+    }
+    http_lru_head = hs;
+}
+
+/** Close the least recently active connection to free its state objects.
+ * WebSockets are idle most of the time by design, so they are never evicted.
+ *
+ * @param ssi_required only evict a connection which is sending an SSI file
+ * @return 1 if a connection has been closed
+ */
+static u8_t http_evict_connection(u8_t ssi_required)
+{
+    struct http_state * hs;
+
+    for (hs = http_lru_tail; hs != NULL; hs = hs->lru_prev)
+    {
+        if (hs->is_websocket || (hs->pcb == NULL))
+        {
+            continue;
+        }
+#if LWIP_HTTPD_SSI
+        if (ssi_required && (hs->ssi == NULL))
+        {
+            continue;
+        }
+#endif /* LWIP_HTTPD_SSI */
+        HTTPD_LOGI("Evicting connection %p", (void *)hs->pcb);
+        /* send RST, the connection is closed because of memory shortage */
+        http_close_or_abort_conn(hs->pcb, hs, 1); /* this also unlinks the http_state from the list */
+        return 1;
+    }
+    return 0;
+}
+#endif /* HTTPD_USE_SLAB_POOL */
+
 #if LWIP_HTTPD_SSI
 /** Allocate as struct http_ssi_state. */
 static struct http_ssi_state * http_ssi_state_alloc(void)
@@ -566,6 +963,17 @@ static struct http_ssi_state * http_ssi_state_alloc(void)
         ret = HTTP_ALLOC_SSI_STATE();
     }
 #endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
+#if HTTPD_USE_SLAB_POOL
+    if ((ret == NULL) && http_evict_connection(1))
+    {
+        http_ssi_state_slab.stats.evictions++;
+        ret = HTTP_ALLOC_SSI_STATE();
+    }
+    if (ret == NULL)
+    {
+        http_ssi_state_slab.stats.failures++;
+    }
+#endif /* HTTPD_USE_SLAB_POOL */
     if (ret != NULL)
     {
         memset(ret, 0, sizeof(struct http_ssi_state));
@@ -578,11 +986,7 @@ static void http_ssi_state_free(struct http_ssi_state * ssi)
 {
     if (ssi != NULL)
     {
-#if HTTPD_USE_MEM_POOL
-        memp_free(MEMP_HTTPD_SSI_STATE, ssi);
-#else  /* HTTPD_USE_MEM_POOL */
-        mem_free(ssi);
-#endif /* HTTPD_USE_MEM_POOL */
+        HTTP_FREE_SSI_STATE(ssi);
     }
 }
 #endif /* LWIP_HTTPD_SSI */
@@ -610,9 +1014,23 @@ static struct http_state * http_state_alloc(void)
         ret = HTTP_ALLOC_HTTP_STATE();
     }
 #endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
+#if HTTPD_USE_SLAB_POOL
+    if ((ret == NULL) && http_evict_connection(0))
+    {
+        http_state_slab.stats.evictions++;
+        ret = HTTP_ALLOC_HTTP_STATE();
+    }
+    if (ret == NULL)
+    {
+        http_state_slab.stats.failures++;
+    }
+#endif /* HTTPD_USE_SLAB_POOL */
     if (ret != NULL)
     {
         http_state_init(ret);
+#if HTTPD_USE_SLAB_POOL
+        http_lru_touch(ret);
+#endif /* HTTPD_USE_SLAB_POOL */
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
         /* add the connection to the list */
         if (http_connections == NULL)
@@ -666,6 +1084,30 @@ static void http_state_eof(struct http_state * hs)
 #endif /* LWIP_HTTPD_SSI */
 }
 
+/** Prepare a struct http_state for the next request of its connection,
+ * it stays on the connection lists.
+ */
+static void http_state_reset(struct http_state * hs)
+{
+#if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
+    struct http_state * next = hs->next;
+#endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
+#if HTTPD_USE_SLAB_POOL
+    struct http_state * lru_prev = hs->lru_prev;
+    struct http_state * lru_next = hs->lru_next;
+#endif /* HTTPD_USE_SLAB_POOL */
+
+    http_state_eof(hs);
+    http_state_init(hs);
+#if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
+    hs->next = next;
+#endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
+#if HTTPD_USE_SLAB_POOL
+    hs->lru_prev = lru_prev;
+    hs->lru_next = lru_next;
+#endif /* HTTPD_USE_SLAB_POOL */
+}
+
 /** Free a struct http_state.
  * Also frees the file data if dynamic.
  */
@@ -674,6 +1116,35 @@ static void http_state_free(struct http_state * hs)
     if (hs != NULL)
     {
         http_state_eof(hs);
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+        if (hs->pipelined != NULL)
+        {
+            pbuf_free(hs->pipelined);
+            hs->pipelined = NULL;
+        }
+        if (hs == http_pipelined_hs)
+        {
+            if (http_pipelined_next != NULL)
+            {
+                pbuf_free(http_pipelined_next);
+                http_pipelined_next = NULL;
+            }
+            http_pipelined_hs = NULL;
+        }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+        if (hs->is_websocket)
+        {
+            websocket_unsubscribe(hs);
+        }
+        if (hs->ws != NULL)
+        {
+            if (hs->ws->msg != NULL)
+            {
+                mem_free(hs->ws->msg);
+            }
+            mem_free(hs->ws);
+            hs->ws = NULL;
+        }
 #if LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED
         /* take the connection off the list */
         if (http_connections)
@@ -696,15 +1167,51 @@ static void http_state_free(struct http_state * hs)
             }
         }
 #endif /* LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED */
-#if HTTPD_USE_MEM_POOL
-        memp_free(MEMP_HTTPD_STATE, hs);
-#else  /* HTTPD_USE_MEM_POOL */
-        mem_free(hs);
-#endif /* HTTPD_USE_MEM_POOL */
+#if HTTPD_USE_SLAB_POOL
+        http_lru_unlink(hs);
+#endif /* HTTPD_USE_SLAB_POOL */
+        HTTP_FREE_HTTP_STATE(hs);
+    }
+}
+
+/** Number of bytes that complete the last segment queued on pcb but not sent
+ * yet, a full segment if there is none. lwIP appends each write to that
+ * segment before it starts new ones.
+ */
+static u16_t http_segment_room(struct tcp_pcb * pcb)
+{
+    u16_t mss = tcp_mss(pcb);
+
+    return mss - (u16_t)((pcb->snd_lbb - pcb->snd_nxt) % mss);
+}
+
+/** Send planner: trims a write of a response that continues afterwards to
+ * end on a segment boundary. Headers and body thus share the segments and
+ * only the last segment of a response may be short.
+ *
+ * @param pcb tcp_pcb to send
+ * @param len number of bytes that could be written now
+ * @param more nonzero if the response continues after these bytes
+ * @return number of bytes to write
+ */
+static u16_t http_send_plan(struct tcp_pcb * pcb, u16_t len, u8_t more)
+{
+#if HTTPD_SEND_PLANNER
+    u16_t room = http_segment_room(pcb);
+
+    if (more && (len > room))
+    {
+        len = room + ((len - room) / tcp_mss(pcb)) * tcp_mss(pcb);
     }
+#else  /* HTTPD_SEND_PLANNER */
+    LWIP_UNUSED_ARG(pcb);
+    LWIP_UNUSED_ARG(more);
+#endif /* HTTPD_SEND_PLANNER */
+    return len;
 }
 
-/** Call tcp_write() in a loop trying smaller and smaller length
+/** Call tcp_write() in a loop trying smaller and smaller length, whole
+ * segments are dropped first
  *
  * @param pcb tcp_pcb to send
  * @param ptr Data to send
@@ -716,6 +1223,7 @@ static void http_state_free(struct http_state * hs)
 static err_t http_write(struct tcp_pcb * pcb, const void * ptr, u16_t * length, u8_t apiflags)
 {
     u16_t len;
+    u16_t room;
     err_t err;
     LWIP_ASSERT("Length != NULL", length != NULL);
     len = *length;
@@ -723,6 +1231,7 @@ static err_t http_write(struct tcp_pcb * pcb, const void * ptr, u16_t * length,
     {
         return ERR_OK;
     }
+    room = http_segment_room(pcb);
     do
     {
         HTTPD_LOGI("Trying to send %d bytes", len);
@@ -734,6 +1243,13 @@ static err_t http_write(struct tcp_pcb * pcb, const void * ptr, u16_t * length,
                 /* No need to try smaller sizes */
                 len = 1;
             }
+            else if (len > room)
+            {
+                /* Drop the last segment: the write still ends on a segment
+                 * boundary and the rest follows */
+                len      = room + ((len - room - 1) / tcp_mss(pcb)) * tcp_mss(pcb);
+                apiflags = apiflags | TCP_WRITE_FLAG_MORE;
+            }
             else
             {
                 len /= 2;
@@ -755,6 +1271,140 @@ static err_t http_write(struct tcp_pcb * pcb, const void * ptr, u16_t * length,
     return err;
 }
 
+#if LWIP_HTTPD_SUPPORT_CHUNKED
+/** Write file data of the response, in chunks if the response is chunked.
+ * The headers of the file go unchanged up to their last line, which is
+ * replaced by HTTP_CHUNKED_LINES. A chunk is sized to what the send buffer
+ * takes when it is started; a shorter write leaves the rest of it to the
+ * next call, which continues the body wherever the caller takes it from.
+ *
+ * @param pcb tcp_pcb to send
+ * @param hs connection state
+ * @param ptr Data to send
+ * @param length Length of data to send (in/out: on return, contains the
+ *        amount of data sent)
+ * @param apiflags directly passed to tcp_write
+ * @return the error code returned by tcp_write
+ */
+static err_t http_write_chunk(struct tcp_pcb * pcb, struct http_state * hs, const void * ptr, u16_t * length,
+                              u8_t apiflags)
+{
+    char  size_line[HTTP_CHUNK_HDR_LEN + 1];
+    u16_t len = *length;
+    int   size_len;
+    err_t err;
+
+    if ((hs->chunked == HTTP_CHUNK_NONE) || (len == 0))
+    {
+        return http_write(pcb, ptr, length, apiflags);
+    }
+    if (hs->chunked == HTTP_CHUNK_HEADERS)
+    {
+        if (hs->chunk_left != 0)
+        {
+            if (len > hs->chunk_left)
+            {
+                len = hs->chunk_left;
+            }
+            err = http_write(pcb, ptr, &len, apiflags | TCP_WRITE_FLAG_MORE);
+            if (err == ERR_OK)
+            {
+                hs->chunk_left -= len;
+            }
+            *length = len;
+            return err;
+        }
+        hs->chunked    = HTTP_CHUNK_LINES;
+        hs->chunk_left = sizeof(HTTP_CHUNKED_LINES) - 1;
+    }
+    if (hs->chunked == HTTP_CHUNK_LINES)
+    {
+        /* May take several calls when the send buffer is small */
+        u16_t lines = hs->chunk_left;
+        err = http_write(pcb, HTTP_CHUNKED_LINES + sizeof(HTTP_CHUNKED_LINES) - 1 - lines, &lines,
+                         TCP_WRITE_FLAG_MORE);
+        if (err != ERR_OK)
+        {
+            *length = 0;
+            return err;
+        }
+        hs->chunk_left -= lines;
+        if (hs->chunk_left != 0)
+        {
+            *length = 0;
+            return ERR_MEM;
+        }
+        hs->chunked    = HTTP_CHUNK_SKIP;
+        hs->chunk_left = sizeof(HTTP_CONN_CLOSE_LINE CRLF) - 1;
+    }
+    if (hs->chunked == HTTP_CHUNK_SKIP)
+    {
+        /* The replaced line counts as sent */
+        if (len > hs->chunk_left)
+        {
+            len = hs->chunk_left;
+        }
+        hs->chunk_left -= len;
+        if (hs->chunk_left == 0)
+        {
+            hs->chunked = HTTP_CHUNK_BODY;
+        }
+        *length = len;
+        return ERR_OK;
+    }
+    if (hs->chunk_left == 0)
+    {
+        if ((tcp_sndbuf(pcb) <= HTTP_CHUNK_HDR_LEN) || (tcp_sndqueuelen(pcb) >= TCP_SND_QUEUELEN))
+        {
+            *length = 0;
+            return ERR_MEM;
+        }
+        if (len > (tcp_sndbuf(pcb) - HTTP_CHUNK_HDR_LEN))
+        {
+            len = tcp_sndbuf(pcb) - HTTP_CHUNK_HDR_LEN;
+        }
+        /* The CRLF ending the previous chunk goes with the size of this one */
+        size_len = snprintf(size_line, sizeof(size_line), "%s%x" CRLF, hs->chunk_open ? CRLF : "", len);
+        err      = tcp_write(pcb, size_line, (u16_t)size_len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+        if (err != ERR_OK)
+        {
+            *length = 0;
+            return err;
+        }
+        hs->chunk_open = 1;
+        hs->chunk_left = len;
+    }
+    if (len > hs->chunk_left)
+    {
+        len = hs->chunk_left;
+    }
+    err = http_write(pcb, ptr, &len, apiflags);
+    if (err == ERR_OK)
+    {
+        hs->chunk_left -= len;
+    }
+    *length = len;
+    return err;
+}
+
+/** Queue the last chunk, which ends a chunked body
+ *
+ * @param pcb tcp_pcb to send
+ * @param hs connection state
+ * @return ERR_OK if queued, another err_t to retry once data is acknowledged
+ */
+static err_t http_write_last_chunk(struct tcp_pcb * pcb, struct http_state * hs)
+{
+    static const char last_chunk[] = CRLF "0" CRLF CRLF;
+    u16_t             skip         = hs->chunk_open ? 0 : 2;
+
+    LWIP_ASSERT("chunk not complete", (hs->chunked == HTTP_CHUNK_BODY) && (hs->chunk_left == 0));
+    return tcp_write(pcb, &last_chunk[skip], (u16_t)(sizeof(last_chunk) - 1 - skip), 0);
+}
+#else /* LWIP_HTTPD_SUPPORT_CHUNKED */
+#define http_write_chunk(pcb, hs, ptr, length, apiflags) http_write(pcb, ptr, length, apiflags)
+#endif /* LWIP_HTTPD_SUPPORT_CHUNKED */
+
 /**
  * The connection shall be actively closed (using RST to close from fault states).
  * Reset the sent- and recv-callbacks.
@@ -841,39 +1491,101 @@ static err_t http_close_conn(struct tcp_pcb * pcb, struct http_state * hs)
  */
 static void http_eof(struct tcp_pcb * pcb, struct http_state * hs)
 {
-    /* HTTP/1.1 persistent connection? (Not supported for SSI) */
-#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-    if (hs->keepalive && !LWIP_HTTPD_IS_SSI(hs))
+#if LWIP_HTTPD_SUPPORT_CHUNKED
+    if (hs->chunked && (http_write_last_chunk(pcb, hs) != ERR_OK))
     {
-        http_state_eof(hs);
-        http_state_init(hs);
-        hs->keepalive = 1;
+        /* No room for the last chunk, http_sent() comes back here */
+        return;
     }
-    else
-#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
-        if (hs->is_websocket)
+#endif /* LWIP_HTTPD_SUPPORT_CHUNKED */
+    if (hs->is_websocket)
     {
-        http_state_eof(hs);
-        http_state_init(hs);
+        /* The upgraded connection carries frames from now on, keep the
+         * decoder: frames may have arrived while the handshake was sent */
+        struct websocket_state * ws = hs->ws;
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+        if (hs->pipelined != NULL)
+        {
+            pbuf_free(hs->pipelined);
+        }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+        http_state_reset(hs);
+        hs->pcb          = pcb;
         hs->is_websocket = 1;
+        hs->ws           = ws;
     }
-    else
+    /* HTTP/1.1 persistent connection? (SSI only if chunked) */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    else if (hs->keepalive && (!LWIP_HTTPD_IS_SSI(hs) || HTTP_IS_CHUNKED(hs)))
     {
-        http_close_conn(pcb, hs);
-    }
-}
+        struct pbuf * pipelined = hs->pipelined;
+        u16_t         offset    = hs->pipelined_off;
+        u16_t         wnd       = hs->pipelined_wnd;
 
-#if LWIP_HTTPD_CGI
-/**
- * Extract URI parameters from the parameter-part of an URI in the form
- * "test.cgi?x=y" @todo: better explanation!
+        http_state_reset(hs);
+        hs->pcb       = pcb;
+        hs->keepalive = 1;
+        if (wnd != 0)
+        {
+            /* The queued requests are parsed now, the client may send more */
+            tcp_recved(pcb, wnd);
+        }
+        if (pipelined != NULL)
+        {
+            /* The client did not wait for this response, serve its next request */
+            HTTPD_LOGI("Pipelined request");
+            pipelined = http_pbuf_free_header(pipelined, offset);
+#if !LWIP_HTTPD_SUPPORT_REQUESTLIST
+            if (pipelined->next != NULL)
+            {
+                /* Without the request list a request is parsed from one pbuf */
+                pipelined = pbuf_coalesce(pipelined, PBUF_RAW);
+            }
+#endif /* !LWIP_HTTPD_SUPPORT_REQUESTLIST */
+            if (hs == http_pipelined_hs)
+            {
+                /* Sent synchronously from the loop below: hand the rest back
+                 * instead of nesting one stack frame per queued request */
+                http_pipelined_next = pipelined;
+                return;
+            }
+            http_pipelined_hs = hs;
+            while (pipelined != NULL)
+            {
+                http_pipelined_next = NULL;
+                http_handle_request(pcb, hs, pipelined);
+                if (hs != http_pipelined_hs)
+                {
+                    /* Closed, hs is freed */
+                    return;
+                }
+                /* NULL unless the response was sent completely */
+                pipelined = http_pipelined_next;
+            }
+            http_pipelined_next = NULL;
+            http_pipelined_hs   = NULL;
+        }
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+    else
+    {
+        http_close_conn(pcb, hs);
+    }
+}
+
+#if LWIP_HTTPD_CGI
+/**
+ * Extract URI parameters from the parameter-part of an URI in the form
+ * "test.cgi?x=y" @todo: better explanation!
  * Pointers to the parameters are stored in hs->param_vals.
  *
  * @param hs http connection state
  * @param params pointer to the NULL-terminated parameter string from the URI
- * @return number of parameters extracted
+ * @param first number of parameters already stored in hs->params
+ * @return number of parameters stored
  */
-static int extract_uri_parameters(struct http_state * hs, char * params)
+static int extract_uri_parameters(struct http_state * hs, char * params, int first)
 {
     char * pair;
     char * equals;
@@ -882,7 +1594,7 @@ static int extract_uri_parameters(struct http_state * hs, char * params)
     /* If we have no parameters at all, return immediately. */
     if (!params || (params[0] == '\0'))
     {
-        return (0);
+        return (first);
     }
 
     /* Get a pointer to our first parameter */
@@ -890,7 +1602,7 @@ static int extract_uri_parameters(struct http_state * hs, char * params)
 
     /* Parse up to LWIP_HTTPD_MAX_CGI_PARAMETERS from the passed string and ignore the
      * remainder (if any) */
-    for (loop = 0; (loop < LWIP_HTTPD_MAX_CGI_PARAMETERS) && pair; loop++)
+    for (loop = first; (loop < LWIP_HTTPD_MAX_CGI_PARAMETERS) && pair; loop++)
     {
         /* Save the name of the parameter */
         hs->params[loop] = pair;
@@ -936,6 +1648,58 @@ static int extract_uri_parameters(struct http_state * hs, char * params)
 
     return loop;
 }
+
+/** FNV-1a hash of a CGI URI
+ *
+ * @param uri the NULL-terminated URI
+ * @param len receives the length of the URI
+ */
+static u32_t http_cgi_hash(const char * uri, u16_t * len)
+{
+    const char * c = uri;
+    u32_t        h = 0x811C9DC5UL;
+
+    while (*c != 0)
+    {
+        h = (h ^ (u8_t)*c++) * 0x01000193UL;
+    }
+    *len = (u16_t)(c - uri);
+    return h;
+}
+
+/** Find the CGI handling a request: the exact URI is looked up in the hash
+ * table, then the prefix routes are tried from the longest.
+ *
+ * @param uri the base URI of the request (without parameters)
+ * @param method HTTPD_METHOD_* of the request
+ * @return the route or NULL if no CGI handles the request
+ */
+static const struct http_cgi_route * http_cgi_find(const char * uri, u8_t method)
+{
+    const struct http_cgi_route * route;
+    u16_t                         len;
+    u32_t                         h = http_cgi_hash(uri, &len);
+    u32_t                         slot;
+    u8_t                          i;
+
+    for (slot = h & (HTTP_CGI_HASH_SIZE - 1); http_cgi_slots[slot] != 0; slot = (slot + 1) & (HTTP_CGI_HASH_SIZE - 1))
+    {
+        route = &http_cgi_routes[http_cgi_slots[slot] - 1];
+        if ((route->hash == h) && (route->methods & method) && !strcmp(route->name, uri))
+        {
+            return route;
+        }
+    }
+    for (i = 0; i < http_cgi_num_prefixes; i++)
+    {
+        route = &http_cgi_routes[http_cgi_prefixes[i]];
+        if ((route->len <= len) && (route->methods & method) && !strncmp(route->name, uri, route->len))
+        {
+            return route;
+        }
+    }
+    return NULL;
+}
 #endif /* LWIP_HTTPD_CGI */
 
 #if LWIP_HTTPD_SSI
@@ -1123,17 +1887,17 @@ static void get_http_headers(struct http_state * pState, char * pszURI)
 
 /** Sub-function of http_send(): send dynamic headers
  *
- * @returns: - HTTP_NO_DATA_TO_SEND: no new data has been enqueued
- *           - HTTP_DATA_TO_SEND_CONTINUE: continue with sending HTTP body
- *           - HTTP_DATA_TO_SEND_BREAK: data has been enqueued, headers pending,
+ * @returns: - HTTP_DATA_TO_SEND_CONTINUE: headers enqueued, continue with
+ *                                         sending HTTP body
+ *           - HTTP_DATA_TO_SEND_BREAK: headers pending or no HTTP body,
  *                                      so don't send HTTP body yet
  */
 static u8_t http_send_headers(struct tcp_pcb * pcb, struct http_state * hs)
 {
     err_t err;
     u16_t len;
-    u8_t  data_to_send = HTTP_NO_DATA_TO_SEND;
     u16_t hdrlen, sendlen;
+    u8_t  more;
 
     /* How much data can we send? */
     len     = tcp_sndbuf(pcb);
@@ -1142,7 +1906,6 @@ static u8_t http_send_headers(struct tcp_pcb * pcb, struct http_state * hs)
     while (len && (hs->hdr_index < NUM_FILE_HDR_STRINGS) && sendlen)
     {
         const void * ptr;
-        u16_t        old_sendlen;
         /* How much do we have to send from the current header? */
         hdrlen = (u16_t)strlen(hs->hdrs[hs->hdr_index]);
 
@@ -1151,15 +1914,10 @@ static u8_t http_send_headers(struct tcp_pcb * pcb, struct http_state * hs)
 
         /* Send this amount of data or as much as we can given memory
          * constraints. */
-        ptr         = (const void *)(hs->hdrs[hs->hdr_index] + hs->hdr_pos);
-        old_sendlen = sendlen;
-        err         = http_write(pcb, ptr, &sendlen, HTTP_IS_HDR_VOLATILE(hs, ptr));
-        if ((err == ERR_OK) && (old_sendlen != sendlen))
-        {
-            /* Remember that we added some more data to be transmitted. */
-            data_to_send = HTTP_DATA_TO_SEND_CONTINUE;
-        }
-        else if (err != ERR_OK)
+        ptr  = (const void *)(hs->hdrs[hs->hdr_index] + hs->hdr_pos);
+        more = (hs->file != NULL) || (hs->hdr_index + 1 < NUM_FILE_HDR_STRINGS);
+        err  = http_write(pcb, ptr, &sendlen, HTTP_IS_HDR_VOLATILE(hs, ptr) | (more ? TCP_WRITE_FLAG_MORE : 0));
+        if (err != ERR_OK)
         {
             /* special case: http_write does not try to send 1 byte */
             sendlen = 0;
@@ -1180,13 +1938,14 @@ static u8_t http_send_headers(struct tcp_pcb * pcb, struct http_state * hs)
     /* If we get here and there are still header bytes to send, we send
      * the header information we just wrote immediately. If there are no
      * more headers to send, but we do have file data to send, drop through
-     * to try to send some file data too. */
+     * to send file data too: it fills the segment of the headers instead of
+     * waiting for their ACK. */
     if ((hs->hdr_index < NUM_FILE_HDR_STRINGS) || !hs->file)
     {
         HTTPD_LOGI("tcp_output");
         return HTTP_DATA_TO_SEND_BREAK;
     }
-    return data_to_send;
+    return HTTP_DATA_TO_SEND_CONTINUE;
 }
 #endif /* LWIP_HTTPD_DYNAMIC_HEADERS */
 
@@ -1316,8 +2075,9 @@ static u8_t http_send_data_nonssi(struct tcp_pcb * pcb, struct http_state * hs)
     {
         len = 2 * mss;
     }
+    len = http_send_plan(pcb, len, hs->left > len);
 
-    err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs));
+    err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs) | HTTP_MORE_DATA(hs, len));
     if (err == ERR_OK)
     {
         data_to_send = 1;
@@ -1367,8 +2127,9 @@ static u8_t http_send_data_ssi(struct tcp_pcb * pcb, struct http_state * hs)
         {
             len = 2 * mss;
         }
+        len = http_send_plan(pcb, len, hs->left > len);
 
-        err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs));
+        err = http_write_chunk(pcb, hs, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs) | HTTP_MORE_DATA(hs, len));
         if (err == ERR_OK)
         {
             data_to_send = 1;
@@ -1573,7 +2334,8 @@ static u8_t http_send_data_ssi(struct tcp_pcb * pcb, struct http_state * hs)
                             }
 #endif /* LWIP_HTTPD_SSI_INCLUDE_TAG*/
 
-                            err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs));
+                            err = http_write_chunk(pcb, hs, hs->file, &len,
+                                                   HTTP_IS_DATA_VOLATILE(hs) | TCP_WRITE_FLAG_MORE);
                             if (err == ERR_OK)
                             {
                                 data_to_send = 1;
@@ -1630,7 +2392,8 @@ static u8_t http_send_data_ssi(struct tcp_pcb * pcb, struct http_state * hs)
 #endif /* LWIP_HTTPD_SSI_INCLUDE_TAG*/
                     if (len != 0)
                     {
-                        err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs));
+                        err = http_write_chunk(pcb, hs, hs->file, &len,
+                                               HTTP_IS_DATA_VOLATILE(hs) | TCP_WRITE_FLAG_MORE);
                     }
                     else
                     {
@@ -1679,7 +2442,8 @@ static u8_t http_send_data_ssi(struct tcp_pcb * pcb, struct http_state * hs)
                          * single tag insert buffer per connection. If we don't do
                          * this, insert corruption can occur if more than one insert
                          * is processed before we call tcp_output. */
-                        err = http_write(pcb, &(ssi->tag_insert[ssi->tag_index]), &len, HTTP_IS_TAG_VOLATILE(hs));
+                        err = http_write_chunk(pcb, hs, &(ssi->tag_insert[ssi->tag_index]), &len,
+                                               HTTP_IS_TAG_VOLATILE(hs) | HTTP_MORE_DATA(hs, 0));
                         if (err == ERR_OK)
                         {
                             data_to_send = 1;
@@ -1728,8 +2492,9 @@ static u8_t http_send_data_ssi(struct tcp_pcb * pcb, struct http_state * hs)
         {
             len = 2 * tcp_mss(pcb);
         }
+        len = http_send_plan(pcb, len, hs->left > len);
 
-        err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs));
+        err = http_write_chunk(pcb, hs, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs) | HTTP_MORE_DATA(hs, len));
         if (err == ERR_OK)
         {
             data_to_send = 1;
@@ -1739,6 +2504,120 @@ static u8_t http_send_data_ssi(struct tcp_pcb * pcb, struct http_state * hs)
     }
     return data_to_send;
 }
+
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+/** Sub-function of http_send(): This is the send-routine for ssi files
+ * which come with the tag table generated by makefsdata.py. The data between
+ * the tags is sent in blocks as large as the send buffer allows and the SSI
+ * handler is only called at the tag offsets, nothing is scanned.
+ *
+ * @returns: - 1: data has been written (so call tcp_ouput)
+ *           - 0: no data has been written (no need to call tcp_output)
+ */
+static u8_t http_send_data_ssi_tags(struct tcp_pcb * pcb, struct http_state * hs)
+{
+    err_t        err = ERR_OK;
+    u16_t        len;
+    u8_t         data_to_send = 0;
+    const char * span_end;
+    size_t       name_len;
+
+    struct http_ssi_state * ssi = hs->ssi;
+    LWIP_ASSERT("ssi->next_tag != NULL", ssi->next_tag != NULL);
+
+    while (err == ERR_OK)
+    {
+        if (ssi->tag_state == TAG_SENDING)
+        {
+#if LWIP_HTTPD_SSI_MULTIPART
+            if ((ssi->tag_index >= ssi->tag_insert_len) && (ssi->tag_part != HTTPD_LAST_TAG_PART))
+            {
+                /* The last SSIHandler call has more to send */
+                ssi->tag_index = 0;
+                get_tag_insert(hs);
+            }
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+            if (ssi->tag_index >= ssi->tag_insert_len)
+            {
+                /* The insert has been sent, go on with the data after the tag */
+                ssi->tag_state = TAG_NONE;
+                ssi->next_tag++;
+                continue;
+            }
+            len = tcp_sndbuf(pcb);
+            if (len == 0)
+            {
+                break;
+            }
+            if (len > (ssi->tag_insert_len - ssi->tag_index))
+            {
+                len = (ssi->tag_insert_len - ssi->tag_index);
+            }
+            /* The insert buffer is reused by the next tag, so it is copied */
+            err = http_write_chunk(pcb, hs, &(ssi->tag_insert[ssi->tag_index]), &len,
+                                   HTTP_IS_TAG_VOLATILE(hs) | HTTP_MORE_DATA(hs, 0));
+            if (err == ERR_OK)
+            {
+                data_to_send = 1;
+                ssi->tag_index += len;
+            }
+            continue;
+        }
+
+        /* Send the file data up to the next tag (or the end of the file) */
+#if LWIP_HTTPD_SSI_INCLUDE_TAG
+        span_end = hs->handle->data + ssi->next_tag->end;
+#else  /* LWIP_HTTPD_SSI_INCLUDE_TAG */
+        span_end = hs->handle->data + ssi->next_tag->start;
+#endif /* LWIP_HTTPD_SSI_INCLUDE_TAG */
+        if (hs->file < span_end)
+        {
+            len = tcp_sndbuf(pcb);
+            if (len == 0)
+            {
+                break;
+            }
+            if (len > (span_end - hs->file))
+            {
+                len = (u16_t)(span_end - hs->file);
+            }
+            len = http_send_plan(pcb, len, hs->left > len);
+            err = http_write_chunk(pcb, hs, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs) | HTTP_MORE_DATA(hs, len));
+            if (err == ERR_OK)
+            {
+                data_to_send = 1;
+                hs->file += len;
+                hs->left -= len;
+            }
+            continue;
+        }
+        if (ssi->next_tag->name == NULL)
+        {
+            /* The end of the file, only the terminating entry has no name */
+            break;
+        }
+
+#if !LWIP_HTTPD_SSI_INCLUDE_TAG
+        /* pretend to have sent the tag */
+        hs->file += (ssi->next_tag->end - ssi->next_tag->start);
+        hs->left -= (u32_t)(ssi->next_tag->end - ssi->next_tag->start);
+#endif /* !LWIP_HTTPD_SSI_INCLUDE_TAG */
+
+        /* Call the client to ask for the insert string of the tag */
+        name_len = LWIP_MIN(strlen(ssi->next_tag->name), LWIP_HTTPD_MAX_TAG_NAME_LEN);
+        MEMCPY(ssi->tag_name, ssi->next_tag->name, name_len);
+        ssi->tag_name[name_len] = '\0';
+        ssi->tag_name_len       = (u8_t)name_len;
+#if LWIP_HTTPD_SSI_MULTIPART
+        ssi->tag_part = 0; /* start with tag part 0 */
+#endif                     /* LWIP_HTTPD_SSI_MULTIPART */
+        get_tag_insert(hs);
+        ssi->tag_index = 0;
+        ssi->tag_state = TAG_SENDING;
+    }
+    return data_to_send;
+}
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
 #endif /* LWIP_HTTPD_SSI */
 
 /**
@@ -1789,7 +2668,7 @@ static u8_t http_send(struct tcp_pcb * pcb, struct http_state * hs)
 
     /* Have we run out of file data to send? If so, we need to read the next
      * block from the file. */
-    if (hs->left == 0)
+    if ((hs->left == 0) && !HTTP_SSI_INSERT_PENDING(hs))
     {
         if (!http_check_eof(pcb, hs))
         {
@@ -1798,6 +2677,13 @@ static u8_t http_send(struct tcp_pcb * pcb, struct http_state * hs)
     }
 
 #if LWIP_HTTPD_SSI
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+    if (hs->ssi && hs->ssi->next_tag)
+    {
+        data_to_send = http_send_data_ssi_tags(pcb, hs);
+    }
+    else
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
     if (hs->ssi)
     {
         data_to_send = http_send_data_ssi(pcb, hs);
@@ -1808,7 +2694,7 @@ static u8_t http_send(struct tcp_pcb * pcb, struct http_state * hs)
         data_to_send = http_send_data_nonssi(pcb, hs);
     }
 
-    if ((hs->left == 0) && (fs_bytes_left(hs->handle) <= 0))
+    if ((hs->left == 0) && (fs_bytes_left(hs->handle) <= 0) && !HTTP_SSI_INSERT_PENDING(hs))
     {
         /* We reached the end of the file so this request is done.
          * This adds the FIN flag right into the last data segment. */
@@ -1820,164 +2706,678 @@ static u8_t http_send(struct tcp_pcb * pcb, struct http_state * hs)
     return data_to_send;
 }
 
-#if LWIP_HTTPD_SUPPORT_EXTSTATUS
-/** Initialize a http connection with a file to send for an error message
+#if LWIP_HTTPD_SUPPORT_GZIP
+/** Check whether the Accept-Encoding header of the request allows gzip
  *
- * @param hs http connection state
- * @param error_nr HTTP error number
- * @return ERR_OK if file was found and hs has been initialized correctly
- *         another err_t otherwise
+ * @param value the value of the Accept-Encoding header, NULL if absent
+ * @param value_len length of the value
+ * @return 1 if gzip is listed and not refused with "q=0", 0 otherwise
  */
-static err_t http_find_error_file(struct http_state * hs, u16_t error_nr)
+static u8_t http_accepts_gzip(const char * value, u16_t value_len)
 {
-    const char *uri1, *uri2, *uri3;
-    err_t       err;
+    const char * end;
 
-    if (error_nr == 501)
+    if (value == NULL)
     {
-        uri1 = "/501.html";
-        uri2 = "/501.htm";
-        uri3 = "/501.shtml";
+        return 0;
     }
-    else
+    end   = value + value_len;
+    value = strncasestr(value, "gzip", value_len);
+    if (value == NULL)
     {
-        /* 400 (bad request is the default) */
-        uri1 = "/400.html";
-        uri2 = "/400.htm";
-        uri3 = "/400.shtml";
+        return 0;
     }
-    err = fs_open(&hs->file_handle, uri1);
-    if (err != ERR_OK)
+
+    /* Look for the quality value of the coding: "gzip;q=0" refuses it */
+    value += 4;
+    while ((value < end) && (*value == ' '))
     {
-        err = fs_open(&hs->file_handle, uri2);
-        if (err != ERR_OK)
+        value++;
+    }
+    if ((value < end) && (*value == ';'))
+    {
+        value++;
+        while ((value < end) && (*value == ' '))
         {
-            err = fs_open(&hs->file_handle, uri3);
-            if (err != ERR_OK)
+            value++;
+        }
+        if (((end - value) >= 3) && !strncmp(value, "q=0", 3))
+        {
+            value += 3;
+            if ((value < end) && (*value == '.'))
             {
-                HTTPD_LOGI("Error page for error %" U16_F " not found", error_nr);
-                return ERR_ARG;
+                value++;
+                while ((value < end) && (*value == '0'))
+                {
+                    value++;
+                }
+            }
+            if ((value == end) || (*value == ',') || (*value == ' '))
+            {
+                return 0;
             }
         }
     }
-    return http_init_file(hs, &hs->file_handle, 0, NULL, 0);
+    return 1;
 }
-#else /* LWIP_HTTPD_SUPPORT_EXTSTATUS */
-#   define http_find_error_file(hs, error_nr) ERR_ARG
-#endif /* LWIP_HTTPD_SUPPORT_EXTSTATUS */
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
 
-/**
- * Get the file struct for a 404 error page.
- * Tries some file names and returns NULL if none found.
+#if LWIP_HTTPD_SUPPORT_ETAG
+/** Replace the file found for the request with its 304 response if the
+ * If-None-Match header lists the entity tag of the file.
  *
- * @param uri pointer that receives the actual file name URI
- * @return file struct for the error page or NULL no matching file was found
+ * @param hs http connection state with the file to send
+ * @param value the value of the If-None-Match header, NULL if absent
+ * @param value_len length of the value
+ * @return 1 if the 304 response is sent, 0 otherwise
  */
-static struct fs_file * http_get_404_file(struct http_state * hs, const char ** uri)
+static u8_t http_check_not_modified(struct http_state * hs, const char * value, u16_t value_len)
 {
-    err_t err;
+    const struct fsdata_etag * etag;
 
-    *uri = "/404.html";
-    err  = fs_open(&hs->file_handle, *uri);
-    if (err != ERR_OK)
+    if ((hs->handle == NULL) || (hs->handle->etag == NULL) || (value == NULL))
     {
-        /* 404.html doesn't exist. Try 404.htm instead. */
-        *uri = "/404.htm";
-        err  = fs_open(&hs->file_handle, *uri);
-        if (err != ERR_OK)
-        {
-            /* 404.htm doesn't exist either. Try 404.shtml instead. */
-            *uri = "/404.shtml";
-            err  = fs_open(&hs->file_handle, *uri);
-            if (err != ERR_OK)
-            {
-                /* 404.htm doesn't exist either. Try 404.shtml instead. */
-                *uri = "/error.html";
-                err  = fs_open(&hs->file_handle, *uri);
-                if (err != ERR_OK)
-                {
-                    /* 404.htm doesn't exist either. Indicate to the caller that it should
-                     * send back a default 404 page.
-                     */
-                    *uri = NULL;
-                    return NULL;
-                }
-            }
-        }
+        return 0;
     }
+    etag = hs->handle->etag;
 
-    return &hs->file_handle;
+    /* "*" matches any file, the list may carry weak tags (W/"...") as well */
+    if ((strnstr(value, "*", value_len) != NULL) || (strnstr(value, etag->etag, value_len) != NULL))
+    {
+        HTTPD_LOGI("Not modified: %s", etag->etag);
+        hs->file = (char *)etag->not_modified;
+        hs->left = etag->not_modified_len;
+        return 1;
+    }
+    return 0;
 }
+#endif /* LWIP_HTTPD_SUPPORT_ETAG */
 
-static struct fs_file * http_get_inet_or_redirect_file(struct http_state * hs, const char ** uri)
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** The Connection line to add to the headers of a response: none if the
+ * client assumes what happens anyway (a connection persists if the request
+ * and the response are HTTP/1.1, HTTP/1.0 closes it), HTTP_CONN_CLOSE_LINE
+ * or HTTP_CONN_KEEPALIVE_LINE otherwise.
+ *
+ * @param hs http connection state, keepalive decided
+ * @param version the protocol version of the request line
+ * @param status the status line of the response
+ * @return the line, "" for none
+ */
+static const char * http_connection_line(struct http_state * hs, const char * version, const char * status)
 {
-    static const char redirect[] =
-        "HTTP/1.0 302 Moved Temporarily\r\nContent-Length: 0\r\nLocation: http://www.home.com\r\n\r\n";
-    //    static const char no_content[] = "HTTP/1.0 204 No content\r\nAccess-Control-Allow-Origin: *\r\nContent-Length:
-    //    0\r\n\r\n"; static const char ncsi[]       = "HTTP/1.0 200 OK\r\nAccess-Control-Allow-Origin:
-    //    *\r\nContent-Type: text/plain\r\nContent-Length: 14\r\n\r\nMicrosoft NCSI"; static const char conntest[]   =
-    //    "HTTP/1.0 200 OK\r\nAccess-Control-Allow-Origin: *\r\nContent-Type: text/plain\r\nContent-Length:
-    //    22\r\n\r\nMicrosoft Connect Test";
+    u8_t is_11 = ((strncmp(version, "HTTP/1.1", 8) == 0) && (strncmp(status, "HTTP/1.1", 8) == 0)) ? 1 : 0;
 
-    struct fs_file *      result = NULL;
-    static struct fs_file file   = {0};
+    if (hs->keepalive == is_11)
+    {
+        return "";
+    }
+    return hs->keepalive ? HTTP_CONN_KEEPALIVE_LINE : HTTP_CONN_CLOSE_LINE;
+}
+#else  /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#define http_connection_line(hs, version, status) ""
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 
-    //    LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("InetRedirect\n", uri));
+#if LWIP_HTTPD_SUPPORT_RANGE
+#if !LWIP_HTTPD_SUPPORT_ETAG
+#    error "LWIP_HTTPD_SUPPORT_RANGE needs the entity tags of LWIP_HTTPD_SUPPORT_ETAG"
+#endif
+#define HTTP_RANGE_UNIT            "bytes="
+#define HTTP_RANGE_NOT_SATISFIABLE "HTTP/1.1 416 Range Not Satisfiable\r\n"
 
-    if ((NULL != strstr(*uri, "generate_204")) || (NULL != strstr(*uri, "gen_204")))
+/** Strip the whitespace ending a header value
+ *
+ * @param value the value of the header
+ * @param len length of the value
+ * @return the end of the value
+ */
+static const char * http_value_end(const char * value, u16_t len)
+{
+    const char * end = value + len;
+    while ((end > value) && ((end[-1] == ' ') || (end[-1] == '\t')))
     {
-        file.data = redirect;                // no_content;
-        file.len  = (sizeof(redirect) - 1);  // no_content) - 1);
-        result    = &file;
+        end--;
     }
-    else if (NULL != strstr(*uri, "ncsi.txt"))
+    return end;
+}
+
+/** Parse the decimal number of a byte range, saturating beyond any file size
+ *
+ * @param p the first character of the number
+ * @param end the end of the header value
+ * @param n receives the number, 0 if there are no digits
+ * @return the character following the digits
+ */
+static const char * http_range_number(const char * p, const char * end, u32_t * n)
+{
+    *n = 0;
+    while ((p < end) && (*p >= '0') && (*p <= '9'))
     {
-        file.data = redirect;                // ncsi;
-        file.len  = (sizeof(redirect) - 1);  // ncsi) - 1);
-        result    = &file;
+        *n = (*n < 100000000) ? (*n * 10 + (u32_t)(*p - '0')) : 0xFFFFFFFF;
+        p++;
     }
-    else if (NULL != strstr(*uri, "connecttest.txt"))
+    return p;
+}
+
+/** Replace the file found for the request with the byte range it asks for.
+ *
+ * A single range of the current entity is answered with 206 Partial
+ * Content: the precomputed headers of the file are queued from ROM, the
+ * Content-Range and Content-Length follow, and hs->file and hs->left are
+ * set to the range in the file data. A range beyond the end of the file
+ * is answered with 416. Several ranges, a malformed header or an If-Range
+ * that does not name the entity tag of the file get the whole file.
+ *
+ * @param hs http connection state with the file to send
+ * @param pcb the tcp_pcb which received the request
+ * @param range the value of the Range header, NULL if absent
+ * @param range_len length of the value
+ * @param if_range the value of the If-Range header, NULL if absent
+ * @param if_range_len length of the value
+ * @param version the protocol version of the request line
+ * @return ERR_OK unless the headers could only be queued in part
+ */
+static err_t http_check_range(struct http_state * hs, struct tcp_pcb * pcb, const char * range, u16_t range_len,
+                              const char * if_range, u16_t if_range_len, const char * version)
+{
+    const struct fsdata_etag * etag;
+    const char *               end;
+    const char *               p;
+    const char *               q;
+    u32_t                      total;
+    u32_t                      first;
+    u32_t                      last;
+    u8_t                       has_first;
+    u8_t                       has_last;
+    u16_t                      skip = 0;
+    const char *               conn_line;
+    char                       tail[128];
+    int                        tail_len;
+    err_t                      err  = ERR_OK;
+
+    if ((range == NULL) || (hs->handle == NULL) || (hs->handle->etag == NULL) || LWIP_HTTPD_IS_SSI(hs))
     {
-        file.data = redirect;                // conntest;
-        file.len  = (sizeof(redirect) - 1);  // conntest) - 1);
-        result    = &file;
+        return ERR_OK;
     }
-    else if (NULL != strstr(*uri, "redirect"))
+    etag = hs->handle->etag;
+
+    /* If-Range: a date never matches, the validator is the entity tag */
+    if (if_range != NULL)
     {
-        /* We have been asked for the default root file */
-        /* Try each of the configured default filenames until we find one
-           that exists. */
-        for (size_t loop = 0; loop < g_psDefaultFilenames.count; loop++)
+        end = http_value_end(if_range, if_range_len);
+        if (((size_t)(end - if_range) != strlen(etag->etag)) || (strncmp(if_range, etag->etag, end - if_range) != 0))
         {
-            HTTPD_LOGI("Looking for %s...", g_psDefaultFilenames.names[loop].name);
-            err_t err = fs_open(&hs->file_handle, (char *)g_psDefaultFilenames.names[loop].name);
-            *uri = (char *)g_psDefaultFilenames.names[loop].name;
-            if (err == ERR_OK)
-            {
-                result = &hs->file_handle;
-                HTTPD_LOGI("Opened");
-                break;
-            }
+            return ERR_OK;
         }
-        //*uri      = "/index.html";
-        //err_t err = fs_open(&hs->file_handle, *uri);
-        //if (err == ERR_OK)
-        //{
-        //    result = &hs->file_handle;
-        //}
     }
 
-    if (NULL != result)
+    /* bytes=first-[last] or bytes=-suffix */
+    end = http_value_end(range, range_len);
+    if (((end - range) < (int)(sizeof(HTTP_RANGE_UNIT) - 1)) ||
+        (strncmp(range, HTTP_RANGE_UNIT, sizeof(HTTP_RANGE_UNIT) - 1) != 0))
     {
-        file.index                = file.len;
-        file.pextension           = NULL;
-        file.http_header_included = 1;
-#if HTTPD_PRECALCULATED_CHECKSUM
-        file->chksum_count = f->chksum_count;
-        file->chksum       = f->chksum;
-#endif /* HTTPD_PRECALCULATED_CHECKSUM */
-#if LWIP_HTTPD_FILE_STATE
-        file->state = fs_state_init(file, name);
+        return ERR_OK;
+    }
+    p         = range + sizeof(HTTP_RANGE_UNIT) - 1;
+    q         = http_range_number(p, end, &first);
+    has_first = (q != p);
+    if ((q == end) || (*q != '-'))
+    {
+        return ERR_OK;
+    }
+    p        = q + 1;
+    q        = http_range_number(p, end, &last);
+    has_last = (q != p);
+    if ((q != end) || (!has_first && !has_last) || (has_first && has_last && (last < first)))
+    {
+        return ERR_OK;
+    }
+
+    total = (u32_t)(hs->handle->len - etag->body);
+    if (!has_first)
+    {
+        /* The last bytes of the file */
+        first = ((last == 0) || (total == 0)) ? total : ((last < total) ? (total - last) : 0);
+        last  = total - 1;
+    }
+    else if (!has_last || (last >= total))
+    {
+        last = total - 1;
+    }
+
+    conn_line = http_connection_line(hs, version, (const char *)etag->partial);
+    if (first >= total)
+    {
+        /* The status line of the 206 headers is replaced */
+        skip     = (u16_t)(strnstr((const char *)etag->partial, CRLF, etag->partial_len) + 2 - (const char *)etag->partial);
+        tail_len = snprintf(tail, sizeof(tail), "Content-Range: bytes */%u" CRLF "Content-Length: 0" CRLF "%s" CRLF,
+                            (unsigned int)total, conn_line);
+    }
+    else
+    {
+        tail_len = snprintf(tail, sizeof(tail),
+                            "Content-Range: bytes %u-%u/%u" CRLF "Content-Length: %u" CRLF "%s" CRLF,
+                            (unsigned int)first, (unsigned int)last, (unsigned int)total,
+                            (unsigned int)(last - first + 1), conn_line);
+    }
+
+    /* Queue the headers at once or not at all: the 200 response needs no room now */
+    if ((tcp_sndbuf(pcb) < (sizeof(HTTP_RANGE_NOT_SATISFIABLE) - 1 + etag->partial_len + tail_len)) ||
+        ((tcp_sndqueuelen(pcb) + 4) > TCP_SND_QUEUELEN))
+    {
+        HTTPD_LOGI("No room for the range headers, sending the whole file");
+        return ERR_OK;
+    }
+    if (skip != 0)
+    {
+        err = tcp_write(pcb, HTTP_RANGE_NOT_SATISFIABLE, sizeof(HTTP_RANGE_NOT_SATISFIABLE) - 1,
+                        TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+    }
+    if (err == ERR_OK)
+    {
+        err = tcp_write(pcb, etag->partial + skip, etag->partial_len - skip, TCP_WRITE_FLAG_MORE);
+    }
+    if (err == ERR_OK)
+    {
+        err = tcp_write(pcb, tail, tail_len, TCP_WRITE_FLAG_COPY | ((skip == 0) ? TCP_WRITE_FLAG_MORE : 0));
+    }
+    if (err != ERR_OK)
+    {
+        HTTPD_LOGE("Range headers not sent: %d", err);
+        return ERR_MEM;
+    }
+
+    if (skip != 0)
+    {
+        HTTPD_LOGI("Range not satisfiable: %u bytes", (unsigned int)total);
+        hs->file = NULL;
+        hs->left = 0;
+    }
+    else
+    {
+        HTTPD_LOGI("Range %u-%u/%u", (unsigned int)first, (unsigned int)last, (unsigned int)total);
+        hs->file = (char *)hs->handle->data + etag->body + first;
+        hs->left = last - first + 1;
+    }
+    return ERR_OK;
+}
+#endif /* LWIP_HTTPD_SUPPORT_RANGE */
+
+#if LWIP_HTTPD_SUPPORT_CHUNKED
+/** Send the SSI file found for an HTTP/1.1 request in chunks, so that the
+ * connection persists. This needs the last header line of the file to be
+ * "Connection: close", http_write_chunk() replaces it. Other SSI files close
+ * the connection after the response as before.
+ *
+ * @param hs http connection state with the file to send
+ */
+static void http_start_chunked(struct http_state * hs)
+{
+    const char * end;
+    u16_t        keep;
+
+    if (!LWIP_HTTPD_IS_SSI(hs) || (hs->handle == NULL) || !hs->handle->http_header_included)
+    {
+        return;
+    }
+    end = strnstr(hs->file, CRLF CRLF, hs->left);
+    if (end == NULL)
+    {
+        return;
+    }
+    keep = (u16_t)(end + 2 - hs->file);
+    if ((keep < sizeof(HTTP_CONN_CLOSE_LINE) - 1) ||
+        (strncmp(end + 2 - (sizeof(HTTP_CONN_CLOSE_LINE) - 1), HTTP_CONN_CLOSE_LINE,
+                 sizeof(HTTP_CONN_CLOSE_LINE) - 1) != 0))
+    {
+        return;
+    }
+    hs->chunked    = HTTP_CHUNK_HEADERS;
+    hs->chunk_left = keep - (sizeof(HTTP_CONN_CLOSE_LINE) - 1);
+}
+#endif /* LWIP_HTTPD_SUPPORT_CHUNKED */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Decide whether the connection persists after the response: HTTP/1.1
+ * connections do unless the client sends "Connection: close", HTTP/1.0 ones
+ * only if it sends "Connection: keep-alive".
+ *
+ * @param version the protocol version of the request line
+ * @param value the value of the Connection header, NULL if absent
+ * @param value_len length of the value
+ * @return 1 if the connection is kept open, 0 otherwise
+ */
+static u8_t http_is_keepalive(const char * version, const char * value, u16_t value_len)
+{
+    if (value != NULL)
+    {
+        if (strncasestr(value, "close", value_len) != NULL)
+        {
+            return 0;
+        }
+        if (strncasestr(value, "keep-alive", value_len) != NULL)
+        {
+            return 1;
+        }
+    }
+    return (strncmp(version, "HTTP/1.1", 8) == 0) ? 1 : 0;
+}
+
+/** Add the Connection line to the headers of a static file or its 304
+ * response. The headers are queued from ROM up to their empty line, the
+ * line and the empty line follow, and hs->file continues with the body.
+ * Like the range headers, they are queued at once or the line is left out.
+ * SSI files carry their own line, range responses get it with the range
+ * headers.
+ *
+ * @param hs http connection state with the file to send
+ * @param pcb the tcp_pcb which received the request
+ * @param version the protocol version of the request line
+ * @return ERR_OK unless the headers could only be queued in part
+ */
+static err_t http_write_connection(struct http_state * hs, struct tcp_pcb * pcb, const char * version)
+{
+    const char * line;
+    const char * end;
+    u16_t        len;
+    u16_t        line_len;
+    err_t        err;
+
+    if ((hs->handle == NULL) || !hs->handle->http_header_included || LWIP_HTTPD_IS_SSI(hs))
+    {
+        return ERR_OK;
+    }
+    /* Not the headers any more if a range of the file is sent */
+    if ((hs->file != (const char *)hs->handle->data)
+#if LWIP_HTTPD_SUPPORT_ETAG
+        && ((hs->handle->etag == NULL) || (hs->file != (const char *)hs->handle->etag->not_modified))
+#endif /* LWIP_HTTPD_SUPPORT_ETAG */
+    )
+    {
+        return ERR_OK;
+    }
+    line     = http_connection_line(hs, version, hs->file);
+    line_len = (u16_t)strlen(line);
+    end      = strnstr(hs->file, CRLF CRLF, hs->left);
+    if ((line_len == 0) || (end == NULL))
+    {
+        return ERR_OK;
+    }
+    len = (u16_t)(end + 2 - hs->file);
+
+    if ((tcp_sndbuf(pcb) < (len + line_len + 2)) || ((tcp_sndqueuelen(pcb) + 4) > TCP_SND_QUEUELEN))
+    {
+        HTTPD_LOGI("No room for the headers, sending them without the Connection line");
+        return ERR_OK;
+    }
+    err = tcp_write(pcb, hs->file, len, TCP_WRITE_FLAG_MORE);
+    if (err == ERR_OK)
+    {
+        /* The line and the empty line, CRLF CRLF ends the headers in ROM */
+        err = tcp_write(pcb, line, line_len, TCP_WRITE_FLAG_MORE);
+    }
+    if (err == ERR_OK)
+    {
+        err = tcp_write(pcb, end + 2, 2, (hs->left > (u32_t)len + 2) ? TCP_WRITE_FLAG_MORE : 0);
+    }
+    if (err != ERR_OK)
+    {
+        HTTPD_LOGE("Headers not sent: %d", err);
+        return ERR_MEM;
+    }
+    hs->file += len + 2;
+    hs->left -= len + 2;
+    return ERR_OK;
+}
+
+/** Keep the data following the parsed request for the next request.
+ * The received pbufs are kept as they are, http_eof() drops the parsed
+ * request from them, so a segment of many requests is never copied.
+ *
+ * @param hs http connection state
+ * @param p the received request
+ * @param offset length of the parsed request
+ */
+static void http_keep_pipelined(struct http_state * hs, struct pbuf * p, u16_t offset)
+{
+    if (p->tot_len <= offset)
+    {
+        return;
+    }
+    LWIP_ASSERT("pipelined data already kept", hs->pipelined == NULL);
+    pbuf_ref(p);
+    hs->pipelined     = p;
+    hs->pipelined_off = offset;
+}
+
+/** Drop the first bytes of a pbuf chain, like pbuf_free_header() of lwIP 2.1
+ *
+ * @param p the pbuf chain, not referenced elsewhere
+ * @param size number of bytes to drop
+ * @return the rest of the chain
+ */
+static struct pbuf * http_pbuf_free_header(struct pbuf * p, u16_t size)
+{
+    struct pbuf * next;
+
+    while ((p != NULL) && (size >= p->len) && (size != 0))
+    {
+        size    = (u16_t)(size - p->len);
+        next    = p->next;
+        p->next = NULL;
+        pbuf_free(p);
+        p = next;
+    }
+    if ((p != NULL) && (size != 0))
+    {
+        pbuf_header(p, -(s16_t)size);
+    }
+    return p;
+}
+
+/** Queue data received while a response is still being sent, http_eof()
+ * serves it. It is not taken from the receive window before, so a client
+ * that pipelines without reading the responses is held back by TCP.
+ *
+ * @param hs http connection state
+ * @param p the received data
+ * @return ERR_OK if queued, ERR_MEM if the queue is full (lwIP passes p again later)
+ */
+static err_t http_queue_pipelined(struct http_state * hs, struct pbuf * p)
+{
+    if (hs->pipelined == NULL)
+    {
+        hs->pipelined = p;
+    }
+    else if ((pbuf_clen(hs->pipelined) + pbuf_clen(p)) > LWIP_HTTPD_PIPELINE_QUEUELEN)
+    {
+        HTTPD_LOGI("Recv: pipelined queue full");
+        return ERR_MEM;
+    }
+    else
+    {
+        pbuf_cat(hs->pipelined, p);
+    }
+    hs->pipelined_wnd += p->tot_len;
+    return ERR_OK;
+}
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+/** Open a file, choosing its encoding from the request of the connection
+ *
+ * @param hs http connection state
+ * @param uri name of the file to open
+ * @return ERR_OK if the file was found, another err_t otherwise
+ */
+static err_t http_fs_open(struct http_state * hs, const char * uri)
+{
+#if LWIP_HTTPD_SUPPORT_GZIP
+    if (hs->accept_gzip)
+    {
+        return fs_open_gzip(&hs->file_handle, uri);
+    }
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+    return fs_open(&hs->file_handle, uri);
+}
+
+#if LWIP_HTTPD_SUPPORT_EXTSTATUS
+/** Initialize a http connection with a file to send for an error message
+ *
+ * @param hs http connection state
+ * @param error_nr HTTP error number
+ * @return ERR_OK if file was found and hs has been initialized correctly
+ *         another err_t otherwise
+ */
+static err_t http_find_error_file(struct http_state * hs, u16_t error_nr)
+{
+    const char *uri1, *uri2, *uri3;
+    err_t       err;
+
+    if (error_nr == 501)
+    {
+        uri1 = "/501.html";
+        uri2 = "/501.htm";
+        uri3 = "/501.shtml";
+    }
+    else
+    {
+        /* 400 (bad request is the default) */
+        uri1 = "/400.html";
+        uri2 = "/400.htm";
+        uri3 = "/400.shtml";
+    }
+    err = http_fs_open(hs, uri1);
+    if (err != ERR_OK)
+    {
+        err = http_fs_open(hs, uri2);
+        if (err != ERR_OK)
+        {
+            err = http_fs_open(hs, uri3);
+            if (err != ERR_OK)
+            {
+                HTTPD_LOGI("Error page for error %" U16_F " not found", error_nr);
+                return ERR_ARG;
+            }
+        }
+    }
+    return http_init_file(hs, &hs->file_handle, 0, NULL, 0);
+}
+#else /* LWIP_HTTPD_SUPPORT_EXTSTATUS */
+#   define http_find_error_file(hs, error_nr) ERR_ARG
+#endif /* LWIP_HTTPD_SUPPORT_EXTSTATUS */
+
+/**
+ * Get the file struct for a 404 error page.
+ * Tries some file names and returns NULL if none found.
+ *
+ * @param uri pointer that receives the actual file name URI
+ * @return file struct for the error page or NULL no matching file was found
+ */
+static struct fs_file * http_get_404_file(struct http_state * hs, const char ** uri)
+{
+    err_t err;
+
+    *uri = "/404.html";
+    err  = http_fs_open(hs, *uri);
+    if (err != ERR_OK)
+    {
+        /* 404.html doesn't exist. Try 404.htm instead. */
+        *uri = "/404.htm";
+        err  = http_fs_open(hs, *uri);
+        if (err != ERR_OK)
+        {
+            /* 404.htm doesn't exist either. Try 404.shtml instead. */
+            *uri = "/404.shtml";
+            err  = http_fs_open(hs, *uri);
+            if (err != ERR_OK)
+            {
+                /* 404.htm doesn't exist either. Try 404.shtml instead. */
+                *uri = "/error.html";
+                err  = http_fs_open(hs, *uri);
+                if (err != ERR_OK)
+                {
+                    /* 404.htm doesn't exist either. Indicate to the caller that it should
+                     * send back a default 404 page.
+                     */
+                    *uri = NULL;
+                    return NULL;
+                }
+            }
+        }
+    }
+
+    return &hs->file_handle;
+}
+
+static struct fs_file * http_get_inet_or_redirect_file(struct http_state * hs, const char ** uri)
+{
+    static const char redirect[] =
+        "HTTP/1.0 302 Moved Temporarily\r\nContent-Length: 0\r\nLocation: http://www.home.com\r\n\r\n";
+    //    static const char no_content[] = "HTTP/1.0 204 No content\r\nAccess-Control-Allow-Origin: *\r\nContent-Length:
+    //    0\r\n\r\n"; static const char ncsi[]       = "HTTP/1.0 200 OK\r\nAccess-Control-Allow-Origin:
+    //    *\r\nContent-Type: text/plain\r\nContent-Length: 14\r\n\r\nMicrosoft NCSI"; static const char conntest[]   =
+    //    "HTTP/1.0 200 OK\r\nAccess-Control-Allow-Origin: *\r\nContent-Type: text/plain\r\nContent-Length:
+    //    22\r\n\r\nMicrosoft Connect Test";
+
+    struct fs_file *      result = NULL;
+    static struct fs_file file   = {0};
+
+    //    LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("InetRedirect\n", uri));
+
+    if ((NULL != strstr(*uri, "generate_204")) || (NULL != strstr(*uri, "gen_204")))
+    {
+        file.data = redirect;                // no_content;
+        file.len  = (sizeof(redirect) - 1);  // no_content) - 1);
+        result    = &file;
+    }
+    else if (NULL != strstr(*uri, "ncsi.txt"))
+    {
+        file.data = redirect;                // ncsi;
+        file.len  = (sizeof(redirect) - 1);  // ncsi) - 1);
+        result    = &file;
+    }
+    else if (NULL != strstr(*uri, "connecttest.txt"))
+    {
+        file.data = redirect;                // conntest;
+        file.len  = (sizeof(redirect) - 1);  // conntest) - 1);
+        result    = &file;
+    }
+    else if (NULL != strstr(*uri, "redirect"))
+    {
+        /* We have been asked for the default root file */
+        /* Try each of the configured default filenames until we find one
+           that exists. */
+        for (size_t loop = 0; loop < g_psDefaultFilenames.count; loop++)
+        {
+            HTTPD_LOGI("Looking for %s...", g_psDefaultFilenames.names[loop].name);
+            err_t err = http_fs_open(hs, (char *)g_psDefaultFilenames.names[loop].name);
+            *uri = (char *)g_psDefaultFilenames.names[loop].name;
+            if (err == ERR_OK)
+            {
+                result = &hs->file_handle;
+                HTTPD_LOGI("Opened");
+                break;
+            }
+        }
+        //*uri      = "/index.html";
+        //err_t err = fs_open(&hs->file_handle, *uri);
+        //if (err == ERR_OK)
+        //{
+        //    result = &hs->file_handle;
+        //}
+    }
+
+    if (NULL != result)
+    {
+        file.index                = file.len;
+        file.pextension           = NULL;
+        file.http_header_included = 1;
+#if HTTPD_PRECALCULATED_CHECKSUM
+        file->chksum_count = f->chksum_count;
+        file->chksum       = f->chksum;
+#endif /* HTTPD_PRECALCULATED_CHECKSUM */
+#if LWIP_HTTPD_FILE_STATE
+        file->state = fs_state_init(file, name);
 #endif /* #if LWIP_HTTPD_FILE_STATE */
     }
 
@@ -2225,10 +3625,179 @@ static void http_continue(void * connection)
 }
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
 
+/** Header names recorded by the request parser, in enum http_req_hdr order */
+static const char * const http_req_hdr_names[HTTP_NUM_REQ_HDRS] = {
+    HTTP_CONNECTION, HTTP_ACCEPT_ENCODING, HTTP_IF_NONE_MATCH, HTTP_UPGRADE, HTTP_WS_KEY, HTTP_RANGE, HTTP_IF_RANGE};
+
+/** Examine the next bytes of a request: find the spaces of the request line,
+ * the end of each line and the values of the headers in http_req_hdr_names.
+ * Stops after the empty line ending the headers.
+ *
+ * @param rp parser state of the request
+ * @param data the next bytes of the request
+ * @param len number of bytes in data
+ */
+static void http_parse_bytes(struct http_req_parse * rp, const char * data, u16_t len)
+{
+    u16_t i;
+
+    for (i = 0; (i < len) && (rp->hdr_end == 0); i++)
+    {
+        char  c   = data[i];
+        u16_t off = rp->scanned + i;
+
+        if ((c == '\n') && (rp->last == '\r'))
+        {
+            if (rp->line_end == 0)
+            {
+                rp->line_end = off - 1;
+            }
+            else if (rp->line_start == off - 1)
+            {
+                rp->hdr_end = off + 1;
+            }
+            else if ((rp->current != 0) && (rp->value[rp->current - 1] != 0))
+            {
+                rp->value_len[rp->current - 1] = off - 1 - rp->value[rp->current - 1];
+            }
+            rp->line_start = off + 1;
+            rp->candidates = (1 << HTTP_NUM_REQ_HDRS) - 1;
+            rp->name_pos   = 0;
+            rp->current    = 0;
+        }
+        else if (rp->line_end == 0)
+        {
+            /* Request line: method SP URI [SP version] */
+            if (c == ' ')
+            {
+                if (rp->method_end == 0)
+                {
+                    rp->method_end = off;
+                }
+                else if (rp->uri_end == 0)
+                {
+                    rp->uri_end = off;
+                }
+            }
+        }
+        else if (rp->candidates != 0)
+        {
+            /* Header name, compared with the recorded ones as it arrives */
+            u8_t hdr;
+            for (hdr = 0; hdr < HTTP_NUM_REQ_HDRS; hdr++)
+            {
+                if ((rp->candidates & (1 << hdr)) == 0)
+                {
+                    continue;
+                }
+                if (tolower((unsigned char)c) != tolower((unsigned char)http_req_hdr_names[hdr][rp->name_pos]))
+                {
+                    rp->candidates &= ~(1 << hdr);
+                }
+                else if (c == ':')
+                {
+                    rp->candidates = 0;
+                    if ((rp->found & (1 << hdr)) == 0)
+                    {
+                        /* The first one counts if a header is repeated */
+                        rp->found |= 1 << hdr;
+                        rp->current = hdr + 1;
+                    }
+                }
+            }
+            rp->name_pos++;
+        }
+        else if ((rp->current != 0) && (rp->value[rp->current - 1] == 0) && (c != ' ') && (c != '\t') &&
+                 (c != '\r'))
+        {
+            rp->value[rp->current - 1] = off;
+        }
+        rp->last = c;
+    }
+    rp->scanned += i;
+}
+
+/** Value of a request header recorded by the parser
+ *
+ * @param hs the connection state
+ * @param data the request
+ * @param hdr the header, from enum http_req_hdr
+ * @param len receives the length of the value
+ * @return the value (not null-terminated), NULL if the header is absent
+ */
+static const char * http_req_value(struct http_state * hs, const char * data, u8_t hdr, u16_t * len)
+{
+    *len = hs->parse.value_len[hdr];
+    return (hs->parse.value[hdr] != 0) ? &data[hs->parse.value[hdr]] : NULL;
+}
+
+/** Answer the WebSocket opening handshake of a request
+ *
+ * @param hs the connection state, is_websocket is set on success
+ * @param pcb the tcp_pcb which received the request
+ * @param key the value of the Sec-WebSocket-Key header
+ * @param key_len length of the key
+ * @return ERR_OK unless the key is too long or out of memory
+ */
+static err_t http_websocket_handshake(struct http_state * hs, struct tcp_pcb * pcb, const char * key_start,
+                                      u16_t key_len)
+{
+    char key[64];
+    int  len = key_len;
+
+    HTTPD_LOGI("WebSocket opening handshake");
+    if ((len + sizeof(WS_GUID) < sizeof(key)) && (len > 0))
+    {
+        /* Allocate response buffer */
+        unsigned char * retval = mem_malloc(WS_RSP_LEN);
+        if (retval == NULL)
+        {
+            HTTPD_LOGI("Out of memory");
+            return ERR_MEM;
+        }
+        unsigned char * retval_ptr;
+        retval_ptr = memcpy(retval, WS_RSP, sizeof(WS_RSP) - 1);
+        retval_ptr += sizeof(WS_RSP) - 1;
+
+        /* Concatenate key */
+        memcpy(key, key_start, len);
+        strlcpy(&key[len], WS_GUID, sizeof(key));
+        HTTPD_LOGI("Resulting key: %s", key);
+
+        /* Get SHA1 */
+        int           sha_len = sizeof(WS_GUID) - 1 + len;
+        unsigned char sha1sum[20];
+        mbedtls_sha1((unsigned char *)key, sha_len, sha1sum);
+
+        /* Base64 encode */
+        unsigned int olen = WS_BASE64_LEN;
+        int          ok   = mbedtls_base64_encode(retval_ptr, WS_BASE64_LEN, &olen, sha1sum, 20);
+
+        if (ok == 0)
+        {
+            HTTPD_LOGI("Base64 encoded: %s", retval_ptr);
+
+            /* Send response */
+            memcpy(&retval_ptr[olen], CRLF CRLF, sizeof(CRLF CRLF));
+            HTTPD_LOGI("Sending: %s", retval);
+            tcp_write(pcb, retval, WS_RSP_LEN - 1, 0);
+            hs->is_websocket = 1;
+        }
+        mem_free(retval);
+        return ERR_OK;
+    }
+    HTTPD_LOGI("Key overflow");
+    return ERR_MEM;
+}
+
 /**
  * When data has been received in the correct state, try to parse it
  * as a HTTP request.
  *
+ * The received bytes are examined once: the parser state in hs->parse
+ * resumes with each new pbuf until the end of the headers, the request is
+ * copied into one buffer only when it is complete and spans several pbufs.
+ *
  * @param p the received pbuf
  * @param hs the connection state
  * @param pcb the tcp_pcb which received this packet
@@ -2238,16 +3807,20 @@ static void http_continue(void * connection)
  */
 static err_t http_parse_request(struct pbuf ** inp, struct http_state * hs, struct tcp_pcb * pcb)
 {
-    char *        data;
-    char *        crlf;
-    u16_t         data_len;
-    struct pbuf * p = *inp;
-#if LWIP_HTTPD_SUPPORT_REQUESTLIST
-    u16_t clen;
-#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    char *                  data;
+    struct pbuf *           p  = *inp;
+    struct http_req_parse * rp = &hs->parse;
+    struct pbuf *           q;
+    const char *            value;
+    u16_t                   value_len;
 #if LWIP_HTTPD_SUPPORT_POST
+    int   is_post = 0;
     err_t err;
 #endif /* LWIP_HTTPD_SUPPORT_POST */
+    int    is_09 = 0;
+    char * sp1;
+    char * sp2;
+    char * uri;
 
     LWIP_UNUSED_ARG(pcb); /* only used for post */
     LWIP_ASSERT("p != NULL", p != NULL);
@@ -2265,8 +3838,6 @@ static err_t http_parse_request(struct pbuf ** inp, struct http_state * hs, stru
 
     HTTPD_LOGI("Received %" U16_F " bytes", p->tot_len);
 
-    /* first check allowed characters in this pbuf? */
-
     /* enqueue the pbuf */
     if (hs->req == NULL)
     {
@@ -2278,227 +3849,220 @@ static err_t http_parse_request(struct pbuf ** inp, struct http_state * hs, stru
         HTTPD_LOGI("The pbuf enqueued");
         pbuf_cat(hs->req, p);
     }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
 
-    if (hs->req->next != NULL)
+    /* Only the new bytes are examined */
+    for (q = p; (q != NULL) && (rp->hdr_end == 0); q = q->next)
     {
-        data_len = LWIP_MIN(hs->req->tot_len, LWIP_HTTPD_MAX_REQ_LENGTH);
-        pbuf_copy_partial(hs->req, httpd_req_buf, data_len, 0);
-        data = httpd_req_buf;
+        http_parse_bytes(rp, (const char *)q->payload, q->len);
     }
-    else
-#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+
+    if (rp->hdr_end == 0)
     {
-        data     = (char *)p->payload;
-        data_len = p->len;
-        if (p->len != p->tot_len)
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+        if ((hs->req->tot_len <= LWIP_HTTPD_REQ_BUFSIZE) && (pbuf_clen(hs->req) <= LWIP_HTTPD_REQ_QUEUELEN))
         {
-            HTTPD_LOGE("Warning: incomplete header due to chained pbufs");
+            /* request not fully received (CRLFCRLF is missing) */
+            return ERR_INPROGRESS;
         }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+        goto badrequest;
     }
 
-    /* Parse WebSocket request */
-    hs->is_websocket = 0;
-    if (strncasestr(data, WS_HEADER, data_len))
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (hs->req->len < rp->hdr_end)
     {
-        HTTPD_LOGI("WebSocket opening handshake");
-        char * key_start = strncasestr(data, WS_KEY, data_len);
-        if (key_start)
-        {
-            key_start += sizeof(WS_KEY) - 1;
-            char * key_end = strnstr(key_start, CRLF, data_len);
-            if (key_end)
-            {
-                char key[64];
-                int  len = sizeof(char) * (key_end - key_start);
-                if ((len + sizeof(WS_GUID) < sizeof(key)) && (len > 0))
-                {
-                    /* Allocate response buffer */
-                    unsigned char * retval = mem_malloc(WS_RSP_LEN);
-                    if (retval == NULL)
-                    {
-                        HTTPD_LOGI("Out of memory");
-                        return ERR_MEM;
-                    }
-                    unsigned char * retval_ptr;
-                    retval_ptr = memcpy(retval, WS_RSP, sizeof(WS_RSP) - 1);
-                    retval_ptr += sizeof(WS_RSP) - 1;
-
-                    /* Concatenate key */
-                    memcpy(key, key_start, len);
-                    strlcpy(&key[len], WS_GUID, sizeof(key));
-                    HTTPD_LOGI("Resulting key: %s", key);
-
-                    /* Get SHA1 */
-                    int           key_len = sizeof(WS_GUID) - 1 + len;
-                    unsigned char sha1sum[20];
-                    mbedtls_sha1((unsigned char *)key, key_len, sha1sum);
-
-                    /* Base64 encode */
-                    unsigned int olen = WS_BASE64_LEN;
-                    int          ok   = mbedtls_base64_encode(retval_ptr, WS_BASE64_LEN, &olen, sha1sum, 20);
-
-                    if (ok == 0)
-                    {
-                        HTTPD_LOGI("Base64 encoded: %s", retval_ptr);
-
-                        /* Send response */
-                        memcpy(&retval_ptr[olen], CRLF CRLF, sizeof(CRLF CRLF));
-                        HTTPD_LOGI("Sending: %s", retval);
-                        tcp_write(pcb, retval, WS_RSP_LEN - 1, 0);
-                        hs->is_websocket = 1;
-                    }
-                    mem_free(retval);
-                }
-                else
-                {
-                    HTTPD_LOGI("Key overflow");
-                    return ERR_MEM;
-                }
-            }
-        }
-        else
+        if (rp->hdr_end > LWIP_HTTPD_MAX_REQ_LENGTH)
         {
-            HTTPD_LOGE("Error: malformed packet");
-            return ERR_ARG;
+            HTTPD_LOGI("Request too long");
+            goto badrequest;
         }
+        pbuf_copy_partial(hs->req, httpd_req_buf, rp->hdr_end, 0);
+        data = httpd_req_buf;
     }
+    else
+    {
+        data = (char *)hs->req->payload;
+    }
+#else  /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    if (p->len < rp->hdr_end)
+    {
+        HTTPD_LOGE("Warning: incomplete header due to chained pbufs");
+        goto badrequest;
+    }
+    data = (char *)p->payload;
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
 
-    /* received enough data for minimal request? */
-    if (data_len >= MIN_REQ_LEN)
+    /* parse method */
+    if ((rp->method_end == 3) && !strncmp(data, "GET", 3))
     {
-        /* wait for CRLF before parsing anything */
-        crlf = strnstr(data, CRLF, data_len);
-        if (crlf != NULL)
-        {
+        /* received GET request */
+        rp->method = HTTPD_METHOD_GET;
+        HTTPD_LOGI("Received GET request");
 #if LWIP_HTTPD_SUPPORT_POST
-            int is_post = 0;
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-            int   is_09 = 0;
-            char *sp1, *sp2;
-            u16_t left_len, uri_len;
-            HTTPD_LOGI("CRLF received, parsing request");
-            /* parse method */
-            if (!strncmp(data, "GET ", 4))
-            {
-                sp1 = data + 3;
-                /* received GET request */
-                HTTPD_LOGI("Received GET request");
-#if LWIP_HTTPD_SUPPORT_POST
-            }
-            else if (!strncmp(data, "POST ", 5))
-            {
-                /* store request type */
-                is_post = 1;
-                sp1     = data + 4;
-                /* received GET request */
-                HTTPD_LOGI("Received POST request");
+    }
+    else if ((rp->method_end == 4) && !strncmp(data, "POST", 4))
+    {
+        /* store request type */
+        is_post    = 1;
+        rp->method = HTTPD_METHOD_POST;
+        /* received POST request */
+        HTTPD_LOGI("Received POST request");
 #endif /* LWIP_HTTPD_SUPPORT_POST */
-            }
-            else
-            {
-                /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
-                data[4] = 0;
-                /* unsupported method! */
-                HTTPD_LOGI("Unsupported request method (not implemented): \"%s\"", data);
-                return http_find_error_file(hs, 501);
-            }
-            /* if we come here, method is OK, parse URI */
-            left_len = data_len - ((sp1 + 1) - data);
-            sp2      = strnstr(sp1 + 1, " ", left_len);
+    }
+    else
+    {
+        /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
+        data[4] = 0;
+        /* unsupported method! */
+        HTTPD_LOGI("Unsupported request method (not implemented): \"%s\"", data);
+        return http_find_error_file(hs, 501);
+    }
+
+    /* if we come here, method is OK, parse URI */
+    sp1 = &data[rp->method_end];
+    uri = sp1 + 1;
+    if (rp->uri_end != 0)
+    {
+        sp2 = &data[rp->uri_end];
+    }
+    else
+    {
 #if LWIP_HTTPD_SUPPORT_V09
-            if (sp2 == NULL)
-            {
-                /* HTTP 0.9: respond with correct protocol version */
-                sp2   = strnstr(sp1 + 1, CRLF, left_len);
-                is_09 = 1;
+        /* HTTP 0.9: respond with correct protocol version */
+        sp2   = &data[rp->line_end];
+        is_09 = 1;
 #if LWIP_HTTPD_SUPPORT_POST
-                if (is_post)
-                {
-                    /* HTTP/0.9 does not support POST */
-                    goto badrequest;
-                }
+        if (is_post)
+        {
+            /* HTTP/0.9 does not support POST */
+            goto badrequest;
+        }
 #endif /* LWIP_HTTPD_SUPPORT_POST */
-            }
+#else  /* LWIP_HTTPD_SUPPORT_V09 */
+        HTTPD_LOGI("Invalid URI");
+        goto badrequest;
 #endif /* LWIP_HTTPD_SUPPORT_V09 */
-            uri_len = sp2 - (sp1 + 1);
-            if ((sp2 != 0) && (sp2 > sp1))
-            {
-                /* wait for CRLFCRLF (indicating end of HTTP headers) before parsing anything */
-                if (strnstr(data, CRLF CRLF, data_len) != NULL)
-                {
-                    char * uri = sp1 + 1;
+    }
+
 #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-                    if (!is_09 && strnstr(data, HTTP11_CONNECTIONKEEPALIVE, data_len))
-                    {
-                        hs->keepalive = 1;
-                    }
+    value         = http_req_value(hs, data, HTTP_HDR_CONNECTION, &value_len);
+    hs->keepalive = !is_09 && http_is_keepalive(sp2 + 1, value, value_len);
 #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
-                    /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
-                    *sp1         = 0;
-                    uri[uri_len] = 0;
-                    HTTPD_LOGI("Received \"%s\" request for URI: \"%s\"", data, uri);
+#if LWIP_HTTPD_SUPPORT_GZIP
+    /* HTTP/0.9 responses are sent without the headers naming the encoding */
+    value           = http_req_value(hs, data, HTTP_HDR_ACCEPT_ENCODING, &value_len);
+    hs->accept_gzip = !is_09 && http_accepts_gzip(value, value_len);
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
+
+    /* Parse WebSocket request */
+    hs->is_websocket = 0;
+    value            = http_req_value(hs, data, HTTP_HDR_UPGRADE, &value_len);
+    if ((value != NULL) && (strncasestr(value, "websocket", value_len) != NULL))
+    {
+        value = http_req_value(hs, data, HTTP_HDR_WS_KEY, &value_len);
+        if (value == NULL)
+        {
+            HTTPD_LOGE("Error: malformed packet");
+            return ERR_ARG;
+        }
+        if (http_websocket_handshake(hs, pcb, value, value_len) != ERR_OK)
+        {
+            return ERR_MEM;
+        }
+    }
+
+    /* null-terminate the METHOD and the URI (pbuf is freed anyway when returning) */
+    *sp1 = 0;
+    *sp2 = 0;
+    HTTPD_LOGI("Received \"%s\" request for URI: \"%s\"", data, uri);
 #if LWIP_HTTPD_SUPPORT_POST
-                    if (is_post)
-                    {
+    if (is_post)
+    {
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
-                        struct pbuf ** q = &hs->req;
+        struct pbuf ** r        = &hs->req;
+        u16_t          data_len = (data == httpd_req_buf) ? rp->hdr_end : hs->req->len;
 #else  /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-                        struct pbuf ** q = inp;
+        struct pbuf ** r        = inp;
+        u16_t          data_len = p->len;
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-                        err = http_post_request(q, hs, data, data_len, uri, sp2);
-                        if (err != ERR_OK)
-                        {
-                            /* restore header for next try */
-                            *sp1         = ' ';
-                            *sp2         = ' ';
-                            uri[uri_len] = ' ';
-                        }
-                        if (err == ERR_ARG)
-                        {
-                            goto badrequest;
-                        }
-                        return err;
-                    }
-                    else
+        err = http_post_request(r, hs, data, data_len, uri, sp2);
+        if (err != ERR_OK)
+        {
+            /* restore header for next try */
+            *sp1 = ' ';
+            *sp2 = ' ';
+        }
+        if (err == ERR_ARG)
+        {
+            goto badrequest;
+        }
+        return err;
+    }
 #endif /* LWIP_HTTPD_SUPPORT_POST */
-                    {
-                        if (hs->is_websocket)
-                        {
-                            if (websocket_open_cb)
-                                websocket_open_cb(pcb, uri);
-                            return ERR_OK;  // We handled this
-                        }
-                        else
-                        {
-                            return http_find_file(hs, uri, is_09);
-                        }
-                    }
-                }
-            }
-            else
+    if (hs->is_websocket)
+    {
+        if (websocket_open_cb)
+        {
+            websocket_cb_hs = hs;
+            websocket_open_cb(pcb, uri);
+            websocket_cb_hs = NULL;
+            if (websocket_cb_drop)
             {
-                HTTPD_LOGI("Invalid URI");
+                /* A broadcast from the callback found this client too slow */
+                websocket_cb_drop = 0;
+                return ERR_MEM;
             }
         }
+        return ERR_OK; // We handled this
     }
-
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if (hs->keepalive)
+    {
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
-    clen = pbuf_clen(hs->req);
-    if ((hs->req->tot_len <= LWIP_HTTPD_REQ_BUFSIZE) && (clen <= LWIP_HTTPD_REQ_QUEUELEN))
+        http_keep_pipelined(hs, hs->req, rp->hdr_end);
+#else  /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+        http_keep_pipelined(hs, *inp, rp->hdr_end);
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+    err_t found = http_find_file(hs, uri, is_09);
+#if LWIP_HTTPD_SUPPORT_ETAG
+    if ((found == ERR_OK) && !is_09)
+    {
+        value = http_req_value(hs, data, HTTP_HDR_IF_NONE_MATCH, &value_len);
+#if LWIP_HTTPD_SUPPORT_RANGE
+        if (!http_check_not_modified(hs, value, value_len))
+        {
+            const char * if_range;
+            u16_t        if_range_len;
+            value    = http_req_value(hs, data, HTTP_HDR_RANGE, &value_len);
+            if_range = http_req_value(hs, data, HTTP_HDR_IF_RANGE, &if_range_len);
+            found    = http_check_range(hs, pcb, value, value_len, if_range, if_range_len, sp2 + 1);
+        }
+#else  /* LWIP_HTTPD_SUPPORT_RANGE */
+        http_check_not_modified(hs, value, value_len);
+#endif /* LWIP_HTTPD_SUPPORT_RANGE */
+    }
+#endif /* LWIP_HTTPD_SUPPORT_ETAG */
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if ((found == ERR_OK) && !is_09)
     {
-        /* request not fully received (too short or CRLF is missing) */
-        return ERR_INPROGRESS;
+        found = http_write_connection(hs, pcb, sp2 + 1);
     }
-    else
-#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+#if LWIP_HTTPD_SUPPORT_CHUNKED
+    if ((found == ERR_OK) && hs->keepalive && (strncmp(sp2 + 1, "HTTP/1.1", 8) == 0))
     {
-#if LWIP_HTTPD_SUPPORT_POST
-    badrequest:
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-        HTTPD_LOGI("Bad request");
-        /* could not parse request */
-        return http_find_error_file(hs, 400);
+        http_start_chunked(hs);
     }
+#endif /* LWIP_HTTPD_SUPPORT_CHUNKED */
+    return found;
+
+badrequest:
+    HTTPD_LOGI("Bad request");
+    /* could not parse request */
+    return http_find_error_file(hs, 400);
 }
 
 /** Try to find the file specified by uri and, if found, initialize hs
@@ -2517,8 +4081,8 @@ static err_t http_find_file(struct http_state * hs, const char * uri, int is_09)
     char *           params;
     err_t            err;
 #if LWIP_HTTPD_CGI
-    int i;
-    int count;
+    const struct http_cgi_route * route;
+    int                           count;
 #endif /* LWIP_HTTPD_CGI */
 #if !LWIP_HTTPD_SSI
     const
@@ -2534,7 +4098,7 @@ static err_t http_find_file(struct http_state * hs, const char * uri, int is_09)
         for (loop = 0; loop < g_psDefaultFilenames.count; loop++)
         {
             HTTPD_LOGI("Looking for %s...", g_psDefaultFilenames.names[loop].name);
-            err = fs_open(&hs->file_handle, (char *)g_psDefaultFilenames.names[loop].name);
+            err = http_fs_open(hs, (char *)g_psDefaultFilenames.names[loop].name);
             uri = (char *)g_psDefaultFilenames.names[loop].name;
             if (err == ERR_OK)
             {
@@ -2569,27 +4133,29 @@ static err_t http_find_file(struct http_state * hs, const char * uri, int is_09)
 
 #if LWIP_HTTPD_CGI
         /* Does the base URI we have isolated correspond to a CGI handler? */
-        if (g_iNumCGIs && g_pCGIs)
+        route = http_cgi_find(uri, hs->parse.method);
+        if (route != NULL)
         {
-            for (i = 0; i < g_iNumCGIs; i++)
+            /*
+             * We found a CGI that handles this URI so extract the
+             * parameters and call the handler.
+             */
+            count = 0;
+            if (route->prefix)
             {
-                if (strcmp(uri, g_pCGIs[i].pcCGIName) == 0)
-                {
-                    /*
-                     * We found a CGI that handles this URI so extract the
-                     * parameters and call the handler.
-                     */
-                    count = extract_uri_parameters(hs, params);
-                    uri   = g_pCGIs[i].pfnCGIHandler(i, count, hs->params, hs->param_vals);
-                    break;
-                }
+                /* Prefix route: the rest of the path comes first */
+                hs->params[0]     = (char *)"*";
+                hs->param_vals[0] = (char *)&uri[route->len];
+                count             = 1;
             }
+            count = extract_uri_parameters(hs, params, count);
+            uri   = route->handler(route->index, count, hs->params, hs->param_vals);
         }
 #endif /* LWIP_HTTPD_CGI */
 
         HTTPD_LOGI("Opening %s", uri);
 
-        err = fs_open(&hs->file_handle, uri);
+        err = http_fs_open(hs, uri);
         if (err == ERR_OK)
         {
             file = &hs->file_handle;
@@ -2649,6 +4215,9 @@ static err_t http_init_file(struct http_state * hs, struct fs_file * file, int i
                 ssi->parsed     = file->data;
                 ssi->parse_left = file->len;
                 ssi->tag_end    = file->data;
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+                ssi->next_tag   = file->ssi_tags;
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
                 hs->ssi         = ssi;
             }
         }
@@ -2730,13 +4299,23 @@ static err_t http_sent(void * arg, struct tcp_pcb * pcb, u16_t len)
 
     LWIP_UNUSED_ARG(len);
 
-    if (hs == NULL)
+    if (hs == NULL)
+    {
+        return ERR_OK;
+    }
+
+    hs->retries = 0;
+#if HTTPD_USE_SLAB_POOL
+    http_lru_touch(hs);
+#endif /* HTTPD_USE_SLAB_POOL */
+
+    if ((hs->handle == NULL) && (hs->file == NULL) && (hs->parse.scanned != 0))
     {
+        /* The previous response has been acknowledged while the next
+         * request is still arriving: keep what was received of it */
         return ERR_OK;
     }
 
-    hs->retries = 0;
-
     http_send(pcb, hs);
 
     return ERR_OK;
@@ -2806,35 +4385,122 @@ void websocket_register_callbacks(tWsOpenHandler ws_open_cb, tWsHandler ws_cb)
 
 err_t websocket_write(struct tcp_pcb * pcb, const uint8_t * data, uint16_t len, uint8_t mode)
 {
-    uint8_t * buf = mem_malloc(len + 4);
-    if (buf == NULL)
+    u8_t  buf[2 + WS_SHORT_PAYLOAD_LEN];
+    err_t err;
+
+    buf[0] = 0x80 | mode;
+    if (len <= WS_SHORT_PAYLOAD_LEN)
+    {
+        /* Short frames are assembled on the stack and queued in one piece */
+        buf[1] = (u8_t)len;
+        MEMCPY(&buf[2], data, len);
+        WS_LOGI("Sending packet");
+        return tcp_write(pcb, buf, len + 2, TCP_WRITE_FLAG_COPY);
+    }
+
+    buf[1] = 126;
+    buf[2] = (u8_t)(len >> 8);
+    buf[3] = (u8_t)len;
+
+    /* The header and the payload are queued separately and lwIP copies both
+     * straight into the segment. A header queued without its payload would
+     * break the framing, so both have to fit. */
+    if ((tcp_sndbuf(pcb) < (WS_EXTENDED_HEADER_LEN + len)) ||
+        ((tcp_sndqueuelen(pcb) + 2 + (len / tcp_mss(pcb))) > TCP_SND_QUEUELEN))
     {
-        WS_LOGI("Out of memory");
+        WS_LOGI("Send buffer full");
         return ERR_MEM;
     }
 
-    int offset = 2;
-    buf[0]     = 0x80 | mode;
-    if (len > 125)
+    WS_LOGI("Sending packet");
+    err = tcp_write(pcb, buf, WS_EXTENDED_HEADER_LEN, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+    if (err != ERR_OK)
     {
-        offset = 4;
-        buf[1] = 126;
-        buf[2] = len >> 8;
-        buf[3] = len;
+        return err;
     }
-    else
+    err = tcp_write(pcb, data, len, TCP_WRITE_FLAG_COPY);
+    if (err != ERR_OK)
     {
-        buf[1] = len;
+        /* The peer cannot find the next frame anymore, end the stream after
+         * the header. The pcb stays valid (it may be used by the caller). */
+        WS_LOGE("Payload not queued, shutting down");
+        tcp_shutdown(pcb, 0, 1);
     }
+    return err;
+}
+
+err_t websocket_subscribe(struct tcp_pcb * pcb)
+{
+    struct http_state * hs = (struct http_state *)pcb->callback_arg;
+    u8_t                i;
 
-    memcpy(&buf[offset], data, len);
-    len += offset;
+    if ((hs == NULL) || !hs->is_websocket)
+    {
+        return ERR_ARG;
+    }
+    for (i = 0; i < websocket_subscriber_count; i++)
+    {
+        if (websocket_subscribers[i] == hs)
+        {
+            return ERR_OK;
+        }
+    }
+    if (websocket_subscriber_count == WS_MAX_SUBSCRIBERS)
+    {
+        WS_LOGE("Too many subscribers");
+        return ERR_MEM;
+    }
+    websocket_subscribers[websocket_subscriber_count++] = hs;
+    return ERR_OK;
+}
 
-    WS_LOGI("Sending packet");
-    err_t retval = http_write(pcb, buf, &len, TCP_WRITE_FLAG_COPY);
-    mem_free(buf);
+/**
+ * Remove a connection from the subscribers, called when its state is freed.
+ */
+static void websocket_unsubscribe(struct http_state * hs)
+{
+    u8_t i;
+    for (i = 0; i < websocket_subscriber_count; i++)
+    {
+        if (websocket_subscribers[i] == hs)
+        {
+            websocket_subscribers[i] = websocket_subscribers[--websocket_subscriber_count];
+            websocket_subscribers[websocket_subscriber_count] = NULL;
+            return;
+        }
+    }
+}
+
+u8_t websocket_broadcast(const uint8_t * data, uint16_t len, uint8_t mode)
+{
+    u8_t sent = 0;
+    u8_t i    = websocket_subscriber_count;
 
-    return retval;
+    /* Backwards: dropping a client moves the last subscriber to its slot */
+    while (i-- > 0)
+    {
+        struct http_state * hs = websocket_subscribers[i];
+
+        if (websocket_write(hs->pcb, data, len, mode) == ERR_OK)
+        {
+            tcp_output(hs->pcb);
+            sent++;
+        }
+        else
+        {
+            /* The client does not keep up, do not let its queue grow */
+            WS_LOGI("Dropping slow client");
+            if (hs == websocket_cb_hs)
+            {
+                websocket_cb_drop = 1;
+            }
+            else
+            {
+                http_close_or_abort_conn(hs->pcb, hs, 1);
+            }
+        }
+    }
+    return sent;
 }
 
 /**
@@ -2849,84 +4515,326 @@ static err_t websocket_send_close(struct tcp_pcb * pcb)
 }
 
 /**
- * Parse websocket frame.
+ * Unmask payload bytes in place, pos is the offset of data in the frame payload.
+ * The aligned middle is XORed a word at a time with the mask rotated to the
+ * word boundary; the unaligned head and tail go byte by byte.
+ */
+static void websocket_unmask(u8_t * data, u16_t len, const u8_t * mask, u32_t pos)
+{
+    while ((len > 0) && (((mem_ptr_t)data & 3) != 0))
+    {
+        *data++ ^= mask[pos++ & 3];
+        len--;
+    }
+    if (len >= 4)
+    {
+        u8_t    rotated[4];
+        u32_t   key;
+        u32_t * word = (u32_t *)data;
+
+        /* Same byte order in memory as the data, no endianness involved */
+        rotated[0] = mask[pos & 3];
+        rotated[1] = mask[(pos + 1) & 3];
+        rotated[2] = mask[(pos + 2) & 3];
+        rotated[3] = mask[(pos + 3) & 3];
+        MEMCPY(&key, rotated, sizeof(key));
+        for (; len >= 4; len -= 4)
+        {
+            *word++ ^= key;
+        }
+        data = (u8_t *)word;
+    }
+    while (len > 0)
+    {
+        *data++ ^= mask[pos++ & 3];
+        len--;
+    }
+}
+
+/**
+ * Check the header of a frame once it is complete and set up its payload.
+ *
+ * @return ERR_OK: the payload follows
+ *         ERR_VAL: protocol error or message too long
+ */
+static err_t websocket_frame_start(struct websocket_state * ws)
+{
+    u8_t  opcode = ws->hdr[0] & WS_OPCODE;
+    u32_t len    = ws->hdr[1] & WS_PAYLOAD_LEN;
+
+    if (((ws->hdr[0] & WS_RSV) != 0) || ((ws->hdr[1] & WS_MASK) == 0))
+    {
+        WS_LOGE("Error: reserved bits set or unmasked frame");
+        return ERR_VAL;
+    }
+    if (len == 126)
+    {
+        len = (ws->hdr[2] << 8) | ws->hdr[3];
+    }
+    else if (len == 127)
+    {
+        if (ws->hdr[2] | ws->hdr[3] | ws->hdr[4] | ws->hdr[5])
+        {
+            WS_LOGE("Error: frame is too long");
+            return ERR_VAL;
+        }
+        len = ((u32_t)ws->hdr[6] << 24) | ((u32_t)ws->hdr[7] << 16) | (ws->hdr[8] << 8) | ws->hdr[9];
+    }
+    WS_LOGI("Opcode: 0x%hX, payload length: %u", opcode, (unsigned)len);
+
+    switch (opcode)
+    {
+        case WS_OP_CLOSE:
+        case WS_OP_PING:
+        case WS_OP_PONG:
+            if (((ws->hdr[0] & WS_FIN) == 0) || (len > WS_SHORT_PAYLOAD_LEN))
+            {
+                WS_LOGE("Error: invalid control frame");
+                return ERR_VAL;
+            }
+            break;
+        case WS_OP_CONTINUATION:
+            if (ws->msg_opcode == 0)
+            {
+                WS_LOGE("Error: continuation frame without a message");
+                return ERR_VAL;
+            }
+            break;
+        case WS_TEXT_MODE:
+        case WS_BIN_MODE:
+            if (ws->msg_opcode != 0)
+            {
+                WS_LOGE("Error: new message before the end of the previous one");
+                return ERR_VAL;
+            }
+            ws->msg_opcode = opcode;
+            break;
+        default:
+            WS_LOGE("Unsupported opcode 0x%hX", opcode);
+            return ERR_VAL;
+    }
+    if ((opcode < WS_OP_CLOSE) && (len > (u32_t)(WS_MAX_MESSAGE_LEN - ws->msg_len)))
+    {
+        WS_LOGE("Error: message is too long");
+        return ERR_VAL;
+    }
+    ws->payload_len = len;
+    ws->payload_pos = 0;
+    return ERR_OK;
+}
+
+/**
+ * A frame has been received completely, pass the message to the callback
+ * after its final frame.
  *
- * @return ERR_OK: frame parsed
+ * @param data the unmasked payload when it did not need to be reassembled,
+ *        NULL to pass the reassembly buffer
+ * @return ERR_OK: frame handled
  *         ERR_CLSD: close request from client
- *         ERR_VAL: invalid frame.
+ *         ERR_ABRT: the client is to be dropped
  */
-static err_t websocket_parse(struct tcp_pcb * pcb, struct pbuf * p)
+static err_t websocket_frame_end(struct tcp_pcb * pcb, struct websocket_state * ws, u8_t * data)
 {
-    u8_t * data     = (u8_t *)p->payload;
-    u16_t  data_len = p->len;
+    u8_t  opcode = ws->hdr[0] & WS_OPCODE;
+    u16_t len    = (u16_t)ws->payload_len;
+
+    ws->hdr_len  = 0;
+    ws->hdr_size = 0;
+    if (opcode == WS_OP_CLOSE)
+    {
+        WS_LOGI("Close request");
+        return ERR_CLSD;
+    }
+    if ((opcode == WS_OP_PING) || (opcode == WS_OP_PONG) || ((ws->hdr[0] & WS_FIN) == 0))
+    {
+        return ERR_OK;
+    }
 
-    if (data != NULL && data_len > 1)
+    if (data == NULL)
     {
-        WS_LOGI("Frame received");
-        if ((data[0] & 0x80) == 0)
+        data = ws->msg;
+        len  = ws->msg_len;
+    }
+    opcode         = ws->msg_opcode;
+    ws->msg_opcode = 0;
+    ws->msg_len    = 0;
+    if ((websocket_cb != NULL) && (len > 0))
+    {
+        /* user callback */
+        websocket_cb_hs = (struct http_state *)pcb->callback_arg;
+        websocket_cb(pcb, data, len, opcode);
+        websocket_cb_hs = NULL;
+        if (websocket_cb_drop)
         {
-            WS_LOGE("Warning: continuation frames not supported");
-            return ERR_OK;
+            /* A broadcast from the callback found this client too slow */
+            websocket_cb_drop = 0;
+            return ERR_ABRT;
         }
-        u8_t opcode = data[0] & 0x0F;
-        switch (opcode)
+    }
+    return ERR_OK;
+}
+
+/**
+ * Decode the websocket frames of a received pbuf chain.
+ * Frames may be split between pbufs and received calls, messages may be
+ * fragmented: both are reassembled in a buffer of WS_MAX_MESSAGE_LEN bytes.
+ * A whole unfragmented frame found in one pbuf is unmasked in place.
+ *
+ * @return ERR_OK: frames parsed
+ *         ERR_CLSD: close request from client
+ *         ERR_VAL: invalid frame
+ *         ERR_MEM: out of memory
+ *         ERR_ABRT: the client is too slow for websocket_broadcast()
+ */
+static err_t websocket_parse(struct http_state * hs, struct tcp_pcb * pcb, struct pbuf * p)
+{
+    struct websocket_state * ws = hs->ws;
+    struct pbuf *            q;
+    err_t                    err = ERR_OK;
+
+    if (ws == NULL)
+    {
+        ws = (struct websocket_state *)mem_malloc(sizeof(struct websocket_state));
+        if (ws == NULL)
         {
-            case WS_TEXT_MODE:
-            case WS_BIN_MODE:
-                WS_LOGI("Opcode: 0x%hX, frame length: %d", opcode, data_len);
-                if (data_len > 6 && websocket_cb != NULL)
-                {
-                    int    data_offset = 6;
-                    u8_t * dptr        = &data[6];
-                    u8_t * kptr        = &data[2];
-                    u16_t  len         = data[1] & 0x7F;
+            WS_LOGE("Out of memory");
+            return ERR_MEM;
+        }
+        memset(ws, 0, sizeof(struct websocket_state));
+        hs->ws = ws;
+    }
 
-                    if (len == 127)
-                    {
-                        /* most likely won't happen inside non-fragmented frame */
-                        WS_LOGE("Warning: frame is too long");
-                        return ERR_OK;
-                    }
-                    else if (len == 126)
-                    {
-                        /* extended length */
-                        dptr += 2;
-                        kptr += 2;
-                        data_offset += 2;
-                        len = (data[2] << 8) | data[3];
-                    }
+    for (q = p; (q != NULL) && (err == ERR_OK); q = q->next)
+    {
+        u8_t * data = (u8_t *)q->payload;
+        u16_t  left = q->len;
 
-                    data_len -= data_offset;
+        while ((left > 0) && (err == ERR_OK))
+        {
+            const u8_t * mask;
+            u16_t        len;
 
-                    if (len > data_len)
+            if ((ws->hdr_size == 0) || (ws->hdr_len < ws->hdr_size))
+            {
+                /* Frame header, byte by byte as it may be split as well */
+                ws->hdr[ws->hdr_len++] = *data++;
+                left--;
+                if (ws->hdr_len == 2)
+                {
+                    len          = ws->hdr[1] & WS_PAYLOAD_LEN;
+                    ws->hdr_size = 2 + ((len == 126) ? 2 : ((len == 127) ? 8 : 0)) + ((ws->hdr[1] & WS_MASK) ? 4 : 0);
+                }
+                if (ws->hdr_len == ws->hdr_size)
+                {
+                    WS_LOGI("Frame received");
+                    err = websocket_frame_start(ws);
+                    if ((err == ERR_OK) && (ws->payload_len == 0))
                     {
-                        WS_LOGE("Error: incorrect frame size");
-                        return ERR_VAL;
+                        err = websocket_frame_end(pcb, ws, NULL);
                     }
+                }
+                continue;
+            }
 
-                    if (data_len != len)
+            mask = &ws->hdr[ws->hdr_size - 4];
+            len  = (u16_t)LWIP_MIN((u32_t)left, ws->payload_len - ws->payload_pos);
+            if ((ws->payload_pos == 0) && (len == ws->payload_len) && (ws->hdr[0] & WS_FIN) &&
+                ((ws->hdr[0] & WS_OPCODE) != WS_OP_CONTINUATION) && ((ws->hdr[0] & WS_OPCODE) < WS_OP_CLOSE))
+            {
+                /* The whole message is here, no copy needed */
+                websocket_unmask(data, len, mask, 0);
+                ws->payload_pos = len;
+                err             = websocket_frame_end(pcb, ws, data);
+            }
+            else
+            {
+                if ((ws->hdr[0] & WS_OPCODE) < WS_OP_CLOSE)
+                {
+                    if (ws->msg == NULL)
                     {
-                        WS_LOGE("Warning: segmented frame received");
+                        ws->msg = (u8_t *)mem_malloc(WS_MAX_MESSAGE_LEN);
+                        if (ws->msg == NULL)
+                        {
+                            WS_LOGE("Out of memory");
+                            return ERR_MEM;
+                        }
                     }
+                    /* copy first: the word loop needs the alignment of the destination */
+                    MEMCPY(&ws->msg[ws->msg_len], data, len);
+                    websocket_unmask(&ws->msg[ws->msg_len], len, mask, ws->payload_pos);
+                    ws->msg_len += len;
+                }
+                /* control frame payloads are not used */
+                ws->payload_pos += len;
+                if (ws->payload_pos == ws->payload_len)
+                {
+                    err = websocket_frame_end(pcb, ws, NULL);
+                }
+            }
+            data += len;
+            left -= len;
+        }
+    }
+    return err;
+}
 
-                    /* unmask */
-                    for (int i = 0; i < len; i++)
-                        *(dptr++) ^= kptr[i % 4];
+/** Parse a received request and start sending the response
+ *
+ * @param pcb the connection pcb
+ * @param hs connection state
+ * @param p the received data, freed or kept by the function
+ */
+static void http_handle_request(struct tcp_pcb * pcb, struct http_state * hs, struct pbuf * p)
+{
+    err_t parsed = ERR_ABRT;
 
-                    /* user callback */
-                    websocket_cb(pcb, &data[data_offset], len, opcode);
-                }
-                break;
-            case 0x08:  // close
-                WS_LOGI("Close request");
-                return ERR_CLSD;
-            default:
-                WS_LOGE("Unsupported opcode 0x%hX", opcode);
-                break;
+    if (hs->handle == NULL)
+    {
+        parsed = http_parse_request(&p, hs, pcb);
+        LWIP_ASSERT("http_parse_request: unexpected return value",
+                    parsed == ERR_OK || parsed == ERR_INPROGRESS || parsed == ERR_ARG || parsed == ERR_USE ||
+                        parsed == ERR_MEM);
+    }
+    else
+    {
+        HTTPD_LOGI("Recv: already sending data");
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+        /* the pbuf has not been enqueued to hs->req */
+        pbuf_free(p);
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    }
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (parsed != ERR_INPROGRESS)
+    {
+        /* request fully parsed or error */
+        if (hs->req != NULL)
+        {
+            pbuf_free(hs->req);
+            hs->req = NULL;
         }
-        return ERR_OK;
     }
-    return ERR_VAL;
+#else  /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    if (p != NULL)
+    {
+        /* pbuf not passed to application, free it now */
+        pbuf_free(p);
+    }
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    if (parsed == ERR_OK)
+    {
+#if LWIP_HTTPD_SUPPORT_POST
+        if (hs->post_content_len_left == 0)
+#endif /* LWIP_HTTPD_SUPPORT_POST */
+        {
+            HTTPD_LOGI("Recv: data %p len %" S32_F, hs->file, hs->left);
+            http_send(pcb, hs);
+        }
+    }
+    else if (parsed == ERR_ARG || parsed == ERR_MEM)
+    {
+        /* @todo: close on ERR_USE? */
+        http_close_conn(pcb, hs);
+    }
 }
 
 /**
@@ -2935,8 +4843,7 @@ static err_t websocket_parse(struct tcp_pcb * pcb, struct pbuf * p)
  */
 static err_t http_recv(void * arg, struct tcp_pcb * pcb, struct pbuf * p, err_t err)
 {
-    err_t               parsed = ERR_ABRT;
-    struct http_state * hs     = (struct http_state *)arg;
+    struct http_state * hs = (struct http_state *)arg;
     HTTPD_LOGI("Recv: pcb=%p pbuf=%p err=%s", (void *)pcb, (void *)p, lwip_strerr(err));
 
     if (hs != NULL && hs->is_websocket)
@@ -2948,16 +4855,21 @@ static err_t http_recv(void * arg, struct tcp_pcb * pcb, struct pbuf * p, err_t
             return ERR_BUF;
         }
         tcp_recved(pcb, p->tot_len);
-        err_t err = websocket_parse(pcb, p);
-        if (p != NULL)
+        err_t err = websocket_parse(hs, pcb, p);
+        /* otherwise tcp buffer hogs */
+        WS_LOGI("Freeing buffer");
+        pbuf_free(p);
+        if (err == ERR_ABRT)
         {
-            /* otherwise tcp buffer hogs */
-            WS_LOGI("Freeing buffer");
-            pbuf_free(p);
+            /* dropped by a broadcast from the callback, hs is freed */
+            http_close_or_abort_conn(pcb, hs, 1);
+            return ERR_ABRT;
         }
-        if (err == ERR_CLSD)
+        if (err != ERR_OK)
         {
+            /* close request or protocol error, hs is freed */
             http_close_conn(pcb, hs);
+            return ERR_OK;
         }
         /* reset timeout */
         hs->retries = 0;
@@ -2982,6 +4894,23 @@ static err_t http_recv(void * arg, struct tcp_pcb * pcb, struct pbuf * p, err_t
         return ERR_OK;
     }
 
+#if HTTPD_USE_SLAB_POOL
+    http_lru_touch(hs);
+#endif /* HTTPD_USE_SLAB_POOL */
+
+#if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if (((hs->handle != NULL) || (hs->file != NULL))
+#if LWIP_HTTPD_SUPPORT_POST
+        && (hs->post_content_len_left == 0)
+#endif /* LWIP_HTTPD_SUPPORT_POST */
+    )
+    {
+        /* The next request arrived while this one is answered */
+        HTTPD_LOGI("Recv: queueing pipelined request");
+        return http_queue_pipelined(hs, p);
+    }
+#endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
 #if LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND
     if (hs->no_auto_wnd)
     {
@@ -3012,49 +4941,7 @@ static err_t http_recv(void * arg, struct tcp_pcb * pcb, struct pbuf * p, err_t
     else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
     {
-        if (hs->handle == NULL)
-        {
-            parsed = http_parse_request(&p, hs, pcb);
-            LWIP_ASSERT("http_parse_request: unexpected return value",
-                        parsed == ERR_OK || parsed == ERR_INPROGRESS || parsed == ERR_ARG || parsed == ERR_USE ||
-                            parsed == ERR_MEM);
-        }
-        else
-        {
-            HTTPD_LOGI("Recv: already sending data");
-        }
-#if LWIP_HTTPD_SUPPORT_REQUESTLIST
-        if (parsed != ERR_INPROGRESS)
-        {
-            /* request fully parsed or error */
-            if (hs->req != NULL)
-            {
-                pbuf_free(hs->req);
-                hs->req = NULL;
-            }
-        }
-#else  /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-        if (p != NULL)
-        {
-            /* pbuf not passed to application, free it now */
-            pbuf_free(p);
-        }
-#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-        if (parsed == ERR_OK)
-        {
-#if LWIP_HTTPD_SUPPORT_POST
-            if (hs->post_content_len_left == 0)
-#endif /* LWIP_HTTPD_SUPPORT_POST */
-            {
-                HTTPD_LOGI("Recv: data %p len %" S32_F, hs->file, hs->left);
-                http_send(pcb, hs);
-            }
-        }
-        else if (parsed == ERR_ARG || parsed == ERR_MEM)
-        {
-            /* @todo: close on ERR_USE? */
-            http_close_conn(pcb, hs);
-        }
+        http_handle_request(pcb, hs, p);
     }
     return ERR_OK;
 }
@@ -3073,6 +4960,12 @@ static err_t http_accept(void * arg, struct tcp_pcb * pcb, err_t err)
     tcp_accepted(lpcb);
     /* Set priority */
     tcp_setprio(pcb, HTTPD_TCP_PRIO);
+#if HTTPD_SEND_PLANNER
+    /* The send planner only queues whole segments in the middle of a
+     * response, Nagle would just hold back its last segment until the
+     * (delayed) ACK of the previous ones */
+    tcp_nagle_disable(pcb);
+#endif /* HTTPD_SEND_PLANNER */
 
     /* Allocate memory for the structure that holds the state of the
        connection - initialized by that function. */
@@ -3129,6 +5022,17 @@ void httpd_init(bool config)
     LWIP_ASSERT("memp_sizes[MEMP_HTTPD_SSI_STATE] >= sizeof(http_ssi_state)",
                 memp_sizes[MEMP_HTTPD_SSI_STATE] >= sizeof(http_ssi_state));
 #endif
+#if HTTPD_USE_SLAB_POOL
+    /* The slabs stay in use by the connections of a previous init */
+    if (http_state_slab.stats.size == 0)
+    {
+        http_slab_init(&http_state_slab, http_state_objs, sizeof(struct http_state), HTTPD_SLAB_NUM_STATES);
+#if LWIP_HTTPD_SSI
+        http_slab_init(&http_ssi_state_slab, http_ssi_state_objs, sizeof(struct http_ssi_state),
+                       HTTPD_SLAB_NUM_SSI_STATES);
+#endif /* LWIP_HTTPD_SSI */
+    }
+#endif /* HTTPD_USE_SLAB_POOL */
     HTTPD_LOGI("Init");
 
     if (true == config)
@@ -3140,6 +5044,29 @@ void httpd_init(bool config)
     httpd_init_addr(IP_ADDR_ANY);
 }
 
+#if HTTPD_USE_SLAB_POOL
+/**
+ * Get the occupancy of the connection state slabs.
+ *
+ * @param states filled with the stats of the struct http_state slab
+ * @param ssi_states filled with the stats of the struct http_ssi_state slab, may be NULL
+ */
+void httpd_get_pool_stats(struct httpd_pool_stats * states, struct httpd_pool_stats * ssi_states)
+{
+    LWIP_ASSERT("no states given", states != NULL);
+
+    *states = http_state_slab.stats;
+    if (ssi_states != NULL)
+    {
+#if LWIP_HTTPD_SSI
+        *ssi_states = http_ssi_state_slab.stats;
+#else  /* LWIP_HTTPD_SSI */
+        memset(ssi_states, 0, sizeof(*ssi_states));
+#endif /* LWIP_HTTPD_SSI */
+    }
+}
+#endif /* HTTPD_USE_SLAB_POOL */
+
 #if LWIP_HTTPD_SSI
 /**
  * Set the SSI handler function.
@@ -3164,18 +5091,75 @@ void http_set_ssi_handler(tSSIHandler ssi_handler, const char ** tags, int num_t
 
 #if LWIP_HTTPD_CGI
 /**
- * Set an array of CGI filenames/handler functions
+ * Set an array of CGI filenames/handler functions. POST requests are handed
+ * to httpd_post_begin() and never reach a CGI, so HTTPD_METHOD_POST is
+ * refused and an entry listing no other method is ignored.
  *
  * @param cgis an array of CGI filenames/handler functions
  * @param num_handlers number of elements in the 'cgis' array
  */
 void http_set_cgi_handlers(const tCGI * cgis, int num_handlers)
 {
+    struct http_cgi_route * route;
+    u32_t                   slot;
+    int                     i;
+    u8_t                    j;
+    u8_t                    methods;
+
     LWIP_ASSERT("no cgis given", cgis != NULL);
     LWIP_ASSERT("invalid number of handlers", num_handlers > 0);
 
-    g_pCGIs    = cgis;
-    g_iNumCGIs = num_handlers;
+    memset(http_cgi_slots, 0, sizeof(http_cgi_slots));
+    http_cgi_num_routes   = 0;
+    http_cgi_num_prefixes = 0;
+
+    for (i = 0; i < num_handlers; i++)
+    {
+        if (http_cgi_num_routes == LWIP_HTTPD_MAX_CGI_ROUTES)
+        {
+            HTTPD_LOGE("Too many CGIs, %d ignored", num_handlers - i);
+            break;
+        }
+        methods = (cgis[i].ucMethods != 0) ? cgis[i].ucMethods : HTTPD_METHOD_GET;
+        if (methods & HTTPD_METHOD_POST)
+        {
+            HTTPD_LOGE("CGI %s: POST is not dispatched to CGIs", cgis[i].pcCGIName);
+            methods &= (u8_t)~HTTPD_METHOD_POST;
+            if (methods == 0)
+            {
+                continue;
+            }
+        }
+        route          = &http_cgi_routes[http_cgi_num_routes];
+        route->name    = cgis[i].pcCGIName;
+        route->handler = cgis[i].pfnCGIHandler;
+        route->methods = methods;
+        route->index   = (u8_t)i;
+        route->hash    = http_cgi_hash(route->name, &route->len);
+        route->prefix  = (route->len > 0) && (route->name[route->len - 1] == '*');
+
+        if (route->prefix)
+        {
+            /* Prefix route: keep the list sorted by decreasing length so
+             * that the most specific prefix matches first */
+            route->len--;
+            for (j = http_cgi_num_prefixes; (j > 0) && (http_cgi_routes[http_cgi_prefixes[j - 1]].len < route->len); j--)
+            {
+                http_cgi_prefixes[j] = http_cgi_prefixes[j - 1];
+            }
+            http_cgi_prefixes[j] = http_cgi_num_routes;
+            http_cgi_num_prefixes++;
+        }
+        else
+        {
+            for (slot = route->hash & (HTTP_CGI_HASH_SIZE - 1); http_cgi_slots[slot] != 0;
+                 slot = (slot + 1) & (HTTP_CGI_HASH_SIZE - 1))
+            {
+            }
+            http_cgi_slots[slot] = http_cgi_num_routes + 1;
+        }
+        http_cgi_num_routes++;
+    }
 }
 #endif /* LWIP_HTTPD_CGI */
 
@@ -75,6 +75,34 @@
 #define LWIP_HTTPD_FS_ASYNC_READ      0
 #endif
 
+/** LWIP_HTTPD_SUPPORT_GZIP==1: serve the gzip encoded variants generated by
+ * makefsdata.py to the clients which accept them (fs_open_gzip()).
+ */
+#ifndef LWIP_HTTPD_SUPPORT_GZIP
+#define LWIP_HTTPD_SUPPORT_GZIP       1
+#endif
+
+/** LWIP_HTTPD_SUPPORT_ETAG==1: answer a matching If-None-Match with the
+ * 304 response precomputed by makefsdata.py instead of the file.
+ */
+#ifndef LWIP_HTTPD_SUPPORT_ETAG
+#define LWIP_HTTPD_SUPPORT_ETAG       1
+#endif
+
+/** LWIP_HTTPD_SUPPORT_RANGE==1: answer a single byte Range of a file with an
+ * etag with 206 Partial Content, so an interrupted download can be resumed.
+ */
+#ifndef LWIP_HTTPD_SUPPORT_RANGE
+#define LWIP_HTTPD_SUPPORT_RANGE      LWIP_HTTPD_SUPPORT_ETAG
+#endif
+
+/** LWIP_HTTPD_SUPPORT_SSI_TAGS==1: send SSI files using the tag table
+ * generated by makefsdata.py instead of scanning them for tags at runtime.
+ */
+#ifndef LWIP_HTTPD_SUPPORT_SSI_TAGS
+#define LWIP_HTTPD_SUPPORT_SSI_TAGS   1
+#endif
+
 #define FS_READ_EOF     -1
 #define FS_READ_DELAYED -2
 
@@ -86,6 +114,26 @@ struct fsdata_chksum {
 };
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
 
+/** Entity tag of a file, the 304 response that repeats it and the headers
+ * of the 206 response, up to Content-Range and Content-Length. body is the
+ * offset of the file contents in the file data. */
+struct fsdata_etag {
+  const char *etag;
+  const unsigned char *not_modified;
+  int not_modified_len;
+  const unsigned char *partial;
+  int partial_len;
+  int body;
+};
+
+/** SSI tag of a file, the offsets are relative to the file data. The last
+ * entry of a tag table has no name and starts at the end of the file. */
+struct fsdata_ssi_tag {
+  int start;        /* offset of the tag lead-in */
+  int end;          /* offset following the tag lead-out */
+  const char *name;
+};
+
 struct fs_file {
   const char *data;
   int len;
@@ -96,6 +144,12 @@ struct fs_file {
   u16_t chksum_count;
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
   u8_t http_header_included;
+#if LWIP_HTTPD_SUPPORT_ETAG
+  const struct fsdata_etag *etag;
+#endif /* LWIP_HTTPD_SUPPORT_ETAG */
+#if LWIP_HTTPD_SUPPORT_SSI_TAGS
+  const struct fsdata_ssi_tag *ssi_tags;
+#endif /* LWIP_HTTPD_SUPPORT_SSI_TAGS */
 #if LWIP_HTTPD_CUSTOM_FILES
   u8_t is_custom_file;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
@@ -109,6 +163,9 @@ typedef void (*fs_wait_cb)(void *arg);
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
 
 err_t fs_open(struct fs_file *file, const char *name);
+#if LWIP_HTTPD_SUPPORT_GZIP
+err_t fs_open_gzip(struct fs_file *file, const char *name);
+#endif /* LWIP_HTTPD_SUPPORT_GZIP */
 void fs_close(struct fs_file *file);
 #if LWIP_HTTPD_DYNAMIC_FILE_READ
 #if LWIP_HTTPD_FS_ASYNC_READ
@@ -37,6 +37,7 @@
 
 #define FS_FILE_FLAGS_HEADER_INCLUDED (1)
 #define FS_FILE_FLAGS_HEADER_PERSISTENT (1)
+#define FS_FILE_FLAGS_SSI (8)
 
 struct fsdata_file {
   const struct fsdata_file *next;
@@ -44,6 +45,12 @@ struct fsdata_file {
   const unsigned char *data;
   int len;
   u8_t http_header_included;
+  /** gzip encoded variant of the file with its own headers, or NULL */
+  const struct fsdata_file *gzip;
+  /** Validator of the file, or NULL if it is never cached */
+  const struct fsdata_etag *etag;
+  /** SSI tags found by makefsdata.py, or NULL if the file is not parsed */
+  const struct fsdata_ssi_tag *ssi_tags;
 #if HTTPD_PRECALCULATED_CHECKSUM
   u16_t chksum_count;
   const struct fsdata_chksum *chksum;
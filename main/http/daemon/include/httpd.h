@@ -57,6 +57,17 @@
 #define LWIP_HTTPD_SUPPORT_POST   0
 #endif
 
+/** Set this to 1 to allocate the connection states from fixed slabs reserved
+ * at startup instead of the heap. When a slab is exhausted, the least
+ * recently active connection is closed to make room. */
+#ifndef HTTPD_USE_SLAB_POOL
+#define HTTPD_USE_SLAB_POOL       1
+#endif
+
+/* Request methods, a CGI lists the ones it handles in tCGI */
+#define HTTPD_METHOD_GET          0x01
+#define HTTPD_METHOD_POST         0x02
+
 #if LWIP_HTTPD_CGI
 
 /*
@@ -82,10 +93,14 @@
  * iNumParams is defined by LWIP_HTTPD_MAX_CGI_PARAMETERS. Any parameters in the incoming
  * HTTP request above this number will be discarded.
  *
- * Requests intended for use by this CGI mechanism must be sent using the GET
+ * Requests intended for use by this CGI mechanism are sent using the GET
  * method (which encodes all parameters within the URI rather than in a block
- * later in the request). Attempts to use the POST method will result in the
- * request being ignored.
+ * later in the request). POST requests are passed to httpd_post_begin()
+ * instead, so http_set_cgi_handlers refuses HTTPD_METHOD_POST.
+ *
+ * A CGI whose name ends with '*' handles every URI starting with the rest of
+ * the name. The remainder of the path is then passed as the first parameter,
+ * named "*": for the name "/led/" followed by '*', "/led/on" passes "on".
  *
  */
 typedef const char *(*tCGIHandler)(int iIndex, int iNumParams, char *pcParam[],
@@ -99,8 +114,15 @@ typedef struct
 {
     const char *pcCGIName;
     tCGIHandler pfnCGIHandler;
+    u8_t ucMethods; /* HTTPD_METHOD_* handled, 0 for GET only (POST is refused) */
 } tCGI;
 
+/*
+ * Registers the CGIs. The table is compiled into a hash of the URLs, so the
+ * array need not outlive the call and the lookup cost does not grow with the
+ * number of CGIs. At most LWIP_HTTPD_MAX_CGI_ROUTES entries are used. An entry
+ * that lists only HTTPD_METHOD_POST is logged and ignored.
+ */
 void http_set_cgi_handlers(const tCGI *pCGIs, int iNumHandlers);
 
 
@@ -109,6 +131,11 @@ void http_set_cgi_handlers(const tCGI *pCGIs, int iNumHandlers);
 #define LWIP_HTTPD_MAX_CGI_PARAMETERS 16
 #endif
 
+/* The maximum number of CGIs, a power of 2 up to 128 */
+#ifndef LWIP_HTTPD_MAX_CGI_ROUTES
+#define LWIP_HTTPD_MAX_CGI_ROUTES 16
+#endif
+
 #endif /* LWIP_HTTPD_CGI */
 
 #if LWIP_HTTPD_SSI
@@ -246,10 +273,34 @@ typedef void (*tWsOpenHandler)(struct tcp_pcb *pcb, const char *uri);
  * @param data data to send.
  * @param len data length.
  * @param mode WS_TEXT_MODE or WS_BIN_MODE.
- * @return ERR_OK if write succeeded.
+ * @return ERR_OK if the whole frame has been queued,
+ *         ERR_MEM if the send buffer cannot take it now (nothing queued).
  */
 err_t websocket_write(struct tcp_pcb *pcb, const uint8_t *data, uint16_t len, uint8_t mode);
 
+/**
+ * Subscribe a websocket to websocket_broadcast(), e.g. from the open callback.
+ * The subscription ends when the connection is closed.
+ *
+ * @param pcb tcp_pcb of the websocket.
+ * @return ERR_OK if subscribed, ERR_MEM if WS_MAX_SUBSCRIBERS websockets
+ *         are subscribed already, ERR_ARG if pcb is not a websocket.
+ */
+err_t websocket_subscribe(struct tcp_pcb *pcb);
+
+/**
+ * Write the same frame to every subscribed websocket. A client whose send
+ * buffer cannot take the frame is dropped. Must be called on the TCP thread.
+ * It may be called from the websocket callbacks: a client dropped from its
+ * own callback is dropped when the callback returns.
+ *
+ * @param data data to send.
+ * @param len data length.
+ * @param mode WS_TEXT_MODE or WS_BIN_MODE.
+ * @return number of websockets the frame has been queued for.
+ */
+u8_t websocket_broadcast(const uint8_t *data, uint16_t len, uint8_t mode);
+
 /**
  * Register websocket callback functions. Use NULL if callback is not needed.
  *
@@ -260,4 +311,25 @@ void websocket_register_callbacks(tWsOpenHandler ws_open_cb, tWsHandler ws_cb);
 
 void httpd_init(bool config);
 
+#if HTTPD_USE_SLAB_POOL
+/** Occupancy of a connection state slab */
+struct httpd_pool_stats
+{
+    u16_t size;      /* Number of objects in the slab */
+    u16_t used;      /* Number of objects in use */
+    u16_t peak;      /* Maximum number of objects in use since startup */
+    u32_t evictions; /* Connections closed to free an object */
+    u32_t failures;  /* Allocations failed even after an eviction attempt */
+};
+
+/**
+ * Get the occupancy of the connection state slabs.
+ *
+ * @param states filled with the stats of the struct http_state slab.
+ * @param ssi_states filled with the stats of the struct http_ssi_state slab
+ *        (all zero without LWIP_HTTPD_SSI), may be NULL.
+ */
+void httpd_get_pool_stats(struct httpd_pool_stats *states, struct httpd_pool_stats *ssi_states);
+#endif /* HTTPD_USE_SLAB_POOL */
+
 #endif /* __HTTPD_H__ */
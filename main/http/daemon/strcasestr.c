@@ -65,12 +65,13 @@ size_t slen;
     size_t len;
 
     if ((c = *find++) != '\0') {
+        c = tolower((unsigned char) c);
         len = strlen(find);
         do {
             do {
                 if (slen-- < 1 || (sc = *s++) == '\0')
                     return (NULL);
-            } while (sc != c);
+            } while ((char) tolower((unsigned char) sc) != c);
             if (len > slen)
                 return (NULL);
         } while (strncasecmp(s, find, len) != 0);
@@ -5,8 +5,8 @@ static const unsigned char data_complete_html[] = {
     /* "/complete.html" (15 chars) */
     0x2F,0x63,0x6F,0x6D,0x70,0x6C,0x65,0x74,0x65,0x2E,0x68,0x74,0x6D,0x6C,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -19,6 +19,22 @@ static const unsigned char data_complete_html[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x31,0x34,0x30,0x36,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "e5d0cab3fc25d573"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x35,0x64,0x30,0x63,0x61,0x62,0x33,0x66,
+    0x63,0x32,0x35,0x64,0x35,0x37,0x33,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/html" (27 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
@@ -114,13 +130,224 @@ static const unsigned char data_complete_html[] = {
     0x62,0x6F,0x64,0x79,0x3E,0x0A,0x3C,0x2F,0x68,0x74,0x6D,0x6C,0x3E,0x0A,
 };
 
+static const unsigned char data_complete_html_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "e5d0cab3fc25d573"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x35,0x64,0x30,0x63,0x61,0x62,0x33,0x66,
+    0x63,0x32,0x35,0x64,0x35,0x37,0x33,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_complete_html_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "e5d0cab3fc25d573"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x35,0x64,0x30,0x63,0x61,0x62,0x33,0x66,
+    0x63,0x32,0x35,0x64,0x35,0x37,0x33,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_complete_html[] = {{
+    "\"e5d0cab3fc25d573\"",
+    data_complete_html_304,
+    sizeof(data_complete_html_304),
+    data_complete_html_206,
+    sizeof(data_complete_html_206),
+    226,
+}};
+
+static const unsigned char data_complete_html_gz[] = {
+
+    /* "/complete.html" (15 chars) */
+    0x2F,0x63,0x6F,0x6D,0x70,0x6C,0x65,0x74,0x65,0x2E,0x68,0x74,0x6D,0x6C,0x00,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 547" (21 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x35,0x34,0x37,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "34f62f072dad773d"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x33,0x34,0x66,0x36,0x32,0x66,0x30,0x37,0x32,
+    0x64,0x61,0x64,0x37,0x37,0x33,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (27 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (547 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xA5,0x54,0x4D,0x6F,0xDB,0x30,
+    0x0C,0x3D,0x37,0xBF,0x82,0xF3,0x79,0xB6,0x8B,0x21,0x87,0x61,0xB0,0x7D,0x58,0xBB,
+    0x8F,0x5B,0x03,0x34,0x40,0xB1,0xD3,0xA0,0xD8,0x74,0x2C,0x4C,0x1F,0x86,0x44,0xDB,
+    0xCD,0xBF,0x1F,0x2D,0x27,0x8B,0x17,0x17,0xCB,0xBA,0xF9,0x22,0x4A,0xE2,0x7B,0x24,
+    0x1F,0x29,0x67,0x6F,0xEE,0x1F,0xEE,0xB6,0xDF,0x36,0x9F,0xA0,0x21,0xAD,0x8A,0x55,
+    0x36,0x2D,0x37,0x59,0x83,0xA2,0xE2,0xF5,0x26,0xD3,0x48,0x02,0xCA,0x46,0x38,0x8F,
+    0x94,0x47,0x1D,0xD5,0xF1,0xFB,0xE8,0x7C,0x61,0x84,0xC6,0x3C,0xEA,0x25,0x0E,0xAD,
+    0x75,0x14,0x41,0x69,0x0D,0xA1,0x61,0xC7,0x41,0x56,0xD4,0xE4,0x15,0xF6,0xB2,0xC4,
+    0x38,0x6C,0xDE,0x42,0xE7,0xD1,0xC5,0xBE,0x14,0x4A,0xEC,0x14,0xE6,0xC6,0x4E,0x3C,
+    0x4A,0x9A,0x1F,0xE0,0x50,0xE5,0x91,0xA7,0x83,0x42,0xDF,0x20,0x32,0x11,0x1D,0x5A,
+    0x26,0x26,0x7C,0xA6,0xB4,0xF4,0x3E,0x82,0xC6,0x61,0x9D,0x47,0x6C,0xA6,0x35,0x87,
+    0xF0,0xC9,0x78,0x58,0xAC,0xE0,0xF8,0xBD,0x9A,0xA4,0xB4,0x5A,0x5B,0x73,0x64,0xF9,
+    0x87,0x24,0xBC,0x94,0xBA,0x55,0x98,0x68,0x69,0x12,0xAE,0xF0,0x3F,0x88,0x46,0xAF,
+    0x17,0xE1,0x0D,0x0B,0x5A,0x76,0x04,0x92,0x35,0x3D,0x21,0xA4,0xDE,0xA7,0xB5,0xE8,
+    0xC7,0xA3,0xA4,0x35,0xFB,0x09,0x43,0x92,0x14,0x16,0x5F,0xB7,0xDB,0x0D,0x3C,0xA2,
+    0xEB,0xD1,0x65,0xE9,0x74,0xC4,0x6D,0x4C,0x8F,0x7D,0xCC,0x76,0xB6,0x3A,0x14,0xAB,
+    0x20,0x58,0x56,0xC9,0x1E,0x4A,0x25,0xBC,0xE7,0x14,0x58,0x4C,0x21,0x0D,0x3A,0x68,
+    0x84,0x8F,0x5B,0x8A,0xD7,0x93,0xB1,0x3B,0x19,0x2A,0xBE,0x9D,0x0C,0x17,0xDF,0xCE,
+    0x05,0x9F,0x71,0x8C,0xD7,0x43,0x2C,0x3A,0xB2,0x4B,0x48,0x30,0xB4,0x3A,0xDF,0x6A,
+    0x17,0xEC,0x19,0xD5,0x22,0x25,0xE1,0x2A,0x90,0x3E,0xF6,0x8D,0xA8,0xEC,0x80,0x55,
+    0x28,0x92,0xCB,0x1C,0x5D,0x64,0x35,0xEA,0x2A,0xA8,0xF3,0xDF,0x77,0xF6,0x39,0x3A,
+    0x41,0x84,0x42,0x47,0x01,0xD3,0x95,0x25,0x8E,0x5A,0x3E,0x4E,0x46,0x96,0x32,0xEA,
+    0xF7,0x50,0x21,0x5C,0xB3,0x2E,0xEE,0xAC,0xA9,0xE5,0xBE,0x73,0x82,0xA4,0x35,0x3C,
+    0xB7,0x63,0x3B,0x09,0x59,0xB0,0xF5,0x0B,0xFE,0x17,0xD5,0x6A,0x96,0x27,0x5A,0xBA,
+    0x05,0xD7,0xF6,0xC2,0xF1,0x5D,0x54,0x6C,0x1B,0x1C,0x1F,0xC6,0x2C,0x9C,0xAD,0xE1,
+    0x60,0x3B,0x07,0xD3,0xFB,0xE0,0xCC,0x7F,0x25,0x90,0x64,0x69,0x3B,0x15,0x7C,0xB3,
+    0xA0,0xE2,0x06,0x6C,0x14,0x0A,0x8F,0x50,0x5B,0xA5,0xEC,0x00,0xC4,0xC4,0x86,0x87,
+    0x0A,0x3C,0x61,0xEB,0x3F,0xFC,0x19,0x1A,0xC3,0xBD,0xF4,0x9C,0x86,0xC1,0x92,0xA0,
+    0x76,0x56,0xC3,0x93,0xFC,0x2C,0x93,0xAB,0xA0,0x29,0xC5,0x41,0x2A,0xC5,0x83,0xC9,
+    0xE2,0x3B,0x7A,0x15,0xE6,0x14,0x91,0xFB,0xEF,0x6C,0x47,0xE8,0xAE,0xA2,0x1F,0x5A,
+    0x34,0xA1,0xB4,0x27,0xDC,0xC1,0x47,0x67,0x07,0xFF,0x17,0xA0,0x2F,0x76,0x8C,0x40,
+    0x33,0xA5,0xB1,0x02,0x2F,0xAF,0x0A,0x1A,0x03,0x0F,0x02,0x39,0xAB,0x02,0xF6,0xD8,
+    0x8F,0x5E,0x8A,0xB0,0x3D,0xE3,0x17,0x6D,0x5E,0x0E,0xD6,0xC5,0xD1,0x6C,0x7B,0x34,
+    0xC7,0xE7,0x38,0x3D,0x43,0x9E,0xB2,0xF0,0x9B,0xFD,0x09,0xE7,0xAE,0x61,0x93,0x7E,
+    0x05,0x00,0x00,
+};
+
+static const unsigned char data_complete_html_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "34f62f072dad773d"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x33,0x34,0x66,0x36,0x32,0x66,0x30,0x37,0x32,
+    0x64,0x61,0x64,0x37,0x37,0x33,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_complete_html_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "34f62f072dad773d"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x33,0x34,0x66,0x36,0x32,0x66,0x30,0x37,0x32,
+    0x64,0x61,0x64,0x37,0x37,0x33,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_complete_html_gz[] = {{
+    "\"34f62f072dad773d\"",
+    data_complete_html_gz_304,
+    sizeof(data_complete_html_gz_304),
+    data_complete_html_gz_206,
+    sizeof(data_complete_html_gz_206),
+    249,
+}};
+
 static const unsigned char data_config_html[] = {
 
     /* "/config.html" (13 chars) */
     0x2F,0x63,0x6F,0x6E,0x66,0x69,0x67,0x2E,0x68,0x74,0x6D,0x6C,0x00,0x00,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -133,6 +360,22 @@ static const unsigned char data_config_html[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x36,0x39,0x33,0x30,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "ea32b7224dd7f941"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x61,0x33,0x32,0x62,0x37,0x32,0x32,0x34,
+    0x64,0x64,0x37,0x66,0x39,0x34,0x31,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/html" (27 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
@@ -574,13 +817,335 @@ static const unsigned char data_config_html[] = {
     0x3E,0x0A,
 };
 
+static const unsigned char data_config_html_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "ea32b7224dd7f941"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x61,0x33,0x32,0x62,0x37,0x32,0x32,0x34,
+    0x64,0x64,0x37,0x66,0x39,0x34,0x31,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_config_html_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "ea32b7224dd7f941"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x61,0x33,0x32,0x62,0x37,0x32,0x32,0x34,
+    0x64,0x64,0x37,0x66,0x39,0x34,0x31,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_config_html[] = {{
+    "\"ea32b7224dd7f941\"",
+    data_config_html_304,
+    sizeof(data_config_html_304),
+    data_config_html_206,
+    sizeof(data_config_html_206),
+    226,
+}};
+
+static const unsigned char data_config_html_gz[] = {
+
+    /* "/config.html" (13 chars) */
+    0x2F,0x63,0x6F,0x6E,0x66,0x69,0x67,0x2E,0x68,0x74,0x6D,0x6C,0x00,0x00,0x00,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 2333" (22 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x32,0x33,0x33,0x33,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "68d5995534f1e374"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x36,0x38,0x64,0x35,0x39,0x39,0x35,0x35,0x33,
+    0x34,0x66,0x31,0x65,0x33,0x37,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (27 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (2333 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xAD,0x59,0xFB,0x6F,0xDB,0x38,
+    0x12,0xFE,0x39,0xFD,0x2B,0x58,0x2D,0xB0,0x92,0x61,0x5B,0xB2,0xD3,0xF4,0xD0,0x73,
+    0xEC,0x1C,0xF2,0x2A,0xB6,0x87,0x6C,0x1B,0x9C,0x73,0x1B,0x1C,0x0E,0xC5,0x81,0x96,
+    0x28,0x9B,0xA8,0x24,0x7A,0x49,0xCA,0x4E,0x90,0xF5,0xFF,0x7E,0x33,0xA4,0x9E,0x7E,
+    0x64,0x5D,0x6C,0x8D,0x20,0x16,0x1F,0x33,0x9C,0x19,0x0E,0xBF,0xF9,0x28,0x8F,0xDF,
+    0xDE,0x7C,0xB9,0x7E,0xF8,0xCF,0xFD,0x2D,0x59,0xE8,0x34,0xB9,0x78,0x33,0xB6,0x5F,
+    0x27,0xE3,0x05,0xA3,0x11,0x7C,0x9F,0x8C,0x53,0xA6,0x29,0x09,0x17,0x54,0x2A,0xA6,
+    0x27,0x4E,0xAE,0xE3,0xFE,0x07,0xA7,0x1E,0xC8,0x68,0xCA,0x26,0xCE,0x8A,0xB3,0xF5,
+    0x52,0x48,0xED,0x90,0x50,0x64,0x9A,0x65,0x30,0x71,0xCD,0x23,0xBD,0x98,0x44,0x6C,
+    0xC5,0x43,0xD6,0x37,0x8D,0x1E,0xC9,0x15,0x93,0x7D,0x15,0xD2,0x84,0xCE,0x12,0x36,
+    0xC9,0x04,0xE8,0x21,0xC5,0x67,0x9C,0xF0,0xEC,0x1B,0x91,0x2C,0x99,0x38,0x4A,0x3F,
+    0x27,0x4C,0x2D,0x18,0x03,0x75,0xFA,0x79,0x09,0xEA,0x35,0x7B,0xD2,0x41,0xA8,0x94,
+    0x43,0x16,0x92,0xC5,0x13,0x07,0x1E,0x83,0x50,0xA4,0xA9,0xC8,0x7C,0xEC,0x35,0xD6,
+    0x7C,0xAF,0xBC,0xE2,0x3C,0x5D,0x26,0xCC,0x4F,0x79,0xE6,0x83,0x89,0x7F,0x41,0x11,
+    0xCE,0xDA,0x2B,0xBE,0x80,0x88,0x84,0xB9,0x26,0x1C,0x82,0x52,0x4A,0xF0,0x74,0x1E,
+    0xC4,0x74,0x85,0x5D,0xFE,0x32,0x9B,0x5B,0x19,0xCD,0x75,0xC2,0x2E,0x1E,0xD9,0xEC,
+    0xF2,0xF7,0x9C,0xDE,0xF1,0xF9,0x42,0x93,0x6B,0x91,0xC5,0x7C,0x3E,0x0E,0xEC,0x10,
+    0xEC,0x47,0x50,0x6C,0xC8,0x78,0x26,0xA2,0xE7,0x8B,0x37,0x26,0x70,0xE3,0x88,0xAF,
+    0x48,0x98,0x50,0xA5,0xC0,0x14,0x08,0x3C,0xE5,0x19,0x93,0x64,0x41,0x55,0x7F,0xA9,
+    0xFB,0x67,0xF6,0x61,0x56,0x3E,0x24,0xFD,0x81,0x7D,0x90,0xFD,0x41,0x33,0xF0,0x0D,
+    0x1D,0x38,0xBC,0xEE,0xD3,0x5C,0x8B,0x5D,0x11,0xF3,0x90,0x26,0xF5,0x68,0x2A,0xCD,
+    0x73,0x43,0xD5,0x8E,0x49,0x54,0x46,0x84,0xAB,0xBE,0x5A,0xD0,0x48,0xAC,0x59,0x64,
+    0x9C,0x05,0x77,0x71,0x0A,0x8F,0x30,0xBE,0x54,0xE7,0xEA,0x7F,0x33,0xF1,0xE4,0x94,
+    0x22,0x34,0x61,0x52,0x1B,0x19,0x06,0x0E,0x45,0x54,0x3E,0x3B,0x17,0x53,0x4D,0xA5,
+    0xE6,0xD9,0xDC,0xF7,0xFD,0x71,0x00,0xB2,0xED,0x05,0xCD,0xA2,0x8B,0xB3,0x0B,0x08,
+    0x58,0xC6,0x42,0xCD,0x45,0x46,0x96,0x54,0x42,0x56,0x6A,0x26,0x15,0x44,0xED,0x6C,
+    0xCF,0xF4,0x2D,0x97,0x53,0x88,0x91,0xB3,0x3B,0xCD,0xA6,0x25,0x9D,0xB1,0xA4,0x9C,
+    0x6C,0x1A,0xCE,0xC5,0x23,0xFF,0xC8,0xC9,0x74,0xFA,0xE9,0x86,0x78,0xFF,0x12,0x39,
+    0xAC,0x43,0x3E,0xC3,0x7A,0x9D,0x71,0x60,0xC6,0x0F,0x28,0xE2,0xD9,0x12,0x53,0x01,
+    0xDD,0x56,0x3C,0xAA,0x1C,0x36,0xDD,0xCD,0xF4,0x72,0x08,0x64,0x64,0xC2,0xB2,0x39,
+    0x9C,0x1E,0xE7,0x3D,0xB4,0xE8,0x53,0xD9,0x7A,0x77,0xEA,0x90,0x65,0x42,0x43,0xB6,
+    0x10,0x49,0xC4,0xE4,0xC4,0xF9,0x45,0xA4,0xEC,0xF1,0xEE,0xF2,0xB3,0x43,0x82,0x3D,
+    0x5E,0x1E,0x88,0xD5,0x8F,0x70,0xFE,0x1E,0x7A,0xD6,0x42,0x46,0xC7,0xBA,0xBC,0x5C,
+    0x1F,0xEB,0xF1,0x87,0xD7,0x3D,0x2E,0x17,0xFE,0x8B,0x1E,0xFF,0xED,0x7B,0x3C,0x9E,
+    0x72,0xCD,0xCC,0x0E,0x1F,0xBD,0xC1,0x20,0xF0,0x63,0x36,0xB8,0x09,0x09,0xDF,0xE5,
+    0xF2,0x2C,0xD7,0x1A,0x4E,0x42,0x61,0x43,0xD1,0x82,0x63,0x15,0xE7,0x49,0xE2,0x10,
+    0x91,0x85,0x09,0x0F,0xBF,0x4D,0x1C,0x91,0x4D,0xE9,0x8A,0x5D,0xE9,0xEC,0x1A,0xDB,
+    0x5E,0xE7,0x50,0x58,0x78,0xA9,0x49,0xF1,0x7E,0x22,0xC2,0x6F,0x25,0x2A,0x0C,0x9D,
+    0x8B,0x71,0xC0,0x0F,0x08,0xA9,0x25,0xCD,0x2E,0x50,0xFF,0x38,0x30,0x8F,0x7B,0x8C,
+    0xB7,0x86,0x6D,0x21,0x48,0xDB,0xA5,0x46,0xB3,0x78,0x04,0x0C,0x54,0xA1,0xE4,0x4B,
+    0x8D,0x70,0xB2,0xA2,0x92,0xAC,0xD5,0x79,0xF1,0x24,0x99,0x96,0x9C,0x99,0x66,0x10,
+    0x60,0x07,0x14,0x1C,0x68,0x93,0x09,0xC9,0xD8,0x9A,0x3C,0xF0,0x94,0x4D,0x4D,0x87,
+    0xD7,0x39,0xAF,0x16,0xB0,0x13,0x43,0x91,0x08,0x79,0x0F,0x41,0x80,0xD3,0x6C,0x67,
+    0x73,0x29,0xFC,0xEB,0xBA,0xD7,0x73,0x7F,0x5A,0x9A,0x07,0x17,0x64,0x41,0x3F,0xFC,
+    0xAD,0x79,0x06,0xB8,0xE6,0x8B,0x2C,0x11,0x34,0x02,0x29,0x91,0x3D,0x9A,0x9E,0x3B,
+    0x68,0x9A,0x39,0x71,0x9E,0x59,0x44,0x6A,0x8E,0x78,0x1D,0x18,0x79,0x41,0x24,0x04,
+    0x84,0x53,0x02,0x6A,0x47,0x22,0xE6,0x9E,0x63,0x27,0x10,0x54,0x05,0x48,0xD9,0x41,
+    0x17,0xD0,0xBA,0xB5,0xFA,0xB2,0x64,0x99,0x67,0xDA,0xE0,0x93,0x42,0x2C,0xBC,0x17,
+    0x09,0x54,0x99,0x79,0xDD,0xC9,0xF4,0xD4,0x40,0xE9,0x95,0x78,0xF2,0x20,0xE1,0x62,
+    0xE1,0xF4,0x88,0x83,0x72,0x30,0x8B,0x40,0x0E,0x4D,0x61,0xCB,0x98,0xF6,0x7D,0xAB,
+    0x76,0x63,0xAD,0xAF,0x8C,0xCB,0x97,0x11,0xD5,0xAC,0xD6,0x10,0x26,0xAA,0x47,0x30,
+    0x53,0x2B,0x43,0x15,0x40,0x34,0xF8,0x17,0x89,0x30,0x4F,0xA1,0xB8,0xFB,0x73,0xA6,
+    0x6F,0x13,0x86,0x8F,0x57,0xCF,0x9F,0x22,0xCF,0xAD,0x81,0xDC,0xB5,0x36,0xA1,0x80,
+    0x6F,0x52,0x06,0xCF,0x0D,0x88,0xD6,0xC0,0xEE,0x90,0x2E,0x24,0x93,0xAA,0xA7,0x71,
+    0xC0,0x6D,0xF9,0xCB,0xC3,0xAF,0x77,0x30,0x0D,0x57,0x3D,0xDF,0x0E,0x8D,0x31,0xC5,
+    0x1A,0xDE,0x8E,0xE9,0xAF,0x4C,0x29,0x3A,0x67,0x1F,0xA5,0x48,0x61,0x5B,0x57,0xB0,
+    0x47,0x6C,0x55,0x1B,0x1D,0x04,0x45,0x36,0x80,0xDE,0x81,0x51,0x9A,0x30,0x4D,0x90,
+    0xA9,0x60,0x5C,0xED,0x1E,0xFF,0x9B,0x67,0xFA,0xC3,0xA5,0x94,0xF4,0x19,0x45,0x7D,
+    0x88,0x03,0xED,0x54,0x53,0x91,0x61,0xD0,0x0C,0x37,0x16,0x85,0xFE,0x3B,0xF8,0x5A,
+    0x8D,0x58,0x7F,0x49,0x39,0x32,0xFC,0x6A,0x76,0xBB,0xBD,0x9F,0x85,0x71,0x24,0x06,
+    0xEB,0x30,0x0D,0xC1,0xBC,0x11,0x41,0xE7,0x51,0xC4,0xA6,0xD0,0x09,0x8F,0x89,0xE7,
+    0x0D,0x9E,0x06,0x43,0x32,0x99,0x94,0xCB,0x75,0xC8,0xCF,0x3F,0x13,0xEC,0x1C,0x60,
+    0xA7,0x5D,0xA9,0x83,0x4E,0x59,0xAF,0xDA,0x8B,0x58,0x96,0x90,0x4B,0x6A,0x22,0x22,
+    0x59,0xC8,0xF8,0x8A,0x45,0x6F,0x9D,0x42,0xBF,0x31,0x56,0xC4,0x31,0x24,0x08,0xD8,
+    0x7A,0x7A,0x5E,0xF5,0x61,0x09,0x82,0x9E,0x39,0x26,0x8E,0xC4,0xF8,0x5D,0xE5,0x71,
+    0x0C,0xF1,0x43,0xDB,0x7A,0x85,0x84,0x0D,0xC4,0x49,0x21,0xDE,0x9D,0x18,0x21,0xDF,
+    0x42,0x55,0xAD,0x09,0x90,0xFD,0xBB,0x15,0x81,0xCC,0x8E,0x1E,0xC4,0xCC,0x23,0x14,
+    0x1D,0x0A,0x81,0x0D,0xAD,0xB1,0x70,0x45,0x93,0x9C,0x41,0xC3,0x31,0x5D,0xB8,0x56,
+    0xBB,0x07,0x57,0xB2,0x5D,0xA5,0xBE,0xC3,0x79,0x0D,0xFA,0xDC,0x4E,0x21,0x3F,0x69,
+    0xA8,0x37,0x76,0x63,0x1A,0x1D,0x14,0x85,0x75,0x1B,0x92,0x95,0x15,0x7F,0x2E,0x88,
+    0xE6,0x35,0xD7,0xAC,0xAC,0x35,0xA2,0x78,0x76,0x4F,0x58,0xA2,0x18,0x29,0x73,0xE7,
+    0xF4,0xC7,0xE4,0x8E,0xA2,0x65,0xE2,0xE0,0xC4,0x02,0xD9,0x00,0xEA,0xCD,0xA8,0x8F,
+    0xDC,0x15,0x4F,0x31,0xAC,0x03,0x9C,0x19,0xAA,0x5B,0x6D,0x4C,0x10,0xA0,0x25,0x60,
+    0x21,0x2E,0x39,0x78,0xBA,0xBA,0xBD,0xFD,0x48,0xFE,0xF8,0x83,0x54,0x1D,0x37,0xB7,
+    0x97,0x37,0x1D,0x3B,0xB1,0xBD,0xFE,0xDD,0xED,0x0D,0x51,0x6B,0xAE,0xC3,0x45,0x89,
+    0x77,0x30,0x05,0x5D,0x2B,0x26,0x5B,0xE8,0xF6,0xE9,0x12,0x70,0x2C,0xF2,0xF0,0xB4,
+    0xDE,0x00,0x4C,0x79,0x1D,0x8C,0x18,0x22,0xB9,0xD7,0xE9,0xE1,0x2A,0x4D,0x48,0x0B,
+    0x82,0x0A,0x1D,0x2C,0x6E,0x42,0x2E,0x31,0x9A,0x1A,0xC4,0x0D,0x82,0x17,0xF3,0xDF,
+    0xD4,0x89,0x5C,0x72,0x74,0x07,0xE0,0x14,0xC7,0x9D,0x7A,0x60,0x5D,0xD6,0x8A,0x0A,
+    0x35,0x3D,0x67,0xAD,0x46,0x41,0x80,0xA1,0x48,0x16,0x42,0xE9,0xD1,0x87,0xC1,0x87,
+    0x01,0xD8,0x0B,0x75,0x03,0x92,0xA9,0x8E,0x10,0x0C,0x41,0x1B,0x14,0x77,0x6C,0xF5,
+    0x81,0x20,0x2A,0x28,0x0D,0x69,0x01,0x03,0x13,0x52,0x9A,0x66,0x40,0x8A,0x14,0xC6,
+    0xB4,0xF7,0xA4,0x85,0x41,0x66,0xD4,0xD4,0x30,0xD8,0x47,0x34,0xEB,0x9F,0xD3,0x2F,
+    0x9F,0xFD,0x25,0xDE,0xC3,0xF6,0x4C,0x6C,0xAA,0x31,0x02,0xF5,0xD0,0xC1,0x54,0xCB,
+    0x97,0x1A,0xE2,0x08,0xC9,0xD6,0x84,0x60,0x23,0xEC,0xDB,0x21,0x70,0xC8,0x25,0x96,
+    0x89,0x2B,0xF7,0xCF,0xF5,0xC1,0x0D,0x65,0xB9,0x57,0x1B,0x0E,0x18,0x5D,0xB3,0x67,
+    0xCD,0x8E,0xD1,0x94,0xB0,0x68,0x4B,0x91,0x75,0x0A,0x60,0x23,0xC2,0xB4,0x1A,0x76,
+    0xC8,0x3F,0x88,0xFB,0x25,0x73,0xC9,0x08,0xBE,0xE2,0xB8,0x52,0xB9,0x29,0x1E,0xB6,
+    0x6B,0x5C,0x59,0x46,0xCB,0xE2,0x80,0x39,0x8B,0x7B,0x0D,0xBA,0xF2,0x2C,0x62,0x31,
+    0x5C,0x9C,0x22,0x4C,0x5B,0xD8,0x33,0xC8,0x88,0xE8,0x19,0xAB,0x21,0x23,0x6F,0x21,
+    0x81,0x1B,0xC7,0x07,0x85,0x8A,0x9A,0x62,0x7A,0x8B,0xEE,0x93,0xED,0x02,0xEA,0x44,
+    0x34,0x9B,0x33,0x89,0x45,0x18,0x13,0x15,0xAE,0x08,0xD5,0xC1,0x32,0x47,0xE6,0xA4,
+    0xCC,0xF2,0x83,0x0A,0xEA,0xDB,0x0F,0xE8,0x28,0x6F,0x36,0xE6,0x06,0xD4,0x56,0xD4,
+    0xDC,0xF5,0x56,0x2A,0x96,0xE7,0xF8,0x50,0x3A,0x3B,0xDB,0xB9,0x5B,0x09,0xF8,0x33,
+    0x9E,0xC1,0xC2,0x0F,0xC0,0x57,0x41,0xD6,0xA5,0x58,0x1C,0x67,0x06,0x8B,0xDD,0x6A,
+    0x8A,0xC8,0x04,0x44,0x73,0x37,0xA7,0xA1,0x26,0x17,0xC6,0xB2,0xE8,0x41,0x34,0x6A,
+    0xF2,0x39,0xD9,0x34,0x84,0x99,0x94,0x42,0xEE,0x91,0x7E,0x25,0x8E,0xB7,0x28,0x82,
+    0x51,0x6C,0x29,0x3A,0x78,0xB8,0x0E,0x92,0x83,0xB6,0x7C,0x98,0x08,0xC5,0x8E,0x31,
+    0x64,0x4D,0x25,0x72,0x29,0xB4,0xE4,0x86,0xAB,0xB0,0xF4,0xB1,0x61,0x4F,0x10,0xB4,
+    0x11,0xC7,0xF6,0x6E,0x33,0x90,0xCD,0x0E,0x8B,0x81,0xCB,0x01,0x88,0x7C,0xCA,0xF6,
+    0x94,0xBB,0x1E,0x9C,0x1E,0x09,0xAB,0x56,0x49,0x8B,0x75,0x32,0x31,0x71,0xB7,0x03,
+    0xCD,0x22,0x5A,0x56,0x7A,0xA4,0xA1,0x46,0xDA,0xD6,0x36,0xC3,0x4F,0xB0,0xA3,0xDB,
+    0xFD,0x0A,0x43,0x20,0x60,0x66,0xC7,0x10,0x7F,0x0F,0x45,0xB8,0x31,0x0D,0xBE,0xC6,
+    0x66,0x8C,0xF0,0x6E,0xD7,0x2E,0xDF,0xED,0x16,0x89,0xBF,0x4D,0xDA,0x2B,0x8D,0x5F,
+    0x6B,0x3B,0xF0,0xED,0xD0,0xB5,0x88,0xD8,0xA5,0xF6,0x78,0x83,0x59,0xE3,0x67,0xD7,
+    0xE3,0xD7,0x4B,0x7C,0xE1,0x2B,0x8A,0xEE,0x71,0xA9,0x1E,0xC0,0x38,0x94,0xFC,0xAB,
+    0xF0,0xAF,0x39,0x0C,0x86,0xE1,0xB0,0xEB,0x9A,0x30,0x60,0xEF,0x6B,0x2E,0x77,0x8A,
+    0x39,0xE5,0xCA,0xF8,0x41,0x0D,0xC0,0x55,0xA6,0xD6,0x43,0x64,0x71,0xD7,0x85,0x97,
+    0x5E,0x73,0xD1,0x8A,0xA8,0x6F,0xCA,0x85,0x60,0xCF,0x73,0x99,0x91,0x17,0x53,0xB4,
+    0x47,0xA8,0xA7,0x47,0xEC,0x46,0x8D,0xD0,0x80,0x0C,0x4E,0xDE,0xB0,0xB3,0xD9,0xC7,
+    0x67,0xDB,0x77,0xB1,0xE6,0xAE,0x17,0x7C,0xED,0x28,0xA2,0x52,0xA5,0x83,0xA5,0x66,
+    0xC7,0x30,0x94,0x9A,0xD8,0x5A,0x16,0x76,0x14,0x39,0xF1,0xB5,0xB8,0x13,0x6B,0x26,
+    0xAF,0x29,0x14,0xA4,0x06,0xA1,0xB5,0xB6,0x02,0xB0,0x3A,0x0E,0x22,0xAA,0xB1,0xA2,
+    0x6A,0xD9,0x05,0x4C,0xB3,0x01,0xAC,0x05,0xDD,0x30,0x77,0x04,0xCF,0xB9,0x4C,0x12,
+    0xA2,0x17,0xAC,0xF1,0x1A,0x87,0xA4,0x39,0x54,0xD7,0x05,0x84,0x87,0xC4,0x3C,0xC1,
+    0x1A,0x60,0x2C,0x50,0x25,0xAC,0x56,0xAC,0x68,0x7F,0xCA,0xB6,0x68,0x07,0x06,0x99,
+    0x54,0xD7,0x63,0xBC,0xD1,0x45,0x35,0x79,0x6C,0xD2,0xC6,0x16,0x61,0x2C,0xCE,0x73,
+    0x45,0x57,0xED,0x31,0x3C,0x2B,0x39,0xA7,0xDD,0xDF,0x82,0x6E,0x56,0x0D,0xC3,0xDD,
+    0xB6,0x89,0x6E,0x45,0xC7,0x07,0xE7,0x3B,0x86,0xE2,0xB8,0xC5,0xDA,0x02,0xB6,0xCD,
+    0xD5,0xA4,0x38,0x26,0xA0,0xA8,0xB3,0x5F,0xC4,0xDC,0x69,0x76,0x2E,0x34,0x56,0x51,
+    0xC9,0x71,0xAB,0x9C,0x65,0x1A,0x0F,0x2E,0x12,0xC7,0x6D,0x5A,0xEE,0x0D,0x0B,0x2F,
+    0x5F,0xC7,0x24,0xF0,0x77,0x87,0xD1,0x7B,0xED,0x28,0x1C,0xA5,0x08,0x42,0xB5,0xAB,
+    0xA7,0x15,0xBF,0xE3,0xEC,0xD9,0xDA,0x9D,0xB5,0x9A,0x02,0x5F,0xAC,0xAA,0x4F,0x15,
+    0x85,0xBD,0xE8,0xBB,0x35,0xD9,0x50,0xAA,0x36,0x45,0x68,0xD2,0x01,0x48,0xDB,0x77,
+    0x98,0xC4,0x05,0xAA,0x77,0xBB,0xE4,0x82,0xBC,0x6F,0xA6,0x71,0xF3,0xAE,0xDE,0x66,
+    0xEA,0x3B,0x8A,0x86,0x2D,0x39,0x5F,0x21,0xC7,0xAD,0xAF,0x9F,0x9B,0x3D,0xE8,0xB0,
+    0xBF,0xB2,0x96,0xD6,0x6E,0x57,0x9A,0x5D,0x4A,0x91,0x87,0x21,0x94,0xC4,0x06,0xA1,
+    0xB0,0xB4,0x7B,0xE7,0xE2,0xFA,0x20,0x9F,0x89,0x16,0x08,0xD3,0xE6,0x14,0x86,0xCD,
+    0x6B,0x42,0x83,0x80,0xBC,0x39,0x3A,0x71,0x87,0x5B,0x69,0x7B,0x64,0xCA,0x16,0x97,
+    0x6E,0x9B,0xAC,0x43,0xB3,0xE8,0xE1,0xBD,0x35,0xC1,0xAA,0xA3,0xD5,0x7E,0x4D,0x42,
+    0x6C,0x98,0xCD,0x6B,0x1E,0xC0,0x70,0x5D,0x2C,0x3C,0x4D,0x85,0xD0,0x0B,0xCE,0x10,
+    0xD7,0xB5,0xF7,0x92,0x02,0xB2,0x70,0x75,0xCF,0xE4,0x3D,0x7F,0x62,0xC9,0x68,0x38,
+    0xEC,0xCD,0x25,0x8F,0x46,0x2F,0x88,0x38,0x53,0x7C,0xC7,0x3F,0x72,0x7F,0x8A,0xCD,
+    0xC7,0xED,0x01,0xA8,0x8B,0x6F,0x6C,0xBB,0x77,0x26,0x64,0xC4,0xE4,0x6F,0x5C,0xF1,
+    0x19,0xF4,0xC7,0x14,0x36,0x7F,0xD3,0xB3,0x0C,0xCF,0xBC,0x38,0x54,0x6D,0x65,0x03,
+    0xF3,0x71,0x37,0xBD,0x94,0x3E,0xFD,0x66,0x8A,0xC5,0x70,0x70,0x7A,0xD6,0x4B,0x79,
+    0x66,0x5B,0x83,0x4D,0x11,0x6A,0x63,0xB4,0x4F,0xA3,0xA8,0xF1,0x02,0xCB,0xDE,0x8E,
+    0x7A,0xE4,0x05,0x5C,0x64,0x8F,0xF8,0xF3,0xCA,0xE8,0x74,0xCB,0xAC,0xC1,0x3B,0xFA,
+    0xF7,0xF8,0xCC,0xED,0xB5,0x1C,0x18,0xC6,0xEF,0x63,0xEA,0xB6,0x35,0xDB,0x5B,0xD0,
+    0x83,0xF0,0x0E,0xE1,0xBE,0x63,0xE6,0x5D,0xD3,0x6C,0x45,0x95,0x03,0xD7,0xAE,0xF7,
+    0x83,0x41,0xA1,0x00,0x8E,0xE0,0xA7,0x0C,0x20,0x1A,0xF0,0xD8,0xAB,0x58,0x14,0x52,
+    0xA8,0xB5,0x7A,0x94,0x70,0x32,0x3D,0xF7,0xD2,0x45,0x92,0xD4,0x90,0xD9,0xDA,0xAA,
+    0xF9,0x92,0x8B,0x6A,0x8B,0xF0,0xA8,0xBC,0x76,0x29,0xE8,0xDB,0x0B,0x23,0x94,0x20,
+    0xB8,0x35,0x22,0x74,0x5B,0x1E,0x7E,0x52,0xAD,0x76,0x5B,0xBC,0x80,0xAA,0x29,0x76,
+    0x3D,0x76,0xE3,0xD6,0x87,0x6B,0x1C,0x54,0xAF,0x10,0xC7,0x81,0xFD,0x45,0x65,0x1C,
+    0xD8,0x9F,0xBE,0xFE,0x0F,0x5E,0xFE,0xEF,0x7B,0x12,0x1B,0x00,0x00,
+};
+
+static const unsigned char data_config_html_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "68d5995534f1e374"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x36,0x38,0x64,0x35,0x39,0x39,0x35,0x35,0x33,
+    0x34,0x66,0x31,0x65,0x33,0x37,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_config_html_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "68d5995534f1e374"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x36,0x38,0x64,0x35,0x39,0x39,0x35,0x35,0x33,
+    0x34,0x66,0x31,0x65,0x33,0x37,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_config_html_gz[] = {{
+    "\"68d5995534f1e374\"",
+    data_config_html_gz_304,
+    sizeof(data_config_html_gz_304),
+    data_config_html_gz_206,
+    sizeof(data_config_html_gz_206),
+    250,
+}};
+
 static const unsigned char data_error_html[] = {
 
     /* "/error.html" (12 chars) */
     0x2F,0x65,0x72,0x72,0x6F,0x72,0x2E,0x68,0x74,0x6D,0x6C,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -593,6 +1158,22 @@ static const unsigned char data_error_html[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x37,0x34,0x38,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "d868e86e7f2b7b5a"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x38,0x36,0x38,0x65,0x38,0x36,0x65,0x37,
+    0x66,0x32,0x62,0x37,0x62,0x35,0x61,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/html" (27 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
@@ -647,13 +1228,213 @@ static const unsigned char data_error_html[] = {
     0x79,0x3E,0x0A,0x3C,0x2F,0x68,0x74,0x6D,0x6C,0x3E,0x0A,0x0A,
 };
 
+static const unsigned char data_error_html_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "d868e86e7f2b7b5a"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x38,0x36,0x38,0x65,0x38,0x36,0x65,0x37,
+    0x66,0x32,0x62,0x37,0x62,0x35,0x61,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_error_html_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "d868e86e7f2b7b5a"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x38,0x36,0x38,0x65,0x38,0x36,0x65,0x37,
+    0x66,0x32,0x62,0x37,0x62,0x35,0x61,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_error_html[] = {{
+    "\"d868e86e7f2b7b5a\"",
+    data_error_html_304,
+    sizeof(data_error_html_304),
+    data_error_html_206,
+    sizeof(data_error_html_206),
+    225,
+}};
+
+static const unsigned char data_error_html_gz[] = {
+
+    /* "/error.html" (12 chars) */
+    0x2F,0x65,0x72,0x72,0x6F,0x72,0x2E,0x68,0x74,0x6D,0x6C,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 371" (21 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x33,0x37,0x31,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "292288bba000e8d1"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x32,0x39,0x32,0x32,0x38,0x38,0x62,0x62,0x61,
+    0x30,0x30,0x30,0x65,0x38,0x64,0x31,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (27 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (371 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9D,0x92,0xB9,0x72,0x83,0x30,
+    0x10,0x86,0x6B,0xFB,0x29,0x14,0xD5,0x11,0xB8,0xA0,0x48,0x01,0x34,0x89,0x67,0xD2,
+    0xC5,0x33,0x71,0x93,0x52,0x96,0x16,0x4B,0x13,0x1D,0x8C,0xB4,0x40,0xFC,0xF6,0x11,
+    0x60,0xC6,0xE4,0x68,0x12,0x9A,0xFD,0xB5,0xC7,0xA7,0xDD,0x15,0xE5,0xDD,0xD3,0xCB,
+    0xE3,0xF1,0xED,0xB0,0x27,0x0A,0xAD,0xA9,0xB7,0xE5,0x6C,0x36,0xA5,0x02,0x2E,0x93,
+    0xDD,0x94,0x16,0x90,0x13,0xA1,0x78,0x88,0x80,0x15,0xED,0xB0,0x61,0x0F,0xF4,0x16,
+    0x70,0xDC,0x42,0x45,0x7B,0x0D,0x43,0xEB,0x03,0x52,0x22,0xBC,0x43,0x70,0x29,0x71,
+    0xD0,0x12,0x55,0x25,0xA1,0xD7,0x02,0xD8,0x74,0xB8,0x27,0x5D,0x84,0xC0,0xA2,0xE0,
+    0x86,0x9F,0x0C,0x54,0xCE,0xCF,0x1C,0xA3,0xDD,0x3B,0x09,0x60,0x2A,0x1A,0xF1,0x62,
+    0x20,0x2A,0x80,0x04,0xC2,0x4B,0x9B,0xC0,0x08,0x1F,0x98,0x8B,0x18,0x29,0x51,0x01,
+    0x9A,0x8A,0x26,0x99,0x37,0xE9,0x8A,0x98,0x8D,0xCE,0x7A,0x4B,0xAE,0xDF,0x9F,0x21,
+    0xC2,0x5B,0xEB,0xDD,0x95,0xF2,0x8F,0x26,0xA2,0xD6,0xB6,0x35,0x90,0x59,0xED,0xB2,
+    0x34,0xE1,0xAF,0x20,0x95,0x36,0x22,0x3A,0x24,0x3A,0x2D,0x65,0xA9,0xD5,0xF6,0x9C,
+    0x37,0xBC,0x1F,0x5D,0x59,0xEB,0xCE,0x73,0x0D,0x6A,0x34,0x50,0x3F,0x1F,0x8F,0x07,
+    0xF2,0x0A,0xA1,0x87,0x50,0xE6,0xB3,0x2B,0xBD,0x43,0x7E,0x7D,0x88,0xF2,0xE4,0xE5,
+    0x65,0xB4,0x52,0xF7,0x44,0x18,0x1E,0x63,0x6A,0x24,0x6D,0x82,0x6B,0x07,0x81,0x28,
+    0x1E,0x59,0x8B,0xAC,0x98,0xC5,0x69,0x11,0x86,0xED,0x66,0x11,0xD8,0x6E,0xBC,0x6A,
+    0x5A,0xD5,0x0A,0x30,0xC6,0x06,0xC6,0x3B,0xF4,0x3F,0xF3,0x27,0x61,0xCD,0x2D,0x6A,
+    0xC3,0xA4,0x17,0xCE,0x77,0x96,0xE0,0x41,0x12,0x1D,0x59,0x54,0x5C,0xFA,0x01,0xE4,
+    0x34,0xDA,0xE6,0x4B,0xBF,0xDC,0x40,0xC0,0x31,0x47,0x72,0x77,0x86,0x40,0xEB,0x7D,
+    0x08,0x3E,0x0D,0x9B,0x52,0x56,0xD0,0x09,0xAC,0x8A,0xBA,0xD8,0x15,0x84,0x91,0x03,
+    0x3F,0x03,0x71,0x1E,0x49,0xE3,0x3B,0x27,0xD3,0x3A,0x8A,0xD7,0x75,0x03,0xAB,0xDA,
+    0x45,0xDF,0xEC,0xBC,0xB2,0x54,0x33,0xFD,0xD3,0xDB,0x4F,0x70,0xB4,0x6F,0x37,0xEC,
+    0x02,0x00,0x00,
+};
+
+static const unsigned char data_error_html_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "292288bba000e8d1"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x32,0x39,0x32,0x32,0x38,0x38,0x62,0x62,0x61,
+    0x30,0x30,0x30,0x65,0x38,0x64,0x31,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_error_html_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "292288bba000e8d1"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x32,0x39,0x32,0x32,0x38,0x38,0x62,0x62,0x61,
+    0x30,0x30,0x30,0x65,0x38,0x64,0x31,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_error_html_gz[] = {{
+    "\"292288bba000e8d1\"",
+    data_error_html_gz_304,
+    sizeof(data_error_html_gz_304),
+    data_error_html_gz_206,
+    sizeof(data_error_html_gz_206),
+    249,
+}};
+
 static const unsigned char data_index_html[] = {
 
     /* "/index.html" (12 chars) */
     0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -666,6 +1447,22 @@ static const unsigned char data_index_html[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x39,0x34,0x37,0x30,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "5f7f26785706bd8b"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x35,0x66,0x37,0x66,0x32,0x36,0x37,0x38,0x35,
+    0x37,0x30,0x36,0x62,0x64,0x38,0x62,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/html" (27 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
@@ -1265,13 +2062,476 @@ static const unsigned char data_index_html[] = {
     0x62,0x6F,0x64,0x79,0x3E,0x0A,0x3C,0x2F,0x68,0x74,0x6D,0x6C,0x3E,0x0A,
 };
 
+static const unsigned char data_index_html_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "5f7f26785706bd8b"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x35,0x66,0x37,0x66,0x32,0x36,0x37,0x38,0x35,
+    0x37,0x30,0x36,0x62,0x64,0x38,0x62,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_index_html_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "5f7f26785706bd8b"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x35,0x66,0x37,0x66,0x32,0x36,0x37,0x38,0x35,
+    0x37,0x30,0x36,0x62,0x64,0x38,0x62,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_index_html[] = {{
+    "\"5f7f26785706bd8b\"",
+    data_index_html_304,
+    sizeof(data_index_html_304),
+    data_index_html_206,
+    sizeof(data_index_html_206),
+    226,
+}};
+
+static const unsigned char data_index_html_gz[] = {
+
+    /* "/index.html" (12 chars) */
+    0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 2931" (22 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x32,0x39,0x33,0x31,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "9b200395647ffe34"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x39,0x62,0x32,0x30,0x30,0x33,0x39,0x35,0x36,
+    0x34,0x37,0x66,0x66,0x65,0x33,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (27 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (2931 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xAD,0x1A,0x6B,0x6F,0xDB,0x38,
+    0xF2,0xB3,0xF3,0x2B,0x58,0x2D,0xB0,0x96,0x11,0xDB,0xB2,0xD3,0xC7,0xF5,0x9C,0x38,
+    0x87,0x36,0xC9,0xEE,0xF5,0xD0,0x6D,0x02,0x38,0xDD,0xE2,0x70,0x28,0x16,0xB2,0x44,
+    0xD9,0x6C,0x64,0xD1,0x4B,0x49,0x71,0x72,0x59,0xFF,0xF7,0x9B,0x19,0x52,0x0F,0xCA,
+    0x8F,0xB8,0xB8,0x66,0x17,0x8D,0x44,0xCE,0x0C,0xE7,0xCD,0x99,0x51,0xCE,0x5E,0x5C,
+    0x5E,0x5F,0xDC,0xFE,0xFB,0xE6,0x8A,0xCD,0xB3,0x45,0x7C,0x7E,0x74,0xA6,0x7F,0xB5,
+    0xCE,0xE6,0xDC,0x0F,0xE1,0x77,0xEB,0x6C,0xC1,0x33,0x9F,0x05,0x73,0x5F,0xA5,0x3C,
+    0x1B,0x3B,0x79,0x16,0xF5,0xDE,0x3A,0xD5,0x46,0xE2,0x2F,0xF8,0xD8,0xB9,0x17,0x7C,
+    0xB5,0x94,0x2A,0x73,0x58,0x20,0x93,0x8C,0x27,0x00,0xB8,0x12,0x61,0x36,0x1F,0x87,
+    0xFC,0x5E,0x04,0xBC,0x47,0x2F,0x5D,0x96,0xA7,0x5C,0xF5,0xD2,0xC0,0x8F,0xFD,0x69,
+    0xCC,0xC7,0x89,0x04,0x3A,0xCC,0xFC,0x9C,0xC5,0x22,0xB9,0x63,0x8A,0xC7,0x63,0x27,
+    0xCD,0x1E,0x63,0x9E,0xCE,0x39,0x07,0x72,0xD9,0xE3,0x12,0xC8,0x67,0xFC,0x21,0xF3,
+    0x82,0x34,0x75,0xD8,0x5C,0xF1,0x68,0xEC,0xC0,0xA3,0x17,0xC8,0xC5,0x42,0x26,0x7D,
+    0x5C,0x25,0x6E,0xBE,0x17,0x3F,0x15,0x62,0xB1,0x8C,0x79,0x7F,0x21,0x92,0x3E,0xB0,
+    0xF8,0x7F,0x10,0x42,0xA8,0xAD,0xE8,0x73,0xD0,0x48,0x90,0x67,0x4C,0x80,0x52,0x0A,
+    0x0C,0xB1,0x98,0x79,0x91,0x7F,0x8F,0x4B,0xFD,0x65,0x32,0xD3,0x38,0x99,0xC8,0x62,
+    0x7E,0xFE,0x85,0x4F,0xDF,0xFD,0x99,0xFB,0x1F,0xC5,0x6C,0x9E,0x9D,0x79,0x7A,0x0D,
+    0x0C,0xE1,0x19,0x4B,0x9C,0x4D,0x65,0xF8,0x78,0x7E,0x44,0x1A,0x3B,0x0B,0xC5,0x3D,
+    0x0B,0x62,0x3F,0x4D,0x81,0x07,0xD0,0xB8,0x2F,0x12,0xAE,0xD8,0xDC,0x4F,0x7B,0xCB,
+    0xAC,0xF7,0x4A,0x3F,0x4C,0x8B,0x87,0xB8,0x37,0xD0,0x0F,0xAA,0x37,0xA8,0x6B,0xBC,
+    0x46,0x03,0xB7,0x57,0x3D,0x3F,0xCF,0xE4,0x26,0x0A,0x3D,0x2C,0xE2,0x6A,0x77,0xA1,
+    0xE8,0xB9,0x46,0x6A,0x83,0x25,0x5F,0x85,0x4C,0xA4,0xBD,0x74,0xEE,0x87,0x72,0xC5,
+    0x43,0x92,0x12,0xE4,0x44,0x10,0x11,0xA2,0x62,0xFD,0x2C,0x4F,0xFF,0x98,0xCA,0x07,
+    0xA7,0x40,0xF1,0x63,0xAE,0x32,0xC2,0xE1,0x20,0x50,0xE8,0xAB,0x47,0x83,0x04,0x1A,
+    0xF5,0xA7,0x3C,0xAE,0xE1,0x39,0x36,0xD7,0x51,0x1E,0xC7,0xC4,0x17,0x1A,0xA7,0x17,
+    0x80,0xF3,0x71,0xE5,0x9C,0x4F,0x32,0x5F,0x65,0x22,0x99,0xF5,0xFB,0xFD,0x33,0x8F,
+    0x28,0x18,0x1E,0x3C,0x60,0xC2,0xE6,0xBC,0xE4,0xDE,0x8F,0xC5,0x2C,0x01,0xEE,0x0D,
+    0x89,0x0D,0x20,0xED,0xA7,0x15,0x37,0x22,0xE3,0x25,0x2F,0x66,0x39,0xED,0x4D,0x63,
+    0x19,0xDC,0x11,0x3F,0xA9,0xF8,0x2F,0xEF,0xBD,0x74,0xD0,0xAE,0x0C,0x0D,0xCB,0x8C,
+    0x65,0x0D,0x37,0x1B,0x94,0x35,0x67,0x96,0xA2,0x96,0x22,0xB8,0x03,0x56,0x1A,0x9C,
+    0xD5,0xE5,0x07,0x7B,0xBF,0x29,0xEC,0xFD,0xC6,0x39,0x6F,0x12,0xD9,0x61,0x90,0x43,
+    0x5C,0x05,0xE1,0xA3,0x98,0x3F,0xD0,0xC2,0xB7,0x3C,0xCD,0x44,0xF4,0x68,0xD4,0xDB,
+    0x54,0x37,0xBD,0x83,0x36,0x16,0x69,0x6F,0xBF,0xF2,0x6A,0x2C,0xD5,0xA9,0x37,0x50,
+    0x5B,0xDA,0xEE,0x22,0x59,0x42,0xF0,0xE8,0xC0,0x0B,0xE6,0x3C,0xB8,0x23,0x7F,0x21,
+    0xCD,0xE7,0xC9,0x1F,0xE9,0x4A,0x64,0xC1,0xBC,0xD4,0x45,0xF1,0x2A,0x93,0x20,0x06,
+    0xA5,0x8D,0x1D,0x99,0x4C,0xF2,0x64,0x42,0xAB,0x17,0xB8,0xE2,0x66,0x73,0x91,0xF6,
+    0x89,0x0E,0x0F,0x3B,0xA7,0x8E,0x57,0xB8,0x57,0xA5,0xB1,0xD6,0xF7,0xF1,0xA7,0x4D,
+    0x6E,0xD9,0xBF,0x34,0xFB,0xB0,0x88,0x9A,0x13,0x54,0x63,0x9E,0xA4,0x3C,0xE6,0x41,
+    0x86,0x69,0xCF,0x61,0x91,0x54,0x96,0x08,0xE7,0xB7,0x73,0xCE,0x80,0x59,0x26,0x16,
+    0x02,0x1C,0x5C,0xC8,0x84,0x2D,0x64,0xC8,0x2D,0xB7,0xAD,0xB3,0xB9,0xC5,0x85,0x1B,
+    0x4B,0xB5,0x57,0xF3,0x08,0xE9,0x23,0x0D,0x94,0x58,0x66,0x2C,0x55,0xC1,0xD8,0xF9,
+    0x96,0x7A,0x42,0xC9,0xFE,0xB7,0xD4,0x4A,0x6C,0xDF,0xFC,0x7B,0x5F,0x43,0xA1,0x23,
+    0xE9,0xA7,0xF3,0x12,0x13,0x0F,0xBF,0xF7,0x15,0x5B,0xA5,0xA7,0xE6,0x49,0xF1,0x4C,
+    0x09,0x4E,0xAF,0x9E,0x87,0x0B,0x90,0xDE,0xE1,0x9D,0x8D,0x59,0xC2,0x57,0xEC,0x56,
+    0x2C,0xF8,0x84,0x16,0xDC,0xCE,0x69,0xC9,0x1A,0x82,0x05,0x32,0x96,0xEA,0x86,0x5C,
+    0xDB,0xC0,0x22,0x33,0x17,0xD5,0xAA,0xDB,0xFE,0x49,0x7B,0x7E,0xBB,0xCB,0x9E,0xD8,
+    0x0A,0x32,0x70,0x4C,0xB1,0x93,0xF0,0x34,0x1D,0xB1,0xC8,0x8F,0x53,0xCE,0xD6,0x1D,
+    0x3C,0x17,0x72,0x45,0x9A,0x01,0x4B,0x37,0x4A,0x66,0x12,0xE8,0x02,0xBD,0x27,0x36,
+    0xE3,0xD9,0x85,0x4C,0x12,0x50,0x38,0xE8,0xF2,0xC6,0x57,0x70,0x45,0x81,0xE1,0x00,
+    0x73,0xF0,0x30,0x18,0x76,0xB7,0x7A,0x66,0xF9,0x93,0xEE,0xC1,0x3D,0x39,0x04,0x17,
+    0x84,0x20,0xE0,0x97,0x5D,0xE3,0x27,0x2D,0x5C,0x07,0xF3,0x7E,0x28,0xAC,0xFB,0x1B,
+    0x18,0x97,0x40,0x5E,0x55,0x20,0xC0,0xF2,0x84,0x92,0x1B,0x6D,0xBC,0x2E,0x36,0x34,
+    0xD9,0x3C,0x08,0x48,0x70,0xD8,0x19,0x58,0x3B,0x32,0x29,0x64,0xAA,0x2F,0x46,0xD1,
+    0x16,0x50,0x63,0xAB,0x11,0xB3,0x69,0xA3,0xA3,0xD5,0x79,0x03,0xCC,0x67,0x84,0x44,
+    0x0C,0x23,0xE5,0x70,0x83,0xD4,0xE7,0xE4,0x2E,0x91,0x2B,0xA0,0x72,0xF2,0xFA,0x35,
+    0x5B,0x17,0x7E,0x22,0x30,0x6E,0xEE,0xFD,0xF8,0x43,0x08,0xE6,0x19,0x14,0xAB,0x44,
+    0x68,0xEE,0x27,0x33,0x8E,0x46,0x83,0x28,0xCA,0x46,0x35,0x43,0xF6,0x6B,0xE4,0xBA,
+    0x40,0x41,0x64,0xC2,0xCF,0x78,0xF8,0xFE,0xF1,0x33,0x38,0x99,0xF1,0x81,0x2E,0xF8,
+    0x0E,0x0F,0x3F,0x8B,0xCF,0xCB,0x10,0xF6,0xCC,0x22,0x9D,0x0A,0xFF,0xAF,0x44,0x02,
+    0xA9,0xAE,0x2F,0x93,0x58,0xFA,0x78,0xAE,0x4C,0xBE,0xD0,0xCA,0x47,0x78,0x3D,0x85,
+    0x78,0x68,0x45,0x79,0x42,0x46,0xB6,0x76,0xDC,0x0E,0xEC,0x3C,0xA1,0x58,0xE8,0x59,
+    0x12,0x2E,0xF6,0x58,0xCE,0x5C,0x47,0x03,0x30,0x24,0x05,0xB7,0x19,0x79,0x1E,0x8A,
+    0xBC,0x4A,0xAF,0x97,0x3C,0x71,0xE9,0xBD,0x55,0xF3,0x6A,0x38,0xD5,0x6D,0x53,0xFA,
+    0x1A,0xA5,0x78,0x0F,0x81,0x1B,0x43,0x3A,0xC2,0x27,0xD2,0x9C,0x96,0x7A,0x1F,0x16,
+    0x4F,0x42,0xC2,0xB9,0x4A,0xC2,0x0D,0x0C,0xCF,0x23,0x9A,0x37,0x32,0x86,0x52,0x63,
+    0x66,0x0E,0xB7,0x54,0x0C,0xFE,0xF6,0xC1,0xBC,0xBB,0xA5,0x63,0x75,0xD9,0x70,0x30,
+    0x18,0x10,0xF4,0xDA,0x12,0xBF,0x84,0xD8,0x21,0xFB,0xAF,0x1C,0x92,0x86,0xBE,0x78,
+    0x0B,0x06,0x82,0x98,0xFB,0xAA,0x3C,0xA2,0x3A,0x5B,0xEF,0xC7,0x80,0x30,0xCD,0xA3,
+    0xA8,0x8C,0xEE,0x77,0x4A,0xF9,0x8F,0xEF,0x69,0xC5,0x1D,0xD6,0x72,0x01,0xFE,0x20,
+    0x30,0x56,0x8F,0x06,0xF4,0x33,0x10,0x7B,0x4B,0xF0,0xAE,0x26,0xA1,0x49,0x22,0xC4,
+    0x7F,0x06,0x5F,0x01,0xA8,0xE6,0x21,0x25,0xE3,0x04,0xB2,0x4A,0x27,0xA0,0xB5,0x5B,
+    0x09,0x29,0xE7,0x1E,0xCE,0xA9,0x61,0xDB,0xE2,0xE6,0xE4,0x2C,0x1A,0xF1,0xBD,0x7C,
+    0x70,0x83,0x18,0x54,0x83,0xE9,0xAF,0x94,0x3E,0x85,0x7B,0x06,0x4E,0x0A,0x65,0x90,
+    0x2F,0x20,0xE5,0xE3,0x39,0x57,0x31,0xC7,0xC7,0xF7,0x8F,0x1F,0x42,0xB7,0x5D,0x55,
+    0x2F,0x6D,0xCD,0x1D,0x22,0xF4,0xE9,0x1E,0xF8,0x04,0xE9,0x02,0x50,0xAB,0x6A,0xC6,
+    0x61,0xC7,0x70,0x43,0x68,0x0E,0x53,0x7D,0x47,0x3C,0x4B,0xB9,0xA0,0x4A,0xE0,0x7D,
+    0x01,0xC9,0x48,0xDD,0x02,0x7F,0x80,0x88,0x6C,0x9E,0x36,0x0D,0x44,0xBC,0x6F,0xCA,
+    0x09,0x79,0x06,0x92,0x86,0x3F,0xE3,0xBF,0x28,0xB9,0x30,0x4A,0xE1,0xF7,0x95,0x94,
+    0x26,0x21,0x90,0x11,0x4C,0x54,0xB6,0x4A,0x63,0xD0,0x5A,0xC3,0x1E,0x80,0xDC,0x07,
+    0xD5,0xF9,0x95,0x91,0xB1,0x04,0xF7,0x13,0xF4,0x38,0x63,0x9F,0x72,0x47,0x0B,0xC2,
+    0x8A,0x9D,0xE1,0x57,0x8A,0x38,0xDB,0xAF,0x0C,0x7B,0x2C,0x02,0xFE,0xF0,0xE6,0xB8,
+    0xC7,0xB8,0x46,0x7D,0x21,0x4A,0x47,0x23,0x88,0x88,0xB9,0xAE,0x6D,0xF2,0x6D,0xD9,
+    0x99,0x8D,0xC7,0x05,0x33,0x1D,0xF6,0xF3,0xCF,0xAC,0x8E,0x62,0xB2,0x27,0x82,0x68,
+    0xAE,0x3A,0xA8,0x02,0xAD,0x03,0x9B,0x21,0xA0,0x1C,0x89,0x59,0xAE,0xF4,0x15,0xAC,
+    0x78,0xC0,0xC5,0x3D,0x0F,0x5F,0x38,0x86,0x17,0x12,0x0C,0x92,0x2B,0x44,0x17,0xC8,
+    0x75,0x72,0x5A,0xAE,0xA5,0xA9,0x40,0x1D,0x90,0x3B,0x2A,0xD4,0xB6,0x71,0x75,0x94,
+    0xA3,0x6B,0x30,0xB4,0xD2,0x5A,0x06,0xFD,0x78,0x4C,0x48,0xFD,0x98,0x27,0xB3,0x6C,
+    0x5E,0x51,0x5A,0xAE,0xBE,0x9F,0x10,0xE0,0x6C,0xD0,0xC1,0xCA,0xF4,0x00,0x42,0xBB,
+    0x54,0xA0,0xCD,0x40,0x1C,0x42,0x58,0xE7,0x1C,0x5E,0x1C,0x5A,0xC2,0xB3,0xEC,0x15,
+    0x3C,0x49,0x2F,0x19,0x7A,0xE8,0x3A,0xBB,0xFD,0x1B,0xA0,0xDB,0x1D,0xCB,0xA5,0x2B,
+    0x02,0xC4,0xFE,0x1A,0xFF,0xE1,0x78,0xBF,0x37,0x4D,0x5F,0x5C,0xAE,0x3F,0xCA,0xD6,
+    0x48,0x4A,0xA4,0x98,0x2B,0x5F,0x98,0xBC,0xB6,0xF7,0xEC,0xE6,0x05,0xFE,0x63,0xD8,
+    0xD8,0x5E,0xF9,0xED,0xE5,0x6B,0x5B,0x02,0xAC,0x33,0x53,0x9D,0x84,0x9E,0x40,0xE4,
+    0x4C,0x14,0x9E,0x7C,0xAD,0x3C,0x24,0xD0,0xAA,0x64,0x4F,0x10,0x73,0xB4,0xF9,0xF2,
+    0x6B,0x97,0xCD,0xCC,0xF3,0x2B,0x78,0x9E,0x9A,0xE7,0xD7,0x5F,0xD7,0x15,0x56,0x98,
+    0xA5,0xBB,0xDD,0xEA,0x8D,0x71,0xCD,0x2D,0x7A,0x1E,0x93,0xAF,0xD0,0x99,0x7D,0x85,
+    0xBE,0x33,0xAA,0xDE,0x67,0x8D,0xF7,0x29,0xF9,0x56,0x8F,0x30,0xE0,0x3C,0xCB,0xB9,
+    0x5A,0xCD,0xE4,0xED,0x18,0x55,0x3B,0xDD,0x4D,0xD8,0xAA,0xC2,0xDE,0x93,0x72,0xEB,
+    0x75,0x78,0x81,0xD8,0xB4,0x7E,0xB3,0x46,0x42,0x6D,0xE3,0x9A,0xB6,0x7B,0xA6,0x72,
+    0x72,0x86,0x8A,0x50,0xD9,0x64,0x90,0x2D,0x8C,0x31,0xAC,0x8B,0x5E,0x4B,0x0A,0x26,
+    0x76,0xE9,0xC9,0x28,0x6E,0x5D,0x9E,0x4E,0x56,0x7B,0x31,0xAE,0x95,0x48,0x7D,0xAC,
+    0x8F,0x2C,0x7A,0x8D,0x3D,0xA6,0xA1,0x35,0x25,0x22,0xA2,0xCB,0xE4,0xB1,0x45,0xA5,
+    0x51,0x47,0x69,0x82,0x05,0xC5,0x3A,0xC9,0x7A,0x61,0x85,0x17,0x8F,0xCA,0x0B,0xD2,
+    0xEB,0x06,0xAF,0x85,0xFC,0x3B,0x90,0x2D,0x9E,0x1B,0xFE,0xBB,0x53,0xB1,0x47,0x45,
+    0x51,0x69,0xF0,0x74,0x15,0xDC,0xD4,0xEF,0x36,0xBE,0x28,0x4E,0x6C,0xA9,0xB6,0x22,
+    0x92,0x72,0x6C,0xCC,0xE7,0x0D,0xB4,0x47,0x41,0x35,0x7A,0xEB,0x32,0x66,0x3D,0x0F,
+    0x05,0x06,0xA7,0x44,0xC1,0x06,0x0F,0xEF,0xAF,0xAE,0x7E,0x61,0x7F,0xFD,0xC5,0xCA,
+    0x85,0xCB,0xAB,0x77,0x97,0x1D,0x0D,0x68,0x47,0xCD,0xC7,0xAB,0x4B,0xA6,0x59,0x2E,
+    0xAA,0x4D,0x00,0x29,0x24,0x03,0x60,0xDD,0x67,0xF5,0xFD,0x25,0x54,0x9F,0xA1,0x8B,
+    0xF7,0xF4,0x25,0xB0,0xE1,0x76,0xD0,0xBB,0xB1,0xED,0x72,0x3B,0x5D,0x3C,0xC5,0x54,
+    0x05,0x54,0x0E,0x7B,0x5E,0x59,0x19,0xE8,0xAA,0x15,0x42,0x98,0xFB,0x0B,0xAA,0xF9,
+    0x3C,0xEF,0x89,0xFE,0xA5,0xB2,0x3C,0x57,0x02,0xE3,0x15,0x8A,0x4C,0xDC,0x77,0xAA,
+    0x8D,0x55,0xD1,0xD8,0x7D,0xE1,0xD3,0x89,0x04,0x35,0x65,0xAE,0xB3,0x4A,0x47,0x9E,
+    0x17,0xCB,0xC0,0x8F,0xE7,0x12,0xEA,0xF7,0xB7,0x83,0xB7,0x03,0xE0,0x97,0x79,0x1E,
+    0x04,0x2F,0x2E,0xE3,0x79,0x7D,0xDC,0x82,0x77,0x20,0xDC,0xD1,0xAD,0x22,0x16,0x6B,
+    0x50,0xEC,0x2E,0x4C,0x01,0x00,0xDA,0x33,0xAC,0x51,0x81,0xC2,0x0C,0x33,0x76,0x26,
+    0xB1,0xAA,0x0F,0xDA,0xA5,0x86,0x13,0x1C,0x07,0xD9,0xFA,0xD7,0xE4,0xFA,0x53,0x7F,
+    0x89,0x23,0xCA,0x2D,0x80,0x75,0x32,0x84,0x50,0x6D,0xED,0xBC,0xA9,0xF2,0x65,0x06,
+    0x7A,0x2C,0xEE,0xAA,0x7F,0xDE,0xFE,0xF6,0x91,0xE9,0x64,0x9E,0xF6,0xF5,0x16,0x08,
+    0xD4,0x66,0x7A,0x56,0x95,0xB6,0x9F,0xA7,0x37,0xE7,0xFE,0x72,0x2B,0x35,0xDC,0x20,
+    0x5A,0xD3,0xC7,0x8C,0x1F,0x42,0x29,0xE6,0x61,0x83,0x90,0x16,0x0A,0x8A,0x80,0x10,
+    0xDD,0x6A,0xD8,0x61,0xFF,0x60,0xED,0xEB,0xA4,0xCD,0x46,0xF0,0x2B,0x8A,0x4A,0x92,
+    0x6B,0xF3,0x60,0x1C,0xA2,0xE1,0x0E,0x55,0xF1,0xAF,0x83,0x14,0x48,0x8D,0x59,0x9E,
+    0x84,0x3C,0x12,0x09,0x10,0x06,0xB7,0x05,0x9B,0x81,0x47,0x84,0x8F,0x98,0x7D,0x29,
+    0x3B,0x95,0x7E,0xD0,0xBF,0xB8,0xFE,0xF4,0xE9,0xEA,0xE2,0xF6,0xC3,0xA7,0x5F,0x6B,
+    0xD7,0x4F,0x23,0xD8,0x8B,0x7A,0xF3,0xAC,0x68,0x45,0xAD,0xCC,0xB0,0x91,0xD8,0x43,
+    0x8C,0x32,0x05,0x79,0xDD,0x41,0x87,0x96,0x79,0x79,0x1B,0x9A,0x70,0x2D,0xE3,0x7C,
+    0x17,0x81,0x6A,0x8E,0x08,0x34,0x8A,0xA2,0x91,0xE6,0x81,0x36,0x21,0x2B,0xF0,0x6C,
+    0x9F,0xD5,0xD7,0x96,0xB5,0x66,0x50,0xE9,0x8A,0xB0,0x36,0x12,0xAA,0xFC,0x41,0x67,
+    0x4E,0x19,0x0E,0x4E,0x07,0xD4,0xA6,0xB9,0xDB,0x05,0x3B,0x3C,0xF9,0x5B,0x7F,0x00,
+    0xFF,0x0D,0x0F,0x80,0x8D,0xA0,0xFF,0x6A,0xDC,0x28,0xF5,0x0E,0x75,0x32,0x62,0x90,
+    0xD2,0x89,0xDB,0x98,0xE9,0xE3,0x4F,0xCB,0x3C,0x7A,0x78,0xEC,0xEE,0x51,0xF1,0xD6,
+    0xF3,0x14,0x5F,0x48,0x70,0x87,0xFA,0x81,0xAD,0x9D,0xA7,0xED,0x52,0xA7,0x3E,0x0F,
+    0x1C,0x6C,0x2A,0x12,0xB0,0xD8,0xED,0xE3,0x12,0xB3,0x42,0xDB,0xC7,0xBE,0x43,0x37,
+    0x72,0xED,0xD3,0x02,0x44,0x26,0x12,0xDC,0x75,0x33,0x69,0xE0,0x34,0xC4,0x98,0x99,
+    0x57,0x6D,0x20,0xEE,0x9D,0xB2,0x75,0x0D,0x9B,0x2B,0x45,0x15,0x49,0x13,0x7D,0x8F,
+    0x07,0x5E,0x21,0x0A,0xFA,0x9F,0x45,0x68,0x67,0xFA,0xDA,0xD9,0x7A,0xD9,0xF8,0x41,
+    0x2C,0x53,0x7E,0x08,0x23,0x2B,0x5F,0x25,0xE0,0xB9,0xC8,0xC9,0xA5,0x48,0x83,0x42,
+    0xC6,0x1A,0x3F,0x9E,0x67,0xE7,0x74,0xBD,0x5A,0x44,0x5C,0xD1,0xDD,0x1D,0x74,0xBF,
+    0x6F,0x96,0x15,0xDB,0x67,0x32,0x1B,0xD0,0x8D,0xD2,0xC2,0xBA,0x13,0xD7,0x1B,0xDD,
+    0xE9,0x32,0xC7,0x1A,0xF2,0x43,0xB2,0xA5,0x31,0xE9,0x42,0x66,0x54,0x20,0x6F,0x99,
+    0x90,0xB0,0xF2,0x8C,0xC9,0xE4,0x7A,0xA3,0xDE,0xEE,0x14,0x3D,0x19,0x0E,0x78,0x08,
+    0x5B,0xD7,0x70,0x54,0xBA,0xE2,0xC2,0xF1,0x31,0x0E,0x0D,0x00,0x81,0xA0,0x23,0xB0,
+    0xBC,0x8B,0x28,0x82,0x94,0x02,0xBF,0xCE,0x68,0x8F,0x89,0xE3,0x63,0x7D,0xFC,0xF1,
+    0xB1,0xC9,0x60,0xCD,0xB1,0x57,0x49,0xF1,0x6B,0xC5,0x07,0x7E,0x14,0xBB,0x00,0x0D,
+    0xBC,0xCB,0x5C,0xD1,0x18,0x6B,0xAC,0xB7,0x8F,0x59,0x76,0x36,0x63,0x46,0xD6,0x62,
+    0x22,0xD2,0x10,0xA9,0xDA,0x40,0x3D,0x14,0xF5,0xBC,0x91,0xAF,0xBE,0x0D,0x8C,0xE1,
+    0x76,0xBB,0x4D,0x6A,0xC0,0xD5,0x7D,0x22,0x77,0x8E,0xAA,0x2A,0xAB,0x9C,0x61,0x02,
+    0x05,0xE8,0x2A,0x27,0x5A,0x42,0xEC,0xCD,0x2F,0x8C,0x94,0x6E,0xFD,0xD0,0x72,0x04,
+    0xB6,0x2E,0x0E,0x02,0x6F,0xCB,0x55,0xC2,0x9E,0xA8,0x06,0x1F,0x21,0x9D,0x2E,0xD3,
+    0x86,0x1A,0x21,0x03,0x09,0x84,0xFE,0xB0,0xB3,0xDE,0x36,0xA7,0x68,0xCC,0xE9,0x8B,
+    0xEA,0x79,0xEB,0x30,0xCA,0x6E,0x96,0x4C,0x79,0x4F,0x13,0x7F,0xDD,0xB4,0x96,0xF3,
+    0xFD,0xA3,0x67,0x27,0x51,0x27,0xDF,0x3F,0x89,0xDA,0x39,0x8A,0xDA,0xD2,0x20,0x9E,
+    0x16,0x77,0x69,0x4D,0x1E,0x93,0x49,0xCD,0x4C,0xC4,0x26,0x21,0x13,0xBB,0xD9,0x7B,
+    0x0E,0x3C,0x8A,0x0C,0xFC,0xD1,0x73,0x71,0x58,0x05,0xF7,0xFE,0x39,0x59,0xAB,0x36,
+    0x09,0xDC,0xB4,0x53,0x03,0x8F,0x4A,0xAC,0x7A,0xC9,0xE0,0xDA,0xF5,0xC1,0xD8,0xAA,
+    0x0F,0x3E,0x5E,0x4F,0xAE,0x2E,0xF1,0x8A,0xDB,0x5F,0x12,0x80,0x4B,0x56,0x6A,0xDA,
+    0x18,0xB0,0x36,0xFB,0xE0,0x9D,0xC7,0x5D,0xDF,0x5C,0x7D,0x6A,0xD2,0x01,0x13,0x41,
+    0xA9,0x5C,0xCD,0xAF,0x0E,0x26,0xB6,0xB5,0xB6,0x69,0xA6,0xD6,0xF5,0x36,0xB7,0x6E,
+    0xCC,0x7B,0x4D,0x2B,0x51,0xE8,0xEC,0xA0,0x8E,0x74,0x6B,0xC7,0x72,0x90,0xB1,0xD7,
+    0x47,0xA5,0x73,0xD7,0x78,0xB2,0xE7,0xC9,0x75,0x8E,0xEA,0x91,0x60,0x45,0x1C,0xA0,
+    0x94,0xD3,0x82,0x5A,0x17,0x0F,0x3C,0x35,0xFA,0x78,0xC5,0x29,0xC8,0xAD,0x5E,0xDE,
+    0xB4,0xE3,0xCD,0x30,0xDB,0x19,0x93,0xAF,0x7E,0x6C,0x4C,0x92,0xAC,0xD5,0x00,0x99,
+    0x62,0xA8,0xE4,0xBF,0x5A,0x3F,0xA9,0xD6,0x49,0x8A,0x6A,0xE7,0x65,0xB5,0x33,0x8D,
+    0x0F,0x89,0xA2,0x2A,0xFF,0xDB,0xCE,0xB0,0xBD,0x32,0x69,0xCE,0x62,0x0B,0x77,0xDA,
+    0x33,0xE6,0x70,0x2E,0x6A,0xF7,0xFF,0xE6,0x50,0xF5,0x56,0x3D,0xB2,0x4C,0xE2,0x65,
+    0xC3,0xB2,0x39,0x47,0x4B,0x56,0x23,0xCD,0x5A,0xE9,0x7B,0xB8,0x45,0x86,0x3F,0xD0,
+    0x22,0x3B,0xA6,0xB7,0x7B,0xC7,0xF7,0xBB,0xF2,0x52,0xA5,0x5C,0xFB,0x6B,0x88,0x19,
+    0x19,0xD0,0x67,0x46,0xB8,0xB8,0x32,0xC3,0xE7,0x64,0x21,0x65,0x36,0x17,0x18,0x37,
+    0x2A,0x73,0x9F,0x16,0x02,0xC0,0xD3,0x1B,0x0E,0xFD,0xFE,0x03,0x8F,0x47,0xC3,0x61,
+    0x77,0xA6,0x44,0x38,0x7A,0x8A,0x60,0x7D,0x82,0x7F,0xCF,0x31,0x6A,0xFF,0x14,0xD1,
+    0x4F,0xBB,0x0B,0x37,0x99,0xBC,0xE3,0xCD,0xD5,0xA9,0x54,0x21,0x57,0xBF,0x8B,0x54,
+    0x4C,0x61,0x5D,0x7F,0x79,0x32,0x9F,0xC3,0x68,0x6E,0x9F,0xDA,0xC4,0x06,0xF4,0xD3,
+    0x5E,0x77,0x17,0xFE,0xC3,0xEF,0x74,0x43,0x0E,0x07,0x27,0xAF,0xBA,0x0B,0x91,0xE8,
+    0xB7,0xC1,0xBA,0x98,0x9E,0x21,0x83,0x7D,0x3F,0x0C,0x6B,0x9F,0x4F,0x75,0xBB,0xDF,
+    0x65,0x4F,0x20,0x22,0xFF,0x82,0x7F,0x4A,0x33,0x3A,0x69,0xB0,0x35,0x78,0xE9,0xFF,
+    0x3D,0x7A,0xD5,0xEE,0x5A,0x02,0x0C,0xA3,0xD7,0x91,0xDF,0xB6,0x29,0xEB,0xB6,0xFE,
+    0x56,0xBA,0x3B,0xF3,0x0F,0xC1,0x5D,0xF8,0xC9,0xBD,0x0F,0x0D,0x47,0x97,0xBD,0x36,
+    0x1F,0x8D,0x5A,0xAD,0xFA,0x67,0xA5,0xB2,0x68,0xC5,0x8A,0x75,0x95,0x7E,0x51,0x22,
+    0xE3,0x6E,0xFB,0x5D,0x1B,0x6B,0xD2,0x1A,0x4E,0xC3,0x54,0xB3,0xA5,0x90,0xA5,0x89,
+    0x30,0xEF,0xEE,0xEB,0x72,0x7B,0x3A,0x09,0xB6,0xCB,0x24,0xD8,0x29,0xBA,0x0B,0x73,
+    0xDA,0x95,0xF9,0x50,0x52,0x9B,0xF9,0x94,0x7B,0x97,0xED,0x2A,0xCD,0xD7,0x3F,0x65,
+    0x7B,0xFA,0x8F,0x68,0xCE,0x3C,0xFD,0x67,0x4E,0xFF,0x03,0xE2,0x1C,0xA4,0xEC,0xFE,
+    0x24,0x00,0x00,
+};
+
+static const unsigned char data_index_html_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "9b200395647ffe34"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x39,0x62,0x32,0x30,0x30,0x33,0x39,0x35,0x36,
+    0x34,0x37,0x66,0x66,0x65,0x33,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (27 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_index_html_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "9b200395647ffe34"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x39,0x62,0x32,0x30,0x30,0x33,0x39,0x35,0x36,
+    0x34,0x37,0x66,0x66,0x65,0x33,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: no-cache" (25 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6E,
+    0x6F,0x2D,0x63,0x61,0x63,0x68,0x65,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_index_html_gz[] = {{
+    "\"9b200395647ffe34\"",
+    data_index_html_gz_304,
+    sizeof(data_index_html_gz_304),
+    data_index_html_gz_206,
+    sizeof(data_index_html_gz_206),
+    250,
+}};
+
+static const unsigned char data_status_shtml[] = {
+
+    /* "/status.shtml" (14 chars) */
+    0x2F,0x73,0x74,0x61,0x74,0x75,0x73,0x2E,0x73,0x68,0x74,0x6D,0x6C,0x00,0x00,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Type: text/html" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x68,0x74,0x6D,0x6C,0x0D,0x0A,
+
+    /* "Connection: close" (21 chars) */
+    0x43,0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3A,0x20,0x63,0x6C,0x6F,0x73,
+    0x65,0x0D,0x0A,0x0D,0x0A,
+
+    /* raw file data (1092 bytes) */
+    0x3C,0x21,0x44,0x4F,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6D,0x6C,0x3E,0x0A,
+    0x3C,0x68,0x74,0x6D,0x6C,0x3E,0x0A,0x09,0x3C,0x68,0x65,0x61,0x64,0x3E,0x0A,0x09,
+    0x09,0x3C,0x6D,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3D,0x22,
+    0x75,0x74,0x66,0x2D,0x38,0x22,0x3E,0x0A,0x09,0x09,0x3C,0x6D,0x65,0x74,0x61,0x20,
+    0x6E,0x61,0x6D,0x65,0x3D,0x22,0x76,0x69,0x65,0x77,0x70,0x6F,0x72,0x74,0x22,0x20,
+    0x63,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x3D,0x22,0x77,0x69,0x64,0x74,0x68,0x3D,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x2D,0x77,0x69,0x64,0x74,0x68,0x2C,0x20,0x75,0x73,0x65,
+    0x72,0x2D,0x73,0x63,0x61,0x6C,0x61,0x62,0x6C,0x65,0x3D,0x6E,0x6F,0x22,0x3E,0x0A,
+    0x09,0x09,0x3C,0x6D,0x65,0x74,0x61,0x20,0x68,0x74,0x74,0x70,0x2D,0x65,0x71,0x75,
+    0x69,0x76,0x3D,0x22,0x72,0x65,0x66,0x72,0x65,0x73,0x68,0x22,0x20,0x63,0x6F,0x6E,
+    0x74,0x65,0x6E,0x74,0x3D,0x22,0x35,0x22,0x3E,0x0A,0x09,0x09,0x3C,0x6C,0x69,0x6E,
+    0x6B,0x20,0x72,0x65,0x6C,0x3D,0x22,0x73,0x74,0x79,0x6C,0x65,0x73,0x68,0x65,0x65,
+    0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,0x2F,0x63,0x73,
+    0x73,0x22,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x63,0x73,0x73,0x2F,0x66,0x6F,0x6E,
+    0x74,0x73,0x2E,0x63,0x73,0x73,0x22,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x3C,0x6C,0x69,0x6E,0x6B,0x20,0x72,0x65,0x6C,0x3D,0x22,0x73,0x74,0x79,0x6C,
+    0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x63,0x73,
+    0x73,0x2F,0x63,0x6F,0x6D,0x6D,0x6F,0x6E,0x2E,0x63,0x73,0x73,0x22,0x3E,0x0A,0x09,
+    0x09,0x3C,0x6C,0x69,0x6E,0x6B,0x20,0x72,0x65,0x6C,0x3D,0x22,0x73,0x74,0x79,0x6C,
+    0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x63,0x73,
+    0x73,0x2F,0x73,0x69,0x69,0x6D,0x70,0x6C,0x65,0x2E,0x6D,0x69,0x6E,0x2E,0x69,0x63,
+    0x65,0x2E,0x63,0x73,0x73,0x22,0x3E,0x0A,0x09,0x09,0x3C,0x6C,0x69,0x6E,0x6B,0x20,
+    0x72,0x65,0x6C,0x3D,0x22,0x73,0x74,0x79,0x6C,0x65,0x73,0x68,0x65,0x65,0x74,0x22,
+    0x20,0x74,0x79,0x70,0x65,0x3D,0x22,0x74,0x65,0x78,0x74,0x2F,0x63,0x73,0x73,0x22,
+    0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x63,0x73,0x73,0x2F,0x73,0x74,0x79,0x6C,0x65,
+    0x2E,0x63,0x73,0x73,0x22,0x3E,0x0A,0x09,0x09,0x3C,0x6C,0x69,0x6E,0x6B,0x20,0x72,
+    0x65,0x6C,0x3D,0x22,0x73,0x68,0x6F,0x72,0x74,0x63,0x75,0x74,0x20,0x69,0x63,0x6F,
+    0x6E,0x22,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x69,0x6D,0x67,0x2F,0x66,0x61,0x76,
+    0x69,0x63,0x6F,0x6E,0x2E,0x70,0x6E,0x67,0x22,0x3E,0x0A,0x09,0x09,0x3C,0x74,0x69,
+    0x74,0x6C,0x65,0x3E,0x48,0x54,0x54,0x50,0x20,0x53,0x65,0x72,0x76,0x65,0x72,0x3C,
+    0x2F,0x74,0x69,0x74,0x6C,0x65,0x3E,0x0A,0x09,0x3C,0x2F,0x68,0x65,0x61,0x64,0x3E,
+    0x0A,0x09,0x3C,0x62,0x6F,0x64,0x79,0x3E,0x0A,0x0A,0x20,0x20,0x20,0x20,0x3C,0x64,
+    0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x6F,0x6E,0x74,0x61,0x69,
+    0x6E,0x65,0x72,0x20,0x68,0x61,0x73,0x2D,0x70,0x74,0x2D,0x34,0x20,0x68,0x61,0x73,
+    0x2D,0x70,0x62,0x2D,0x34,0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,0x2D,0x30,0x20,0x68,
+    0x61,0x73,0x2D,0x70,0x72,0x2D,0x30,0x22,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,
+    0x73,0x2D,0x77,0x2D,0x61,0x75,0x74,0x6F,0x20,0x68,0x61,0x73,0x2D,0x70,0x6C,0x2D,
+    0x30,0x20,0x68,0x61,0x73,0x2D,0x70,0x72,0x2D,0x30,0x20,0x68,0x61,0x73,0x2D,0x6D,
+    0x6C,0x2D,0x61,0x75,0x74,0x6F,0x20,0x68,0x61,0x73,0x2D,0x6D,0x72,0x2D,0x61,0x75,
+    0x74,0x6F,0x22,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x63,0x61,0x72,
+    0x64,0x20,0x69,0x73,0x2D,0x73,0x68,0x61,0x64,0x6F,0x77,0x65,0x64,0x22,0x3E,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x3C,0x68,0x34,0x3E,0x53,0x74,0x61,0x74,0x75,0x73,0x3C,0x2F,0x68,0x34,0x3E,0x0A,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x3C,0x64,0x69,0x76,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,0x2D,
+    0x6D,0x62,0x2D,0x34,0x22,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x70,0x20,0x63,
+    0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x30,0x22,0x3E,
+    0x55,0x70,0x74,0x69,0x6D,0x65,0x3A,0x20,0x3C,0x21,0x2D,0x2D,0x23,0x75,0x70,0x74,
+    0x69,0x6D,0x65,0x2D,0x2D,0x3E,0x20,0x73,0x3C,0x2F,0x70,0x3E,0x0A,0x09,0x09,0x09,
+    0x09,0x09,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,0x2D,
+    0x6D,0x62,0x2D,0x30,0x22,0x3E,0x46,0x72,0x65,0x65,0x20,0x68,0x65,0x61,0x70,0x3A,
+    0x20,0x3C,0x21,0x2D,0x2D,0x23,0x68,0x65,0x61,0x70,0x2D,0x2D,0x3E,0x20,0x62,0x79,
+    0x74,0x65,0x73,0x3C,0x2F,0x70,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x70,0x20,
+    0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x30,0x22,
+    0x3E,0x4C,0x45,0x44,0x3A,0x20,0x3C,0x21,0x2D,0x2D,0x23,0x6C,0x65,0x64,0x2D,0x2D,
+    0x3E,0x3C,0x2F,0x70,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x70,0x20,0x63,0x6C,
+    0x61,0x73,0x73,0x3D,0x22,0x68,0x61,0x73,0x2D,0x6D,0x62,0x2D,0x30,0x22,0x3E,0x43,
+    0x6F,0x6E,0x6E,0x65,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3A,0x20,0x3C,0x21,0x2D,0x2D,
+    0x23,0x63,0x6F,0x6E,0x6E,0x73,0x2D,0x2D,0x3E,0x3C,0x2F,0x70,0x3E,0x0A,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3C,0x2F,
+    0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x3C,0x2F,0x64,0x69,0x76,0x3E,0x0A,0x20,0x20,0x20,0x20,0x3C,0x2F,0x64,0x69,0x76,
+    0x3E,0x0A,0x0A,0x09,0x3C,0x2F,0x62,0x6F,0x64,0x79,0x3E,0x0A,0x3C,0x2F,0x68,0x74,
+    0x6D,0x6C,0x3E,0x0A,
+};
+
+static const struct fsdata_ssi_tag ssi_status_shtml[] = {
+    {951, 965, "uptime"},
+    {1008, 1020, "heap"},
+    {1061, 1072, "led"},
+    {1115, 1128, "conns"},
+    {1219, 1219, NULL},
+};
+
 static const unsigned char data_css_common_css[] = {
 
     /* "/css/common.css" (16 chars) */
     0x2F,0x63,0x73,0x73,0x2F,0x63,0x6F,0x6D,0x6D,0x6F,0x6E,0x2E,0x63,0x73,0x73,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -1284,6 +2544,18 @@ static const unsigned char data_css_common_css[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x32,0x38,0x0D,0x0A,
 
+    /* "ETag: "aaa1f9ff2360a8cd"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x61,0x61,0x61,0x31,0x66,0x39,0x66,0x66,0x32,
+    0x33,0x36,0x30,0x61,0x38,0x63,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/css" (26 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,0x0D,0x0A,
@@ -1293,13 +2565,68 @@ static const unsigned char data_css_common_css[] = {
     0x2F,0x66,0x6F,0x6E,0x74,0x73,0x2E,0x63,0x73,0x73,0x29,0x3B,
 };
 
+static const unsigned char data_css_common_css_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "aaa1f9ff2360a8cd"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x61,0x61,0x61,0x31,0x66,0x39,0x66,0x66,0x32,
+    0x33,0x36,0x30,0x61,0x38,0x63,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_css_common_css_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "aaa1f9ff2360a8cd"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x61,0x61,0x61,0x31,0x66,0x39,0x66,0x66,0x32,
+    0x33,0x36,0x30,0x61,0x38,0x63,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_css_common_css[] = {{
+    "\"aaa1f9ff2360a8cd\"",
+    data_css_common_css_304,
+    sizeof(data_css_common_css_304),
+    data_css_common_css_206,
+    sizeof(data_css_common_css_206),
+    205,
+}};
+
 static const unsigned char data_css_fonts_css[] = {
 
     /* "/css/fonts.css" (15 chars) */
     0x2F,0x63,0x73,0x73,0x2F,0x66,0x6F,0x6E,0x74,0x73,0x2E,0x63,0x73,0x73,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -1312,6 +2639,22 @@ static const unsigned char data_css_fonts_css[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x31,0x33,0x37,0x30,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "c0946974652697c4"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x63,0x30,0x39,0x34,0x36,0x39,0x37,0x34,0x36,
+    0x35,0x32,0x36,0x39,0x37,0x63,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/css" (26 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,0x0D,0x0A,
@@ -1405,14 +2748,211 @@ static const unsigned char data_css_fonts_css[] = {
     0x55,0x2B,0x46,0x46,0x46,0x44,0x3B,0x0A,0x7D,0x0A,
 };
 
+static const unsigned char data_css_fonts_css_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "c0946974652697c4"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x63,0x30,0x39,0x34,0x36,0x39,0x37,0x34,0x36,
+    0x35,0x32,0x36,0x39,0x37,0x63,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_css_fonts_css_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "c0946974652697c4"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x63,0x30,0x39,0x34,0x36,0x39,0x37,0x34,0x36,
+    0x35,0x32,0x36,0x39,0x37,0x63,0x34,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_css_fonts_css[] = {{
+    "\"c0946974652697c4\"",
+    data_css_fonts_css_304,
+    sizeof(data_css_fonts_css_304),
+    data_css_fonts_css_206,
+    sizeof(data_css_fonts_css_206),
+    230,
+}};
+
+static const unsigned char data_css_fonts_css_gz[] = {
+
+    /* "/css/fonts.css" (15 chars) */
+    0x2F,0x63,0x73,0x73,0x2F,0x66,0x6F,0x6E,0x74,0x73,0x2E,0x63,0x73,0x73,0x00,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 323" (21 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x33,0x32,0x33,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "dc6fd0e6f55d9cc3"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x63,0x36,0x66,0x64,0x30,0x65,0x36,0x66,
+    0x35,0x35,0x64,0x39,0x63,0x63,0x33,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (26 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (323 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xED,0x92,0x41,0x4F,0x83,0x30,
+    0x14,0xC7,0xEF,0x7C,0x8A,0x5E,0x0C,0xDB,0xB4,0xF2,0xFA,0xD8,0xC0,0xB1,0x8B,0xD0,
+    0xAD,0xD7,0x1D,0x8C,0x1F,0x80,0x60,0xD9,0x48,0x58,0x31,0xAC,0xCB,0x5C,0x8C,0xDF,
+    0xDD,0x96,0xD6,0x65,0x27,0x13,0x0F,0x1A,0x63,0xBC,0xF4,0x97,0x7F,0xDF,0x6B,0x81,
+    0x1F,0x2F,0x9A,0x90,0xB6,0xD4,0x8D,0xA2,0xF2,0x45,0x93,0x49,0x14,0xDC,0xD7,0x9D,
+    0xD2,0xB4,0x2E,0x2B,0x49,0x5E,0x03,0x42,0x7C,0xDA,0x35,0xED,0x29,0x23,0xE1,0xFA,
+    0x59,0x2A,0xF2,0x50,0xAA,0x7D,0xB8,0xF8,0xA8,0xED,0xF5,0xA9,0x95,0x19,0x51,0x5D,
+    0xBF,0x2B,0xDB,0xF3,0xEE,0x51,0x36,0x9B,0xAD,0xCE,0x48,0x0C,0x70,0xD1,0xD9,0x4B,
+    0x5D,0x6D,0x33,0xC2,0x00,0xAE,0xEC,0xEE,0xBE,0xAF,0x32,0x72,0xE8,0xDB,0x51,0x64,
+    0xEB,0xD1,0xF9,0x35,0x6E,0x8F,0x5D,0x5D,0xE3,0xD8,0x9C,0x32,0x77,0xEA,0x51,0x38,
+    0xC4,0x70,0x6C,0x8F,0x1C,0x54,0x53,0x75,0x4F,0x92,0xF6,0xA5,0xDA,0x98,0xA7,0x3E,
+    0x5E,0x83,0xB9,0x8C,0x02,0xE6,0xE2,0xC6,0x86,0x18,0xA6,0x9E,0x77,0x8E,0x38,0xB7,
+    0x64,0x2B,0xD3,0xC4,0x56,0x73,0xE1,0x82,0x40,0x13,0xC4,0x10,0x10,0x10,0x1C,0x73,
+    0xA0,0x66,0x29,0x7C,0x58,0x9A,0xC0,0x5D,0x07,0x63,0xF1,0x40,0x9E,0x98,0x0E,0x9E,
+    0x0E,0x9B,0x79,0x8A,0x40,0xF3,0x54,0x88,0x45,0xF0,0x16,0x44,0xDE,0xE0,0x2F,0xB0,
+    0xF7,0x25,0x73,0x60,0xCD,0x81,0xF3,0x00,0x2C,0x66,0x8E,0x33,0xA4,0x66,0x19,0x3E,
+    0x19,0xB0,0x28,0x8C,0xDB,0x82,0xBB,0xC0,0x13,0xC7,0x65,0xEE,0xC9,0x3F,0x73,0x8E,
+    0xF6,0x7A,0x84,0xC4,0x6B,0x4E,0xA7,0xDE,0x2C,0x77,0x52,0x11,0x1D,0xE7,0xCC,0xD3,
+    0x49,0x36,0x05,0xCF,0x99,0xA5,0xF0,0xBF,0x49,0x08,0xB1,0xBC,0x54,0xFD,0x3D,0xC3,
+    0x3A,0xFD,0x1F,0xD6,0x9F,0xB4,0xF7,0xD7,0x87,0xF5,0x1D,0x0B,0x56,0xD9,0x0A,0x5A,
+    0x05,0x00,0x00,
+};
+
+static const unsigned char data_css_fonts_css_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "dc6fd0e6f55d9cc3"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x63,0x36,0x66,0x64,0x30,0x65,0x36,0x66,
+    0x35,0x35,0x64,0x39,0x63,0x63,0x33,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_css_fonts_css_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "dc6fd0e6f55d9cc3"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x63,0x36,0x66,0x64,0x30,0x65,0x36,0x66,
+    0x35,0x35,0x64,0x39,0x63,0x63,0x33,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_css_fonts_css_gz[] = {{
+    "\"dc6fd0e6f55d9cc3\"",
+    data_css_fonts_css_gz_304,
+    sizeof(data_css_fonts_css_gz_304),
+    data_css_fonts_css_gz_206,
+    sizeof(data_css_fonts_css_gz_206),
+    253,
+}};
+
 static const unsigned char data_css_siimple_min_ice_css[] = {
 
     /* "/css/siimple.min.ice.css" (25 chars) */
     0x2F,0x63,0x73,0x73,0x2F,0x73,0x69,0x69,0x6D,0x70,0x6C,0x65,0x2E,0x6D,0x69,0x6E,
     0x2E,0x69,0x63,0x65,0x2E,0x63,0x73,0x73,0x00,0x00,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -1425,6 +2965,22 @@ static const unsigned char data_css_siimple_min_ice_css[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x38,0x37,0x38,0x35,0x33,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "e4ad28a21f5d84f2"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x34,0x61,0x64,0x32,0x38,0x61,0x32,0x31,
+    0x66,0x35,0x64,0x38,0x34,0x66,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/css" (26 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,0x0D,0x0A,
@@ -6923,13 +8479,824 @@ static const unsigned char data_css_siimple_min_ice_css[] = {
     0x6C,0x6F,0x72,0x3A,0x23,0x38,0x31,0x61,0x31,0x63,0x31,0x3B,0x7D,
 };
 
+static const unsigned char data_css_siimple_min_ice_css_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "e4ad28a21f5d84f2"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x34,0x61,0x64,0x32,0x38,0x61,0x32,0x31,
+    0x66,0x35,0x64,0x38,0x34,0x66,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_css_siimple_min_ice_css_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "e4ad28a21f5d84f2"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x34,0x61,0x64,0x32,0x38,0x61,0x32,0x31,
+    0x66,0x35,0x64,0x38,0x34,0x66,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_css_siimple_min_ice_css[] = {{
+    "\"e4ad28a21f5d84f2\"",
+    data_css_siimple_min_ice_css_304,
+    sizeof(data_css_siimple_min_ice_css_304),
+    data_css_siimple_min_ice_css_206,
+    sizeof(data_css_siimple_min_ice_css_206),
+    231,
+}};
+
+static const unsigned char data_css_siimple_min_ice_css_gz[] = {
+
+    /* "/css/siimple.min.ice.css" (25 chars) */
+    0x2F,0x63,0x73,0x73,0x2F,0x73,0x69,0x69,0x6D,0x70,0x6C,0x65,0x2E,0x6D,0x69,0x6E,
+    0x2E,0x69,0x63,0x65,0x2E,0x63,0x73,0x73,0x00,0x00,0x00,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 10133" (23 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x31,0x30,0x31,0x33,0x33,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "dbcdf714b871b38d"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x62,0x63,0x64,0x66,0x37,0x31,0x34,0x62,
+    0x38,0x37,0x31,0x62,0x33,0x38,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (26 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (10133 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xDD,0x7D,0x5D,0x8F,0xE3,0xB8,
+    0x92,0xE5,0x7B,0xFF,0x8A,0x5C,0x34,0x2E,0x6E,0xF7,0xA0,0x9C,0x48,0x7D,0xA4,0xEC,
+    0x74,0xBE,0xCC,0x60,0x5F,0x17,0xD8,0x87,0xFD,0x05,0x92,0x2D,0xA7,0x35,0x25,0x5A,
+    0x1E,0x5A,0xAE,0xAC,0xBC,0x85,0xFE,0xEF,0x4B,0x4A,0xA4,0xC4,0x8F,0x20,0x65,0x91,
+    0x71,0x07,0x33,0x83,0x06,0xAA,0xCB,0x52,0xF0,0x50,0x71,0x44,0x46,0x90,0x47,0x52,
+    0xD4,0xB9,0x27,0xED,0xD3,0xAF,0xAA,0xFB,0xB9,0xB9,0x35,0xFF,0x68,0x2E,0x1F,0xFB,
+    0xAA,0xA3,0xC7,0x9A,0x6E,0xD8,0x91,0xF7,0xAA,0x3C,0x7C,0xFF,0xA0,0xDD,0xFD,0x72,
+    0xDC,0xCF,0x7F,0x7D,0x3F,0x74,0x6D,0x47,0xF7,0xBF,0x67,0x55,0x9E,0xBE,0xA6,0x8A,
+    0xCD,0x46,0x9C,0x38,0x9D,0x4E,0xEF,0xA7,0xEE,0xD2,0x6F,0x4E,0x25,0x69,0xDA,0xAF,
+    0xFD,0xDF,0xFF,0xEF,0xB5,0xBE,0x3C,0xFD,0xBF,0xF2,0x72,0xFB,0xFB,0x78,0x9C,0x75,
+    0x54,0xEF,0x93,0xE2,0xFA,0x73,0xFC,0xF9,0x59,0x37,0x1F,0xE7,0x7E,0x9F,0xBF,0xBC,
+    0xBC,0xB7,0xCD,0xA5,0xDE,0x9C,0xC7,0xDF,0xC9,0xF3,0xEB,0xFB,0xED,0x40,0xBB,0xB6,
+    0xDD,0x54,0xF5,0xB9,0xFC,0xD1,0x30,0xEC,0x1B,0xE9,0xBA,0xFE,0xFC,0xFE,0xD7,0x6F,
+    0xFF,0xF2,0xED,0x5F,0xF6,0x55,0x7D,0xEA,0x68,0xCD,0xFE,0x52,0x9E,0xFA,0x9A,0x6A,
+    0x3E,0x34,0x97,0x73,0x4D,0x9B,0x9E,0x19,0x56,0xDD,0xF1,0xEB,0xE9,0x17,0x29,0xE9,
+    0x47,0x73,0xD9,0xBF,0xBC,0x5F,0xCB,0xE3,0x91,0x1B,0xBC,0xBC,0x93,0xE6,0x32,0xF5,
+    0xF4,0xF2,0xF2,0xE3,0xFC,0xDE,0xD7,0x3F,0xFB,0x0D,0xAD,0x2F,0xCC,0x79,0x6E,0xD1,
+    0x5D,0xFB,0x86,0xB0,0x0B,0xFD,0x3F,0xF5,0x47,0x53,0x35,0x6D,0xD3,0x7F,0xBD,0xB3,
+    0x2B,0xAD,0xBE,0x37,0xCC,0xAF,0xC1,0x89,0xE1,0x52,0xB8,0x65,0x79,0xE9,0x9B,0xB2,
+    0x6D,0xCA,0x5B,0x7D,0x7C,0xDF,0x90,0xEE,0x1F,0x9B,0xEE,0xF6,0xD3,0xB4,0xF9,0xA0,
+    0xE5,0xD7,0xED,0x50,0xB6,0xF5,0xFB,0xB1,0xB9,0x5D,0xDB,0xF2,0x6B,0x5F,0xB5,0xDD,
+    0xE1,0xFB,0x3B,0x29,0x7F,0x6E,0x3E,0x9B,0x63,0x7F,0xDE,0xEF,0x5E,0x5E,0x18,0x21,
+    0xE3,0xDF,0xDF,0xF2,0xBF,0xBD,0x8F,0x97,0xBC,0x69,0xEB,0x53,0xBF,0x2F,0xEF,0x7D,
+    0x27,0x0F,0xD0,0xE1,0x92,0x87,0x23,0x7F,0xFD,0x76,0x6F,0xA5,0x6F,0xEC,0x7E,0xF5,
+    0x7D,0x47,0xF6,0x09,0xAD,0x89,0x34,0xED,0xBB,0x2B,0x73,0xF4,0xAF,0xDF,0xBA,0x87,
+    0xAC,0x8E,0x0F,0x59,0x5D,0x9F,0x7E,0x2D,0xDD,0xB4,0x05,0x10,0xE6,0xE5,0x5F,0xBF,
+    0xDD,0x7A,0xDA,0x5D,0x3E,0x74,0xAC,0xED,0x0B,0xEF,0xA0,0x82,0x0E,0x36,0x84,0xD9,
+    0xEA,0xCC,0x89,0x0E,0x05,0x35,0x92,0x45,0x76,0x2B,0xFF,0xC6,0xEC,0x7F,0x34,0xC7,
+    0xBA,0x5B,0xD5,0xA2,0x39,0xD1,0x92,0xD4,0x7C,0x10,0xF1,0xD1,0x3F,0xB8,0xDA,0x97,
+    0x55,0xCB,0x8F,0x98,0x03,0xBC,0xA7,0x6C,0x28,0x5F,0x4B,0x36,0x54,0xFA,0x77,0x31,
+    0x59,0xD8,0x89,0xB6,0xBC,0xDE,0xEA,0xFD,0xAD,0x66,0x27,0xCA,0xBE,0x96,0x27,0x98,
+    0xDD,0x61,0x1C,0x6F,0xE2,0xC0,0xD8,0x29,0x27,0x01,0x9E,0x72,0xF2,0x92,0x87,0xCE,
+    0x0D,0x2A,0x53,0x4E,0xA5,0x76,0xD5,0xE3,0x25,0xF6,0xD4,0x35,0x81,0x35,0xB4,0x0D,
+    0xED,0x3E,0xE7,0x36,0xE7,0x6F,0xE2,0x2F,0xC7,0xC7,0x1A,0x1F,0xEA,0xB6,0xD5,0x6E,
+    0xB5,0x9C,0x63,0x72,0x4A,0x0D,0x37,0x7A,0x86,0xAF,0xCB,0x07,0x81,0xB9,0x25,0x3B,
+    0xC1,0x29,0xBE,0x1A,0xED,0xFB,0xB3,0xBC,0x21,0x82,0x02,0x19,0x62,0xEA,0x43,0x7D,
+    0x3A,0xE5,0xEF,0xFA,0xB9,0x5B,0xFF,0xD5,0xB2,0x3B,0xD0,0xB5,0xCD,0xD1,0x38,0x23,
+    0x48,0x7F,0x4E,0xD2,0x57,0x7E,0x91,0xEA,0xF8,0xAA,0xBA,0xF6,0x38,0x4E,0x7D,0x36,
+    0x85,0x3F,0x2E,0x7B,0x3E,0xDF,0xDE,0x7F,0xD4,0xB4,0x6F,0xD8,0x6C,0x15,0xC7,0x46,
+    0x94,0xF9,0xDA,0xC6,0x98,0x62,0x71,0x2B,0x5C,0x30,0x1A,0x93,0xE6,0x78,0x64,0x77,
+    0x52,0x6F,0x3C,0x92,0x3E,0x5C,0x22,0x9B,0x13,0xB0,0x57,0xFC,0x04,0xE0,0x12,0x3F,
+    0x6C,0xF8,0x63,0xF4,0xC8,0x2C,0x58,0x77,0xE7,0xE4,0xE9,0x97,0xC0,0x4D,0xEB,0x2C,
+    0xCF,0x5F,0x8C,0xC8,0xB3,0x1C,0xA1,0xD3,0x67,0x8B,0xAD,0xAD,0x35,0xDD,0x53,0x73,
+    0xBE,0xBF,0x8C,0xAD,0xA6,0x40,0x3B,0x4C,0xF7,0x73,0x1A,0x7D,0x31,0x68,0x97,0x92,
+    0xC5,0x5E,0x4A,0xF2,0xBC,0xC5,0x23,0x26,0x8F,0xBF,0x1A,0xBC,0x8B,0x79,0x8D,0xBF,
+    0x98,0x14,0xEF,0x6A,0x8A,0xE8,0xAB,0x31,0x97,0x18,0xA1,0x97,0x52,0x4E,0x57,0xF2,
+    0x5A,0xEF,0x92,0xF2,0xC0,0x13,0x18,0x29,0xDB,0x56,0xA4,0xAA,0xA1,0xB3,0x97,0xE7,
+    0xDD,0x38,0x2C,0x58,0x8E,0xA4,0xB5,0x38,0x63,0x5F,0xDE,0xB7,0x27,0xD2,0x5D,0x3A,
+    0x9E,0x16,0xEA,0xF7,0x8E,0x4D,0xDC,0x53,0xCB,0x02,0xC7,0x4F,0x99,0xCF,0x0F,0xDD,
+    0xB1,0x36,0xFB,0x7A,0x00,0x08,0xB8,0x0A,0xD3,0xED,0x21,0xC4,0x1D,0xEB,0x43,0xC7,
+    0xB2,0x53,0xD3,0x5D,0xF6,0x97,0xEE,0xC2,0x83,0xD2,0x99,0x02,0x09,0x4E,0x0F,0x44,
+    0x03,0x07,0x60,0x26,0x9D,0x02,0x90,0x71,0xE3,0x28,0x43,0xEF,0xFF,0xD8,0x9F,0x1A,
+    0x7A,0xEB,0x37,0x87,0x73,0xD3,0x1E,0xFF,0x9C,0x96,0x16,0x7C,0x09,0x20,0x32,0x85,
+    0xB4,0x6B,0x4B,0xDB,0x4C,0x5D,0x3C,0xB0,0x35,0x01,0xEF,0xF5,0x3F,0xEE,0x5D,0x3F,
+    0x25,0xE8,0x71,0x5D,0xF4,0x32,0x0E,0xB7,0xA7,0x21,0x40,0x3E,0x1D,0xEE,0x94,0xE7,
+    0xE4,0xFF,0xCD,0x7D,0x10,0x8B,0x54,0xED,0x90,0xB9,0xF2,0x72,0xAD,0x52,0x46,0x68,
+    0xE6,0x8A,0xB6,0xE2,0xE2,0x07,0x3A,0x9E,0xCD,0xFB,0x2F,0xD6,0x6F,0x21,0x7D,0x9E,
+    0xC7,0xCD,0x56,0xA5,0x62,0x04,0x91,0xD3,0x41,0x1E,0x14,0x48,0x86,0xE9,0xB0,0x2A,
+    0x7A,0x96,0x83,0xE7,0x99,0x2D,0x12,0x69,0xFF,0xF4,0x6B,0x88,0xE5,0x9B,0xA6,0xAF,
+    0xC9,0x6D,0x7F,0x60,0x3E,0xD4,0x14,0x58,0x6A,0x8B,0x21,0x22,0x38,0xA1,0xE5,0xB1,
+    0xB9,0xDF,0xE4,0x10,0x1E,0x4D,0x3E,0xCF,0x0C,0x62,0x72,0xFD,0xD4,0xD6,0x3F,0xED,
+    0xF4,0xB7,0xBC,0x60,0xE3,0x8B,0xE5,0x79,0xE5,0x32,0x65,0x7C,0xE9,0x5E,0x77,0x6B,
+    0x86,0x41,0x45,0xEB,0x96,0x8D,0xAE,0x1F,0xF5,0xE4,0xC6,0x73,0x73,0xDB,0xDC,0xD8,
+    0xA0,0xBB,0x1C,0x4B,0xFA,0x05,0x8D,0xB4,0x2A,0xDF,0xB1,0x44,0xAF,0x5D,0xAB,0xDA,
+    0xF6,0x58,0x5E,0x3E,0x6A,0x70,0x88,0x56,0xA7,0x22,0x29,0x4A,0x67,0xC3,0xCF,0x92,
+    0x5E,0x1A,0xBE,0xC0,0x04,0x06,0x77,0x75,0xA8,0x76,0x95,0xB3,0xE5,0xED,0x7E,0x38,
+    0xD4,0xB7,0x1B,0xD4,0xB2,0xCC,0xAA,0x7A,0x77,0x18,0x5B,0xDE,0xE6,0xA6,0x55,0x79,
+    0xFC,0x80,0xD6,0x89,0xAE,0xBB,0x93,0x3A,0x6F,0x4F,0x73,0x19,0xA2,0x93,0x12,0xDF,
+    0xC4,0xA4,0xDE,0xC2,0xEB,0x16,0x33,0x96,0x69,0x73,0x51,0xCC,0x0D,0x31,0x1A,0xC0,
+    0xF9,0x6F,0x2E,0x1C,0xB8,0xCD,0xB8,0x7A,0x18,0x9D,0x0A,0xBC,0x7D,0x53,0xDB,0xB5,
+    0xB7,0x6F,0x6A,0xB8,0xFA,0xF6,0xCD,0x97,0xBB,0xFE,0xF6,0xDD,0xD9,0xB0,0xBF,0xB0,
+    0x09,0x77,0xBD,0xD6,0x6C,0xED,0x7E,0x39,0xD4,0x23,0x39,0x0B,0xF7,0x53,0xAC,0xE1,
+    0x17,0x26,0x1E,0x0B,0x40,0x37,0xF6,0xE3,0xDA,0x35,0xC3,0x0C,0x76,0xDF,0x68,0x11,
+    0xE0,0xE5,0xA2,0x7A,0xBE,0xF9,0xDA,0x11,0xD7,0xCD,0x97,0x46,0xF0,0x3C,0x15,0xE3,
+    0xE7,0x29,0x51,0x86,0xC2,0x78,0xC7,0x45,0x60,0x01,0x07,0xC7,0xFD,0xC6,0xF7,0x2F,
+    0x75,0x5B,0x1F,0x7A,0x70,0xB4,0x4C,0x0B,0x5B,0xC1,0xE0,0xFE,0xCC,0xF3,0xD9,0xD3,
+    0x2F,0x10,0x6C,0xD8,0x33,0x0D,0x41,0x62,0x73,0xBC,0x8B,0x13,0x2F,0xCF,0xD9,0x4D,
+    0x3D,0x71,0xA5,0xDD,0x95,0x75,0xF1,0xB5,0x37,0x99,0x9F,0xFB,0x08,0x1D,0x90,0x53,
+    0xE3,0xD3,0x9D,0x67,0x6D,0x3D,0x13,0x68,0x3B,0x2A,0xC5,0x96,0x59,0xF1,0x25,0x3B,
+    0x5B,0xAA,0x8B,0xBB,0xC8,0xB2,0x15,0xF3,0x9D,0x25,0x6C,0x76,0xEC,0x7F,0x35,0xE4,
+    0xDA,0xD1,0x9E,0xED,0xFD,0xD5,0xAC,0xA0,0x1E,0xD6,0xB1,0xD6,0xCE,0x84,0xA9,0xE5,
+    0xFA,0xA9,0x30,0x33,0xB5,0x7A,0x2E,0x1C,0x4A,0x3A,0xEF,0x4C,0xA0,0x51,0x2D,0x07,
+    0x9A,0xCE,0xA0,0x1C,0x68,0xA9,0x2B,0xD2,0xA8,0xBC,0xE8,0x74,0x1F,0xCE,0xF5,0xE1,
+    0x3B,0xDB,0x14,0x3E,0x32,0xFF,0xF4,0xFD,0x91,0x11,0x4F,0xE1,0xAD,0xE6,0xDA,0xB9,
+    0x38,0x05,0x53,0xB1,0xB2,0x91,0xC2,0xD1,0x73,0x22,0xD6,0x55,0x76,0xAE,0x13,0xFE,
+    0x78,0x37,0x63,0x93,0x9B,0x93,0x56,0xE5,0x13,0x15,0xD8,0xF8,0xEE,0xD9,0xFF,0xF7,
+    0x7F,0xFF,0xFB,0xBC,0xD2,0xCA,0x8C,0xEE,0xCB,0x8A,0x2D,0x7A,0xEE,0xE2,0xAE,0x49,
+    0xF0,0xE1,0x2F,0xF5,0xF1,0xDB,0x7C,0xA4,0xB9,0x1C,0x6B,0xD6,0x21,0x8B,0x0B,0x65,
+    0xEF,0xCB,0x51,0x2A,0x8A,0xD6,0x66,0x16,0xD7,0xEC,0x6D,0xF8,0x48,0x6B,0xE0,0x26,
+    0x5C,0x2C,0xE0,0x32,0xF1,0x73,0x5C,0x04,0x8D,0x7F,0x97,0x96,0x72,0x45,0x64,0xFA,
+    0xF7,0x4F,0xBB,0x26,0x65,0x6D,0x09,0xC1,0x0D,0xC7,0x01,0xB0,0xE1,0x38,0xEC,0x9E,
+    0xEA,0xDC,0xE4,0x2A,0xBF,0xD5,0xA7,0x8E,0x92,0x3D,0xED,0x7A,0x46,0xF1,0x1F,0x9B,
+    0xFC,0xF5,0x58,0x7F,0xFC,0x39,0xF9,0x5D,0xA4,0x93,0xE7,0x6D,0x77,0xAB,0x1F,0x98,
+    0x1A,0xB6,0x24,0x35,0x1A,0x02,0xAB,0x60,0xFF,0x2C,0x18,0x16,0x88,0x72,0x12,0xF0,
+    0x8B,0xD0,0x96,0xBC,0xD6,0xD8,0x9F,0xA3,0xF7,0x5E,0x18,0x3E,0x0D,0x51,0x5D,0xCC,
+    0x09,0xD5,0x0B,0x99,0x1E,0x24,0x60,0xF2,0xFC,0x32,0x9F,0x13,0x52,0xAE,0xF8,0xE5,
+    0x9A,0x23,0x9A,0x1F,0x7A,0x14,0x48,0xAE,0x3F,0x81,0x69,0x93,0xB1,0xA3,0xD3,0x6A,
+    0xDE,0x9E,0x3A,0xFC,0xB6,0x14,0x93,0xE8,0xAA,0x5F,0xED,0x78,0x45,0x2C,0x9B,0x99,
+    0x37,0x4B,0xDC,0xAB,0xC9,0x50,0x5C,0xAC,0xF3,0xA6,0x72,0x43,0xD6,0x1D,0x61,0x2B,
+    0x0C,0x4E,0xEE,0x3E,0x51,0x95,0x67,0x6D,0x35,0x6D,0xA9,0x7B,0xA2,0x21,0x0F,0xE5,
+    0x1D,0xBF,0x37,0xCD,0x89,0x0B,0x62,0x03,0xCA,0x70,0x77,0x47,0xE3,0x74,0xB0,0xFD,
+    0x57,0x52,0x1F,0x9B,0xF2,0xE9,0x76,0xA0,0x35,0xDB,0x21,0x96,0x97,0xE3,0xD3,0x1F,
+    0xB3,0xC6,0xF9,0x54,0xE4,0xAC,0x27,0xB6,0xBB,0x02,0x21,0x37,0xA4,0xAB,0x1A,0xAE,
+    0x74,0xC2,0xC8,0x30,0xF6,0xB4,0xD0,0x58,0xC0,0x1E,0x54,0xAF,0x3E,0x14,0x3B,0x49,
+    0x8B,0xDC,0x03,0x7E,0xAC,0x6F,0xDF,0xD9,0x4D,0x74,0xA3,0x1B,0xAD,0xFE,0xE3,0x5E,
+    0xD2,0xE1,0x6E,0x59,0xF6,0xAF,0xE1,0x1C,0x0A,0x50,0x37,0x8B,0xAF,0x31,0x2C,0x4A,
+    0x74,0x27,0x8F,0xAF,0x51,0x3C,0x4A,0x78,0x37,0x93,0xAF,0x20,0x93,0xFD,0xB9,0xE1,
+    0x2B,0x05,0xD3,0x3A,0xCB,0x9E,0xB3,0x2C,0x9C,0xCA,0x01,0xD5,0x49,0xE4,0x04,0x1E,
+    0xCA,0xE5,0x08,0xEF,0x62,0xF2,0x61,0x78,0x27,0x99,0x23,0xBE,0x93,0x4A,0xA5,0x03,
+    0xA5,0x61,0xFF,0xD9,0x8D,0xA3,0xF9,0x66,0xB7,0xC8,0x03,0xA7,0xF6,0x8C,0xE9,0x24,
+    0x33,0x0F,0x9E,0xDB,0x0A,0xB8,0x8B,0xCA,0x3C,0x7C,0x72,0x2B,0xE8,0x4E,0x22,0x73,
+    0x7B,0x76,0x9F,0xCB,0xF6,0x64,0x1B,0xBE,0x06,0xF2,0xC7,0xD1,0x9C,0xCC,0xBD,0x06,
+    0x33,0x37,0xC0,0xBA,0x38,0x7B,0x0D,0xE7,0x6C,0xC0,0x75,0xB2,0xF5,0x6A,0xB3,0xD5,
+    0x9F,0x19,0xB8,0x73,0xD4,0x15,0xA1,0xA3,0x4E,0x41,0x75,0xB2,0x57,0x84,0x8F,0x3B,
+    0x15,0xDE,0xC5,0x62,0x11,0x31,0xF2,0x54,0x7C,0x27,0x9B,0xC5,0x0B,0x38,0x83,0x87,
+    0xA9,0x0F,0x71,0x59,0x3C,0x17,0x45,0xF8,0x24,0x1E,0x61,0xDD,0x64,0x4A,0xF4,0xD0,
+    0x79,0x2C,0xF0,0x9D,0x6C,0x3E,0x8A,0xEF,0x9C,0xCA,0xA2,0x03,0x37,0x9D,0x73,0x0F,
+    0xD6,0xAD,0x10,0xB9,0x09,0x60,0x75,0xFB,0x1A,0x33,0x42,0x25,0xAE,0x93,0xD6,0xED,
+    0x6B,0xDC,0x18,0x9D,0x3A,0x70,0xF1,0xBA,0x7D,0x8D,0x1C,0xA5,0x53,0x0F,0x4E,0x62,
+    0xB7,0x76,0xDE,0x3E,0x75,0x77,0xEA,0x9C,0xF4,0xBB,0xC0,0x49,0xAF,0x80,0x3A,0xF9,
+    0xDC,0x05,0xCF,0x79,0x15,0xDD,0x45,0xE6,0x2E,0x7C,0xCA,0xAB,0xF0,0x4E,0x26,0x77,
+    0xF6,0x8C,0x1F,0x55,0x24,0xD3,0x50,0xAC,0xDA,0x03,0x38,0x64,0x70,0x4E,0xF2,0x04,
+    0x6A,0x10,0x7B,0x1C,0xD7,0x45,0xDB,0x83,0xB8,0x30,0x6F,0x1C,0xD8,0x49,0xD8,0x84,
+    0x2C,0x5A,0xDC,0x66,0xC1,0x6D,0x7C,0xFE,0xC0,0xFE,0xD8,0x7C,0xD2,0xF2,0xBA,0xE7,
+    0x7F,0x68,0x4F,0x5D,0x36,0xEA,0xC3,0x87,0xF1,0x69,0xC9,0x66,0xDA,0x97,0xB1,0xED,
+    0x5D,0xC9,0xF6,0xA8,0xD4,0xD4,0xEF,0x1E,0x78,0x53,0x46,0x79,0xDD,0x63,0xF0,0xC7,
+    0x7C,0x4C,0x03,0x3C,0xA5,0x11,0x07,0x8D,0x0D,0x19,0xBD,0x93,0x4A,0x3E,0xA0,0xF3,
+    0x6D,0xAB,0x2D,0xB5,0xD6,0xFB,0xE8,0xC8,0x7E,0x72,0x64,0x3E,0x23,0xD2,0xAE,0x49,
+    0x7F,0x70,0xE4,0x90,0xA5,0x1C,0x0F,0xFC,0x46,0x17,0xA0,0xCD,0xB8,0x6B,0x2F,0x3F,
+    0xB5,0x31,0x1F,0xD6,0xED,0x0D,0x1D,0x66,0xB8,0x46,0xDF,0x56,0x7D,0x38,0x2F,0xB6,
+    0x15,0x8A,0x78,0x3E,0x1C,0xF6,0xBE,0xE9,0xA0,0x58,0x7B,0xDE,0x8A,0x80,0xEE,0xCA,
+    0x2C,0x09,0x38,0x9E,0x60,0x3A,0x54,0x35,0xF9,0xA4,0x6E,0xD6,0x6F,0x12,0x50,0xBA,
+    0x31,0x94,0x9B,0x49,0xB7,0xE1,0x84,0xF1,0x99,0x52,0x1E,0xF8,0xCD,0x98,0x14,0xE4,
+    0x63,0x7D,0x2A,0xEF,0xED,0x2C,0x19,0x73,0xDE,0xC5,0x90,0xD9,0xD4,0x3F,0xD8,0x95,
+    0xDE,0xF4,0xFB,0x74,0x33,0xC5,0x58,0x09,0xE0,0x98,0x50,0x97,0x4E,0x9D,0x52,0xEA,
+    0x03,0x3D,0xF9,0xAC,0x79,0x7F,0x6E,0x8E,0xC7,0xFA,0x62,0x3D,0x7B,0x9E,0x9F,0x15,
+    0x8C,0xC3,0x9E,0xEB,0x5E,0xC3,0xDB,0x4B,0xB5,0x00,0x35,0xA4,0xED,0x23,0xED,0xAE,
+    0xC7,0xEE,0xF3,0x32,0x4F,0xC6,0x75,0xA2,0xAD,0x83,0xF7,0x81,0x69,0x3E,0xD9,0x66,
+    0xD9,0x46,0x95,0x47,0xFE,0xB1,0xE1,0xE2,0xE4,0x4F,0x6E,0xC2,0x2F,0xE2,0xB3,0xE1,
+    0x22,0xC0,0x74,0x25,0xE0,0x73,0x48,0xCD,0x46,0x8C,0x7B,0xE0,0xEA,0xC7,0x61,0xC1,
+    0xEC,0x9B,0xCB,0xF5,0xDE,0x2F,0x3E,0x14,0x77,0xBF,0x0A,0x06,0x0C,0x4E,0x58,0x65,
+    0xD4,0xA9,0xF0,0xC9,0xD7,0xB0,0xE8,0xBE,0xFE,0xB1,0xD1,0x85,0x0D,0xDC,0x12,0x7E,
+    0x89,0x4B,0xEA,0xDC,0xD6,0xB3,0xDE,0xEE,0xDE,0x73,0x7B,0xE3,0x79,0xD2,0xA8,0x50,
+    0x3E,0x01,0x92,0xD5,0x40,0xDF,0xFE,0xD4,0x1D,0xEE,0xF3,0xD8,0xB5,0xA4,0xE6,0xB6,
+    0xAC,0xEA,0x16,0x7C,0xC4,0x0D,0x3B,0x3C,0x3F,0xB6,0x1E,0xDF,0xEB,0x00,0x1F,0x86,
+    0x82,0xCF,0xBE,0xE6,0x18,0x9B,0x02,0xA1,0x33,0x05,0x42,0x3C,0xA9,0x2F,0xF7,0xF5,
+    0x0F,0x23,0x9C,0xC3,0xC1,0xBC,0xCB,0x0F,0x8E,0x91,0xC7,0x85,0x5B,0x2D,0x9E,0x65,
+    0xBA,0x64,0xBB,0x7B,0x24,0xA9,0x4C,0x47,0x1D,0x4F,0x36,0x32,0x75,0xE2,0xE5,0xE3,
+    0xC4,0xE3,0x24,0x39,0x04,0xDD,0xE1,0x94,0x54,0x4F,0xE7,0xE8,0xEC,0x7B,0x57,0x43,
+    0xD3,0xE4,0xFD,0x2F,0x75,0x98,0x0A,0xAF,0x7C,0xEA,0x2D,0xFC,0x73,0x44,0x15,0xF9,
+    0x88,0x66,0xAB,0xA8,0xF1,0xD3,0xFB,0x16,0xC3,0x05,0x3F,0x24,0x39,0x43,0xCF,0x65,
+    0xC2,0xBA,0x97,0x97,0xCD,0xBB,0xEF,0x8E,0x65,0x0B,0xC5,0x1B,0xFE,0x1A,0x35,0x38,
+    0x88,0xEC,0x37,0x88,0xC5,0xD5,0xBC,0xF1,0xD7,0x98,0xE7,0xA5,0x4E,0x31,0xBC,0x51,
+    0x3C,0x05,0xFA,0x2F,0x3D,0xD0,0xDB,0x2F,0x93,0x3E,0x5F,0xCA,0x1F,0x6C,0xAE,0x7F,
+    0x7F,0xE8,0x01,0xA0,0x77,0x34,0x3A,0xDE,0x30,0x81,0x1E,0x4A,0x2F,0x3E,0x2E,0xB4,
+    0x1E,0x43,0xDB,0xA9,0x09,0x76,0x43,0x8E,0x4F,0x2B,0xFA,0x88,0xF3,0x5A,0x7A,0xF6,
+    0xD8,0xCC,0x8F,0x81,0xE7,0x89,0xF5,0xEA,0xCA,0xDA,0x57,0xDA,0x7D,0xD0,0xE1,0x99,
+    0xEB,0xCA,0x08,0x22,0x8C,0x34,0xE2,0xDF,0xDE,0xDE,0xAE,0x32,0x07,0xC8,0x6B,0xF3,
+    0x2D,0x63,0x66,0x96,0xB5,0xC7,0xD3,0x46,0xE6,0x57,0x5E,0xD6,0x72,0x3F,0x96,0x95,
+    0x7E,0xEC,0xF7,0xF2,0xA5,0x77,0x79,0x64,0x53,0x95,0x4B,0xCF,0x2F,0xFD,0xED,0x7F,
+    0x94,0xED,0xBD,0x5E,0x9A,0x6A,0x3A,0x04,0x7F,0xA9,0x7E,0xA1,0x7F,0xB3,0x35,0xA7,
+    0xB0,0x03,0xEE,0x82,0x27,0xCD,0x4A,0x8A,0x57,0x3D,0x27,0x36,0x1F,0x13,0xA7,0x0B,
+    0x4F,0x89,0xA7,0x79,0x3F,0x5C,0xA0,0x19,0x28,0xF5,0x91,0x31,0x59,0x3D,0xF2,0xD0,
+    0x18,0x1E,0x3A,0x0F,0x2D,0x7F,0xE5,0xA3,0xD8,0xAD,0x67,0x51,0x36,0x9D,0x36,0x97,
+    0xBA,0xE3,0x15,0x0E,0x73,0xCD,0x79,0x9D,0x96,0x43,0xE6,0x83,0x5C,0xDF,0xDD,0x34,
+    0x16,0x9E,0x3A,0x00,0xC8,0x9F,0xA7,0x35,0xDB,0xE5,0x36,0xE4,0xB1,0x97,0xEB,0xE8,
+    0x47,0x55,0xFE,0xF1,0xF2,0x6D,0xF8,0xEF,0xF9,0xF5,0x4F,0x7D,0x31,0x32,0x7F,0x39,
+    0xF2,0xB7,0xF7,0x7F,0xBF,0xDF,0xFA,0xE6,0xF4,0xB5,0x91,0x6C,0x0B,0xC0,0x69,0x05,
+    0xAB,0x44,0x60,0x7B,0xF1,0x2D,0x27,0xA5,0x24,0xFD,0xD4,0xFC,0xAC,0x8F,0xEF,0xF2,
+    0xBD,0x3B,0x65,0x52,0x1A,0x19,0x78,0x8C,0x88,0xFF,0x6D,0xD6,0xA9,0xDA,0x9A,0xF4,
+    0x81,0x05,0xA8,0xBA,0x9E,0x89,0x5B,0x90,0x8A,0xD4,0xB1,0xB0,0x22,0xBD,0x31,0x1A,
+    0xF8,0x48,0x0C,0x7C,0x09,0x25,0x99,0x13,0xE4,0x42,0x14,0x31,0xE6,0x9F,0x1A,0x3E,
+    0x0C,0x3D,0x40,0x7D,0x05,0x53,0x1C,0x01,0x89,0x30,0xDE,0xAF,0x52,0x36,0xEF,0xE9,
+    0xCD,0xE4,0x62,0xF0,0x72,0x0A,0xC9,0xE3,0xCF,0x4D,0x7F,0x66,0x3B,0xCD,0x6F,0xD3,
+    0x49,0x1E,0x6C,0x29,0x7F,0x5D,0xC9,0x3A,0x71,0x1B,0x8F,0x3C,0xF6,0x64,0xDE,0x9D,
+    0xD0,0xE0,0x21,0xA4,0xBE,0x74,0xA0,0x3F,0x90,0xF7,0x5C,0xB5,0x7D,0xC3,0x14,0xFB,
+    0xF9,0x7A,0xAD,0xCF,0x8F,0x9E,0x6F,0xD7,0xE6,0x72,0xB1,0x57,0x07,0xBE,0x58,0x9F,
+    0xFA,0x02,0x7B,0x2A,0xAF,0x75,0xC4,0x9D,0x5E,0x68,0x90,0xBF,0x35,0xA5,0xC4,0x58,
+    0xE2,0xBA,0xA3,0xF8,0x70,0xDF,0x96,0x82,0x78,0x3A,0x87,0x70,0xE7,0x5B,0x0E,0x73,
+    0x2C,0x81,0x2F,0xD4,0x13,0x40,0x95,0xED,0x44,0xAA,0x36,0x14,0x1E,0x95,0x97,0x86,
+    0x94,0xFA,0x7B,0x7D,0xC9,0xED,0x7D,0x3E,0xCA,0x62,0xEC,0x78,0x98,0x41,0xDF,0x2F,
+    0x7C,0xBE,0x9F,0x9A,0x0B,0x7F,0xA7,0x66,0x36,0xB9,0x94,0x84,0x05,0xA2,0x11,0xF6,
+    0xDF,0xE4,0x51,0xE5,0x3C,0xFF,0x0E,0x8F,0xED,0x56,0x4E,0xF7,0xCB,0x61,0xC0,0xE7,
+    0xB7,0xA6,0xA4,0x0B,0xCA,0xCF,0x5F,0xBF,0xFD,0xEB,0xF7,0xFA,0x6B,0xF8,0xA8,0xEB,
+    0xF6,0x64,0x82,0x3F,0xFD,0xFA,0xED,0x44,0x3B,0x02,0xBC,0xB5,0xF1,0x22,0xDE,0xD9,
+    0xE8,0x3B,0xE0,0x64,0xF6,0xFA,0x26,0x4E,0xCF,0x3C,0x18,0x6F,0x24,0xDA,0x81,0xE5,
+    0xB3,0xE9,0x0F,0xE7,0xFF,0xB4,0x85,0xC8,0xE2,0xF8,0x1C,0x2E,0xC7,0x99,0x77,0xB5,
+    0xD7,0x9D,0xD6,0x0C,0xC2,0xE9,0xBB,0x03,0xB1,0x96,0xB0,0x5E,0x97,0x33,0x16,0x13,
+    0xF2,0xBC,0x12,0xB7,0x78,0xCB,0x41,0x71,0x7C,0xAA,0xCB,0x5B,0x3D,0xAD,0x33,0x84,
+    0xA1,0x4C,0x7F,0xA9,0xE2,0xC5,0x34,0x76,0x1F,0x0B,0xD2,0xE9,0x18,0xA4,0xFD,0x8E,
+    0x18,0xE2,0x93,0x73,0x36,0x29,0x17,0x6E,0x76,0x6F,0x39,0xA1,0xE5,0xEF,0x44,0x71,
+    0xC0,0x58,0x06,0x8D,0x62,0xB4,0x7E,0xA7,0xAC,0x85,0xCE,0xD2,0xC2,0x97,0xEF,0xA7,
+    0x58,0x2C,0x29,0xFF,0xE7,0x48,0x58,0xC8,0x7A,0x15,0xDB,0x44,0x70,0x74,0xF9,0x9E,
+    0xA6,0x91,0x22,0x25,0x7D,0x4B,0x0B,0x86,0x63,0xF3,0x63,0x5C,0x31,0x60,0x7F,0x3D,
+    0x23,0x91,0x1F,0xFB,0x86,0x46,0xB7,0x5E,0xFE,0x92,0xE6,0x99,0x7F,0x9E,0xFA,0xC1,
+    0xF6,0xCC,0x67,0xC7,0x53,0x14,0xEF,0x57,0xBB,0x73,0x6B,0x1E,0xF6,0xDA,0xE1,0x13,
+    0x4F,0xFF,0xC7,0x5F,0xC3,0xEE,0x9F,0xD3,0xFA,0x5F,0xFF,0x5B,0xDA,0xE7,0x90,0x8F,
+    0x69,0x9F,0xA7,0xAF,0x69,0x9F,0xFF,0x39,0x9F,0xD3,0x3E,0xC7,0x7E,0x4F,0xFB,0xFC,
+    0x5F,0xF9,0x83,0xDA,0xE7,0xA8,0x2F,0x6A,0x9F,0xFF,0x93,0x3F,0xA9,0x1D,0xFB,0x1B,
+    0x35,0x21,0x3E,0xEB,0x8E,0xFF,0x5C,0x56,0xC1,0x0E,0xFF,0x09,0xBE,0xAA,0xFD,0x8C,
+    0x56,0x83,0x67,0xDF,0xA0,0xA3,0x47,0x87,0x54,0xF1,0x70,0xE6,0x70,0x74,0x66,0xC5,
+    0x2F,0xB8,0x77,0x20,0xCC,0x01,0x0F,0x17,0x0D,0x65,0x0B,0xEE,0x72,0x24,0x12,0x08,
+    0x9C,0x8A,0x8F,0xFA,0x7D,0x71,0xA3,0x0E,0x9B,0x76,0xB6,0x60,0x1C,0xC6,0x2D,0x1B,
+    0xC1,0x1D,0x7F,0x04,0x32,0x6C,0xE4,0xB9,0x55,0xD3,0xB7,0x75,0xC4,0xA7,0xAC,0xAB,
+    0xBE,0x5D,0xB5,0xD3,0xC9,0xD0,0xFD,0x42,0x32,0x91,0xAB,0xC3,0xC1,0x96,0x3B,0x94,
+    0xA8,0x71,0x3D,0x9D,0xB4,0x9E,0xE9,0x7C,0xAA,0x9D,0x37,0xCF,0x66,0x7A,0x56,0xD8,
+    0x5A,0xCD,0x73,0xDD,0xC0,0x3A,0xFF,0x0A,0xA5,0x15,0xD5,0xA0,0xD0,0x0C,0x8A,0xD1,
+    0xD3,0x73,0xC9,0xEE,0xEF,0xC7,0x66,0x58,0xC3,0xBA,0x04,0x75,0xC3,0x6C,0x33,0xEA,
+    0x56,0x42,0x29,0x5E,0x6A,0x52,0xB5,0xCC,0x00,0x32,0x7B,0x19,0x35,0x19,0xD5,0x6C,
+    0x09,0x59,0x6F,0x22,0x16,0x71,0x0F,0x2C,0xEF,0xF4,0x06,0x0B,0xBD,0x38,0x1A,0x2B,
+    0x49,0x77,0x59,0xC9,0xB5,0xDB,0x2C,0x74,0x0A,0xB7,0xBF,0x52,0xB6,0xF7,0x82,0xBF,
+    0xD9,0x9A,0x17,0x55,0xBA,0xED,0x12,0x85,0x56,0xBB,0x47,0xBE,0x0C,0x03,0xAC,0x97,
+    0xFA,0xB1,0x5A,0x12,0xB6,0x11,0x38,0xFA,0x65,0x4E,0xD5,0x72,0x09,0xDF,0x6A,0xB5,
+    0xF8,0xB1,0x98,0x69,0xBA,0xE8,0x81,0xD9,0x6C,0xF9,0xA3,0x32,0xCB,0x76,0xD1,0x0B,
+    0xB3,0xDD,0xF2,0xD7,0x67,0x96,0xED,0x52,0x1F,0x56,0xBB,0x6B,0xD7,0x82,0x4F,0x03,
+    0x44,0x98,0x7D,0x12,0x45,0x8A,0x9E,0x7E,0xCF,0xB3,0xFC,0xF0,0x5A,0xB3,0xFF,0x1F,
+    0x5E,0x0B,0x8D,0x89,0x01,0x61,0xA9,0xDF,0x87,0xD1,0x6E,0x97,0xEE,0x13,0x02,0x38,
+    0xEE,0x8E,0x75,0xFD,0xF6,0xF4,0x7B,0xFD,0x5A,0xBF,0x9D,0x18,0x90,0x75,0xCB,0x79,
+    0xC3,0xA5,0xAB,0x58,0x04,0x39,0xD1,0xEE,0x06,0x4A,0xC2,0xBB,0x13,0xBB,0x39,0xD5,
+    0xD3,0xEF,0xBB,0xDD,0xE1,0xE5,0xC8,0x5A,0xB2,0x79,0x93,0x1C,0x92,0x27,0x7B,0x06,
+    0x0D,0x08,0x4B,0xD7,0xF1,0x30,0x5A,0x79,0xA7,0x1D,0x2D,0xDD,0x03,0xF2,0xE9,0xF7,
+    0xE3,0xCB,0x6E,0xBB,0xE5,0xAE,0x0C,0x83,0xE7,0x49,0xDC,0xE0,0x27,0x7B,0xCA,0x8D,
+    0x50,0x8F,0x8D,0xF3,0x47,0x61,0x87,0x45,0xAA,0xC8,0x16,0x76,0xBC,0x9F,0xCF,0xEA,
+    0xBD,0x3A,0x2C,0x45,0x6E,0xB0,0xA3,0xFB,0x7C,0x16,0xC4,0x31,0x2D,0xA7,0x4C,0xE0,
+    0x8E,0xE0,0xAA,0x1D,0x84,0xE9,0x6C,0xA3,0xC5,0x7D,0x67,0xB0,0x36,0x4D,0xA1,0x2E,
+    0x5C,0xCD,0xA6,0x28,0x0F,0x86,0x68,0xD5,0x04,0x24,0x03,0x30,0xB7,0xB5,0x35,0xE0,
+    0x26,0x3A,0x42,0xB9,0xBB,0x81,0x88,0xE0,0x60,0x00,0x9E,0x0D,0x40,0x34,0xC0,0x58,
+    0xC6,0x6B,0x30,0xDA,0x2A,0x16,0xF0,0xD5,0xD9,0xD6,0x53,0x74,0x06,0x43,0xAB,0x6A,
+    0x02,0x5F,0xA1,0x6D,0x3E,0xC5,0x62,0x30,0x90,0xAA,0x26,0x20,0x22,0x60,0x2E,0x22,
+    0xEF,0xAA,0x00,0x39,0x37,0x04,0x7B,0x59,0x01,0x32,0xC6,0xD9,0x87,0xE2,0xE2,0x64,
+    0x0F,0xF6,0xF9,0x40,0x5B,0x11,0x55,0x57,0x05,0xBF,0xB9,0x21,0xD8,0xEB,0x0A,0x10,
+    0x19,0x43,0xC3,0x23,0x1C,0x14,0x3A,0x83,0xD0,0xF8,0x62,0x7B,0xF3,0xE2,0xA8,0x79,
+    0x33,0x5B,0x24,0xAE,0xB5,0xF9,0x70,0x36,0x75,0x2C,0xED,0x27,0x83,0x0C,0xDE,0x1B,
+    0x4C,0xE7,0x73,0xC7,0xE6,0x62,0x32,0x78,0x85,0xF6,0x26,0xD3,0xD9,0x02,0xDE,0xD9,
+    0x4C,0xE7,0xB7,0xEA,0xF9,0xCC,0x3C,0xBB,0xD3,0xCE,0xDA,0xAD,0xDF,0xD4,0xF3,0xB9,
+    0xC5,0x8C,0x46,0x5E,0xAE,0x35,0x1F,0x77,0x79,0x9B,0x96,0xFF,0xA9,0x57,0xC0,0xCB,
+    0xE6,0x0C,0x21,0x8C,0xC6,0xF7,0xF8,0xEC,0x42,0x7C,0xBA,0x15,0x7F,0xAD,0xFB,0x4E,
+    0x74,0xAB,0x57,0xCB,0x8A,0xCB,0x35,0x50,0xC5,0x3D,0xCD,0x66,0xCC,0x6D,0xAA,0xD1,
+    0xDB,0x6C,0xD4,0x9E,0x37,0xC3,0x3B,0x3B,0xBF,0xB4,0xDD,0xA9,0x72,0xB6,0x1F,0x7D,
+    0xB2,0x36,0xAF,0x6A,0xFB,0xD1,0x21,0xB3,0x92,0xE0,0x6C,0xD1,0x76,0xC3,0x87,0xD0,
+    0xAA,0x41,0x3A,0x5D,0x25,0x1F,0x94,0xB3,0x16,0xF8,0xF8,0x1B,0xF8,0xA2,0xF1,0xF4,
+    0xEA,0xBD,0x8A,0xF1,0xF8,0xFB,0xF6,0x12,0x45,0xBE,0x68,0xBF,0x06,0x45,0x79,0xBB,
+    0x5E,0xC2,0x4C,0xAF,0xD5,0xEB,0x38,0xE2,0x7C,0x2E,0x8F,0x0B,0x79,0x70,0x9D,0xAB,
+    0xB9,0xE1,0xAA,0x00,0x59,0xEB,0x6B,0x6E,0xF8,0xFA,0x20,0x8C,0xE5,0x6C,0x6E,0x3A,
+    0x3B,0x01,0x09,0x83,0x9D,0x3C,0x91,0x86,0x78,0xBB,0x33,0xBC,0x4D,0xC3,0xBC,0xDD,
+    0x19,0xDE,0xA6,0x81,0xDE,0xEE,0x4C,0x6F,0x53,0xC3,0xDB,0x24,0x95,0x67,0xB2,0x10,
+    0x77,0x93,0xD4,0xF0,0x37,0x0B,0xF3,0x97,0xE1,0xE8,0x0E,0x67,0x81,0x0E,0x33,0x20,
+    0xC3,0xE3,0xCC,0xF4,0xB8,0x90,0x67,0xF2,0x20,0x8F,0x0B,0xC3,0xE3,0x3C,0xD0,0xE3,
+    0xC2,0xF0,0x38,0x0F,0xF5,0xB8,0x30,0x3D,0xCE,0x0D,0x8F,0xD3,0x69,0x02,0x17,0x21,
+    0x1E,0xA7,0xE6,0x0C,0x2E,0xC2,0x3C,0x4E,0xCD,0x29,0x5C,0x04,0x7A,0x9C,0x5A,0x73,
+    0xB8,0x30,0x3C,0xCE,0xA6,0x51,0xBD,0x0B,0xF1,0x38,0x33,0x47,0xF5,0x2E,0xCC,0xE3,
+    0xCC,0x1C,0xD5,0xBB,0x40,0x8F,0x33,0x6B,0x54,0xEF,0x0C,0x8F,0xF3,0x29,0x6C,0x25,
+    0x41,0x71,0x2B,0x37,0x03,0x57,0x12,0x18,0xB9,0x72,0x33,0x74,0x25,0xA1,0xB1,0x2B,
+    0xB7,0x82,0x57,0x62,0x46,0xAF,0x62,0x4E,0x4D,0x41,0x43,0xBB,0xB0,0x92,0x53,0xE0,
+    0xD8,0x2E,0xAC,0xF4,0x14,0x3A,0xB8,0x0B,0x3B,0x41,0x99,0xA3,0xFB,0x6D,0x8A,0x60,
+    0x69,0x50,0x08,0x7B,0x33,0x43,0x58,0x1A,0x18,0xC3,0xDE,0xCC,0x18,0x96,0x86,0x06,
+    0xB1,0x37,0x2B,0x88,0xA5,0x66,0x14,0x4B,0xDE,0xA6,0x49,0x9D,0x07,0xCD,0x6A,0x06,
+    0x60,0x86,0xEE,0xC0,0x79,0xCD,0x91,0x8C,0xE0,0x1D,0x3A,0xB3,0x39,0x94,0x19,0xBE,
+    0xCD,0xB9,0x3D,0xAE,0x74,0xC3,0x17,0x9B,0xBC,0x3D,0xCA,0x7A,0x73,0x00,0x42,0x59,
+    0x72,0x0E,0x48,0xFE,0x55,0xE7,0x58,0x5D,0x21,0xA4,0xA6,0xC2,0xDC,0xDE,0xF0,0x7A,
+    0x6D,0x15,0x05,0x05,0x48,0xF7,0x7A,0x75,0xDD,0x04,0x05,0xC9,0xF0,0x7A,0xAA,0x94,
+    0x30,0x9A,0x8C,0x5F,0xF9,0x06,0x7D,0xDB,0x3B,0x03,0x98,0x41,0xED,0x25,0xC8,0x6F,
+    0xED,0x4B,0xDE,0xD0,0xEF,0x77,0x15,0x28,0x33,0xAC,0xBD,0xE8,0x9E,0xF3,0x0F,0x45,
+    0xE4,0x39,0x51,0x99,0x76,0x9D,0xE7,0xBC,0x91,0xE1,0xB9,0xC0,0x59,0xEB,0xF9,0x80,
+    0xA4,0x7B,0xFE,0x20,0x92,0xE5,0xF9,0x00,0x65,0x78,0x3E,0x61,0x09,0x1B,0x81,0x35,
+    0xF3,0xF2,0xE3,0x73,0xB5,0xF3,0xA3,0x99,0x7D,0xE3,0x07,0xA8,0xB5,0xFE,0x0B,0x30,
+    0xEB,0xDE,0x3F,0x04,0x66,0x51,0x20,0xD0,0xEC,0xDB,0x2F,0xE0,0x06,0xB3,0x33,0xDF,
+    0x4F,0x2B,0x05,0xAA,0xD6,0xF9,0x7F,0x56,0x36,0xD4,0x1A,0xC8,0x3A,0xCF,0xCF,0xCA,
+    0x8E,0x7A,0x15,0x8C,0xE1,0xF3,0x59,0xDD,0x52,0x1B,0x40,0xC2,0x20,0x9F,0x4E,0x04,
+    0x6C,0xAA,0xCF,0xCA,0xA6,0x5A,0x47,0x59,0xEB,0x6F,0x6E,0xFA,0x1B,0xB6,0xAD,0x3E,
+    0xAB,0xDB,0x6A,0x13,0x49,0x58,0xEC,0xA6,0x33,0x69,0x88,0xC7,0x3B,0xD3,0xE3,0x34,
+    0xCC,0xE3,0x9D,0xE9,0x71,0x1A,0xE8,0xF1,0xCE,0xF2,0x38,0x35,0x3C,0xE6,0x7B,0x6B,
+    0xF5,0x9B,0x82,0xB5,0x2E,0x2B,0x9B,0x6B,0x1D,0x66,0xAD,0xCF,0xCA,0xEE,0x7A,0x1D,
+    0x90,0xE5,0xB4,0xBA,0xBD,0x36,0xA1,0xA4,0x49,0x31,0x9D,0xCA,0x83,0xBC,0x2E,0x4C,
+    0xAF,0xF3,0x40,0xAF,0x0B,0xD3,0xEB,0x3C,0xD4,0xEB,0xC2,0xF2,0x3A,0x37,0xBC,0x4E,
+    0xE7,0x09,0x5D,0x84,0x78,0x9D,0x5A,0x33,0xBA,0x08,0xF3,0x3A,0xB5,0xA6,0x74,0x11,
+    0xE8,0x75,0x6A,0xCF,0xE9,0xC2,0xF0,0x3A,0x9B,0x47,0xF8,0x2E,0xC4,0xEB,0xCC,0x1A,
+    0xE1,0xBB,0x30,0xAF,0x33,0x6B,0x84,0xEF,0x02,0xBD,0xCE,0xEC,0x11,0xBE,0x33,0xBC,
+    0xCE,0xE7,0x50,0x96,0x04,0xC5,0xB2,0xDC,0x0A,0x66,0x49,0x60,0x34,0xCB,0xAD,0x70,
+    0x96,0x84,0xC6,0xB3,0xDC,0x0E,0x68,0x89,0x19,0xD1,0x0A,0x25,0x6D,0x05,0x0D,0xF3,
+    0xC2,0x4E,0x5C,0x81,0xE3,0xBC,0xB0,0x53,0x57,0xE8,0x40,0x2F,0x80,0xE4,0x65,0x8E,
+    0xF4,0xB7,0x39,0xAA,0xA5,0x41,0x61,0xED,0xCD,0x0A,0x6B,0x69,0x60,0x5C,0x7B,0xB3,
+    0xE2,0x5A,0x1A,0x1A,0xD8,0xDE,0xEC,0xC0,0x96,0x9A,0x91,0x6D,0xD8,0x77,0xCB,0xA8,
+    0x17,0x34,0xCB,0xD5,0x8D,0xB7,0x01,0xB4,0x3A,0xA6,0xBF,0x59,0x13,0x3D,0x0F,0x9D,
+    0xE9,0xDA,0xD6,0xDB,0x02,0x13,0x46,0xE3,0xDE,0x3B,0x62,0x61,0xAA,0x6D,0xBE,0xA3,
+    0xD6,0xA6,0xDA,0xEE,0x3B,0x6E,0x79,0xAA,0x6F,0xBF,0xE1,0x15,0xEA,0xB8,0xFF,0x3E,
+    0xCB,0x67,0x78,0x7F,0x5B,0xED,0xB9,0xB6,0x01,0xD7,0x70,0xD6,0x7A,0xAE,0xED,0xC0,
+    0x57,0x21,0x59,0x9E,0xEB,0x5B,0x70,0x03,0x4B,0xD8,0x8C,0x7B,0x70,0xF5,0xDB,0x9C,
+    0xB5,0xAE,0x6B,0x9B,0x70,0x1D,0x68,0xAD,0xEF,0xDA,0x2E,0x7C,0x1D,0x94,0xE5,0xBC,
+    0xBE,0x0D,0x37,0xC1,0x84,0xD1,0xB8,0x0F,0x57,0xFF,0xDD,0xB2,0xB5,0xDE,0x6B,0x1B,
+    0x71,0x1D,0x68,0xAD,0xF7,0xDA,0x4E,0x7C,0x1D,0x94,0xE5,0xBD,0xBE,0x15,0x37,0xC1,
+    0x84,0x91,0xDC,0x8B,0x6B,0xFF,0x4A,0xDF,0x5A,0x02,0x8C,0xCD,0xB8,0x81,0xB5,0x96,
+    0x03,0x63,0x37,0xBE,0x12,0xCD,0xA2,0xC1,0xDC,0x8E,0x5B,0x78,0x83,0xDD,0x95,0xEF,
+    0xC7,0x1D,0x55,0x1B,0xD6,0xD1,0x71,0x55,0xF6,0xE6,0x4E,0xC0,0x75,0x9C,0x5C,0x95,
+    0x7D,0x7A,0x30,0xA4,0x41,0xCC,0x55,0xDD,0xB3,0x7B,0x40,0x85,0x71,0xA2,0x18,0x89,
+    0x0F,0x6B,0x23,0x18,0x4A,0x6C,0x86,0x20,0xD0,0xB5,0x2C,0x25,0x36,0x4B,0x21,0xB0,
+    0x16,0x53,0x09,0xC0,0x14,0x0C,0x2C,0x1A,0xA4,0xAA,0x61,0x2C,0x59,0x29,0x40,0x56,
+    0x3C,0x57,0x29,0xC0,0x15,0x02,0x55,0x29,0x44,0x95,0x87,0xA9,0x4C,0xB5,0xDB,0xC6,
+    0x52,0x95,0x01,0x54,0x6D,0xE3,0xB9,0xCA,0x00,0xAE,0xB6,0x08,0x64,0x65,0x10,0x59,
+    0x5B,0x0F,0x5B,0xF9,0x6C,0x98,0x44,0x52,0x95,0x5B,0x54,0x25,0xD1,0x3C,0xE5,0x16,
+    0x4F,0x49,0x3C,0x49,0xB9,0x4D,0x52,0xE2,0x66,0xA8,0x50,0xAC,0xA2,0x67,0x5E,0x61,
+    0x73,0x84,0x30,0xF3,0x0A,0x9B,0x25,0x8C,0x99,0x57,0x00,0x3C,0xF9,0x66,0xDE,0x6E,
+    0xB6,0x4B,0x23,0x79,0xDA,0x59,0x3C,0xA5,0xD1,0x2C,0xED,0x2C,0x96,0xD2,0x78,0x8E,
+    0x76,0x36,0x47,0xA9,0x9B,0xA1,0x44,0x09,0xE3,0x59,0x6C,0xC6,0xB3,0xA3,0x78,0x16,
+    0x9F,0xEF,0xEC,0x20,0x9E,0x21,0x64,0x3B,0x20,0x86,0x67,0x1E,0x96,0x94,0x29,0x97,
+    0xC7,0xB2,0x64,0xCF,0xB8,0x3C,0x9E,0x25,0x7B,0xC2,0xE5,0x08,0x2C,0x01,0xF3,0x2D,
+    0xF7,0xAC,0x08,0x94,0xD0,0x5D,0xC4,0x2E,0x08,0xEC,0xD8,0x5D,0xC4,0xAF,0x07,0xEC,
+    0xE0,0x5D,0x20,0x2C,0x07,0x80,0xE8,0x5D,0xB8,0x59,0x1A,0xD5,0x07,0xA4,0x65,0xB8,
+    0xA6,0x44,0xA0,0xAD,0xC4,0x35,0x55,0x02,0x6F,0x31,0xAE,0x2B,0x14,0xCB,0xEB,0xF1,
+    0x51,0xAD,0x90,0x76,0x6C,0x43,0x1F,0xC3,0x94,0xA6,0x5C,0x38,0x31,0xD7,0x32,0xA5,
+    0xA9,0x18,0xC1,0xA8,0x16,0x53,0xBA,0xA2,0xE1,0xC1,0x15,0xF6,0xA3,0xBA,0x31,0xA5,
+    0xC4,0x97,0x38,0xAA,0x34,0xA5,0xC3,0x0D,0xBA,0x96,0x2B,0x4D,0xF5,0x08,0x87,0xB5,
+    0xC8,0xD2,0x15,0x10,0x1F,0xB0,0x68,0x30,0xAA,0x21,0xD2,0x70,0xF8,0x15,0xC1,0x96,
+    0xA6,0x8C,0xB8,0x41,0xD7,0xB2,0xA5,0xA9,0x24,0xE1,0xB0,0x16,0x5B,0xBA,0x62,0xE2,
+    0x03,0x1E,0x1B,0xF4,0x8A,0x68,0x20,0x2B,0x78,0x44,0xD0,0xD5,0xDB,0xCA,0x01,0x8C,
+    0xBA,0x92,0xAF,0xDE,0x96,0x0F,0xC2,0x70,0x4D,0xC2,0x7A,0x40,0x43,0x70,0x21,0xCB,
+    0x16,0x89,0x61,0x19,0x2D,0x26,0xF4,0xB6,0x9A,0xE0,0x46,0x5E,0xCD,0x5C,0x02,0x33,
+    0x87,0x21,0x2B,0xF4,0x80,0xAE,0xE0,0x43,0x97,0xAD,0x52,0xD3,0x3A,0x9A,0xC0,0xD4,
+    0x41,0x20,0x02,0x7F,0xA9,0x83,0x3F,0x0C,0xFA,0x52,0x17,0x7D,0x3E,0xF6,0x32,0xD3,
+    0x78,0x1B,0x4D,0x5F,0xE6,0xA0,0x6F,0x8B,0xC0,0x5F,0xE6,0xE0,0x6F,0x8B,0x41,0x60,
+    0xE6,0x22,0x70,0xEB,0x63,0x30,0xD7,0xAD,0x93,0x58,0xFA,0x72,0x90,0xBE,0x24,0x9E,
+    0xBB,0x1C,0xE4,0x2E,0x41,0x20,0x2E,0x87,0x89,0x4B,0x3C,0xAC,0x15,0x86,0x69,0xFC,
+    0xAC,0x2D,0x60,0xDE,0x30,0x66,0x6D,0x01,0x33,0x87,0x32,0x6B,0x0B,0x07,0x77,0xDE,
+    0x59,0xBB,0xD3,0x8D,0xD3,0x58,0xEE,0x76,0x20,0x77,0x69,0x3C,0x73,0x3B,0x90,0xB9,
+    0x14,0x81,0xB7,0x1D,0xCC,0x5B,0xEA,0x61,0x2D,0x31,0x52,0x45,0x16,0x9D,0x69,0xE1,
+    0x4C,0x91,0x21,0xE4,0x59,0x38,0x51,0x64,0x18,0x59,0xD6,0x91,0x27,0x32,0x1F,0x73,
+    0xC6,0x74,0xCD,0xA3,0x99,0x83,0x67,0x6B,0x8E,0xC0,0x1C,0x3C,0x59,0x73,0x0C,0xE6,
+    0x1C,0x73,0x35,0xF7,0xAD,0x4E,0x8C,0xF4,0x50,0x44,0x2F,0x4E,0xE0,0xFC,0x50,0x20,
+    0xAC,0x4D,0xE0,0x04,0x51,0x60,0x2C,0x4D,0x1C,0x19,0xA2,0xF0,0x30,0xA7,0x89,0x1F,
+    0x28,0xDB,0x09,0x48,0x01,0x41,0xDA,0x51,0x40,0x32,0x08,0xD6,0xA6,0x02,0xD4,0x42,
+    0x96,0xF6,0x15,0x9A,0x20,0x32,0x18,0xC7,0x89,0x22,0x3D,0xA8,0x8A,0xC0,0xC0,0xAB,
+    0xD9,0x83,0xA4,0x91,0x30,0x68,0x9B,0x3D,0x50,0x1F,0x71,0x81,0xCB,0x46,0x9A,0x48,
+    0xB2,0x91,0xFF,0x40,0x50,0x14,0x7D,0x90,0x52,0xE2,0x40,0x5E,0xCD,0x1F,0x24,0x97,
+    0x04,0x62,0xDB,0x04,0x82,0x9A,0x89,0x13,0x5D,0xB6,0xD2,0x84,0x93,0xC1,0x3A,0x52,
+    0x3C,0xE9,0x41,0xF5,0xC4,0x81,0xBC,0x9A,0x41,0x48,0x42,0x09,0xC4,0xB6,0x19,0x04,
+    0x75,0x14,0x27,0xFA,0xD8,0xAA,0x52,0xB5,0x14,0x59,0x6B,0x2F,0x2A,0xFE,0x55,0x80,
+    0x9C,0xE2,0x02,0x5E,0xC9,0x5F,0x05,0x28,0x2A,0xA1,0xD0,0x26,0x7D,0x15,0x24,0xAA,
+    0xB8,0xC1,0x65,0xA3,0xC4,0x36,0x8E,0x96,0x56,0x2A,0x40,0x5A,0xF1,0x81,0xAF,0x66,
+    0x31,0x71,0xB2,0x88,0x21,0xB0,0x54,0x90,0xC0,0xE2,0xEF,0x40,0x36,0x4C,0x81,0x06,
+    0xD1,0x64,0xA6,0x6E,0x32,0x11,0xB8,0x4C,0xDD,0x5C,0x62,0x50,0x99,0x7A,0xA8,0xF4,
+    0x31,0x99,0x01,0xF6,0xDB,0x68,0x2A,0x33,0x37,0x95,0x5B,0x04,0x2E,0x33,0x37,0x97,
+    0x5B,0x0C,0x32,0x33,0x0F,0x99,0x5B,0x1F,0x9B,0xB9,0xD5,0x20,0x89,0xA5,0x32,0x77,
+    0x51,0x99,0xC4,0xF3,0x98,0xBB,0x78,0x4C,0x10,0x48,0xCC,0x9D,0x24,0x26,0x1E,0x06,
+    0x0B,0xDB,0x3A,0x7E,0x66,0x17,0x4E,0x0E,0x31,0x66,0x76,0xE1,0x64,0x11,0x65,0x66,
+    0x17,0x6E,0x1E,0xBD,0x33,0x7B,0x67,0xD9,0xA7,0xB1,0x3C,0xEE,0x5C,0x3C,0xA6,0xF1,
+    0x2C,0xEE,0x5C,0x2C,0xA6,0x08,0x1C,0xEE,0x9C,0x1C,0xA6,0x1E,0x06,0x13,0x3B,0xCD,
+    0x64,0xD1,0x19,0xDB,0x99,0x65,0x32,0x84,0x7C,0xED,0x4C,0x32,0x19,0x46,0xB6,0x76,
+    0xE7,0x98,0xCC,0xC7,0xA2,0x3D,0xA5,0xF3,0x68,0x16,0x9D,0x33,0x3A,0x47,0x60,0xD1,
+    0x39,0xA1,0x73,0x0C,0x16,0xDD,0xF3,0x39,0xF7,0xAD,0x78,0xEC,0xD4,0x52,0x44,0x2F,
+    0x78,0x9C,0xB9,0xA5,0x40,0x58,0xEF,0x38,0x93,0x4B,0x81,0xB1,0xDC,0x71,0x67,0x97,
+    0xC2,0xC3,0xA2,0xAE,0xE1,0x20,0x6D,0x63,0x40,0x19,0x07,0x6D,0x27,0x03,0x2A,0x39,
+    0x78,0x9B,0x19,0x58,0xCC,0x59,0xDE,0xCF,0xE8,0x7A,0x8E,0xB0,0x8F,0x93,0x74,0x2A,
+    0x58,0xD2,0x71,0x61,0xAF,0x66,0x12,0x54,0x75,0x42,0xD1,0x6D,0x26,0x61,0x61,0xC7,
+    0x8D,0x2F,0xDB,0xE9,0xDA,0x8E,0x4C,0xED,0x2F,0x91,0x54,0x82,0xF2,0x8E,0x13,0x7C,
+    0x35,0x97,0xA0,0xC2,0x13,0x0C,0x6F,0x93,0x09,0x8B,0x3C,0x9E,0x0E,0x64,0x43,0x5D,
+    0xE7,0x11,0x0D,0x22,0xA5,0x9E,0x0A,0x96,0x7A,0x9C,0xE0,0xAB,0xD9,0x04,0xD5,0x9E,
+    0x60,0x78,0x9B,0x4D,0x58,0xF0,0xF1,0x74,0x30,0x36,0x6C,0x55,0xCD,0x47,0xFE,0x7B,
+    0x50,0x11,0x3C,0xB6,0x80,0xE2,0x03,0xC3,0xAE,0x64,0xB0,0x05,0xF4,0x9E,0x30,0x60,
+    0x93,0xBB,0x16,0x52,0x7B,0x5C,0xD0,0xB2,0x49,0x62,0x9A,0x46,0x2B,0x3D,0x2D,0xA0,
+    0xF4,0xB8,0xA1,0x57,0xB3,0x97,0x38,0xD8,0xC3,0x50,0x79,0x5A,0x48,0xE5,0xF1,0xC1,
+    0xCB,0x66,0xA9,0x65,0x1E,0x4D,0x62,0xEA,0x22,0x11,0x81,0xC3,0xD4,0xC5,0x21,0x06,
+    0x85,0xA9,0x93,0x42,0x1F,0x83,0x99,0x65,0xBD,0x8D,0xA6,0x30,0x73,0x51,0xB8,0x45,
+    0xE0,0x30,0x73,0x71,0xB8,0xC5,0x20,0x31,0x73,0x92,0xB8,0xF5,0xB1,0x98,0x1B,0xE6,
+    0x49,0x2C,0x85,0x39,0x4C,0x61,0x12,0xCF,0x5F,0x0E,0xF3,0x97,0x20,0x90,0x97,0x3B,
+    0xC8,0x4B,0x3C,0xCC,0x15,0xA6,0x6D,0xFC,0x0C,0x2E,0x1C,0xDC,0x61,0xCC,0xE0,0xC2,
+    0xC1,0x1E,0xCA,0x0C,0x2E,0x5C,0xFC,0x79,0x67,0xF0,0xCE,0xB0,0x4E,0x63,0xF9,0xDB,
+    0xC1,0xFC,0xA5,0xF1,0xEC,0xED,0x60,0xF6,0x52,0x04,0xEE,0x76,0x0E,0xEE,0x52,0x0F,
+    0x73,0x89,0x99,0x3E,0xB2,0xE8,0x0C,0xEC,0xC8,0x1E,0x19,0x42,0xFE,0x75,0x24,0x8F,
+    0x0C,0x23,0xFB,0xBA,0x72,0x47,0xE6,0x63,0xCF,0x9C,0xBA,0x79,0x34,0x7B,0x8E,0x99,
+    0x9B,0x23,0xB0,0xE7,0x98,0xB8,0x39,0x06,0x7B,0xAE,0x79,0x9B,0xFB,0x56,0x2E,0x66,
+    0xCA,0x28,0xA2,0x17,0x2E,0x8E,0x9C,0x51,0x20,0xAC,0x5B,0x1C,0x49,0xA3,0xC0,0x58,
+    0xB6,0xB8,0xB2,0x46,0xE1,0x61,0x4F,0xD7,0x68,0x50,0xB6,0x1D,0xA0,0x42,0x83,0xB4,
+    0xF3,0x00,0xF5,0x19,0xAC,0xCD,0x07,0xAC,0xCE,0x2C,0xED,0x3F,0x74,0x6D,0x66,0xB0,
+    0x8E,0x53,0x66,0x5A,0x58,0x99,0x81,0x91,0x57,0x33,0x08,0xEA,0x32,0x61,0xD8,0x36,
+    0x83,0xB0,0x2A,0xE3,0x42,0x97,0xAD,0x74,0x4D,0x66,0x4C,0xD4,0x2F,0x91,0x14,0x82,
+    0x8A,0x8C,0x03,0x7A,0x35,0x87,0xA0,0x1E,0x13,0x08,0x6E,0x93,0x08,0xAB,0x31,0x4E,
+    0x78,0xD9,0x4C,0xD7,0x62,0x06,0xF3,0x48,0x25,0xA6,0x85,0x95,0x18,0x07,0xF4,0x6A,
+    0x16,0x41,0x1D,0x26,0x10,0xDC,0x66,0x11,0x56,0x61,0x9C,0xF0,0x63,0x33,0xAA,0x6A,
+    0x30,0x54,0x16,0x46,0x8A,0xA0,0x90,0x02,0x22,0x8C,0x03,0x77,0x25,0x7F,0x14,0x50,
+    0x61,0x02,0x91,0x4D,0xF2,0x28,0x24,0xC3,0x38,0xB1,0x65,0x9B,0xC4,0xB2,0x8D,0x16,
+    0x62,0x28,0x20,0xC4,0x78,0xB0,0x57,0x33,0x98,0xB8,0x18,0xC4,0x90,0x62,0x28,0x24,
+    0xC5,0x78,0xF1,0x65,0xBB,0xD4,0xB6,0x8F,0x26,0x32,0x75,0x12,0x89,0xC0,0x63,0xEA,
+    0xE4,0x11,0x83,0xC6,0xD4,0x4D,0xA3,0x8F,0xC5,0xCC,0x36,0xDF,0x46,0xD3,0x98,0x39,
+    0x69,0xDC,0x22,0xF0,0x98,0x39,0x79,0xDC,0x62,0x10,0x99,0xB9,0x89,0xDC,0xFA,0x98,
+    0xCC,0x4D,0xFB,0x24,0x96,0xC6,0xDC,0x41,0x63,0x12,0xCF,0x61,0xEE,0xE0,0x30,0x41,
+    0x20,0x30,0x77,0x11,0x98,0x78,0xD8,0x2B,0x2C,0xE3,0xF8,0xD9,0x5C,0xB8,0xF8,0xC3,
+    0x98,0xCD,0x85,0x8B,0x41,0x94,0xD9,0x5C,0x38,0x39,0xF4,0xCE,0xE6,0x9D,0x69,0x9E,
+    0xC6,0x72,0xB8,0x73,0x70,0x98,0xC6,0x33,0xB8,0x73,0x30,0x98,0x22,0xF0,0xB7,0x73,
+    0xF1,0x97,0x7A,0xD8,0x4B,0xAC,0x94,0x92,0x45,0x67,0x66,0x57,0x46,0xC9,0x10,0xF2,
+    0xB2,0x2B,0xA1,0x64,0x18,0x59,0xD9,0x99,0x4F,0x32,0x1F,0x83,0xD6,0x34,0xCE,0xA3,
+    0x19,0x74,0xCD,0xE2,0x1C,0x81,0x41,0xD7,0x24,0xCE,0x31,0x18,0x74,0xCE,0xE1,0xDC,
+    0xB7,0xAA,0xB1,0xD2,0x48,0x11,0xBD,0xA8,0x71,0xE5,0x91,0x02,0x61,0x4D,0xE3,0x4A,
+    0x24,0x05,0xC6,0x92,0xC6,0x99,0x49,0x0A,0x0F,0x83,0xBA,0x56,0x83,0xB3,0x3D,0x01,
+    0xC5,0x1A,0xAC,0x1D,0x0A,0xA8,0xD6,0xA0,0x6D,0x52,0x60,0xB9,0x66,0x71,0x9F,0xA2,
+    0xEB,0x35,0x54,0xD6,0x80,0x8D,0x62,0x11,0x14,0x6C,0x1C,0xD0,0xAB,0x59,0x04,0x15,
+    0x9B,0x40,0x70,0x9B,0x45,0x58,0xB2,0x71,0xC2,0xCB,0x66,0xBA,0x66,0x43,0xA7,0x62,
+    0xB2,0x51,0x34,0x82,0xA2,0x8D,0x0B,0x7B,0x35,0x8F,0xA0,0x6A,0x13,0x8A,0x6E,0x13,
+    0x09,0xCB,0x36,0x6E,0x7C,0xD9,0x4E,0xD7,0x6D,0xE8,0x54,0x98,0x36,0x8A,0x49,0x50,
+    0xB8,0x71,0x61,0xAF,0x66,0x12,0x54,0x6E,0x42,0xD1,0x6D,0x26,0x61,0xE9,0xC6,0x8D,
+    0x3F,0xB4,0x23,0x5C,0xBA,0x21,0x25,0xFD,0x68,0x2E,0x71,0x41,0x91,0x28,0x92,0x8D,
+    0x0B,0x6F,0x1D,0x63,0x44,0x91,0x6A,0x42,0x11,0x0D,0x96,0x88,0x2A,0xD1,0xB8,0x31,
+    0x85,0x6D,0x32,0xDB,0xC4,0x6A,0x32,0x44,0x91,0x64,0x7C,0x98,0x6B,0x19,0x4A,0x2C,
+    0x86,0x10,0x34,0x18,0xA2,0x4A,0x30,0x7E,0x5C,0x61,0x9F,0x2A,0x76,0xB1,0x44,0xA5,
+    0x36,0x51,0xF1,0x3C,0xA5,0x36,0x4F,0x08,0x34,0xA5,0x00,0x4D,0x1E,0x96,0x32,0xC5,
+    0x6C,0x1B,0x4B,0x53,0x66,0xD3,0xB4,0x8D,0xE7,0x29,0xB3,0x79,0xDA,0x22,0x10,0x95,
+    0x01,0x44,0x6D,0x3D,0x4C,0xE5,0x93,0x5D,0x12,0x49,0x53,0x6E,0xD2,0x94,0x44,0x73,
+    0x94,0x9B,0x1C,0x25,0xF1,0x04,0xE5,0x16,0x41,0x89,0x9B,0x9D,0x62,0x36,0x8A,0x9E,
+    0x6D,0x85,0xC5,0x0F,0xC2,0x6C,0x2B,0x2C,0x86,0x30,0x66,0x5B,0x61,0x73,0xE4,0x9B,
+    0x6D,0xBB,0xC9,0x2C,0x8D,0xE4,0x68,0x67,0x72,0x94,0x46,0x33,0xB4,0x33,0x19,0x4A,
+    0xE3,0xF9,0xD9,0x59,0xFC,0xA4,0x6E,0x76,0x92,0x39,0x64,0x67,0xB1,0x99,0xCD,0x8A,
+    0xD8,0x59,0x7C,0x5E,0xB3,0x02,0x76,0x86,0x90,0xD5,0xEC,0x78,0x9D,0x79,0x18,0x9A,
+    0xA7,0x59,0x1E,0xCB,0x90,0x35,0xCB,0xF2,0x78,0x86,0xAC,0x49,0x96,0x23,0x30,0x64,
+    0xCF,0xB1,0xDC,0x93,0xF5,0xE7,0x30,0x5D,0xC4,0x26,0x7D,0x2B,0x4E,0x17,0xF1,0x39,
+    0xDF,0x0A,0xD4,0x05,0x42,0xCA,0xB7,0x23,0x75,0xE1,0x66,0x68,0x94,0x1E,0x70,0x96,
+    0xD7,0x9A,0xE4,0x80,0xB5,0xC2,0xD6,0xA4,0x06,0xB4,0x45,0xB6,0x2E,0x31,0x2C,0xAE,
+    0xB3,0x47,0x69,0x41,0x98,0x45,0x69,0x0A,0x44,0x97,0x14,0x5C,0x90,0x6B,0x59,0xD2,
+    0xA4,0x84,0x50,0x50,0x8B,0x25,0x5D,0x42,0x70,0xC3,0x0A,0xF3,0x51,0x3A,0x90,0x99,
+    0xEF,0x25,0x8E,0x26,0x4D,0x32,0x70,0x62,0xAE,0xE5,0x49,0x93,0x0A,0x82,0x51,0x2D,
+    0xA2,0x74,0x89,0xC0,0x83,0x2B,0xEC,0x47,0x69,0x40,0xD8,0xC5,0x69,0x02,0x44,0x97,
+    0x04,0x9C,0x98,0x6B,0x99,0xD2,0xA4,0x80,0x60,0x54,0x8B,0x29,0x5D,0x02,0xF0,0xE0,
+    0x8E,0xF6,0xFD,0xBC,0xF9,0x8F,0xAF,0x15,0x45,0x7A,0x4B,0x01,0xC0,0xA8,0x13,0x45,
+    0x7A,0x4B,0x06,0x40,0xA9,0x11,0x45,0x7A,0x5B,0x0B,0xF0,0xD6,0x87,0x22,0xFD,0x2C,
+    0x08,0xE0,0x94,0x9D,0x25,0xBD,0xA5,0x0A,0x60,0x55,0x9D,0x25,0xBD,0x25,0x0D,0xA0,
+    0x15,0x9D,0x25,0xBD,0xAD,0x0F,0x2C,0xD6,0x9C,0x25,0xFD,0x2C,0x12,0xA0,0x94,0x9C,
+    0x25,0xBD,0xA5,0x14,0x20,0x55,0x9C,0x25,0xBD,0x25,0x17,0x60,0x15,0x9C,0x25,0xBD,
+    0xAD,0x19,0x2C,0xD5,0x9B,0x25,0xFD,0x2C,0x1C,0xE0,0x94,0x9B,0x25,0xBD,0xA5,0x1E,
+    0x60,0x55,0x9B,0x25,0xBD,0x25,0x21,0xA0,0x15,0x9B,0x25,0xBD,0xAD,0x23,0x2C,0xD6,
+    0x9A,0x25,0xFD,0x2C,0x26,0x20,0x94,0x9A,0x25,0xBD,0xA5,0x28,0xA0,0x54,0x9A,0x25,
+    0xBD,0x25,0x2B,0xE0,0x14,0x9A,0x25,0xBD,0xAD,0x2D,0xF8,0xEB,0xCC,0x92,0x7E,0x16,
+    0x18,0x50,0xCA,0xCC,0x92,0xDE,0x52,0x19,0x90,0xAA,0xCC,0x92,0xDE,0x92,0x1A,0xB0,
+    0x8A,0xCC,0x92,0xDE,0xD6,0x1B,0x96,0x6A,0xCC,0x92,0x7E,0x16,0x1D,0x10,0x4A,0xCC,
+    0x92,0xDE,0x52,0x1E,0x50,0x2A,0xCC,0x92,0xDE,0x92,0x1F,0x70,0x0A,0xCC,0x92,0xDE,
+    0xD6,0x20,0xFC,0xF5,0x65,0x49,0xAF,0x08,0x11,0x08,0xE5,0x65,0x49,0x6F,0xAB,0x11,
+    0x28,0xD5,0x65,0x49,0x6F,0x4B,0x12,0x38,0xC5,0x65,0x49,0x0F,0xE8,0x12,0xFE,0xDA,
+    0xB2,0xA4,0x57,0xC4,0x09,0x84,0xD2,0xB2,0xA4,0xB7,0x15,0x0A,0x94,0xCA,0xB2,0xA4,
+    0xB7,0x65,0x0A,0x9C,0xC2,0xB2,0xA4,0x07,0xB4,0x0A,0x7F,0x5D,0x59,0xD2,0x2B,0x82,
+    0x05,0x42,0x59,0x59,0xD2,0xDB,0xAA,0x05,0x4A,0x55,0x59,0xD2,0xDB,0xD2,0x05,0x4E,
+    0x51,0x59,0xD2,0x03,0xFA,0x85,0xBF,0xA6,0x2C,0xE9,0x35,0x11,0x03,0x65,0x9B,0x00,
+    0x28,0x19,0x48,0x3B,0x05,0x40,0xCE,0xC0,0xDA,0x2C,0x40,0x9A,0xC6,0xD2,0x7E,0x41,
+    0x15,0x36,0xE2,0xCB,0xC9,0x92,0x1E,0x52,0x37,0x30,0xAA,0xC9,0x92,0x1E,0x92,0x38,
+    0x50,0x8A,0xC9,0x92,0x1E,0xD4,0x39,0xBC,0xB5,0x64,0x49,0xAF,0x89,0x1D,0x08,0xA5,
+    0x64,0x49,0x0F,0x29,0x1E,0x28,0x95,0x64,0x49,0x0F,0xC9,0x1E,0x38,0x85,0x64,0x49,
+    0x0F,0x6A,0x1F,0xFE,0x3A,0xB2,0xA4,0xD7,0x04,0x10,0x84,0x32,0xB2,0xA4,0x87,0x54,
+    0x10,0x94,0x2A,0xB2,0xA4,0x87,0xA4,0x10,0x9C,0x22,0xB2,0xA4,0x07,0xF5,0x10,0x7F,
+    0x0D,0x59,0x52,0x29,0x9A,0x08,0x46,0xED,0x25,0x52,0xD9,0xB2,0x08,0x4E,0xDD,0x25,
+    0x52,0xD9,0xCA,0x08,0x52,0xCD,0x25,0x52,0x01,0xE2,0xC8,0x42,0xBD,0x25,0x52,0x29,
+    0xFA,0x08,0x56,0xF9,0x58,0x52,0xD9,0x12,0x09,0x5E,0xF5,0x58,0x52,0xD9,0x2A,0x09,
+    0x62,0xF1,0x58,0x52,0x01,0x42,0xC9,0x03,0xB5,0x63,0x49,0xA5,0x68,0x25,0x48,0xA5,
+    0x63,0x49,0x65,0xCB,0x25,0x68,0x95,0x63,0x49,0x65,0x2B,0x26,0x78,0x85,0x63,0x49,
+    0x05,0x88,0x26,0xCB,0x75,0x63,0x49,0xA5,0xE8,0x26,0x58,0x65,0x63,0x49,0x65,0x4B,
+    0x27,0x78,0x55,0x63,0x49,0x65,0xAB,0x27,0x88,0x45,0x63,0x49,0x05,0x08,0x28,0x0F,
+    0xD4,0x8C,0x25,0x95,0xA2,0xA1,0xA0,0x94,0x8C,0x25,0x95,0x2D,0xA3,0x20,0x55,0x8C,
+    0x25,0x95,0xAD,0xA4,0x60,0x15,0x8C,0x25,0x15,0x20,0xA6,0x2C,0xD5,0x8B,0x25,0x95,
+    0xA2,0xA7,0x20,0x95,0x8B,0x25,0x95,0x2D,0xA9,0xA0,0x55,0x8B,0x25,0x95,0xAD,0xAA,
+    0xE0,0x15,0x8B,0x25,0x15,0x20,0xAC,0x2C,0xD7,0x8A,0x25,0x95,0xA2,0xAD,0xA0,0x94,
+    0x8A,0x25,0x95,0x2D,0xAF,0x20,0x55,0x8A,0x25,0x95,0xAD,0xB0,0x60,0x15,0x8A,0x25,
+    0x15,0x20,0xB2,0x2C,0xD5,0x89,0x25,0x95,0xAA,0xB3,0xA0,0x94,0x89,0x25,0x15,0x20,
+    0xB5,0x20,0x55,0x89,0x25,0x15,0xA0,0xB6,0x60,0x15,0x89,0x25,0x15,0x24,0xB8,0x2C,
+    0xD5,0x88,0x25,0x95,0xAA,0xB9,0xA0,0x94,0x88,0x25,0x15,0x20,0xBB,0x20,0x55,0x88,
+    0x25,0x15,0xA0,0xBC,0x60,0x15,0x88,0x25,0x15,0x24,0xBE,0x2C,0xD5,0x87,0x25,0x95,
+    0xAA,0xBF,0xA0,0x94,0x87,0x25,0x15,0x20,0xC1,0x20,0x55,0x87,0x25,0x15,0xA0,0xC2,
+    0x60,0x15,0x87,0x25,0x15,0x24,0xC4,0x2C,0xD5,0x86,0x25,0x95,0xAE,0xC5,0x20,0x6D,
+    0x4F,0x20,0x39,0x06,0x6D,0x87,0x02,0x29,0x32,0x78,0x9B,0x14,0x50,0x94,0x59,0xDE,
+    0xA7,0x68,0xBA,0x0C,0x46,0x59,0x58,0x52,0x81,0xD2,0x0C,0x4E,0x55,0x58,0x52,0x81,
+    0xEA,0x0C,0x52,0x51,0x58,0x52,0xC1,0x02,0xCD,0x42,0x4D,0x58,0x52,0xE9,0x1A,0x0D,
+    0x4A,0x49,0x58,0x52,0x81,0x32,0x0D,0x52,0x45,0x58,0x52,0x81,0x4A,0x0D,0x56,0x41,
+    0x58,0x52,0xC1,0x62,0xCD,0x52,0x3D,0x58,0x52,0xE9,0x7A,0x0D,0x4A,0x39,0x58,0x52,
+    0x81,0x92,0x0D,0x52,0x35,0x58,0x52,0x81,0xAA,0x0D,0x56,0x31,0x58,0x52,0xC1,0xC2,
+    0xCD,0x52,0x2D,0x58,0xD2,0x2A,0xDA,0x4D,0x7C,0x4D,0x26,0xD2,0xDA,0xCA,0x0D,0x46,
+    0x3D,0x26,0xD2,0xDA,0xBA,0x0D,0x4A,0x2D,0x26,0xD2,0x02,0xAA,0x8D,0xB7,0x0E,0x13,
+    0x69,0x15,0xCD,0x06,0xA7,0x0C,0x2C,0x69,0x6D,0xC5,0x06,0xAB,0x0A,0x2C,0x69,0x6D,
+    0xBD,0x06,0xAD,0x08,0x2C,0x69,0x01,0xB5,0x66,0xB1,0x06,0x2C,0x69,0x15,0xAD,0x06,
+    0xA5,0x04,0x2C,0x69,0x6D,0xA5,0x06,0xA9,0x02,0x2C,0x69,0x6D,0x9D,0x06,0xAB,0x00,
+    0x2C,0x69,0x01,0x95,0x66,0xA9,0xFE,0x2B,0x69,0x15,0x8D,0x06,0xA7,0xFC,0x2B,0x69,
+    0x6D,0x85,0x06,0xAB,0xFA,0x2B,0x69,0x6D,0x7D,0x06,0xAD,0xF8,0x2B,0x69,0x01,0x75,
+    0x66,0xB1,0xF6,0x2B,0x69,0x15,0x6D,0x06,0xA1,0xF4,0x2B,0x69,0x6D,0x65,0x06,0xA5,
+    0xF2,0x2B,0x69,0x6D,0x5D,0x06,0xA7,0xF0,0x2B,0x69,0x01,0x55,0xC6,0x5F,0xF7,0x95,
+    0xB4,0x8A,0x26,0x83,0x52,0xF6,0x95,0xB4,0xB6,0x22,0x83,0x54,0xF5,0x95,0xB4,0xB6,
+    0x1E,0x83,0x55,0xF4,0x95,0xB4,0x80,0x1A,0xB3,0x54,0xF3,0x95,0xB4,0x8A,0x16,0x83,
+    0x50,0xF2,0x95,0xB4,0xB6,0x12,0x83,0x52,0xF1,0x95,0xB4,0xB6,0x0E,0x83,0x53,0xF0,
+    0x95,0xB4,0x80,0x0A,0xE3,0xAF,0xF7,0x4A,0x5A,0x55,0x83,0x41,0x28,0xF7,0x4A,0x5A,
+    0x40,0x81,0x41,0xA9,0xF6,0x4A,0x5A,0x40,0x7F,0xC1,0x29,0xF6,0x4A,0x5A,0x48,0x7D,
+    0xF1,0xD7,0x7A,0x25,0xAD,0xAA,0xBD,0x20,0x94,0x7A,0x25,0x2D,0xA0,0xBC,0xA0,0x54,
+    0x7A,0x25,0x2D,0xA0,0xBB,0xE0,0x14,0x7A,0x25,0x2D,0xA4,0xBA,0xF8,0xEB,0xBC,0x92,
+    0x56,0xD5,0x5C,0x10,0xCA,0xBC,0x92,0x16,0x50,0x5C,0x50,0xAA,0xBC,0x92,0x16,0xD0,
+    0x5B,0x70,0x8A,0xBC,0x92,0x16,0x52,0x5B,0xFC,0x35,0x5E,0x49,0xAB,0x6B,0x2D,0x28,
+    0xDB,0x09,0x48,0x69,0x41,0xDA,0x51,0x40,0x3A,0x0B,0xD6,0xA6,0x02,0x54,0x59,0x96,
+    0xF6,0x15,0x9A,0xC6,0x12,0x5F,0xDE,0x95,0xB4,0xA0,0xC2,0x82,0x51,0xDD,0x95,0xB4,
+    0xA0,0xBE,0x82,0x52,0xDC,0x95,0xB4,0xB0,0xBA,0xE2,0xAD,0xED,0x4A,0x5A,0x5D,0x5B,
+    0x41,0x28,0xED,0x4A,0x5A,0x50,0x59,0x41,0xA9,0xEC,0x4A,0x5A,0x50,0x57,0xC1,0x29,
+    0xEC,0x4A,0x5A,0x58,0x55,0xF1,0xD7,0x75,0x25,0xAD,0xAE,0xA9,0x20,0x94,0x75,0x25,
+    0x2D,0xA8,0xA8,0xA0,0x54,0x75,0x25,0x2D,0xA8,0xA7,0xE0,0x14,0x75,0x25,0x2D,0xAC,
+    0xA6,0xF8,0x6B,0xBA,0x12,0xAA,0x68,0x29,0x08,0x35,0x93,0x08,0xB5,0xC5,0x14,0x94,
+    0x7A,0x49,0x84,0xDA,0x6A,0x0A,0x4E,0xAD,0x24,0x42,0x01,0x39,0xC5,0x5F,0x27,0x89,
+    0x50,0x45,0x4F,0x41,0x2A,0xE7,0x4A,0xA8,0x2D,0xA8,0xA0,0x55,0x73,0x25,0xD4,0x56,
+    0x54,0xF0,0x8A,0xB9,0x12,0x0A,0x48,0x2A,0xCB,0xB5,0x5C,0x09,0x55,0x34,0x15,0x9C,
+    0x52,0xAE,0x84,0xDA,0xA2,0x0A,0x56,0x25,0x57,0x42,0x6D,0x55,0x05,0xAD,0x90,0x2B,
+    0xA1,0x80,0xAC,0xB2,0x58,0xC7,0x95,0x50,0x45,0x57,0x41,0x2A,0xE3,0x4A,0xA8,0x2D,
+    0xAC,0xA0,0x55,0x71,0x25,0xD4,0x56,0x56,0xF0,0x8A,0xB8,0x12,0x0A,0x48,0x2B,0xCB,
+    0x35,0x5C,0x09,0x55,0xB4,0x15,0x8C,0x12,0xAE,0x84,0xDA,0xE2,0x0A,0x4E,0x05,0x57,
+    0x42,0x6D,0x75,0x05,0xA9,0x80,0x2B,0xA1,0x80,0xBC,0xB2,0x50,0xBF,0x95,0x50,0x45,
+    0x5F,0xC1,0x29,0xDF,0x4A,0xA8,0x2D,0xB0,0x60,0x55,0x6F,0x25,0xD4,0x56,0x58,0xD0,
+    0x8A,0xB7,0x12,0x0A,0x48,0x2C,0x8B,0xB5,0x5B,0x09,0x55,0x34,0x16,0x8C,0xD2,0xAD,
+    0x84,0xDA,0x22,0x0B,0x4E,0xE5,0x56,0x42,0x6D,0x95,0x05,0xA9,0x70,0x2B,0xA1,0x80,
+    0xCC,0xB2,0x50,0xB7,0x95,0x50,0x55,0x67,0xC1,0x28,0xDB,0x4A,0x28,0x20,0xB4,0xE0,
+    0x54,0x6D,0x25,0x14,0x50,0x5A,0x90,0x8A,0xB6,0x12,0x0A,0x49,0x2D,0x0B,0x35,0x5B,
+    0x09,0x55,0xB5,0x16,0x8C,0x92,0xAD,0x84,0x02,0x62,0x0B,0x4E,0xC5,0x56,0x42,0x01,
+    0xB5,0x05,0xA9,0x60,0x2B,0xA1,0x90,0xDC,0xB2,0x50,0xAF,0x95,0x50,0x55,0x6F,0xC1,
+    0x28,0xD7,0x4A,0x28,0x20,0xB8,0xE0,0x54,0x6B,0x25,0x14,0x50,0x5C,0x90,0x8A,0xB5,
+    0x12,0x0A,0x49,0x2E,0x0B,0xB5,0x5A,0x09,0xD5,0x35,0x17,0x9C,0x6D,0x07,0x24,0xBA,
+    0x60,0xED,0x3C,0x20,0xD5,0x05,0x6D,0xF3,0x01,0xCA,0x2E,0x8B,0xFB,0x0F,0x4D,0x77,
+    0x41,0x28,0xD3,0x4A,0x28,0x28,0xBC,0xA0,0x54,0x69,0x25,0x14,0x54,0x5E,0x70,0x8A,
+    0xB4,0x12,0x0A,0x4B,0x2F,0xFE,0x1A,0xAD,0x84,0xEA,0xDA,0x0B,0x46,0x89,0x56,0x42,
+    0x41,0xF1,0x05,0xA7,0x42,0x2B,0xA1,0xA0,0xFA,0x82,0x54,0xA0,0x95,0x50,0x58,0x7E,
+    0x59,0xA8,0xCF,0x4A,0xA8,0xAE,0xBF,0x60,0x94,0x67,0x25,0x14,0x14,0x60,0x70,0xAA,
+    0xB3,0x12,0x0A,0x2A,0x30,0x48,0xC5,0x59,0x09,0x85,0x25,0x98,0x85,0xDA,0xAC,0xC7,
+    0x86,0xD6,0x87,0xBE,0xE9,0x98,0x61,0xF7,0xF9,0xF4,0xEB,0xD4,0xD6,0x3F,0xE7,0x63,
+    0x7B,0x76,0x6C,0x25,0x83,0x1A,0xDE,0xC4,0x23,0x08,0xBB,0x8E,0x3D,0x1D,0x58,0x72,
+    0x18,0x04,0x6C,0x30,0xA7,0x23,0x4F,0xFC,0x39,0xA0,0x8D,0x26,0x87,0xAE,0xBD,0x93,
+    0x8B,0x65,0x3D,0x1E,0x0E,0xE6,0x6E,0x6C,0xEE,0xA2,0x6F,0x02,0x0F,0x65,0x50,0xC0,
+    0x3B,0x48,0x7C,0x18,0xDE,0xC9,0xA3,0xC0,0x77,0x51,0xA9,0x74,0x00,0xDC,0x00,0x5A,
+    0xFF,0x80,0xC8,0xE7,0xC7,0x6B,0x7A,0xAB,0xA3,0xC6,0x23,0xC3,0xF0,0x8C,0x49,0xA5,
+    0x8B,0x98,0xB1,0xC9,0x3B,0x71,0x8F,0xCF,0x15,0x9D,0x78,0xC7,0x29,0xEF,0xC5,0x33,
+    0x56,0xB5,0x6E,0xE0,0xDB,0x03,0x11,0x3D,0x9F,0x8A,0xE2,0x7A,0x86,0xF1,0x8F,0x61,
+    0x04,0xC6,0x95,0xAE,0xBC,0xE3,0x19,0x83,0x77,0xA5,0x2F,0xFF,0xD8,0xB6,0xD9,0x1F,
+    0xCC,0x3E,0xE6,0x18,0xCB,0xFF,0xBA,0x4F,0x56,0x12,0x3C,0xB5,0xD4,0x59,0x9D,0xB0,
+    0xD6,0x71,0x38,0xA3,0x69,0xC4,0x3D,0x8C,0x66,0xD0,0x34,0xC3,0xE9,0xDC,0x28,0x78,
+    0xB3,0xDD,0xA5,0xB3,0xC8,0x78,0x09,0x21,0x43,0xE0,0x00,0x7C,0xBC,0x84,0xF1,0x21,
+    0x01,0x6D,0x4A,0x5E,0x02,0x29,0x91,0x88,0x00,0x2B,0x2F,0x06,0x2B,0xB7,0x33,0x6D,
+    0x2E,0xDF,0x85,0xC5,0xF8,0x23,0x6C,0x8C,0x8C,0x6D,0x75,0x56,0x14,0xBC,0x00,0x5E,
+    0x04,0xA2,0x46,0xCB,0x0A,0x44,0x88,0x18,0x01,0xA9,0xF3,0xA2,0x61,0x6A,0x24,0x42,
+    0xE4,0x84,0x8E,0x19,0x0F,0x3F,0xE1,0xE3,0xC6,0x43,0x51,0xC4,0xD8,0xF1,0xB1,0x64,
+    0x8E,0x9F,0x4F,0x5A,0x4A,0x0B,0xFE,0xD7,0x3D,0xFF,0x23,0x84,0x21,0xDE,0x4E,0x27,
+    0x47,0x85,0x0B,0x60,0x67,0x00,0xD4,0x88,0x59,0x03,0x08,0x31,0x33,0x20,0xEA,0xA4,
+    0xE8,0x90,0x86,0xE9,0x9C,0xEC,0x26,0xB3,0xC0,0x2C,0xA7,0x61,0x3A,0x58,0x0A,0xCE,
+    0x6B,0x3A,0x38,0xCC,0x58,0x78,0x26,0xD3,0xD1,0x1D,0xEC,0x39,0x72,0x17,0x1B,0x8A,
+    0xE6,0xF0,0xBA,0x74,0xA1,0x03,0x4C,0x80,0x01,0xEC,0x4D,0x98,0x61,0x73,0xD0,0x31,
+    0xD0,0x1E,0x46,0x75,0x4C,0x42,0xD7,0x68,0x53,0x70,0x07,0xFB,0x43,0x77,0xE9,0xEB,
+    0x4B,0xBF,0xB9,0xF5,0x25,0x65,0x17,0x50,0xB6,0xCD,0xC7,0x45,0x1E,0xDC,0x8F,0x33,
+    0x97,0x9F,0x59,0x49,0x99,0x86,0x3A,0x71,0xE6,0x01,0x5F,0xC7,0x9D,0x0E,0x2F,0xC9,
+    0x8B,0x80,0x37,0x48,0xD4,0xF1,0x27,0x16,0xBD,0x1D,0x68,0x0D,0x6B,0x86,0x0F,0x99,
+    0xB3,0xE3,0x81,0x4C,0xB2,0x96,0x3E,0x1E,0x47,0xE0,0x30,0x16,0x39,0xB4,0x87,0xC3,
+    0xC7,0xA0,0x1D,0x0C,0x72,0x6C,0x1F,0x7F,0x12,0x5C,0x6B,0x74,0x60,0x7F,0xD4,0xD4,
+    0xB4,0x1F,0x8F,0x06,0xD2,0x37,0x36,0x76,0x30,0x38,0x21,0x87,0xF1,0x27,0xB0,0x61,
+    0x0A,0x1F,0xC6,0x76,0x10,0x28,0xC0,0x1D,0x1C,0x2A,0xE8,0x5A,0xAB,0xAA,0xEE,0x3F,
+    0x79,0x27,0x86,0xF9,0xED,0x5A,0x1E,0x6A,0x79,0x32,0x90,0x49,0xD1,0xDA,0x41,0xA5,
+    0xD9,0x43,0x18,0xA3,0xB2,0x0F,0x98,0xD2,0xB5,0x7D,0x38,0x98,0x95,0x9D,0x38,0xA8,
+    0xB5,0x7B,0xD1,0x5A,0x97,0xB4,0xBB,0xDB,0x93,0x7C,0x6C,0x34,0x9E,0x0B,0xE4,0x77,
+    0x6C,0xEC,0xA5,0x77,0xC2,0x0F,0x63,0x57,0xF4,0xE0,0x23,0xF7,0xE1,0x1E,0x1C,0xDC,
+    0x8A,0x2E,0xBC,0xD4,0x2A,0x7D,0xE8,0x21,0xE3,0x47,0x7D,0x69,0xBF,0xE0,0x36,0xE3,
+    0xB9,0xD0,0x10,0x3A,0x34,0xF6,0x32,0x3B,0xE1,0x07,0x46,0xD2,0xB1,0x07,0x1F,0xB3,
+    0x0F,0xF7,0xE0,0x0A,0xA8,0x63,0x17,0x5E,0x66,0x95,0x3E,0x86,0xB6,0x4D,0x5F,0x93,
+    0x9B,0x9E,0xE1,0x87,0x43,0xE1,0xF9,0x5D,0x41,0x34,0xF8,0x04,0x80,0xD7,0x71,0xA9,
+    0x42,0xEB,0x44,0x06,0x40,0x1B,0x24,0xAA,0xD8,0x06,0x83,0x20,0xB8,0xD2,0x48,0xC9,
+    0xE8,0x8A,0xE9,0xFA,0x7C,0x3E,0xA1,0xB9,0x79,0x0B,0xC9,0xE5,0x33,0xAC,0x93,0xB3,
+    0xA0,0x3C,0x3E,0xE3,0xBA,0xF9,0xD2,0x72,0xF8,0xD8,0x40,0xCF,0xE0,0xA3,0x6D,0x50,
+    0xFE,0x56,0xE1,0x40,0xC6,0x02,0x73,0xB7,0x86,0x0B,0x51,0x16,0x9A,0xB7,0x35,0x60,
+    0x90,0x33,0x33,0x67,0xCB,0x41,0x49,0xEB,0xFE,0x70,0xD6,0x4D,0xC5,0xC1,0xC0,0xC9,
+    0x39,0xB4,0x05,0x49,0x9B,0x71,0xC3,0xE6,0xE6,0x88,0x0C,0xD1,0xF6,0x38,0xB2,0x63,
+    0x6A,0x8E,0xD0,0x20,0x71,0x2A,0xB6,0xD2,0xA6,0x2A,0x6F,0x75,0xDB,0x5C,0x0C,0x17,
+    0xE5,0xD1,0x20,0xEE,0x64,0x63,0x90,0x3C,0x05,0x39,0x84,0xBD,0x09,0x1B,0xA2,0x6F,
+    0x05,0x36,0xC8,0xDF,0x04,0x0E,0x12,0xA8,0xA1,0x0F,0xAD,0xD8,0xEF,0x93,0x78,0x26,
+    0x39,0x1A,0xF2,0x03,0xC3,0xA3,0xB7,0x95,0xBC,0x4D,0x40,0x06,0x65,0x2A,0xDE,0x3A,
+    0xB6,0x66,0x44,0x9D,0xA8,0x35,0x88,0x06,0x47,0x33,0xA4,0x41,0x8F,0x8E,0x39,0xDB,
+    0x6A,0x29,0x73,0x30,0x0A,0xCE,0x98,0x33,0x1E,0xC4,0x50,0x44,0xBE,0x54,0x80,0x01,
+    0xA2,0x62,0xB2,0xA5,0x82,0x0C,0xF1,0x05,0xE5,0xCA,0xA1,0x89,0x92,0x2A,0x67,0xC3,
+    0xF5,0x99,0x52,0x62,0x39,0xF9,0x0A,0xC9,0x93,0x13,0xA8,0x8B,0xAB,0xA0,0x2C,0x39,
+    0xA1,0x3A,0x79,0xD2,0x72,0xE4,0x60,0xAE,0xA7,0xC8,0xC1,0x32,0x28,0x43,0x2A,0x60,
+    0x10,0x53,0x81,0xF9,0x51,0x45,0x05,0xA8,0x0A,0xCD,0x8E,0x2A,0x2C,0xC4,0x95,0x99,
+    0x1B,0xC5,0x10,0xD4,0x52,0xE3,0x60,0x18,0x96,0x19,0x55,0x38,0x88,0xAC,0xD0,0xBC,
+    0xA8,0xE1,0x02,0x74,0x05,0x67,0x45,0x0D,0x18,0x22,0xCC,0xCA,0x89,0x43,0x0B,0x33,
+    0x25,0x0E,0xA6,0x81,0x19,0x51,0x03,0x84,0x48,0x0B,0xCE,0x87,0x3A,0x32,0x40,0x5B,
+    0x78,0x36,0xD4,0xA1,0x21,0xE2,0xEC,0x5C,0xF8,0xEF,0xF7,0x5B,0xDF,0x9C,0xBE,0x64,
+    0xD0,0x97,0x3F,0xA3,0xB5,0x50,0x0D,0x77,0x22,0xD0,0x0B,0xBF,0x8E,0x47,0xBD,0x03,
+    0xC9,0x63,0x54,0x07,0x06,0x9D,0x7A,0x0F,0x13,0x9D,0x0B,0x5D,0x68,0x4D,0x87,0xA4,
+    0x00,0x36,0x58,0x9F,0x19,0x14,0x4C,0x3F,0x9F,0x21,0x19,0x42,0x05,0xF7,0x72,0x19,
+    0x94,0x29,0x54,0x74,0x3F,0x8F,0x5A,0xC6,0x98,0x2C,0x44,0xD2,0x30,0x5B,0x04,0x65,
+    0x0E,0x1D,0xD4,0xC9,0x64,0x60,0x06,0x31,0xD0,0x5D,0x54,0x86,0x66,0x12,0x03,0xDE,
+    0xC9,0xA5,0x99,0x51,0xE4,0xF9,0x49,0x21,0x35,0x1B,0xC4,0x68,0xA4,0x06,0xB8,0x93,
+    0xD2,0x38,0x95,0xD4,0xEC,0xC5,0x45,0x6D,0xA4,0x4E,0x6A,0x76,0xE3,0xA4,0xD8,0xA1,
+    0x94,0x4A,0x33,0xA9,0x94,0xC2,0xCD,0x82,0xB4,0x52,0x1D,0x7A,0x81,0xE6,0x40,0xB5,
+    0xD4,0xE8,0xC3,0x4F,0x72,0xA8,0x5E,0x6A,0x74,0xB2,0x40,0xB1,0xA9,0x98,0x4E,0xC1,
+    0x44,0x28,0xA6,0x70,0xAB,0x20,0xCD,0x54,0x87,0x5E,0x60,0x38,0x50,0x35,0x35,0xFA,
+    0xF0,0x33,0x1C,0xAA,0x9B,0x1A,0x9D,0x2C,0x30,0x6C,0x2A,0xA7,0x1D,0x3D,0xD6,0xF2,
+    0xF5,0xFB,0xE1,0xEF,0xAB,0xDF,0xDF,0x98,0x11,0x26,0x12,0x67,0xA0,0x75,0x7C,0x29,
+    0x50,0x92,0xAB,0xC7,0xA1,0x0C,0x5A,0x14,0xAC,0x89,0x12,0x15,0x4C,0x31,0x3A,0x35,
+    0xF4,0x36,0x75,0xB5,0x79,0x7B,0x7B,0x0B,0x62,0x60,0x40,0x31,0x28,0x10,0x60,0x21,
+    0x2C,0x8C,0x70,0x3A,0x0D,0x0F,0xC2,0x81,0x4C,0x8C,0x78,0x06,0x15,0x13,0xA0,0x62,
+    0xD8,0x96,0x33,0x19,0xA1,0x5C,0x70,0x0C,0x83,0x8A,0x70,0x26,0x06,0x30,0x9D,0x88,
+    0x08,0x1E,0x06,0x34,0x83,0x06,0x8D,0x85,0xBE,0xFE,0xD9,0x8B,0x49,0xD5,0xD4,0x2C,
+    0xAA,0x0F,0xBF,0x87,0x75,0xF5,0x5E,0x4C,0xA9,0x77,0xD5,0x92,0x7F,0x4E,0xAF,0x19,
+    0xF1,0x03,0x9A,0x85,0x5C,0xD2,0x28,0x36,0x53,0xCE,0x9E,0xAD,0x86,0x77,0xC2,0x35,
+    0xA3,0xE1,0x88,0xB4,0x19,0x17,0xF6,0xC3,0x35,0xFF,0xA8,0x69,0xDF,0x1C,0xCA,0x56,
+    0x98,0xB1,0x63,0xBA,0x11,0x69,0x8E,0x47,0xCE,0xBB,0x61,0x37,0x1E,0xD6,0x4D,0xC7,
+    0xCA,0x8A,0x96,0xE9,0x78,0x98,0x9B,0x36,0xB7,0xCD,0xA1,0x6D,0x0E,0xDF,0x39,0xFB,
+    0x4F,0xBF,0x0E,0x77,0x7A,0xEB,0xE8,0xFE,0xDA,0x35,0x83,0x47,0xDA,0xBB,0xEB,0xDC,
+    0xF4,0xD2,0xF1,0x6B,0x6F,0xBB,0x4F,0xCE,0x9B,0x30,0x56,0x8F,0x59,0x0D,0xAA,0xB6,
+    0x3B,0x7C,0x7F,0xFA,0x75,0x6C,0x6E,0xD7,0xB6,0xFC,0xDA,0x0F,0x3F,0x57,0x0C,0x38,
+    0x89,0x30,0x0D,0x35,0x13,0xE8,0xF1,0xE1,0x36,0x41,0xC9,0x81,0xB6,0x16,0x4A,0x19,
+    0x6C,0x13,0xD6,0x34,0xCC,0x6C,0x30,0x6E,0xC4,0x57,0xC1,0xF3,0x39,0xFE,0x6B,0x9D,
+    0xEF,0xC3,0x2A,0xDA,0x74,0x5D,0xC0,0xAC,0xF2,0x7C,0x00,0x32,0x1D,0x7F,0x10,0x48,
+    0xF7,0x7B,0x7C,0xF3,0xD6,0x74,0x7B,0x82,0xE2,0x26,0xCD,0x65,0xDC,0xB8,0xCB,0x93,
+    0xE3,0xEF,0x75,0x9E,0x8F,0x6D,0x2C,0xDF,0x27,0xA8,0x55,0xDE,0x0B,0x30,0xD3,0xFF,
+    0x87,0xC1,0x74,0x06,0x04,0x9A,0xC5,0x81,0x02,0xA7,0x98,0x19,0x13,0x40,0x3D,0x1A,
+    0xC4,0x08,0x3C,0x1D,0x0C,0xD8,0x10,0x76,0xE0,0xC9,0xB1,0x12,0x18,0x64,0xCA,0x31,
+    0x55,0x2C,0x68,0xA5,0x89,0x3E,0x71,0x94,0x83,0x41,0x9C,0x81,0xD3,0x48,0x07,0x0D,
+    0x61,0x0C,0x9C,0x54,0xEB,0x60,0x41,0xBE,0xE0,0x29,0x66,0x02,0xF3,0x06,0x67,0x16,
+    0xF1,0xF9,0x06,0x50,0xDA,0xF0,0xC5,0xD0,0x3A,0x86,0x46,0x04,0x8B,0x1C,0x01,0xB4,
+    0x8A,0x15,0x01,0x65,0x12,0xF2,0x20,0x94,0xCE,0x84,0xC0,0xB2,0x48,0x98,0xC0,0xB8,
+    0xD1,0x90,0xCA,0xEA,0xA3,0x48,0xD0,0xA7,0xB6,0x2B,0xFB,0x29,0x37,0x2B,0xA7,0x45,
+    0xDE,0x1D,0xCF,0x4F,0x29,0x77,0xCC,0x7B,0xD7,0x2B,0x4F,0x64,0x1D,0xCB,0x8E,0xEC,
+    0xF4,0xE7,0x5E,0xF0,0x69,0x65,0x31,0x76,0xCD,0x5D,0xDB,0x8E,0x29,0x72,0x32,0xB6,
+    0xBF,0xEE,0x1A,0x4C,0xCF,0xE5,0x71,0x4C,0x8F,0x55,0xF7,0x53,0xFC,0xDA,0xBF,0x3C,
+    0x89,0x92,0x1E,0x43,0x5D,0x85,0x8D,0x2C,0x91,0x42,0x3F,0xAA,0xF2,0x8F,0xD7,0xFC,
+    0x5B,0x91,0x7D,0xDB,0xBE,0x7D,0x63,0x47,0xFF,0xFC,0xF6,0xF4,0x32,0xFC,0x97,0x5C,
+    0x7F,0x5A,0x67,0x5F,0xD2,0x3F,0xB5,0x3E,0xDA,0xFA,0x76,0xD3,0x7A,0x19,0xD6,0xF8,
+    0xD6,0x05,0x0D,0x1B,0xAE,0xF1,0x7A,0x86,0xE5,0x11,0x2D,0x8F,0xCD,0xFD,0x26,0x6A,
+    0x8C,0x08,0x9B,0x6B,0xC3,0x3F,0x8C,0xD4,0x0D,0xD8,0x92,0xE9,0xED,0xFA,0x53,0x82,
+    0x0C,0xC7,0x64,0x8F,0x1A,0x8E,0xF9,0xC1,0xEA,0x60,0x5E,0xB7,0x65,0xDF,0xFC,0x60,
+    0x6C,0x5D,0xBB,0x5B,0x33,0x7E,0x1D,0x23,0x0E,0xC9,0x9B,0x53,0xDD,0xBA,0xF6,0xDE,
+    0xAB,0x16,0xF2,0x90,0x74,0x92,0xAD,0x57,0xBE,0x7F,0x29,0xE7,0xC7,0x03,0xE2,0xEC,
+    0xA9,0xF9,0xC9,0x7D,0x9A,0x4E,0x0E,0xBF,0xC5,0xB9,0x61,0xC4,0x88,0x7F,0xC0,0x4F,
+    0x2E,0x43,0xC4,0x32,0x68,0xAE,0x20,0x2F,0x4E,0x34,0x3D,0x1B,0x26,0x07,0x36,0x3A,
+    0xBA,0xE1,0x5D,0xC9,0xAF,0xB6,0xDE,0x8F,0x87,0xC4,0x79,0xCE,0x1D,0xE5,0x13,0x4F,
+    0xAE,0x13,0x8F,0xF5,0xA1,0xA3,0xE5,0xD0,0xE7,0x74,0x4E,0x59,0x1C,0xF9,0xEC,0xE1,
+    0xFB,0x73,0x28,0xAF,0x43,0x8F,0xFF,0x98,0x9A,0xF4,0xB4,0xBC,0xDC,0x4E,0x1D,0x25,
+    0xFB,0xF9,0x9C,0x30,0xE6,0xAB,0x2C,0x7A,0x28,0x6F,0xB5,0x65,0x3A,0x9D,0x91,0x17,
+    0xCE,0x86,0x36,0x6C,0x39,0x9D,0x91,0x44,0xD7,0xA4,0x19,0xCE,0x5E,0x4B,0xCA,0x56,
+    0xAD,0x6C,0x84,0xB3,0x7D,0x64,0xD3,0x7F,0xF1,0x21,0x22,0x19,0x05,0x4F,0x4F,0x14,
+    0xDD,0xEA,0xB6,0x3E,0xF4,0xE3,0xF4,0xB8,0xDF,0xD8,0xD8,0x18,0x0F,0x40,0x0E,0x57,
+    0x77,0x76,0x03,0x2E,0xFB,0x33,0x9F,0x45,0xEC,0xCA,0x38,0xEE,0x70,0x03,0x37,0xC7,
+    0xBB,0x60,0x89,0xF5,0x7A,0x7B,0xAF,0xCA,0xC3,0xF7,0x8F,0x51,0x50,0x38,0x74,0x2D,
+    0x5B,0x64,0xFE,0xBE,0x4B,0xCA,0xE4,0x90,0xBC,0xFF,0xF5,0xFF,0x01,0x99,0x39,0x62,
+    0xBE,0x2D,0x57,0x01,0x00,
+};
+
+static const unsigned char data_css_siimple_min_ice_css_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "dbcdf714b871b38d"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x62,0x63,0x64,0x66,0x37,0x31,0x34,0x62,
+    0x38,0x37,0x31,0x62,0x33,0x38,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_css_siimple_min_ice_css_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "dbcdf714b871b38d"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x64,0x62,0x63,0x64,0x66,0x37,0x31,0x34,0x62,
+    0x38,0x37,0x31,0x62,0x33,0x38,0x64,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_css_siimple_min_ice_css_gz[] = {{
+    "\"dbcdf714b871b38d\"",
+    data_css_siimple_min_ice_css_gz_304,
+    sizeof(data_css_siimple_min_ice_css_gz_304),
+    data_css_siimple_min_ice_css_gz_206,
+    sizeof(data_css_siimple_min_ice_css_gz_206),
+    255,
+}};
+
 static const unsigned char data_css_style_css[] = {
 
     /* "/css/style.css" (15 chars) */
     0x2F,0x63,0x73,0x73,0x2F,0x73,0x74,0x79,0x6C,0x65,0x2E,0x63,0x73,0x73,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -6942,6 +9309,22 @@ static const unsigned char data_css_style_css[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x31,0x38,0x30,0x33,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "8b9b6e8748e33fa2"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x38,0x62,0x39,0x62,0x36,0x65,0x38,0x37,0x34,
+    0x38,0x65,0x33,0x33,0x66,0x61,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/css" (26 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,0x0D,0x0A,
@@ -7062,14 +9445,233 @@ static const unsigned char data_css_style_css[] = {
     0x68,0x74,0x3A,0x20,0x30,0x70,0x78,0x3B,0x20,0x0A,0x7D,
 };
 
+static const unsigned char data_css_style_css_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "8b9b6e8748e33fa2"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x38,0x62,0x39,0x62,0x36,0x65,0x38,0x37,0x34,
+    0x38,0x65,0x33,0x33,0x66,0x61,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_css_style_css_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "8b9b6e8748e33fa2"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x38,0x62,0x39,0x62,0x36,0x65,0x38,0x37,0x34,
+    0x38,0x65,0x33,0x33,0x66,0x61,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_css_style_css[] = {{
+    "\"8b9b6e8748e33fa2\"",
+    data_css_style_css_304,
+    sizeof(data_css_style_css_304),
+    data_css_style_css_206,
+    sizeof(data_css_style_css_206),
+    230,
+}};
+
+static const unsigned char data_css_style_css_gz[] = {
+
+    /* "/css/style.css" (15 chars) */
+    0x2F,0x63,0x73,0x73,0x2F,0x73,0x74,0x79,0x6C,0x65,0x2E,0x63,0x73,0x73,0x00,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 686" (21 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x36,0x38,0x36,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "c8f93fc7f7e009dc"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x63,0x38,0x66,0x39,0x33,0x66,0x63,0x37,0x66,
+    0x37,0x65,0x30,0x30,0x39,0x64,0x63,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (26 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (686 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xAD,0x54,0xC1,0x6E,0xDB,0x30,
+    0x0C,0x3D,0x37,0x5F,0x41,0x74,0x18,0xD0,0x62,0x55,0x60,0x37,0x6D,0xB1,0x28,0x97,
+    0xF5,0xD0,0x1C,0xB7,0xCB,0x7E,0x40,0xB6,0xE8,0x58,0x88,0x22,0x19,0x92,0xDC,0xB8,
+    0x2D,0xFA,0xEF,0x93,0x64,0x25,0x71,0x12,0x67,0xC0,0x80,0xF9,0x94,0x50,0x14,0xF9,
+    0xDE,0x23,0x9F,0x5A,0x39,0x55,0xEC,0xB5,0x60,0x06,0x3E,0x26,0x57,0x52,0x58,0x47,
+    0xAC,0x7B,0x93,0x48,0xDC,0x5B,0x83,0x14,0x94,0x56,0xB8,0x98,0x5C,0x6D,0x98,0x59,
+    0x09,0x45,0x0A,0xED,0x9C,0xDE,0x50,0x98,0xDD,0x37,0x9D,0x8F,0x36,0x8C,0x73,0xA1,
+    0x56,0x14,0x32,0xFF,0x47,0xBF,0xA2,0xA9,0xA4,0xDE,0x52,0xA8,0x05,0xE7,0xA8,0x7C,
+    0xA8,0x60,0xE5,0x7A,0x65,0x74,0xAB,0x38,0x29,0xB5,0xD4,0x86,0xC2,0x97,0xD9,0x6C,
+    0xB6,0x98,0x7C,0x4E,0xDA,0x7D,0x53,0x29,0x42,0x5F,0x7F,0x91,0x39,0x0A,0x12,0x2B,
+    0x77,0x76,0xCC,0x42,0x02,0x17,0xB6,0x91,0xEC,0x8D,0x42,0x21,0x75,0xB9,0xF6,0xB5,
+    0x53,0xC1,0x6D,0x2D,0x5C,0x00,0xE8,0xB0,0x73,0x84,0x49,0xB1,0x52,0x14,0x4A,0x54,
+    0x0E,0xCD,0x10,0x5F,0xFE,0xD0,0x74,0x90,0x3F,0x45,0xD0,0x31,0x93,0x63,0xA9,0x0D,
+    0x73,0x42,0xAB,0x1D,0xC5,0xD3,0xA6,0xB4,0x0E,0x84,0xA8,0xD2,0xEE,0x66,0xCA,0x4A,
+    0x27,0x5E,0xF1,0x36,0xE0,0x18,0xA1,0x94,0xE7,0xF9,0xF9,0xF5,0x74,0xE7,0xC2,0x95,
+    0x6C,0xCE,0xB2,0xEA,0x29,0xDC,0xFA,0xB1,0x41,0x2E,0x18,0xD8,0xD2,0x20,0x2A,0x60,
+    0x8A,0xC3,0xCD,0x86,0x75,0x64,0x2B,0xB8,0xAB,0x29,0x3C,0x65,0x59,0xD3,0xDD,0xFA,
+    0x1A,0xC3,0xE2,0x53,0x23,0x56,0xB5,0xBB,0x83,0xE3,0x28,0x7C,0x24,0x0D,0x23,0x9D,
+    0x4F,0x5F,0x7A,0xAA,0x95,0xAE,0x2A,0xBB,0x15,0xAE,0xAC,0x03,0x8E,0x46,0x5B,0xD1,
+    0x33,0x36,0x28,0x59,0x40,0xB7,0x80,0xD4,0x67,0x9E,0x45,0x69,0xC8,0x16,0x8B,0xB5,
+    0x70,0xA4,0xB5,0x68,0x88,0x45,0x89,0xA5,0xA3,0xB1,0x1C,0x90,0x8D,0x7E,0x1F,0x0D,
+    0xDB,0xA3,0xE8,0x5E,0xCB,0x61,0x6F,0x52,0xD6,0x58,0xAE,0x0B,0xDD,0x1D,0xCD,0x71,
+    0x34,0x53,0xB2,0x02,0xE5,0xC8,0xB8,0xE1,0x6C,0xB9,0xA0,0x6C,0x8D,0x0D,0x5A,0x36,
+    0x5A,0xA4,0x69,0x17,0xDA,0x70,0x3F,0x31,0xF0,0xBB,0x09,0x56,0x4B,0xC1,0xBD,0xCE,
+    0xB3,0xE7,0xF9,0xF2,0x61,0x01,0xFD,0x11,0x31,0x8C,0x8B,0xD6,0xFA,0x8C,0x48,0xF7,
+    0xA4,0xB7,0x50,0x0A,0xCD,0x58,0xEF,0xA4,0xD1,0x7D,0x96,0x7D,0x5D,0x40,0x32,0x42,
+    0x58,0x54,0x0A,0x24,0x0F,0x31,0xBF,0x52,0x86,0xA9,0x9D,0xB6,0x7D,0x02,0x64,0xD3,
+    0x99,0x05,0x64,0x16,0x49,0xF8,0x63,0xC7,0xBB,0xD1,0x02,0x2B,0x6D,0xF0,0x0E,0x46,
+    0x8E,0x58,0xE5,0xC6,0xE1,0x0C,0xAD,0xB2,0xC3,0xF6,0x18,0xA0,0xD5,0x18,0xF6,0xC2,
+    0x9B,0x33,0xB0,0x83,0x81,0x37,0xFD,0x76,0x28,0x24,0x47,0xC7,0xDE,0x71,0x5A,0x79,
+    0xA7,0x8B,0x77,0xEC,0xDD,0xE1,0x05,0x1D,0x1A,0x0A,0xE2,0x71,0xC5,0x36,0x42,0xFA,
+    0xCE,0xBF,0x0D,0x16,0xAD,0x9F,0xA2,0x5F,0xBA,0x67,0x23,0x98,0xBC,0x03,0xEB,0x09,
+    0xFB,0xA1,0x1B,0x51,0xA5,0xD4,0x6D,0xAA,0x5E,0x68,0xC9,0xE3,0x2C,0xBA,0x50,0x3C,
+    0x02,0x48,0xE2,0xFB,0xD0,0x5F,0x55,0x08,0x5C,0x4B,0x5F,0xCA,0x9B,0x97,0xC2,0xF5,
+    0xAF,0x9F,0xD7,0x27,0xAE,0xEE,0xDF,0x86,0x9D,0xA7,0xD3,0x04,0x22,0xF4,0x51,0x8B,
+    0xBD,0xE4,0xCB,0xC7,0xE5,0xCB,0x9E,0xD6,0x6E,0x15,0xC6,0x11,0xEC,0xC5,0x1E,0x00,
+    0x58,0x2E,0xAF,0x07,0xED,0x4C,0x4F,0xEF,0x72,0xBF,0x65,0xFC,0x0E,0xFD,0xE6,0xF1,
+    0x3B,0xE1,0x10,0xAB,0x9C,0x61,0x38,0x58,0xF4,0xC2,0xEA,0xE5,0xDF,0xC3,0x80,0xFA,
+    0xCD,0xF2,0x8F,0xC2,0x09,0x84,0x43,0xF3,0xA1,0xC7,0x59,0xE1,0x3D,0xD0,0x86,0x51,
+    0x3A,0xDD,0xC4,0x2D,0xD8,0x3D,0xDE,0xE1,0xB1,0x4E,0x74,0x1E,0x53,0xAD,0x7F,0x74,
+    0xCE,0xD1,0xC2,0x33,0x29,0xCF,0xB6,0x1D,0x2E,0x3D,0x01,0x34,0xFE,0x40,0x0E,0xDF,
+    0x60,0xC4,0xF8,0xE3,0x7E,0x3C,0xB2,0x5C,0xB6,0xF8,0x0F,0xA5,0x0F,0x82,0x27,0x1D,
+    0xA2,0x63,0x26,0x9F,0x7F,0x00,0xD0,0xF7,0xFA,0x03,0x0B,0x07,0x00,0x00,
+};
+
+static const unsigned char data_css_style_css_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "c8f93fc7f7e009dc"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x63,0x38,0x66,0x39,0x33,0x66,0x63,0x37,0x66,
+    0x37,0x65,0x30,0x30,0x39,0x64,0x63,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_css_style_css_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "c8f93fc7f7e009dc"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x63,0x38,0x66,0x39,0x33,0x66,0x63,0x37,0x66,
+    0x37,0x65,0x30,0x30,0x39,0x64,0x63,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/css" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x63,0x73,0x73,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_css_style_css_gz[] = {{
+    "\"c8f93fc7f7e009dc\"",
+    data_css_style_css_gz_304,
+    sizeof(data_css_style_css_gz_304),
+    data_css_style_css_gz_206,
+    sizeof(data_css_style_css_gz_206),
+    253,
+}};
+
 static const unsigned char data_font_latin_woff2[] = {
 
     /* "/font/latin.woff2" (18 chars) */
     0x2F,0x66,0x6F,0x6E,0x74,0x2F,0x6C,0x61,0x74,0x69,0x6E,0x2E,0x77,0x6F,0x66,0x66,
     0x32,0x00,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -7082,6 +9684,18 @@ static const unsigned char data_font_latin_woff2[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x34,0x38,0x34,0x33,0x32,0x0D,0x0A,
 
+    /* "ETag: "eb513857bb01cc4f"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x62,0x35,0x31,0x33,0x38,0x35,0x37,0x62,
+    0x62,0x30,0x31,0x63,0x63,0x34,0x66,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (31 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/plain" (28 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x70,0x6C,0x61,0x69,0x6E,0x0D,0x0A,0x0D,0x0A,
@@ -10116,14 +12730,70 @@ static const unsigned char data_font_latin_woff2[] = {
     0xFB,0x45,0x04,0x60,0xCD,0xD7,0xD0,0x36,0xCF,0x84,0x13,0xB1,0xB6,0x54,0xCF,0x03,
 };
 
+static const unsigned char data_font_latin_woff2_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "eb513857bb01cc4f"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x62,0x35,0x31,0x33,0x38,0x35,0x37,0x62,
+    0x62,0x30,0x31,0x63,0x63,0x34,0x66,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (33 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,0x0D,
+    0x0A,
+};
+
+static const unsigned char data_font_latin_woff2_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "eb513857bb01cc4f"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x62,0x35,0x31,0x33,0x38,0x35,0x37,0x62,
+    0x62,0x30,0x31,0x63,0x63,0x34,0x66,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (31 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/plain" (26 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x70,0x6C,0x61,0x69,0x6E,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_font_latin_woff2[] = {{
+    "\"eb513857bb01cc4f\"",
+    data_font_latin_woff2_304,
+    sizeof(data_font_latin_woff2_304),
+    data_font_latin_woff2_206,
+    sizeof(data_font_latin_woff2_206),
+    211,
+}};
+
 static const unsigned char data_font_latin_ext_woff2[] = {
 
     /* "/font/latin_ext.woff2" (22 chars) */
     0x2F,0x66,0x6F,0x6E,0x74,0x2F,0x6C,0x61,0x74,0x69,0x6E,0x5F,0x65,0x78,0x74,0x2E,
     0x77,0x6F,0x66,0x66,0x32,0x00,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -10136,6 +12806,18 @@ static const unsigned char data_font_latin_ext_woff2[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x33,0x35,0x31,0x32,0x30,0x0D,0x0A,
 
+    /* "ETag: "51a12487fd51cc02"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x35,0x31,0x61,0x31,0x32,0x34,0x38,0x37,0x66,
+    0x64,0x35,0x31,0x63,0x63,0x30,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (31 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: text/plain" (28 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
     0x78,0x74,0x2F,0x70,0x6C,0x61,0x69,0x6E,0x0D,0x0A,0x0D,0x0A,
@@ -12338,14 +15020,70 @@ static const unsigned char data_font_latin_ext_woff2[] = {
     0x91,0x14,0xE6,0x0D,0x3C,0x76,0xB8,0xBA,0x53,0x76,0xB4,0xFC,0xD2,0xBC,0x12,0x2D,
 };
 
+static const unsigned char data_font_latin_ext_woff2_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "51a12487fd51cc02"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x35,0x31,0x61,0x31,0x32,0x34,0x38,0x37,0x66,
+    0x64,0x35,0x31,0x63,0x63,0x30,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (33 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,0x0D,
+    0x0A,
+};
+
+static const unsigned char data_font_latin_ext_woff2_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "51a12487fd51cc02"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x35,0x31,0x61,0x31,0x32,0x34,0x38,0x37,0x66,
+    0x64,0x35,0x31,0x63,0x63,0x30,0x32,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (31 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: text/plain" (26 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x74,0x65,
+    0x78,0x74,0x2F,0x70,0x6C,0x61,0x69,0x6E,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_font_latin_ext_woff2[] = {{
+    "\"51a12487fd51cc02\"",
+    data_font_latin_ext_woff2_304,
+    sizeof(data_font_latin_ext_woff2_304),
+    data_font_latin_ext_woff2_206,
+    sizeof(data_font_latin_ext_woff2_206),
+    211,
+}};
+
 static const unsigned char data_img_favicon_png[] = {
 
     /* "/img/favicon.png" (17 chars) */
     0x2F,0x69,0x6D,0x67,0x2F,0x66,0x61,0x76,0x69,0x63,0x6F,0x6E,0x2E,0x70,0x6E,0x67,
     0x00,0x00,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -12358,6 +15096,18 @@ static const unsigned char data_img_favicon_png[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x37,0x36,0x30,0x0D,0x0A,
 
+    /* "ETag: "80e1c7d3df7a39b6"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x38,0x30,0x65,0x31,0x63,0x37,0x64,0x33,0x64,
+    0x66,0x37,0x61,0x33,0x39,0x62,0x36,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (31 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: image/png" (27 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x69,0x6D,
     0x61,0x67,0x65,0x2F,0x70,0x6E,0x67,0x0D,0x0A,0x0D,0x0A,
@@ -12413,13 +15163,69 @@ static const unsigned char data_img_favicon_png[] = {
     0x49,0x45,0x4E,0x44,0xAE,0x42,0x60,0x82,
 };
 
+static const unsigned char data_img_favicon_png_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "80e1c7d3df7a39b6"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x38,0x30,0x65,0x31,0x63,0x37,0x64,0x33,0x64,
+    0x66,0x37,0x61,0x33,0x39,0x62,0x36,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (33 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,0x0D,
+    0x0A,
+};
+
+static const unsigned char data_img_favicon_png_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "ETag: "80e1c7d3df7a39b6"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x38,0x30,0x65,0x31,0x63,0x37,0x64,0x33,0x64,
+    0x66,0x37,0x61,0x33,0x39,0x62,0x36,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=604800" (31 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x36,0x30,0x34,0x38,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: image/png" (25 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x69,0x6D,
+    0x61,0x67,0x65,0x2F,0x70,0x6E,0x67,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_img_favicon_png[] = {{
+    "\"80e1c7d3df7a39b6\"",
+    data_img_favicon_png_304,
+    sizeof(data_img_favicon_png_304),
+    data_img_favicon_png_206,
+    sizeof(data_img_favicon_png_206),
+    208,
+}};
+
 static const unsigned char data_js_iro_js[] = {
 
     /* "/js/iro.js" (11 chars) */
     0x2F,0x6A,0x73,0x2F,0x69,0x72,0x6F,0x2E,0x6A,0x73,0x00,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -12432,6 +15238,22 @@ static const unsigned char data_js_iro_js[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x37,0x30,0x35,0x36,0x32,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "16feb2d68ac87a88"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x31,0x36,0x66,0x65,0x62,0x32,0x64,0x36,0x38,
+    0x61,0x63,0x38,0x37,0x61,0x38,0x38,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: application/javascript" (40 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
     0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
@@ -16851,14 +19673,1308 @@ static const unsigned char data_js_iro_js[] = {
     0x3B,0x0A,
 };
 
+static const unsigned char data_js_iro_js_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "16feb2d68ac87a88"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x31,0x36,0x66,0x65,0x62,0x32,0x64,0x36,0x38,
+    0x61,0x63,0x38,0x37,0x61,0x38,0x38,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_js_iro_js_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "16feb2d68ac87a88"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x31,0x36,0x66,0x65,0x62,0x32,0x64,0x36,0x38,
+    0x61,0x63,0x38,0x37,0x61,0x38,0x38,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: application/javascript" (38 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
+    0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
+    0x72,0x69,0x70,0x74,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_js_iro_js[] = {{
+    "\"16feb2d68ac87a88\"",
+    data_js_iro_js_304,
+    sizeof(data_js_iro_js_304),
+    data_js_iro_js_206,
+    sizeof(data_js_iro_js_206),
+    245,
+}};
+
+static const unsigned char data_js_iro_js_gz[] = {
+
+    /* "/js/iro.js" (11 chars) */
+    0x2F,0x6A,0x73,0x2F,0x69,0x72,0x6F,0x2E,0x6A,0x73,0x00,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 17828" (23 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x31,0x37,0x38,0x32,0x38,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "ed93c0ad1b78f6dc"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x64,0x39,0x33,0x63,0x30,0x61,0x64,0x31,
+    0x62,0x37,0x38,0x66,0x36,0x64,0x63,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: application/javascript" (40 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
+    0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
+    0x72,0x69,0x70,0x74,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (17828 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xED,0x7D,0xFB,0x7B,0xDB,0x36,
+    0xB2,0xE8,0xEF,0xFE,0x2B,0x18,0xB7,0x1B,0x91,0x09,0x25,0xCB,0x76,0xEC,0x24,0x52,
+    0xB4,0xDE,0xD4,0x49,0x1B,0xDF,0x4D,0x93,0x7C,0x71,0xD2,0x76,0xAF,0xEB,0xF5,0xA1,
+    0x28,0x4A,0x62,0x4D,0x93,0x5A,0x92,0xF2,0xA3,0xB1,0xFF,0xF7,0x3B,0x0F,0x00,0x04,
+    0x48,0x48,0x96,0xF3,0xD8,0xBB,0xE7,0xFB,0xB6,0xE7,0x6C,0x2C,0x02,0x83,0xD7,0x60,
+    0x66,0x30,0x33,0x18,0x00,0x1B,0x0F,0xEE,0xAD,0x39,0x0F,0x9C,0x38,0xCF,0x3A,0x7F,
+    0x14,0xCE,0xF9,0x4E,0x67,0xA7,0xB3,0x85,0x09,0x5B,0xDD,0xCD,0xDD,0xF6,0x56,0x77,
+    0x6B,0xD3,0xF9,0x3F,0xC1,0x59,0x54,0x38,0x2F,0x82,0x34,0x8E,0x12,0xCC,0x79,0x1D,
+    0x87,0x51,0x5A,0x44,0x23,0x67,0x9E,0x8E,0xA2,0xDC,0xF9,0xF9,0xDD,0x6B,0x67,0xAB,
+    0xD3,0xC5,0x9C,0x49,0x5C,0x4E,0xE7,0xC3,0x4E,0x98,0x9D,0x6D,0xFC,0x11,0x60,0xA9,
+    0x0D,0xAE,0x16,0xF2,0x36,0xD6,0xD6,0xDC,0xF1,0x3C,0x0D,0xCB,0x38,0x4B,0x1D,0x77,
+    0x92,0x64,0xC3,0x20,0xF1,0x9D,0x71,0x10,0x96,0x59,0x7E,0xE5,0x39,0x9F,0xD6,0x1C,
+    0xA7,0xBC,0x9A,0x45,0xD9,0xD8,0x89,0x2E,0x67,0x59,0x5E,0x16,0xCE,0x60,0x30,0x70,
+    0x5A,0xD9,0xF0,0x8F,0x28,0x2C,0x5B,0xCE,0xFD,0xFB,0x32,0xFB,0x2C,0x1B,0xCD,0x93,
+    0xC8,0xB9,0x87,0xB9,0xD8,0x81,0x71,0x9C,0x46,0xA3,0x96,0xB3,0x27,0x32,0x3A,0xAA,
+    0xB8,0xAC,0xDC,0xF5,0x9C,0x5E,0x55,0x3B,0x17,0xE0,0xCA,0x65,0x7F,0xA8,0x7A,0xCE,
+    0xE8,0x04,0x67,0x23,0xA8,0x8B,0x3F,0x5C,0xD5,0x3D,0xAC,0x40,0x74,0x1A,0x2A,0x16,
+    0x3F,0xAE,0xAF,0x9D,0x22,0x4A,0xC6,0xBE,0xF8,0xEE,0xC0,0x58,0xF5,0x56,0xBD,0xFE,
+    0xDA,0x8D,0x5B,0x4E,0xE3,0x02,0x86,0xA9,0x06,0x0E,0x23,0x85,0x6E,0x17,0x91,0x53,
+    0x94,0x79,0x0C,0x03,0xEB,0xAF,0x41,0xCD,0xE7,0x41,0xEE,0xA4,0xFE,0xDC,0x2F,0xFD,
+    0xD8,0xCF,0xFD,0xCC,0x1F,0x0F,0x3E,0xDD,0xF8,0xD1,0xE0,0xE8,0xD8,0x0F,0x07,0x1B,
+    0x41,0x18,0x97,0xD7,0xD1,0xA5,0xBB,0xD7,0x2B,0xAE,0x27,0xD7,0xE9,0xF5,0xEC,0xFA,
+    0x7B,0xEF,0x3A,0x9F,0x4D,0xAF,0x27,0x79,0x3C,0xBA,0xCE,0x2E,0x8A,0xEB,0xB3,0x34,
+    0xBC,0x4E,0xCB,0x8B,0x6B,0xE8,0xF1,0x51,0x38,0x3D,0xBE,0xFE,0x33,0xCB,0xAE,0xFF,
+    0x99,0xE5,0xA3,0xEB,0x7F,0xB6,0xDB,0x1B,0x71,0x5F,0x35,0x5E,0xB8,0xA9,0x9F,0x78,
+    0x9F,0xC6,0x59,0xEE,0x62,0x8B,0x73,0x27,0x4E,0x1D,0xF8,0x76,0xD2,0xA3,0xF9,0xF1,
+    0x20,0x81,0x7F,0xFA,0xCE,0x4D,0x1E,0x95,0xF3,0x3C,0x75,0xD2,0x1B,0x55,0x2A,0x70,
+    0x53,0xEF,0x13,0xC2,0x27,0x83,0xB4,0x33,0x0B,0xF2,0x28,0x2D,0xDF,0x64,0xA3,0xA8,
+    0x9F,0xDC,0xBF,0x9F,0x74,0xF2,0xE8,0x2C,0x3B,0x8F,0xF6,0xA7,0x71,0x32,0x02,0xB0,
+    0x7E,0x55,0x6A,0x8A,0x6D,0xF9,0x73,0x2E,0x59,0x8D,0x2B,0xC8,0x27,0xF3,0x33,0xA8,
+    0xA1,0xE8,0xC7,0x63,0x37,0x19,0x14,0x2E,0x0C,0x34,0xF1,0x7C,0x95,0xDC,0x49,0xA2,
+    0x74,0x52,0x4E,0xFF,0xBA,0x0D,0xDD,0xC2,0x7E,0xCE,0x07,0xD0,0x2D,0xBF,0x1C,0x6C,
+    0xF7,0xCB,0x67,0x75,0xA0,0x7E,0xF9,0xF0,0x21,0x80,0xCD,0x3B,0xB3,0x79,0x31,0x75,
+    0xC7,0x47,0xE5,0xB1,0x07,0x03,0x70,0x6E,0xA0,0xE6,0x74,0x9E,0x24,0xF7,0x06,0xF3,
+    0xFB,0xF7,0xDD,0xA4,0x13,0x62,0xE7,0xA0,0xD7,0x83,0xB9,0xE7,0x73,0x7A,0x7A,0xFF,
+    0xBE,0xF8,0xD1,0x81,0x79,0x0E,0xE6,0x49,0xF9,0x2E,0xCF,0x66,0x85,0x68,0x32,0x46,
+    0xB4,0x34,0x72,0xCE,0xB3,0x78,0xE4,0x74,0x81,0x6A,0x92,0xA3,0xF8,0x18,0xEB,0x85,
+    0x3F,0xB5,0xF2,0x90,0xC2,0x1D,0x10,0x38,0xCC,0x06,0x49,0xE7,0x34,0xBA,0x12,0x8D,
+    0xBA,0xF9,0x00,0xD1,0x35,0xF6,0xEE,0xDF,0x1F,0x45,0x49,0x54,0x46,0x0E,0x7D,0x8A,
+    0xDC,0x4C,0x4B,0xC5,0x32,0xE7,0x84,0xBE,0xCC,0xCF,0xBD,0x0A,0xA5,0xE7,0x6E,0xC2,
+    0x34,0xC2,0x48,0xCD,0x07,0x9F,0x90,0xA4,0x7B,0x89,0x3F,0xC3,0xD6,0x7B,0x73,0x1F,
+    0x0A,0xF6,0x4A,0x1F,0x2A,0xED,0xC5,0xFE,0xC9,0xC9,0x69,0x0F,0xAB,0x86,0x1F,0x33,
+    0xF9,0x63,0xD8,0xEB,0xC2,0xBF,0x11,0x7F,0x26,0x32,0x35,0xE4,0x1F,0x61,0x96,0x02,
+    0x49,0xCE,0x91,0x76,0x7B,0x3C,0xD8,0x9B,0xBE,0x24,0x86,0xCE,0x79,0x0A,0x33,0x0E,
+    0x58,0xE3,0x1F,0x6E,0xEE,0xF9,0x79,0xD5,0x2F,0x9C,0xF9,0x4F,0x0A,0x54,0xA2,0xBB,
+    0xCA,0xBF,0xC2,0x7C,0x31,0x29,0x83,0x41,0x7A,0x7D,0xBD,0x3E,0xCC,0xB2,0x24,0x0A,
+    0xD2,0xF5,0xC1,0x40,0x30,0x25,0x00,0x38,0xB2,0x06,0x80,0xEA,0xD3,0x24,0xAE,0x23,
+    0x8B,0xA4,0x13,0x0D,0x0A,0x8A,0xA6,0xF3,0xB3,0x61,0x94,0x5B,0x4B,0x9E,0x53,0x0B,
+    0x7E,0xEA,0xF3,0x1F,0xF8,0xC7,0xEB,0x6B,0xD4,0x90,0x76,0x60,0xEC,0xD7,0xD7,0xD5,
+    0x47,0x28,0xC9,0x1A,0x0A,0x76,0xB0,0x3A,0x1F,0xE8,0x1B,0x51,0x09,0x7F,0xE5,0xBC,
+    0x79,0x12,0x07,0x09,0x96,0xE6,0x3A,0xFC,0xC4,0xC2,0x25,0x67,0xCC,0x5B,0xC8,0xEE,
+    0x5C,0xC9,0x20,0xF5,0xE9,0x03,0xF0,0x5A,0x46,0x97,0xE5,0x20,0xD1,0x98,0xE3,0x82,
+    0x81,0x15,0x4E,0x12,0x6D,0xF8,0xD0,0xC2,0x6C,0x0F,0x00,0xF0,0xAF,0x4F,0xFF,0xC2,
+    0xFF,0x4E,0x3B,0x31,0x48,0xBA,0xCB,0xB7,0x50,0xC0,0x7B,0xB8,0xE9,0xF5,0x04,0x92,
+    0x14,0x27,0xF7,0x93,0x67,0x29,0x81,0x09,0xCE,0x48,0x88,0x33,0xD4,0xD0,0x81,0x8D,
+    0x28,0xFB,0x28,0x39,0xF6,0x24,0xED,0xCF,0x71,0x28,0x55,0xBB,0xF4,0xA9,0x53,0xEF,
+    0xBA,0xEC,0xAD,0x86,0x6B,0xC2,0x12,0x76,0x8E,0x7B,0x50,0x0D,0x68,0xA2,0x64,0x84,
+    0x3F,0xEF,0x57,0xCD,0xA6,0xD4,0xEC,0xCC,0xAB,0xF8,0x8D,0xB0,0x8E,0xDD,0x4E,0x15,
+    0x3E,0xC3,0xCE,0x30,0x28,0xE0,0x27,0x11,0xE5,0xA0,0xFB,0xF9,0x43,0x69,0x54,0xC9,
+    0x63,0x1A,0xE6,0x51,0x70,0x5A,0x8D,0x0B,0xBB,0x7A,0x53,0xF5,0xFC,0xD4,0x05,0xE4,
+    0xBB,0xF7,0x70,0x7A,0x47,0x24,0x2E,0xE0,0xEF,0xE0,0x5E,0x17,0xEA,0xDE,0x04,0x66,
+    0x17,0xB2,0x25,0xF1,0xAE,0xAF,0x63,0x58,0x70,0x90,0xDF,0x87,0x19,0x14,0x8D,0xDE,
+    0x47,0xB8,0xF4,0x01,0x75,0x02,0xA0,0x1B,0xDB,0x32,0x7C,0xD7,0x92,0x78,0x7D,0x5D,
+    0x7A,0xEE,0x89,0xA7,0x0B,0xCA,0x13,0x97,0x31,0x87,0xFC,0xAE,0xE4,0xA4,0x1F,0xF5,
+    0x49,0xFA,0x75,0x0A,0x58,0xCA,0xD4,0xB2,0xC9,0x54,0xA3,0x11,0xE4,0x39,0xFC,0x6F,
+    0xD8,0x4E,0xE5,0xAF,0x1B,0xAF,0x9F,0x62,0x97,0xB3,0x99,0xEB,0xF5,0x51,0xAE,0x8B,
+    0x41,0x95,0x03,0x66,0x68,0x3F,0x96,0x3F,0x32,0x14,0x47,0x20,0x7F,0x53,0x0F,0xCB,
+    0x7A,0x44,0xD5,0xE3,0x01,0x56,0xF9,0x0E,0xD6,0x9D,0xA4,0x33,0xF7,0xE1,0x7F,0x83,
+    0x7B,0x9B,0xFE,0x98,0x8A,0xC3,0x42,0x14,0x0F,0xBE,0x77,0xC7,0xD0,0x39,0x92,0xD8,
+    0xC0,0xFF,0x08,0x9B,0xFA,0x5C,0x1D,0x60,0x66,0xDC,0xC9,0x2E,0xD2,0x28,0x3F,0xFC,
+    0xE5,0xA7,0x97,0x49,0x84,0x42,0x9A,0x99,0xB0,0xF4,0x23,0x9F,0x49,0x3C,0x03,0xB2,
+    0xC9,0xBD,0x5E,0xE6,0xF9,0x7F,0xB8,0x25,0x56,0x10,0x93,0xD0,0x9B,0x40,0xA2,0x87,
+    0x6C,0x5A,0x21,0x64,0xC8,0x2B,0x87,0x42,0x46,0xE8,0x17,0x8C,0xA1,0xA9,0x7F,0xEE,
+    0xCF,0xFC,0x91,0x7F,0xE5,0x9F,0xF9,0x13,0xFF,0x14,0xC5,0x3B,0xCE,0xF0,0xE9,0xF5,
+    0x75,0xE4,0x9F,0x0C,0x14,0xC1,0x00,0xA9,0x84,0xD0,0x21,0xE8,0x78,0x38,0x60,0xFA,
+    0xC8,0xF7,0xF2,0xA3,0xEE,0x71,0xEF,0x04,0xBA,0x30,0xF7,0xBB,0x4C,0xBB,0x9E,0x3F,
+    0x1D,0x74,0x69,0x14,0xA7,0x83,0x4B,0x9A,0xF6,0x53,0x5F,0xE1,0x79,0xAE,0x78,0x13,
+    0x88,0x8B,0x7E,0x63,0x43,0xB3,0x01,0x74,0x0B,0xF1,0x4C,0x88,0x1A,0x3E,0xDC,0x14,
+    0x43,0x1B,0xB8,0xB3,0xC1,0xE9,0xD1,0xF4,0x18,0x88,0x64,0x86,0x5D,0x02,0xD9,0x31,
+    0x18,0xCC,0xF0,0x0F,0x7E,0x21,0xCB,0x0C,0xF0,0x1B,0x7F,0xC0,0xA4,0x20,0xA4,0x98,
+    0x06,0x18,0x76,0x94,0x80,0x2A,0xC0,0xEB,0xCE,0x39,0xD0,0xFE,0xF9,0xB3,0x93,0xFE,
+    0x39,0x12,0x3C,0x34,0x49,0xB5,0x9E,0x23,0x95,0xDF,0x52,0x25,0x42,0xC9,0x1A,0x99,
+    0xD8,0x67,0x34,0xF0,0x3E,0xAF,0x85,0x23,0x98,0x39,0x54,0x2E,0x66,0x83,0xD9,0xF5,
+    0xF5,0x58,0xA1,0x95,0x85,0x3E,0xE0,0xD6,0x87,0x96,0xE7,0x62,0x65,0x9A,0xE1,0xDF,
+    0x7B,0x83,0x73,0x40,0x1E,0xD0,0xAA,0x3B,0x81,0x99,0xF7,0x3C,0xE6,0x81,0x73,0x1A,
+    0x7B,0x78,0x7D,0x3D,0xF2,0xD5,0x42,0x3A,0xD2,0x64,0xD8,0x19,0x94,0x39,0x83,0x14,
+    0x5F,0xF2,0x24,0x0A,0xB5,0x11,0xFE,0x85,0x82,0xC9,0x40,0x48,0x2C,0x1A,0x2F,0x94,
+    0xC9,0x07,0xD8,0x9B,0xD1,0xBD,0x41,0xC8,0x12,0x79,0x30,0x18,0x69,0xBA,0x05,0xF0,
+    0x72,0x4F,0x55,0x0C,0x10,0xA1,0x96,0x87,0x6C,0x48,0xB4,0x1D,0xCC,0x66,0xC0,0x56,
+    0xAC,0x7A,0x8C,0x3C,0x51,0x37,0xC9,0x96,0xAB,0x41,0xE8,0x23,0x36,0xE1,0xC7,0x55,
+    0x27,0x05,0xE1,0x7B,0x18,0x0F,0x13,0xE6,0x55,0x46,0xF0,0x60,0x8B,0x45,0x0A,0x20,
+    0x15,0x86,0xE0,0x10,0xD2,0x9C,0x94,0xA4,0x5F,0x0A,0x92,0xB6,0x88,0xF2,0xF2,0x87,
+    0x08,0x6A,0x8A,0xDC,0x91,0x1F,0x02,0xB3,0xAE,0x67,0x33,0x21,0x09,0x13,0xC2,0x39,
+    0x0C,0x15,0x96,0xC2,0x20,0x99,0x47,0x83,0xF5,0x75,0xC8,0x0F,0xA1,0xF7,0x5A,0x3B,
+    0xBE,0x45,0x76,0xAA,0x82,0x09,0x20,0x03,0xBA,0x7B,0x23,0xE5,0xD1,0xF4,0xE1,0x43,
+    0x7F,0x7E,0xC3,0x0C,0x15,0x0D,0xCE,0x04,0xFA,0xF2,0xFB,0xF7,0xAB,0x4A,0xEE,0x99,
+    0x95,0x08,0x3D,0x65,0x3A,0xC8,0x25,0xC9,0x4F,0xDB,0x6D,0xE2,0x77,0x2E,0x0A,0x04,
+    0x76,0xFF,0x7E,0xE0,0xE2,0x5F,0xD6,0x47,0x18,0xFA,0xC4,0x04,0x3B,0x25,0xB0,0x17,
+    0x2E,0xFE,0xF5,0x4F,0x05,0x2C,0xE0,0x64,0xA2,0xAA,0xEF,0xF6,0xA7,0xCF,0x26,0xAA,
+    0x09,0x12,0xC3,0xCF,0xDD,0x09,0x82,0x4F,0x8E,0x1E,0x3E,0x54,0x7F,0xB8,0x8D,0x8A,
+    0x7F,0x2F,0xA5,0xE6,0xA7,0x66,0x10,0xF5,0xB0,0x39,0x92,0x92,0x7F,0x8B,0x0A,0x90,
+    0x20,0x75,0xB3,0xC4,0xA5,0xA2,0x9E,0xA7,0x91,0xCC,0xF3,0x3C,0x0F,0xAE,0x3A,0x71,
+    0x41,0x7F,0x41,0x88,0x8B,0x7E,0x92,0x7E,0x09,0x7D,0x2D,0x61,0xD9,0x30,0xF4,0x42,
+    0xE8,0x07,0xA8,0x84,0xD4,0x15,0xEA,0xA1,0x60,0x35,0xD9,0xC0,0x5E,0xE2,0x52,0x2D,
+    0xBD,0xD4,0xAB,0xD4,0xDE,0x79,0x35,0x8C,0xFD,0x4A,0x0C,0x09,0x7D,0x8B,0x44,0x72,
+    0x8E,0xDA,0xE1,0x1C,0xD7,0x4D,0xD2,0x9E,0xAF,0xAF,0xDF,0x00,0x5C,0xCE,0xDC,0x34,
+    0x3F,0xCA,0x41,0x57,0xF5,0xC4,0xC2,0x9C,0x4B,0xF5,0x3A,0xB6,0xCF,0x25,0x00,0x03,
+    0x1E,0x88,0x8A,0x00,0x0B,0x83,0x1C,0x3E,0xC2,0x69,0x14,0x9E,0x46,0x23,0xF1,0x89,
+    0xD5,0x91,0xC2,0x89,0x80,0xDC,0x0C,0xFE,0xD6,0x9A,0xA9,0x7A,0xFB,0x4E,0x22,0x7D,
+    0xBD,0xBD,0x4E,0x65,0xBA,0xC7,0x7B,0x69,0xA7,0x88,0x48,0x33,0x05,0x72,0xBE,0x42,
+    0xDD,0x11,0xC6,0x0A,0xCB,0xE6,0xA0,0xA1,0x43,0xC1,0xFC,0xDC,0xC3,0xD5,0x2E,0xEC,
+    0x94,0x51,0x51,0xC2,0x6A,0xB7,0x37,0x7F,0xB8,0x3E,0xBB,0x5C,0xEF,0x89,0xE9,0xDB,
+    0x5B,0x5F,0xEF,0xCD,0xB5,0x25,0xEB,0x4D,0x03,0x35,0xBC,0x66,0xF9,0x21,0x0A,0xDF,
+    0x75,0x90,0x52,0xD8,0x07,0x58,0x5E,0xE2,0xBD,0xF5,0x30,0x09,0x8A,0xE2,0x0D,0x98,
+    0x82,0xD4,0x2D,0xF1,0xBD,0xDE,0x4B,0x7A,0xE2,0x97,0x96,0x4A,0x50,0x3D,0x5C,0x6B,
+    0xD7,0xA5,0x12,0x49,0xD9,0x5E,0x5F,0x92,0x00,0x68,0x84,0x57,0x09,0xD7,0xC4,0x0C,
+    0x9C,0xC3,0xCA,0x4B,0x69,0x7E,0x43,0x59,0xA4,0x39,0xEA,0x84,0x45,0xF1,0x01,0xB5,
+    0xAF,0xB9,0x94,0x0F,0x36,0xBD,0xB2,0x04,0xFA,0xAC,0x40,0xD7,0xD7,0xC1,0xDE,0xE0,
+    0x25,0xA2,0x14,0x34,0x96,0xE1,0x54,0xE2,0x07,0x60,0x8A,0x7E,0xCF,0xAF,0xAF,0xDF,
+    0xB9,0x38,0x6A,0x64,0x7F,0x61,0x73,0xCC,0x05,0xF0,0x58,0x52,0x08,0x54,0x3B,0x3F,
+    0x1A,0xE3,0x14,0x96,0xF0,0x87,0x4B,0x8C,0x7D,0x4C,0x12,0x2C,0x23,0xBA,0xE4,0xAC,
+    0x67,0x72,0xCE,0x80,0x52,0x78,0xCC,0x47,0x9B,0xC7,0x7B,0x2E,0xAC,0xC4,0xF7,0x08,
+    0x8F,0x68,0x29,0xCC,0x92,0x20,0x8C,0xDC,0x8D,0xFD,0x60,0x06,0x94,0x1A,0x7D,0xBF,
+    0x81,0x4D,0x7B,0x60,0x1F,0x82,0x4C,0xC8,0x5E,0x67,0x17,0x51,0xBE,0x0F,0x2A,0x8F,
+    0x0B,0x72,0x64,0xE0,0x86,0x64,0xC1,0xEC,0x85,0x80,0xCB,0x4E,0x91,0x80,0xB1,0xEE,
+    0x6E,0x79,0xFE,0x7C,0xCF,0x2D,0x41,0xD6,0x76,0x82,0xD1,0xE8,0xE5,0x39,0xC8,0xD2,
+    0xD7,0x71,0x51,0x46,0xB0,0x64,0x03,0x61,0x7C,0xF0,0x23,0x0F,0xD5,0x15,0xC8,0xC7,
+    0x7F,0xC1,0xF8,0xF4,0x3C,0x24,0x14,0x24,0x18,0x61,0xE1,0xD9,0x8A,0x78,0xBD,0xF5,
+    0x04,0x52,0x80,0xA4,0x07,0xC0,0xB8,0xEB,0x65,0x30,0xA1,0x19,0x14,0x9F,0x80,0x8A,
+    0x33,0xF1,0xFB,0x1E,0x70,0x40,0xC2,0x7D,0x22,0x02,0xD4,0xC9,0xAA,0x67,0x61,0x0D,
+    0xC0,0xF2,0xFA,0x28,0x48,0x27,0x51,0x9E,0xCD,0x8B,0xE4,0xEA,0x30,0x2A,0x0F,0x52,
+    0x68,0xF6,0xD5,0x87,0x9F,0x5F,0x8B,0x1A,0xDD,0x26,0x62,0xFE,0x79,0x09,0xA2,0xF7,
+    0xB4,0xB7,0xC7,0x88,0xD9,0x13,0x6D,0x5C,0x5F,0x13,0x65,0xCF,0xF7,0xE4,0x40,0x9E,
+    0x97,0x30,0xF9,0xC3,0x79,0x19,0xBD,0x39,0x74,0xD7,0xA7,0x65,0x39,0xEB,0x6D,0x6C,
+    0x5C,0x5C,0x5C,0x74,0x2E,0xB6,0x3B,0x59,0x3E,0xD9,0xD8,0x7C,0xFA,0xF4,0xE9,0x06,
+    0xD5,0xB4,0xEE,0xD7,0x30,0x8B,0xC8,0x00,0x86,0xFA,0xFC,0x0A,0x88,0x01,0x6F,0xEB,
+    0x16,0x70,0x5F,0xAD,0x1D,0xE2,0x5C,0x93,0xDB,0x3F,0xB8,0x95,0x1E,0x48,0x46,0x46,
+    0x79,0xC4,0x4B,0xC3,0x31,0xCC,0x5F,0x84,0x53,0xB5,0x27,0xFE,0x62,0x75,0x89,0x66,
+    0x43,0x7E,0xEF,0xEA,0xAA,0x15,0xF1,0xAC,0x1F,0xE8,0xEA,0xD5,0x95,0x7F,0x81,0xCA,
+    0x95,0x7F,0xE2,0xEF,0xFB,0xEF,0xFC,0x37,0x03,0xD6,0x36,0x90,0xAF,0x95,0xAE,0x37,
+    0xEF,0x68,0xB6,0x62,0xC3,0x70,0x83,0x85,0x03,0xF5,0xCE,0x21,0x2C,0xB6,0x53,0xE0,
+    0x89,0x7E,0x99,0x5F,0xF1,0x6A,0x6E,0x59,0x14,0xDF,0xD0,0x22,0x71,0x82,0x3A,0x2B,
+    0xD9,0x5D,0xFB,0x03,0x28,0xFD,0x46,0x9A,0x4C,0x1F,0x70,0xAD,0xBB,0x7F,0x3F,0x3E,
+    0x9A,0xA2,0xE2,0x71,0xEC,0xBF,0x1B,0x4C,0xF7,0xF6,0xF7,0xF6,0x19,0x96,0x97,0xDF,
+    0x1E,0x66,0xCD,0xC0,0xDC,0x2D,0x11,0x64,0xEF,0x74,0x40,0xBA,0x0C,0xFC,0x1C,0x50,
+    0x82,0x47,0x5A,0x1B,0xEA,0xC6,0x2F,0x7B,0xEE,0x3A,0x94,0x2B,0x33,0x6C,0x79,0x1D,
+    0x48,0xF1,0xCD,0xFD,0xFB,0x6F,0x3A,0x2A,0x05,0x66,0x01,0x35,0xF4,0x3D,0x2E,0x7B,
+    0x3E,0x48,0xA3,0x0B,0x90,0x72,0x27,0xFE,0x3B,0xAF,0xE7,0xEA,0x69,0x67,0x94,0xE6,
+    0x9F,0xEB,0x18,0x18,0xBC,0x81,0x6F,0x2E,0x3F,0x78,0xE5,0xF9,0xFB,0xF7,0xEF,0xEF,
+    0x77,0x8A,0xF9,0xD0,0x3D,0x47,0x38,0x36,0x05,0x4F,0xE0,0x57,0x51,0x06,0x25,0x98,
+    0x9F,0xAE,0xF8,0x85,0x4C,0xC6,0xF5,0x90,0x75,0xF8,0xCE,0xC7,0x5E,0xA6,0x83,0xD8,
+    0xE7,0xFE,0xA2,0x0D,0x42,0x49,0x53,0x6D,0xDD,0xC4,0xEF,0x02,0x88,0x9F,0xFE,0x0E,
+    0x44,0x45,0x52,0xE1,0x7A,0xD3,0x99,0x44,0xE5,0x0B,0xB0,0x32,0xCE,0xA3,0xD1,0x21,
+    0x66,0xFC,0x98,0x67,0x67,0xE4,0x97,0xB8,0x7F,0xBF,0x10,0x45,0x64,0x99,0x3D,0xFE,
+    0x24,0x5D,0x9E,0x7E,0x7A,0x3D,0xFA,0xE3,0x2F,0xAE,0xC4,0x3D,0x11,0x90,0x9E,0x3F,
+    0x13,0x3A,0xC4,0x60,0x69,0x9B,0xDC,0x2B,0x1C,0xE1,0xD9,0x2C,0x4B,0x81,0x14,0x7F,
+    0x8D,0x93,0xE4,0x67,0x30,0x87,0x40,0x2C,0xDA,0x52,0x5D,0x39,0x10,0x2D,0xF3,0x45,
+    0x3C,0x12,0x25,0xC6,0x42,0x09,0xF5,0x34,0x39,0xBE,0x5A,0x1F,0x06,0x83,0x68,0x41,
+    0x67,0xDE,0x47,0x61,0x04,0xA5,0x04,0xEC,0x92,0x4C,0x9E,0xF4,0x7B,0x5A,0x3D,0xC5,
+    0x34,0x9B,0x27,0xA3,0x7D,0x59,0xE0,0xE3,0x6C,0x04,0x0D,0x8B,0x55,0x74,0x41,0xAE,
+    0x44,0x20,0x54,0x25,0x5C,0x70,0x75,0xE2,0xE0,0xF9,0xF5,0xC5,0xF4,0x6F,0xD2,0x0F,
+    0x20,0x67,0xD2,0xBB,0x23,0x61,0xCA,0x84,0x7B,0x21,0x70,0x20,0x12,0x77,0x04,0xF2,
+    0x9D,0xFE,0xB2,0xFB,0x86,0x2C,0x21,0xCA,0x38,0xF5,0x59,0x75,0x9B,0xEB,0x56,0xF4,
+    0x54,0xB8,0xCA,0xD0,0x72,0x46,0xBD,0xCF,0x95,0x3F,0x89,0x43,0x48,0x43,0x12,0x5A,
+    0xF0,0x8D,0x15,0x57,0x72,0x84,0xD6,0x64,0x6D,0x68,0xFD,0x1B,0x56,0xC0,0xC5,0xE0,
+    0xFC,0x0B,0x49,0x72,0x35,0x5A,0xB7,0x0F,0x5D,0xC8,0x8E,0x5C,0xC8,0x8E,0x26,0x2A,
+    0xF0,0xEF,0x3B,0x30,0xC3,0xA6,0x03,0xC9,0x72,0x12,0x8D,0x7E,0xA3,0x1D,0x4F,0xE0,
+    0xE4,0x52,0x18,0x72,0x53,0xA8,0x54,0x98,0x4E,0x23,0x49,0x1A,0x53,0x34,0xA9,0xF6,
+    0xA6,0x42,0xA4,0x48,0xAD,0xA3,0x37,0xAD,0x68,0x11,0x88,0x8B,0x4C,0x8C,0x7D,0xAE,
+    0x94,0xAC,0xFD,0xC2,0x25,0xCE,0x89,0xB1,0x83,0xB5,0x7C,0x58,0x26,0x80,0x41,0xA4,
+    0x4D,0x43,0xD9,0x87,0x69,0x30,0x03,0x8A,0x10,0x16,0x05,0x63,0x8C,0x6C,0xAB,0x85,
+    0xB9,0x2E,0x08,0x61,0xA8,0x66,0x58,0x93,0xD5,0x28,0xA9,0xA1,0x45,0xCD,0xB5,0x31,
+    0x25,0xBC,0x4D,0x2B,0x8B,0xBF,0x92,0x10,0x1A,0x5A,0xC1,0xD4,0xED,0x84,0x41,0x92,
+    0x30,0xF7,0xA8,0xCE,0x5D,0x55,0xBD,0xD4,0x19,0x4E,0x76,0xD0,0x96,0xEA,0xD2,0xEA,
+    0xE0,0xF9,0xA7,0x42,0x08,0xBD,0xA4,0x06,0xD8,0xDA,0x84,0xA9,0x57,0x1A,0x36,0xD2,
+    0xEB,0x9F,0x2E,0x51,0xA7,0x31,0x82,0xC0,0x93,0x0B,0xC4,0x28,0x1E,0x8F,0xA3,0x91,
+    0x5C,0x23,0x6E,0xC2,0xA0,0x0C,0xD1,0xCD,0xC2,0x3E,0x1C,0x1E,0x37,0x24,0xEB,0xBE,
+    0xA9,0x6A,0x0D,0xFB,0x83,0x56,0x44,0xE5,0xC6,0x2E,0xFB,0x25,0xE8,0x01,0x0A,0x05,
+    0xB8,0xDE,0x94,0x4D,0x11,0xE2,0xDA,0x5A,0x29,0xC9,0xFB,0xD1,0x27,0xB3,0x0F,0x84,
+    0x3C,0x3A,0x38,0xE1,0x0F,0xF5,0x48,0xB5,0xF6,0x67,0xDD,0x1D,0xC1,0xAB,0x65,0xE1,
+    0x07,0x3E,0xAD,0x98,0x6A,0xF1,0x1A,0x61,0x2F,0xF0,0x17,0x2E,0x96,0xF1,0x60,0xBD,
+    0x38,0x9F,0x90,0x2A,0x47,0x34,0x77,0x7D,0x1D,0x4B,0xE3,0x47,0x4A,0x91,0x5C,0xE8,
+    0x8B,0x05,0x70,0x6B,0xF1,0x4C,0xD9,0x72,0x45,0xCD,0xDF,0x15,0x80,0x41,0x57,0xA0,
+    0x17,0x40,0xC8,0x3B,0x51,0xE1,0xDE,0x36,0xFC,0x0C,0x3A,0xE8,0x8E,0xC5,0x75,0xB2,
+    0x17,0x74,0x92,0x0C,0x26,0x19,0x35,0x30,0x05,0x03,0x82,0x26,0x1D,0x04,0x3E,0x96,
+    0x67,0xFB,0x5B,0xBA,0xC2,0x94,0x57,0x94,0x6C,0x69,0xF5,0x7B,0xA0,0xEC,0x4B,0x81,
+    0xF8,0x51,0x16,0x92,0xC7,0xBD,0x13,0x42,0xC1,0x32,0x42,0xF5,0x18,0x4D,0x70,0x36,
+    0xB7,0x61,0xB1,0xDA,0xAB,0x01,0x08,0xDF,0x8F,0x5D,0x33,0xDA,0xEA,0x76,0xBB,0x1B,
+    0x88,0x14,0x5F,0x34,0xD3,0xB3,0x97,0x76,0x45,0xB6,0x9F,0x0B,0x2F,0x86,0xA6,0x5F,
+    0x54,0xC3,0x9F,0xDD,0x23,0x36,0x76,0x95,0xB9,0x0C,0xF6,0x6E,0xAE,0x79,0x49,0x8F,
+    0x85,0x0A,0x0F,0xA4,0x16,0x94,0x01,0x58,0xDC,0x3D,0x54,0x19,0xE7,0x66,0x89,0x41,
+    0xC4,0xFA,0x31,0xB3,0x87,0xF0,0x5D,0xE3,0x08,0x71,0x99,0x9B,0xA2,0x5F,0x47,0x4C,
+    0xEE,0xF5,0xF5,0xD8,0xEB,0x2C,0x50,0x49,0xFD,0x73,0xB0,0xFE,0x17,0xE5,0x85,0xB8,
+    0xE2,0x5F,0x5F,0x4F,0x71,0xFE,0xCE,0x81,0xDA,0x51,0x82,0x02,0xC7,0x96,0x67,0x24,
+    0x7C,0xF8,0x17,0x69,0xDD,0xB1,0x2C,0x82,0xCE,0x97,0x73,0x95,0x43,0x4A,0x3E,0x9A,
+    0xA2,0x23,0xD0,0xCD,0x62,0x20,0x3E,0xE1,0xB2,0x4A,0x6A,0x22,0xCB,0x87,0x46,0x2A,
+    0xC7,0x19,0x2A,0xDF,0x51,0x3C,0x49,0xDF,0xD2,0xE6,0x19,0xE9,0xCC,0xC2,0xFD,0xA0,
+    0x64,0x89,0x47,0x5D,0x13,0xE6,0x27,0xE8,0x43,0x80,0x4B,0xA5,0xE0,0x8D,0x58,0xB9,
+    0xBA,0x7F,0x5F,0xFC,0x20,0xCF,0xA7,0x48,0x52,0x8E,0x0F,0xE9,0xB5,0xA1,0x2F,0x54,
+    0xE5,0xC5,0x4F,0xCF,0x57,0x66,0x6C,0xA3,0x5A,0x91,0x81,0x15,0x8B,0x9F,0x54,0xB5,
+    0x4A,0x76,0xD5,0xEF,0x0A,0x18,0x05,0xAA,0xE6,0x67,0x7F,0x2E,0x84,0xC3,0x27,0xE4,
+    0x73,0x9B,0x9F,0x05,0xEC,0x7A,0xD0,0xB3,0x93,0x4E,0x38,0xCF,0xD1,0x65,0x04,0x96,
+    0x9F,0x85,0xEF,0xD1,0xFF,0xA2,0xAA,0x7C,0x21,0xAB,0x44,0xBE,0x26,0x04,0x91,0x0B,
+    0xBB,0x33,0x4F,0xCF,0x58,0xF9,0x50,0x3F,0xA1,0x0E,0x1F,0x58,0x5B,0xEE,0xE3,0x3C,
+    0x77,0x63,0x61,0xF8,0x83,0xA9,0x08,0x73,0xB5,0xC8,0xEB,0x03,0x88,0x2E,0x07,0xDA,
+    0x2E,0x10,0x7A,0xAB,0xA5,0xC3,0x27,0x11,0xBE,0x31,0xB9,0x4B,0x14,0x53,0x7E,0xE8,
+    0x11,0x5B,0xC6,0xB5,0xD5,0x96,0x7B,0x21,0x84,0x9C,0x3D,0xD3,0x2A,0xE7,0xE6,0x24,
+    0xE3,0x62,0x5E,0x3A,0x62,0x5A,0x43,0x99,0xB5,0x48,0x52,0x11,0x45,0x49,0x4B,0x17,
+    0x84,0x51,0xF6,0x2C,0x96,0xC2,0x28,0x63,0x61,0x74,0x94,0x91,0xAB,0x08,0xFF,0xB2,
+    0x64,0x26,0x4F,0x99,0xE4,0xA3,0xC0,0xCD,0x75,0x81,0xF9,0x4A,0xBA,0x22,0x74,0x03,
+    0x45,0xD3,0x97,0xD1,0x19,0xA9,0x59,0x24,0x07,0x26,0xF6,0x41,0xC0,0xF6,0x69,0xD3,
+    0x80,0x85,0xF1,0x8C,0x7A,0x8F,0xFE,0xEA,0x78,0x50,0xA2,0x5B,0x84,0x2D,0xBB,0x1E,
+    0xCC,0x4A,0xC9,0xBE,0x5F,0x5A,0xE4,0xC1,0xEA,0x9D,0xBA,0x23,0x9E,0x0C,0xDC,0x19,
+    0x00,0xBB,0xF8,0xE8,0xD8,0xFF,0xDE,0x9D,0xFB,0xF1,0x1E,0x6B,0x01,0x49,0x0F,0xCD,
+    0xDF,0xB9,0xC7,0x1F,0x7E,0x86,0xAE,0xD0,0xB1,0xAF,0xD9,0x34,0x75,0xFF,0x75,0x89,
+    0x76,0xEB,0xDE,0x51,0x79,0xDC,0xCB,0xB8,0x49,0x43,0x56,0xCC,0x75,0x59,0x01,0x2B,
+    0x33,0xE8,0x28,0x25,0x56,0x19,0xA3,0x7F,0x3B,0xF4,0x71,0x35,0x4C,0x71,0x13,0xF7,
+    0x4C,0xB3,0x31,0xC0,0xA8,0x23,0x05,0x75,0x60,0xFA,0xF3,0x69,0x03,0x67,0x40,0x58,
+    0x82,0xC5,0x1A,0xB5,0x3B,0xFC,0x49,0xEB,0x37,0x0C,0x52,0x24,0x23,0x09,0x89,0x9F,
+    0xAC,0xB6,0x57,0x40,0x60,0x1B,0xBA,0x16,0x23,0x3A,0x45,0xB1,0x32,0x48,0x01,0x05,
+    0xD5,0x9E,0x14,0xF0,0x12,0x1A,0x03,0x73,0x3F,0xD5,0xB6,0x42,0x45,0xBD,0xE8,0xF3,
+    0xA5,0x9F,0xE4,0xF7,0x4F,0x54,0xFA,0x54,0x6E,0x81,0xF8,0xA7,0x94,0x8F,0x9B,0x17,
+    0xC6,0xB0,0x80,0x6C,0x42,0xA1,0xB8,0x68,0x23,0x13,0x5B,0x61,0x5C,0x6F,0x5A,0xAF,
+    0x0D,0xDA,0x97,0x6D,0x75,0x17,0xD5,0x2B,0x4C,0xAA,0x91,0x8F,0xAE,0x43,0xBF,0x1C,
+    0x58,0xD8,0x0B,0xB4,0xF3,0xB3,0xB8,0x88,0xF6,0xC4,0x5F,0xAD,0x70,0x39,0x8D,0xD2,
+    0xCE,0x10,0x96,0x03,0x57,0xE6,0xE5,0x51,0x91,0x25,0xE7,0x64,0xC7,0xC3,0x44,0x7C,
+    0x88,0xCF,0xA2,0x6C,0x0E,0x6B,0xBA,0x75,0xEB,0x86,0x77,0x92,0xF4,0x69,0x32,0x15,
+    0x8E,0x84,0x78,0x66,0xD6,0xE7,0x85,0xDA,0x2D,0x05,0xCF,0x02,0xC5,0x94,0xB4,0xDF,
+    0x25,0x18,0x74,0xEC,0x96,0x3A,0xE1,0xCB,0x85,0xDF,0x48,0xB4,0x59,0x2F,0x2F,0xF3,
+    0x9C,0x0C,0xEB,0x52,0x91,0x8C,0xBB,0x5A,0x19,0xF4,0x67,0x36,0x0C,0x24,0x53,0x19,
+    0xDA,0x47,0xD9,0x00,0x75,0xA3,0x92,0x1C,0xA7,0x73,0xDC,0xF2,0xB3,0x00,0xD0,0x5E,
+    0xBE,0xE0,0xDF,0x53,0x52,0xE4,0x5E,0x0E,0x4A,0x4F,0x13,0x2C,0x03,0xDA,0x5D,0x80,
+    0xB2,0xD3,0x3C,0xBB,0x00,0xA3,0x01,0x16,0xEB,0xB1,0x8F,0xC2,0x03,0xC3,0x19,0xAA,
+    0xBD,0x2D,0x0E,0xA3,0x10,0x3E,0xC8,0x38,0x2A,0xDC,0x32,0xC8,0xA1,0xF3,0xBE,0xC3,
+    0xE4,0x48,0x51,0x1F,0x0E,0x0A,0x1E,0x87,0x30,0x1B,0x3B,0x03,0xDC,0x15,0x89,0x9D,
+    0x67,0x0C,0x20,0xC5,0x90,0x13,0x83,0x1C,0x12,0xC0,0x1C,0x2D,0x01,0x6C,0x17,0xE6,
+    0xF1,0x0C,0x90,0x01,0x45,0x66,0x62,0xF7,0xBD,0x2F,0x00,0xAA,0xCC,0x4E,0x94,0x82,
+    0x86,0x91,0x07,0xC3,0x24,0x02,0x38,0x7B,0xFA,0xF5,0xB5,0x33,0x0E,0x00,0x63,0x96,
+    0xD2,0x80,0xA4,0x71,0x3C,0x99,0xCB,0xF2,0x80,0x7E,0x05,0x15,0x8F,0x1D,0xB9,0x7A,
+    0xA2,0x67,0xAB,0x2A,0x84,0x01,0x1E,0x5A,0x15,0x17,0x79,0x5C,0xEA,0xC5,0x9D,0x1B,
+    0x51,0x01,0xAF,0xCD,0x1D,0x03,0x43,0x57,0x0A,0x3F,0x5A,0x0D,0xB8,0x15,0xAD,0xD7,
+    0xCF,0x3D,0xC0,0x6A,0x6E,0x4C,0x64,0xB3,0x16,0xB5,0x8F,0xAE,0x54,0x77,0xBF,0xA2,
+    0x16,0x42,0x76,0x99,0x91,0x25,0xEB,0x3B,0x28,0x32,0xE2,0xF0,0x9D,0x8E,0x7E,0x1C,
+    0x4A,0x05,0x82,0xFD,0x6F,0xCE,0x9B,0x56,0x5F,0xC5,0x65,0x7A,0xCD,0x9E,0x1C,0x19,
+    0xD6,0x66,0x36,0xB2,0xBC,0x3A,0xB3,0x4B,0xB2,0x16,0x41,0x7B,0x1A,0x5C,0xBF,0x39,
+    0x60,0x50,0x47,0x81,0x65,0x0B,0x57,0x0E,0x44,0x26,0x00,0xAE,0x05,0x76,0x01,0x15,
+    0xA0,0x06,0xD1,0x14,0xAB,0x08,0x1C,0x46,0xB1,0x49,0x4E,0x2A,0xB4,0xE4,0xFB,0x4D,
+    0x28,0x5C,0x05,0xA9,0xAC,0x09,0x18,0x83,0x42,0x37,0x99,0x42,0x1B,0xE1,0x28,0x26,
+    0x95,0x72,0xC5,0x45,0x36,0x07,0xE9,0xA8,0xD7,0xF9,0xFD,0x26,0x51,0xAA,0x82,0x52,
+    0x55,0xC3,0x3C,0x23,0x25,0x71,0x09,0xBD,0x1E,0xC6,0xA9,0x18,0x51,0x25,0xE2,0xA6,
+    0x41,0xF1,0xF6,0x22,0x95,0x94,0xC3,0xCB,0x12,0x17,0xF6,0xB1,0x2E,0xCF,0xAC,0xC2,
+    0x71,0x78,0xDC,0x47,0x90,0x75,0x0C,0xFD,0x61,0x48,0xFA,0xEA,0x6B,0x60,0x37,0x6B,
+    0xF5,0x5F,0x37,0xB2,0xAB,0x72,0x39,0xA7,0x6A,0x04,0x11,0x8A,0x71,0x88,0x2C,0x89,
+    0x7F,0xDC,0x9A,0x4B,0xAE,0x44,0xE8,0x93,0x1A,0xB8,0xA7,0x66,0x70,0x63,0xC3,0x39,
+    0xCC,0xCE,0x22,0x28,0x36,0x99,0x27,0x30,0xF2,0xE8,0x72,0x06,0xD2,0xB9,0x80,0xD9,
+    0x29,0x08,0x1D,0xF9,0x64,0x08,0x73,0x1A,0xA4,0x23,0x67,0x5A,0x24,0xF0,0x6B,0x3F,
+    0x4B,0xB2,0xBC,0x80,0x9A,0x22,0x67,0x98,0x81,0x9C,0xBB,0x88,0x46,0xCE,0x18,0x64,
+    0x9E,0x03,0x12,0xEC,0x8A,0x32,0xB9,0x52,0xB4,0x39,0x0A,0x30,0x3A,0xB4,0x28,0xB4,
+    0xE1,0x04,0x04,0x7A,0xB1,0xF1,0xC1,0x04,0xFC,0x7B,0x94,0x9C,0xA3,0x47,0x3F,0x3A,
+    0x03,0xDC,0x05,0xE8,0x4F,0x77,0xCE,0x82,0x72,0x5A,0xAB,0xFD,0x4D,0x14,0x27,0xCE,
+    0x0F,0x41,0x9E,0x44,0x65,0xD9,0x2A,0x9C,0xF8,0x6C,0xC6,0xAA,0x41,0x80,0x74,0xC4,
+    0x15,0x11,0x9C,0xA5,0xD9,0x14,0x8A,0x0E,0x83,0xBC,0xC4,0xA2,0x1B,0x21,0x36,0xDC,
+    0xD6,0x1A,0x33,0x7B,0xAB,0x99,0x48,0x1F,0xDE,0x6F,0x84,0x45,0xB1,0xDD,0x26,0xB9,
+    0x52,0x6C,0x7C,0x17,0xA7,0x65,0x04,0x66,0x45,0x21,0x42,0xC4,0xF6,0x0F,0x0F,0x4F,
+    0x0E,0xDE,0x7C,0x78,0xF9,0xD3,0xCB,0xF7,0x30,0x83,0xAD,0xA3,0xF6,0xEF,0xBF,0x3F,
+    0x3C,0xDE,0xFB,0xFD,0xF7,0xD1,0xC3,0xBF,0xEC,0xB5,0xFA,0xB2,0xCE,0xE5,0x55,0xF2,
+    0xDE,0x0F,0x7F,0xAE,0x69,0xF5,0xBE,0xF9,0xF8,0xF3,0x0F,0xF5,0x6A,0x1F,0xFC,0xFE,
+    0x7B,0x47,0xAF,0xFD,0x79,0x92,0x80,0xB0,0x9F,0x65,0x45,0x5C,0xC2,0xDA,0x03,0x83,
+    0x9C,0x04,0xF8,0xC3,0x11,0xDD,0xDC,0xE0,0xBA,0x3B,0xCE,0x8B,0x2C,0x6D,0x95,0x4E,
+    0xC8,0x3B,0x15,0xA0,0xFF,0x45,0x4E,0x04,0xA8,0x01,0x00,0xE4,0xF6,0x3F,0xE6,0x45,
+    0xC9,0x69,0xB0,0x00,0x41,0x36,0xAC,0xC2,0x80,0x31,0xA3,0x2F,0x1F,0xDF,0x1C,0x7C,
+    0xC0,0x9E,0xB8,0x7B,0xBD,0x96,0xF3,0x50,0xEF,0xDE,0x43,0xA7,0xE5,0x5D,0x6B,0xC9,
+    0x12,0x1B,0x98,0xCE,0x7D,0x7C,0x17,0xE4,0x45,0x54,0x71,0xFB,0x2C,0xC8,0x83,0xB3,
+    0x82,0x11,0xFE,0x0E,0xF7,0x90,0x0B,0xA2,0x2B,0x68,0xF1,0x2C,0x60,0x8A,0xE2,0xAD,
+    0x5D,0x8C,0x45,0xC4,0x0C,0xA4,0x59,0x07,0x56,0x83,0x0C,0xFE,0x81,0xC1,0x32,0x3D,
+    0x5E,0x4C,0xE3,0x32,0x2A,0x66,0x01,0x30,0xF2,0x30,0x2A,0x2F,0xA2,0x08,0x8D,0x51,
+    0x1C,0x6A,0x21,0x7B,0xFD,0xEE,0xE5,0xFB,0x9F,0x0F,0x0E,0x0F,0x0F,0x7E,0x79,0x79,
+    0xF2,0xF3,0xF3,0x0F,0xFB,0xAF,0x4E,0xB6,0x09,0x93,0xBF,0xFF,0x5E,0x5C,0xFF,0xFE,
+    0xBB,0x7B,0xFC,0xD0,0x95,0x1D,0xA6,0xA1,0x61,0x6F,0x8F,0x7C,0xC8,0x29,0xEE,0x96,
+    0x03,0xC9,0x30,0x25,0x1E,0xCC,0xC6,0xA2,0x66,0x1F,0x7D,0x8B,0x66,0x57,0xE9,0x10,
+    0xE2,0xF7,0x3D,0x10,0xC1,0x25,0x60,0xBC,0x2C,0xA3,0x5C,0x70,0xB2,0x9C,0x87,0x20,
+    0x71,0x88,0x0B,0x1C,0xDE,0x7A,0x53,0x78,0x7B,0x0F,0xB3,0xF7,0xDB,0xC9,0x8F,0x1F,
+    0xDF,0xEC,0x7F,0x38,0x78,0xFB,0xE6,0xF9,0xEB,0x93,0xF7,0x3F,0xFD,0x00,0x43,0x40,
+    0x57,0x3B,0xD4,0xF6,0xF2,0x72,0xE6,0xB6,0x40,0x18,0x60,0xBB,0x4D,0x0C,0x7B,0xFD,
+    0x25,0x95,0x3C,0x6F,0xD6,0x12,0x58,0xAB,0x79,0xB4,0xB8,0x9A,0x57,0x87,0xAF,0x6B,
+    0xB5,0x80,0x38,0xBA,0x6B,0x5F,0xA0,0x92,0xE7,0xCD,0x5A,0x16,0xF6,0x05,0xF1,0xB8,
+    0xAF,0x61,0x0A,0x09,0xB8,0xC0,0xBF,0x39,0x22,0x57,0xA2,0xED,0x15,0xB4,0x71,0xF8,
+    0xE1,0xF9,0x7B,0xE2,0x92,0x7F,0x02,0x3F,0x7C,0xB7,0x77,0xDD,0xBD,0xDC,0xF3,0x14,
+    0x61,0x20,0x00,0xF0,0xC6,0xC9,0xE1,0xC1,0x9B,0x9F,0x5E,0xBF,0x24,0x5E,0x3A,0xEA,
+    0xB6,0x9F,0x06,0xED,0xF1,0xF3,0xF6,0x8F,0xC7,0x9F,0x36,0x6F,0x9A,0xA0,0x2F,0xDE,
+    0x7E,0xFC,0xC1,0x02,0xBA,0xA5,0x81,0xF2,0xE0,0xB0,0xC0,0xB6,0x39,0xA4,0xAA,0x3F,
+    0x0F,0xEB,0x4D,0xAF,0x92,0xD0,0xFA,0xBE,0xE5,0x35,0xDB,0x78,0xF4,0x55,0xDB,0x58,
+    0xB1,0xD1,0xDD,0xDB,0x1B,0x15,0x88,0x5A,0x25,0xC1,0xDE,0xC6,0x93,0xAF,0xDA,0x86,
+    0xBD,0xD1,0x05,0xAB,0x1C,0x1A,0x3A,0x23,0xC5,0x7D,0x7F,0x7F,0xF9,0xFA,0x97,0x83,
+    0x37,0x27,0x3F,0x1F,0xBC,0x81,0x1E,0xA1,0x7B,0xAE,0x5F,0xCB,0x78,0xFE,0x1B,0x64,
+    0x3C,0xEA,0x62,0x0E,0x56,0xF8,0x33,0xAE,0x91,0xC5,0x34,0xCB,0xCB,0x69,0xA0,0x55,
+    0x93,0x64,0x13,0x00,0xC3,0xCC,0x0E,0xFC,0xF4,0xA5,0xBA,0x80,0x4D,0xC9,0x74,0xFA,
+    0x90,0x39,0xE3,0x24,0x23,0xB5,0x9D,0x72,0xE8,0x03,0xDB,0xDD,0x78,0xF0,0x00,0xF3,
+    0x1F,0x38,0x7F,0x43,0x5D,0xD7,0x01,0x35,0xF6,0x6C,0xE6,0x04,0x42,0xD0,0x2A,0xB9,
+    0x1B,0x38,0x67,0x30,0x24,0x94,0xD4,0x67,0xC1,0xA5,0xC3,0xAB,0x18,0x97,0x22,0x49,
+    0x8F,0xE0,0x4E,0x1B,0x16,0xA4,0xD9,0xBC,0xB4,0xE4,0x62,0xD9,0x36,0xD7,0x80,0xD2,
+    0x1D,0x16,0x7A,0x0B,0x0C,0xD4,0xDB,0xA6,0x7F,0x9B,0x30,0x1B,0x86,0xFE,0x19,0x62,
+    0x17,0xC1,0xC8,0x3A,0xF3,0xB1,0x4A,0x1F,0xCB,0x48,0x9D,0x4B,0x28,0x44,0x34,0x42,
+    0xC8,0x73,0xF9,0x47,0x70,0xA9,0xA0,0x3D,0x06,0x67,0x95,0xA8,0x31,0x78,0x5E,0xC4,
+    0x02,0x07,0x56,0x6E,0x67,0x9E,0xC6,0xA5,0x14,0x06,0x6D,0xB1,0x90,0x2A,0xCD,0x09,
+    0x56,0x5E,0x07,0x70,0x19,0x38,0x30,0xC3,0x21,0xAA,0x26,0x93,0x48,0x60,0xCC,0x18,
+    0x13,0x14,0x87,0xB2,0xB5,0xDA,0x16,0x8C,0x9A,0x20,0x68,0xC8,0xBE,0x33,0xC7,0x20,
+    0x7F,0x94,0xE3,0xA0,0x5C,0x86,0xD0,0x60,0x49,0x12,0x49,0x35,0x55,0x48,0xA4,0xE8,
+    0x58,0x41,0x81,0x15,0x7D,0x84,0x4A,0xC0,0x0A,0xC8,0x0D,0xA4,0x90,0xFE,0x5C,0xBC,
+    0xAB,0x7A,0x3A,0xC0,0x9E,0x28,0x9F,0x6D,0xEB,0x2F,0x2D,0xCF,0xF9,0xAB,0xD3,0xDE,
+    0xEC,0x2B,0x68,0x9C,0xCD,0x01,0xD7,0xF8,0x63,0x92,0x05,0x54,0xA5,0xB0,0x7F,0x04,
+    0x86,0x8D,0xFA,0xF6,0x68,0x00,0x1B,0xCE,0x66,0xB7,0x0B,0x23,0xC3,0xC2,0x3D,0xFC,
+    0x77,0x29,0x92,0xA7,0xB0,0x64,0x21,0x7A,0x4A,0x58,0xF1,0x53,0xC4,0xA7,0x05,0x71,
+    0x02,0x06,0x07,0x0F,0x60,0xD4,0x9D,0x85,0x23,0x7F,0x15,0x5D,0x1E,0xA4,0xDC,0x51,
+    0x93,0x16,0x28,0x57,0x64,0xF9,0xCE,0xE6,0xEE,0xA2,0xB9,0x07,0x93,0xE7,0x1C,0x14,
+    0x7A,0xE8,0x78,0x8A,0x84,0x0F,0x3D,0xCA,0xB0,0xD5,0xAD,0xF6,0x28,0x06,0x05,0x13,
+    0xFB,0x62,0xF4,0x10,0x29,0xA0,0x2D,0xB9,0x04,0xE0,0x42,0x2E,0x6E,0xEB,0x1F,0x80,
+    0x7E,0xC8,0xA0,0x7F,0xEE,0x09,0xFC,0xAA,0xF5,0x0E,0x93,0x3A,0x65,0x76,0x48,0xA3,
+    0x74,0xA1,0x77,0x9D,0x59,0x80,0xCE,0x85,0xBC,0x74,0xB7,0x7C,0xA7,0xD5,0x6D,0x55,
+    0xDA,0x3B,0x4E,0xCC,0x41,0x9E,0xF1,0x2A,0x35,0xA0,0x01,0x7C,0x77,0x72,0xF2,0xEE,
+    0xE3,0xFB,0x97,0x27,0x27,0xD0,0xA4,0x63,0x1E,0x76,0xA0,0x46,0xC4,0x10,0xB9,0xDF,
+    0x9A,0x23,0x43,0x2C,0x75,0x7C,0xC6,0xA3,0x82,0xE0,0x91,0x11,0x0D,0x12,0x33,0x83,
+    0xBA,0xA9,0x14,0x08,0xC5,0x8C,0x0E,0xB5,0xA5,0xB5,0x26,0xFB,0xE4,0x0A,0xE2,0xCD,
+    0xD2,0xFD,0x29,0x7A,0xE5,0x2B,0x3B,0x08,0x44,0xD8,0x07,0x50,0x3C,0x45,0xCC,0xBE,
+    0x68,0xBC,0xAA,0xD0,0x61,0x57,0xE5,0xF7,0x40,0x72,0x95,0xE5,0x34,0xED,0x39,0x5D,
+    0x5F,0x7D,0x15,0xC6,0xD7,0xB9,0xF1,0x15,0xF4,0x9C,0x4D,0x69,0x33,0xE9,0x5E,0x02,
+    0xF6,0x8A,0x83,0x19,0xCC,0x2E,0xBB,0xA8,0x14,0x29,0xE8,0x44,0x15,0x3D,0xBA,0x40,
+    0xBF,0x0A,0x32,0x19,0x18,0x0D,0xE1,0x69,0x35,0x24,0x64,0x3D,0xD2,0x48,0xB9,0xAB,
+    0x17,0x71,0x92,0x80,0x24,0x04,0x5A,0xCC,0x72,0x60,0x4C,0x10,0x04,0xD1,0x9A,0xDE,
+    0x73,0x39,0x62,0x18,0x80,0xFC,0xD9,0xD7,0xF3,0x05,0x26,0x7F,0x21,0xC4,0x0E,0x2A,
+    0xFB,0xF9,0xD3,0x8D,0x2F,0x86,0xCE,0x0B,0x47,0x98,0xCD,0xAE,0x14,0xDA,0x2B,0xFC,
+    0xDC,0x34,0xE7,0x92,0x28,0xF6,0x30,0x62,0x85,0x9E,0x3B,0x49,0x26,0x51,0x90,0x5E,
+    0x61,0xC1,0x78,0x64,0xA0,0xB7,0x31,0xB5,0xB8,0x0A,0x5A,0xA6,0x75,0x4D,0x09,0x80,
+    0x13,0x32,0x77,0xA1,0xAF,0x72,0x72,0x2B,0xFB,0x57,0x98,0x9E,0x0C,0x81,0x68,0xC5,
+    0xA3,0x37,0xEA,0xA4,0x8B,0xC2,0xB2,0x9A,0x4A,0x9C,0x0A,0xE1,0x36,0xE4,0xE6,0xE9,
+    0x04,0x10,0xB3,0x75,0x4B,0xB7,0x95,0x11,0x70,0x43,0x53,0xAA,0x74,0x6D,0x68,0xDB,
+    0x7F,0x72,0xF3,0xFD,0x06,0x87,0xC9,0x71,0xFD,0xA6,0x95,0x4D,0x58,0x04,0x16,0x65,
+    0x3E,0x82,0x1E,0x11,0x50,0x65,0x60,0xDF,0x38,0x22,0x94,0x0D,0x9B,0x40,0x9D,0x74,
+    0xEF,0xB6,0xCA,0x00,0x68,0xA5,0xCA,0x50,0xA9,0xBC,0xB5,0x32,0x00,0x5A,0x58,0xD9,
+    0x5A,0xA3,0xD2,0x26,0xB6,0xC4,0x61,0xAC,0x3A,0xB6,0x18,0x02,0xEC,0xEC,0x32,0x48,
+    0x43,0x2C,0x22,0x67,0xCB,0xDA,0x85,0xF3,0x40,0xB6,0x4E,0x1F,0xD6,0xF1,0xB4,0xF2,
+    0x16,0xFA,0x42,0xB8,0xE2,0xFB,0xF7,0x9D,0xD6,0xA4,0xF6,0x3D,0xAC,0xBE,0xED,0x48,
+    0x5B,0x8A,0xAE,0xD6,0xB4,0x56,0x5D,0x51,0xFB,0x3E,0x5F,0x5A,0x3D,0x74,0xFB,0xCB,
+    0xAA,0x4F,0x6E,0xA9,0x3E,0x59,0x5E,0xFD,0x29,0x29,0x76,0x4B,0xEB,0x60,0x10,0x85,
+    0x68,0xFE,0x5C,0x38,0xDB,0x55,0x71,0xE1,0xCF,0x05,0xBE,0x64,0x87,0x72,0xEB,0x20,
+    0x65,0x3E,0xD6,0xD8,0xB4,0xE5,0xF5,0xD7,0xF4,0x6A,0x16,0xCA,0x05,0xD4,0x14,0x43,
+    0x50,0xC4,0x80,0x83,0x91,0x3F,0x03,0xA7,0x98,0x45,0x61,0x3C,0x8E,0x43,0x27,0x04,
+    0xE1,0x94,0x46,0x89,0x5D,0x3A,0x60,0xE4,0x60,0x80,0xAB,0x1A,0xE2,0xF9,0x1A,0x7D,
+    0x40,0xF0,0x2F,0x4C,0x69,0x1D,0x4E,0x56,0x82,0x4B,0xC4,0x28,0x3E,0x8F,0x47,0x73,
+    0x5C,0x25,0x44,0x22,0xB7,0xE9,0x93,0x08,0x8D,0x2E,0x03,0xF4,0xDD,0x20,0xF2,0xCE,
+    0xB2,0x51,0x84,0xD8,0x85,0x4A,0x7D,0x82,0xE5,0x2F,0x68,0xA0,0x80,0xFF,0x25,0xCB,
+    0x04,0x15,0xFF,0x66,0x91,0x1C,0xC9,0x76,0xF4,0x95,0xA8,0x21,0x91,0xF6,0x45,0x5F,
+    0x4C,0xC1,0x24,0x52,0x5D,0x1E,0xA6,0x2F,0x6B,0xF2,0xEB,0x73,0x49,0xF2,0x4F,0x88,
+    0xE8,0xAD,0xBE,0x2E,0xE8,0x8F,0xB8,0xE8,0xB1,0x4D,0x86,0xCB,0x3C,0xDF,0x71,0x55,
+    0x61,0x5C,0xD0,0x20,0x5B,0x7D,0x1F,0x89,0x26,0x8F,0x25,0x7D,0x68,0x79,0x9E,0xE6,
+    0x5F,0xD6,0x26,0x55,0xCE,0xE9,0xFB,0x08,0x67,0x92,0x89,0x81,0xD6,0x2A,0xC0,0x73,
+    0x5C,0x16,0x96,0xD5,0xC2,0x8E,0x95,0x3C,0xAA,0x49,0x6A,0x4A,0x70,0xAB,0x51,0xEB,
+    0x42,0xA2,0xB1,0x68,0xF5,0x97,0xD2,0xDB,0x59,0x70,0x1A,0xD1,0x4C,0xF1,0x42,0x24,
+    0xE5,0x11,0x2C,0x9B,0x60,0xB6,0xE0,0x9C,0x15,0xC1,0x59,0x24,0xA6,0x31,0x28,0x78,
+    0x61,0xCD,0xD2,0x68,0xF1,0x14,0x86,0x49,0x86,0x27,0x45,0x75,0x8D,0x1F,0x12,0xB4,
+    0xCE,0xCA,0xC8,0x04,0x68,0x53,0x69,0x1F,0xB4,0x97,0xB5,0x14,0x87,0x1C,0xF1,0x29,
+    0x90,0x28,0x17,0xEA,0x25,0x38,0x03,0x45,0x30,0x26,0x53,0x4A,0xF5,0x83,0x53,0xEA,
+    0x58,0xD3,0x96,0x7F,0x75,0x2E,0x76,0x39,0xC6,0xA4,0xAE,0x89,0x8C,0xC6,0xB2,0x1D,
+    0xE7,0xD3,0xC2,0x6A,0x08,0xC0,0xFC,0x18,0xD6,0x35,0x36,0xB3,0xCB,0x6A,0x9D,0x06,
+    0xD8,0x0F,0xD9,0x7B,0x92,0xC3,0xD5,0x99,0x50,0x91,0xE6,0xC2,0x0F,0x93,0xCE,0xA7,
+    0xC4,0x92,0xE7,0x9D,0x29,0x68,0xEF,0xBB,0xDD,0xBE,0x96,0x53,0x88,0x9C,0x82,0xF5,
+    0x7A,0x3D,0xEB,0x5C,0x64,0x9D,0x37,0xB3,0xD0,0x4D,0x4F,0x96,0xA5,0x3B,0xF5,0xF4,
+    0xF4,0x31,0x31,0x3B,0x08,0x0C,0x3D,0x71,0x86,0x6C,0x00,0x63,0x75,0x37,0x21,0xA7,
+    0x30,0xE0,0xFF,0xA5,0x67,0x8D,0xE1,0x87,0x99,0x5D,0xEA,0xD9,0x0C,0xE3,0x35,0x80,
+    0x40,0xE4,0x00,0x58,0xEC,0xFC,0xC5,0xD9,0xD5,0x93,0xD1,0x02,0x3E,0x3A,0xF7,0x9D,
+    0x7F,0xF9,0xCE,0x8C,0xFE,0x1F,0x44,0xC1,0xF9,0xF1,0x11,0x40,0x1F,0xEB,0x60,0xB8,
+    0x54,0x1F,0x61,0x16,0xFD,0xBF,0x00,0x6E,0x82,0x21,0x9E,0x8F,0xAA,0x7A,0x18,0xD8,
+    0x04,0x13,0xC4,0x5A,0xC9,0xFA,0xBC,0x27,0x4C,0xD8,0x1C,0x4F,0x7B,0xEF,0xEC,0xF8,
+    0xA0,0xCD,0xE2,0x5F,0xAF,0xD2,0x69,0x27,0x12,0x64,0xB2,0x10,0x64,0x28,0x41,0x86,
+    0x35,0x10,0x53,0x17,0xBE,0x8D,0x04,0x71,0xC9,0xAE,0x48,0x10,0xA6,0xB5,0x4E,0x82,
+    0x08,0xD0,0xD6,0xC0,0x96,0x11,0x1F,0x40,0x81,0xA5,0x43,0xAB,0x74,0x25,0x68,0x44,
+    0x9A,0x0B,0x3F,0x4C,0xE2,0xC3,0x99,0x80,0xC4,0x4E,0x0E,0x74,0x04,0x1D,0xAF,0x63,
+    0x1F,0xB3,0x26,0xCD,0xAC,0xA1,0xC8,0x1A,0x36,0xB3,0xD0,0x0A,0x15,0xEE,0x0D,0xB4,
+    0xF9,0xC1,0xDC,0x9B,0xF8,0xCE,0xD0,0x24,0x0A,0x5A,0x9C,0x95,0x7F,0xC0,0x06,0x02,
+    0x0B,0x55,0x89,0x52,0x50,0x98,0xE6,0xD5,0xF2,0x4D,0x0C,0x43,0x1A,0xBC,0xC9,0x0E,
+    0x42,0xAD,0x07,0x78,0x83,0x81,0xD0,0xF3,0x43,0x5B,0x16,0xA2,0x2E,0xD4,0xE4,0xBA,
+    0x60,0x2B,0x77,0xC1,0x3A,0xE6,0x36,0x36,0xB8,0x8C,0x28,0x54,0x80,0xBC,0x04,0x6B,
+    0xC4,0xD5,0x2C,0x77,0xFC,0x2F,0x0C,0x40,0x51,0x80,0x5E,0xF4,0x34,0x55,0x43,0xF6,
+    0x02,0x8D,0x86,0x20,0x04,0xD5,0xE1,0x0C,0x77,0xF2,0xD6,0x34,0x08,0x8A,0x38,0xD3,
+    0x76,0xBB,0xA8,0x96,0xBC,0x59,0x87,0x8B,0xCE,0x0D,0x98,0x97,0x0D,0xD1,0xA5,0x87,
+    0x98,0xF2,0x0C,0x90,0xBC,0xE7,0xEC,0x42,0x3F,0xBB,0x5E,0xFF,0xB6,0x4A,0x27,0x96,
+    0x4A,0x89,0x62,0xF4,0x4A,0xB7,0x6E,0xAD,0x66,0x68,0xA9,0x06,0x7D,0x00,0x13,0xBD,
+    0x9A,0x47,0x96,0x6A,0xEC,0xBB,0x65,0x86,0x21,0x89,0xD5,0x3D,0x00,0xF9,0x06,0xA2,
+    0x60,0x7B,0xD7,0xB4,0x2A,0x99,0x85,0xB4,0xB9,0x7A,0x80,0x22,0x8D,0x78,0x09,0xFE,
+    0x7A,0x86,0xCD,0xC9,0xB0,0x3C,0xDD,0x26,0xD8,0xDD,0x58,0xCE,0x94,0xFA,0xA0,0x11,
+    0x2D,0x96,0xFA,0x2B,0xCA,0xFB,0x57,0x45,0xD2,0x90,0xF7,0x90,0xD6,0x94,0xF7,0x9F,
+    0x27,0xD5,0xB1,0x72,0x77,0x8B,0x84,0x34,0x74,0xF2,0xDC,0x60,0x16,0xD0,0xFF,0x0A,
+    0xF2,0x2A,0x26,0xCE,0xB3,0x81,0xB3,0x09,0x74,0x93,0x00,0xDD,0x20,0x70,0xC2,0x7B,
+    0x57,0x14,0xEA,0x43,0x60,0x74,0xC8,0xF4,0xCA,0xF9,0x33,0xCA,0x33,0xE7,0x62,0x1A,
+    0xA5,0x4E,0x12,0x4F,0xA6,0x65,0x1A,0x15,0xA0,0xC6,0x14,0xB8,0xC6,0x03,0x19,0x00,
+    0x42,0x30,0x7F,0x6D,0x11,0x23,0xC9,0xF6,0x9E,0x39,0x9B,0x51,0xFB,0xA9,0xE0,0xA6,
+    0x02,0x7B,0x85,0x64,0xC2,0x99,0xFD,0x65,0xA4,0x80,0x8B,0xDD,0xE7,0x51,0x40,0x22,
+    0x61,0x13,0x00,0xD9,0xF9,0xFC,0xC9,0x4F,0x96,0xCB,0x5B,0x04,0x68,0x6B,0x60,0xCB,
+    0x27,0x3F,0x69,0xC8,0x5B,0x99,0x06,0x93,0x9F,0x98,0x93,0x2F,0xF4,0xEF,0x0E,0xF6,
+    0x7F,0xAB,0xB9,0xD6,0x27,0x1D,0xC4,0xA3,0xCB,0xF3,0xD8,0xED,0xCA,0x99,0x84,0x5F,
+    0x30,0x97,0x9E,0xA0,0x8A,0x5B,0xA7,0x14,0xB8,0x94,0xA6,0x33,0x8D,0xA0,0xE2,0xEE,
+    0xC2,0x79,0x64,0x38,0x63,0x16,0xB7,0x70,0x05,0x87,0x66,0x5C,0xCA,0xF3,0x96,0xCF,
+    0x62,0xF2,0xB9,0xB3,0xA8,0xF8,0x58,0x34,0x83,0xAB,0xC8,0x67,0x4E,0x65,0xE0,0x9C,
+    0x36,0x3D,0xFD,0xEC,0xCF,0x0C,0x66,0xA0,0x42,0x5E,0xFA,0x0E,0x6E,0xAB,0x59,0x6D,
+    0x2D,0x51,0xB2,0x6D,0xA9,0x62,0xD9,0x84,0x33,0x74,0x43,0xC1,0xD3,0x92,0x5D,0xFE,
+    0x6D,0xCE,0x3C,0xD6,0x0E,0xF0,0xA2,0xAD,0x06,0x7F,0x8B,0x55,0x50,0x89,0x64,0x72,
+    0x42,0x60,0x91,0x67,0xCE,0xEE,0xAE,0xBE,0x16,0x21,0x9F,0x6B,0x6B,0xAE,0x43,0xEB,
+    0x74,0x7B,0x73,0x67,0xA7,0xB3,0xB5,0xF3,0xE8,0xC9,0xCE,0xCE,0xEE,0xD6,0xE3,0xEE,
+    0xD3,0xCD,0xC7,0x4F,0x61,0x5C,0xDD,0xCE,0xA3,0x47,0x3B,0x4F,0x77,0x9F,0xEE,0x74,
+    0x1F,0xC1,0x3F,0x8F,0x9F,0x6E,0x6E,0x6F,0x23,0x75,0x61,0x01,0xAA,0xBA,0xED,0x6C,
+    0x79,0x30,0x01,0x9B,0xDD,0x47,0x9D,0x47,0x4F,0xB7,0x36,0x77,0x37,0x9F,0x3E,0xDD,
+    0x7E,0xBA,0xFD,0xE4,0xC9,0x13,0x80,0x4A,0xB2,0x89,0x3B,0xD1,0x56,0x9E,0xA1,0x2C,
+    0xF4,0x0C,0xC8,0x51,0x50,0x4B,0x1B,0x5A,0xEC,0x3C,0xDE,0x7D,0xBA,0xBD,0xB3,0xF9,
+    0xE4,0xD1,0xE6,0x56,0xF7,0x69,0x77,0x0B,0xAA,0xEB,0x76,0x9E,0x6C,0x3D,0x7E,0xD4,
+    0x7D,0xBA,0xDB,0xDD,0x7D,0xD4,0xED,0x3E,0xDE,0x7E,0xBA,0x83,0x8D,0x0E,0xAB,0x46,
+    0x37,0xBB,0xD4,0xEA,0xE6,0x4E,0x67,0xF7,0xF1,0xD3,0xA7,0x8F,0x1E,0x75,0x37,0xBB,
+    0xBB,0xBB,0x9B,0x8F,0x1E,0x8B,0x56,0x2B,0x4D,0xA0,0x61,0xA1,0xE3,0xD8,0xA1,0xB1,
+    0xCE,0x53,0x68,0xB4,0xBB,0xB3,0xBB,0xFB,0x04,0xFE,0x79,0xBA,0x4D,0x6D,0x6E,0x6E,
+    0x3E,0xDA,0x82,0x06,0x77,0xB6,0x1F,0x43,0x57,0x76,0xA9,0xC9,0xBC,0x6A,0x12,0x54,
+    0x32,0xF8,0xF7,0x51,0x17,0x70,0xB4,0xBD,0xBB,0xBB,0xDD,0x7D,0xBA,0xBD,0xBD,0xB5,
+    0xB9,0x25,0x5B,0xCC,0x3D,0x13,0x9B,0xDB,0x5B,0x3B,0x80,0xB9,0xA7,0x30,0xA4,0x9D,
+    0xC7,0x9B,0x9B,0x4F,0x1F,0x3F,0xA2,0x16,0xBA,0x8F,0x9F,0x3E,0xDA,0x7E,0xB4,0xB3,
+    0x8B,0x35,0xEC,0x6E,0x6D,0x3F,0xDA,0xAA,0xE1,0x72,0xA7,0x8B,0x6D,0x6C,0x3D,0xE9,
+    0x74,0x9F,0xEC,0x6C,0x3D,0xDD,0xDD,0xDE,0x81,0x02,0x3B,0x8F,0x17,0xA0,0x52,0x9B,
+    0xC1,0xC5,0xCB,0xA6,0x52,0x52,0x59,0x9D,0xCF,0xBD,0x65,0x5A,0x2A,0xC3,0x4C,0xBC,
+    0x65,0x6A,0x2A,0xC3,0x0C,0xBD,0xD5,0xF4,0xD4,0x06,0xAF,0xA5,0xC4,0x4B,0x6C,0x05,
+    0xE9,0x3C,0x16,0x83,0xEA,0x13,0x2D,0xE2,0xA2,0x2F,0xE6,0x37,0x52,0x5E,0xFF,0x2E,
+    0x7D,0x3A,0xA6,0x4E,0xCB,0xC9,0x4B,0xD4,0x5A,0x5F,0x57,0x56,0xA4,0xD6,0xAA,0xF3,
+    0x5D,0x34,0x43,0xC9,0x0B,0x9C,0x52,0xD3,0x50,0x3F,0x30,0xBB,0x56,0xDB,0x84,0x35,
+    0x25,0xB7,0x96,0xFF,0xFC,0xB7,0x7E,0x8D,0xD7,0x15,0x27,0x5F,0x4C,0xE3,0x24,0x22,
+    0x95,0xF2,0x03,0x13,0x8A,0xAC,0xFD,0xAF,0xD8,0xB8,0xCE,0xDA,0x42,0x44,0x28,0xD0,
+    0x87,0x12,0x14,0x97,0xFC,0x6E,0x67,0x47,0xD3,0xD7,0xC8,0x41,0xC2,0xAE,0x3E,0x9B,
+    0x60,0x22,0xD1,0xE1,0x69,0xF0,0x28,0x4E,0x4E,0xA4,0xCA,0x7E,0xC2,0x1A,0xFF,0x5F,
+    0x07,0x0E,0x7E,0xD5,0x3C,0x95,0xD5,0xD8,0x78,0x14,0x35,0x27,0x9C,0x01,0xAA,0xD0,
+    0x54,0x03,0x5D,0x14,0x3E,0xA5,0xA0,0x64,0xF0,0x94,0x11,0xB7,0x27,0x07,0xE2,0x3B,
+    0x47,0xB2,0x15,0xBC,0xD5,0xC7,0x59,0x87,0x15,0x7A,0x5D,0x4E,0xE4,0x24,0x2A,0x7B,
+    0x15,0x11,0x4C,0x0C,0xFF,0x09,0xED,0x72,0x08,0x87,0x6C,0xC1,0x0E,0x8B,0x11,0x11,
+    0x2A,0xC5,0xEE,0x84,0xE4,0x20,0x28,0x30,0x61,0x88,0x31,0x4F,0x23,0x5A,0x28,0xD0,
+    0x37,0xC2,0xF1,0x41,0x90,0x8A,0x47,0x07,0x9C,0x19,0x06,0xCE,0xE1,0x76,0xD7,0x34,
+    0x3A,0x23,0x3F,0x8F,0x81,0x74,0x69,0x69,0xF0,0x9E,0x41,0x35,0xE6,0x06,0xF3,0xD2,
+    0x22,0x29,0x5C,0xBD,0x3A,0x15,0x16,0x32,0xB5,0xD0,0x53,0xCF,0x65,0xEA,0x79,0x85,
+    0x45,0x25,0x20,0x24,0x60,0x61,0x8C,0x1D,0x7D,0x47,0x69,0x74,0xF1,0x4B,0xDD,0x0B,
+    0x8A,0xBD,0xCC,0x92,0xD1,0x2F,0x0B,0x3A,0x2A,0x8B,0xD4,0x1D,0x68,0xB2,0x88,0xAF,
+    0x20,0x78,0x43,0xE4,0x60,0xAC,0x6F,0xC3,0xC4,0x88,0x26,0xC4,0x0E,0x6D,0xDB,0xC8,
+    0x1D,0x52,0x81,0xD9,0x0B,0x74,0x41,0x31,0xCA,0x31,0xAA,0x36,0x10,0x01,0x50,0xE8,
+    0x22,0xC2,0x5D,0x6B,0x68,0x41,0xA2,0x1A,0x21,0xF0,0x88,0x03,0xE5,0xD3,0x79,0xA8,
+    0x3C,0x4A,0xC3,0x48,0x9F,0xC7,0xB7,0xB8,0xD9,0x7B,0x11,0x03,0xC9,0x41,0xB5,0x21,
+    0xC8,0x1A,0x0A,0x9E,0x82,0x99,0x4B,0x82,0x3F,0xAF,0x4C,0xC2,0x36,0x3C,0x40,0x26,
+    0x35,0x53,0x48,0xC9,0xD9,0x6C,0x5E,0x46,0xA2,0x97,0xB2,0x0B,0x3A,0xEE,0x83,0x6A,
+    0x08,0x83,0x5A,0xE0,0x20,0xCC,0x21,0x05,0xC8,0xFA,0x46,0xEA,0xB9,0x35,0xB5,0xB0,
+    0xA6,0x06,0x22,0x55,0x0F,0x34,0xEC,0xEB,0x66,0x62,0x3D,0x08,0x52,0x4E,0x44,0x3D,
+    0x86,0x51,0x74,0x51,0x06,0x31,0xCA,0x59,0xE2,0xEF,0x7B,0x03,0x55,0xCE,0x12,0xD7,
+    0x58,0xF7,0x90,0x7F,0xAF,0x95,0xAF,0x26,0x59,0xFA,0x07,0xA7,0x41,0x21,0x91,0xE5,
+    0xD3,0xC6,0x9C,0x33,0xCD,0xB2,0x53,0xB5,0x45,0xB7,0x56,0x0B,0xCE,0x14,0xFD,0xEA,
+    0x4C,0x31,0xD4,0x54,0x7E,0x14,0xFA,0xC7,0xB9,0xFE,0x11,0xA8,0xED,0x40,0x39,0x63,
+    0x22,0x58,0x52,0x00,0x78,0x7D,0x3D,0x10,0xB3,0x29,0x74,0x9A,0x03,0xB0,0xC8,0x1D,
+    0x66,0x1B,0xA7,0x21,0x46,0x82,0x15,0xE5,0x48,0x2D,0xA8,0xD3,0xD8,0x25,0xBC,0x9D,
+    0x2B,0x1B,0x1B,0x13,0x8B,0x76,0x4E,0x16,0x75,0x74,0x1E,0xDD,0xAD,0x9F,0xDC,0xB5,
+    0xCE,0xF4,0x0B,0xFB,0x66,0x13,0x5E,0x16,0x71,0x64,0xEF,0x74,0xA5,0xF7,0x7F,0x56,
+    0xDF,0x8B,0xAF,0xD8,0xF7,0xE2,0xAE,0x7D,0xE7,0x58,0xF6,0xCF,0xE9,0xF6,0xF9,0x57,
+    0xEC,0xF6,0xF9,0x5D,0xBB,0x1D,0x24,0xB3,0x69,0xF0,0x59,0xDD,0x0E,0xBE,0xB0,0xDB,
+    0x4D,0xC6,0x80,0x74,0xDF,0x18,0x4D,0xD0,0x18,0x8D,0x77,0xCB,0x70,0x58,0x7F,0xB9,
+    0xDB,0x78,0x6C,0x5A,0xA2,0x2B,0xF7,0x41,0x3F,0x9F,0x57,0x97,0x68,0x56,0x22,0x80,
+    0x61,0xF9,0x50,0xF2,0x68,0xB4,0xE2,0x38,0x48,0x5B,0xA5,0xD6,0x64,0xC3,0x0D,0x9D,
+    0x82,0xB4,0xB5,0x2F,0x1C,0x4A,0x73,0xC2,0x20,0xDD,0x9C,0xB0,0xFC,0xCE,0x13,0x36,
+    0xC9,0xA3,0x28,0xFD,0xBA,0xE3,0x9C,0x7C,0xFB,0x71,0x4E,0xEE,0x3C,0xCE,0xE1,0xEA,
+    0xD2,0x61,0xC5,0x61,0x0E,0xBF,0xFD,0x30,0x87,0x77,0x1E,0x26,0x54,0x71,0x87,0x51,
+    0x9E,0x48,0xEE,0xF8,0x5E,0xDB,0xEE,0x6A,0x6C,0x81,0xB9,0x62,0xD5,0x34,0x75,0x22,
+    0x34,0xCF,0x9A,0xE5,0x4D,0x6B,0x8D,0x4D,0x71,0x0B,0xD4,0xC4,0x84,0x1A,0xDA,0xA1,
+    0x86,0x9A,0x8E,0x65,0xD1,0xCD,0x81,0xD8,0x29,0x2E,0x13,0x8D,0x6A,0x93,0x36,0x38,
+    0x79,0x62,0x24,0x0F,0x65,0xF2,0xD0,0xBB,0x93,0x7A,0xBE,0xB2,0x08,0x6D,0xEC,0xDE,
+    0x88,0xA2,0x76,0x91,0xDA,0x09,0x68,0x23,0x43,0x6D,0x74,0x3A,0x7B,0xCE,0xA6,0xA3,
+    0xF2,0xEE,0x34,0xE1,0x5F,0xAC,0x10,0x35,0xE8,0x0E,0x3A,0x49,0x19,0xB4,0x38,0xD9,
+    0xFA,0xF2,0x79,0x14,0xBF,0x92,0xDE,0x54,0x24,0x9F,0x4F,0xC0,0xEC,0xBF,0x6F,0xF8,
+    0xF4,0xED,0x04,0x3C,0x6D,0x12,0xDD,0x2B,0xD3,0x1F,0x4A,0x23,0xB4,0x43,0x15,0x26,
+    0x54,0x62,0x87,0x4A,0x96,0x13,0xF0,0x54,0x92,0xE4,0xD4,0xAB,0x59,0x97,0x9C,0x5C,
+    0x18,0xC9,0x89,0x4C,0x4E,0xBE,0x35,0x01,0x2B,0xD7,0xF7,0xBF,0x83,0x80,0x31,0xF0,
+    0xEB,0x4B,0x09,0x98,0xA2,0x61,0xBE,0x29,0x01,0x5B,0x62,0x9A,0x16,0x33,0x24,0xC7,
+    0xA8,0x7D,0xBD,0xD5,0x06,0xEB,0x74,0xD7,0x9D,0x87,0x62,0x97,0xF7,0xA1,0xB3,0xEE,
+    0x3B,0xF2,0x73,0x62,0x7E,0x0E,0xF1,0xD3,0x5B,0xFF,0x9C,0x71,0xB2,0x53,0xAC,0x0C,
+    0xA7,0x7D,0xB3,0x6F,0x35,0x81,0x5E,0x93,0xDC,0x35,0x43,0x99,0x8E,0x17,0x9A,0x96,
+    0x3D,0xD5,0x09,0xE9,0xB6,0x63,0x2E,0x9D,0xE8,0x32,0x0A,0xAD,0xF1,0x7E,0xB9,0x0C,
+    0x9C,0xA6,0x50,0x6C,0xAA,0xE3,0x68,0xF3,0x98,0x3D,0x9E,0xBA,0x61,0x3C,0xB1,0xC0,
+    0x6D,0x59,0xE0,0x86,0x16,0xB8,0xED,0x06,0x9C,0x16,0xA5,0xB6,0xAC,0xDB,0xCF,0xFF,
+    0xD3,0xFA,0xCD,0x98,0xAF,0xC3,0x3D,0x02,0xB8,0x4D,0x7D,0x74,0x96,0x89,0x59,0x18,
+    0x7D,0x68,0x3A,0x2E,0x70,0xAD,0xAD,0x11,0x42,0xAF,0x41,0x0B,0xBD,0x06,0x39,0xF4,
+    0x9C,0xC0,0xF4,0x99,0x2C,0x75,0x0A,0x2C,0x08,0xDD,0xC3,0xFE,0xC8,0x38,0xD7,0x95,
+    0x1D,0x05,0xB8,0x2E,0x7E,0x0E,0x1F,0x06,0x1A,0x23,0x06,0x56,0x4E,0x0C,0x24,0x2B,
+    0x06,0x35,0x5E,0x0C,0x6A,0xCC,0x18,0x30,0x37,0x6A,0xDF,0xC1,0xE7,0x73,0xE7,0xF2,
+    0x60,0xDA,0x45,0xB2,0x55,0x46,0xF2,0x7E,0x45,0x59,0xF4,0x1D,0x8E,0x46,0x85,0xE2,
+    0x93,0x44,0xF2,0xEA,0x29,0x93,0x46,0xCA,0xE7,0xD9,0x71,0x5F,0x4B,0x24,0xD1,0x4E,
+    0xCD,0x12,0xA1,0x44,0x47,0xC2,0x56,0xE0,0x69,0x71,0x38,0x42,0x72,0x35,0xBA,0xF4,
+    0x37,0x1F,0x5B,0xB9,0xDA,0x80,0xDC,0xB2,0x40,0x0E,0xAD,0x90,0xDB,0x0D,0xC8,0x85,
+    0x12,0x89,0x8E,0x98,0xFD,0x67,0xF6,0x59,0x93,0x46,0x06,0xE4,0xA3,0xBB,0x8D,0x6E,
+    0xF7,0x33,0x46,0xB7,0xD2,0xC0,0x56,0x1A,0xD3,0x8A,0x9D,0x7C,0xF2,0x1F,0xD2,0xC9,
+    0x25,0x38,0xFF,0xFF,0xBC,0x00,0x70,0x7C,0xD9,0x97,0x2F,0x03,0xD5,0x29,0xA6,0x3B,
+    0x2C,0x03,0x50,0xE8,0xC9,0x37,0x58,0x06,0x1A,0x42,0x30,0x68,0x4A,0xC1,0xA0,0x29,
+    0x06,0x61,0x45,0x30,0x92,0xC4,0x9E,0x30,0x2F,0x0D,0x14,0x7D,0xE8,0x7D,0x81,0x8A,
+    0xBA,0xE8,0xD8,0xC6,0x62,0xC5,0xFB,0xCE,0x98,0x61,0x35,0x58,0x6A,0xC4,0x4D,0xBC,
+    0xE0,0x7D,0x07,0x88,0x1A,0x0A,0x2C,0xA9,0x16,0x3F,0x0E,0x8A,0x81,0xCF,0xBF,0x54,
+    0xDF,0x09,0x7D,0x7F,0x55,0x55,0xB5,0x6E,0xBA,0xD5,0x6C,0xB4,0x2F,0x50,0x55,0x5F,
+    0x1D,0xBE,0x5E,0xCC,0xE7,0xD3,0x05,0x2A,0xDF,0xF6,0xAE,0x19,0xF6,0x57,0x2C,0x50,
+    0xF9,0x30,0x62,0x46,0x87,0x4B,0x16,0xA8,0x7C,0x26,0xDC,0x2A,0xAA,0x2A,0x1E,0xDE,
+    0xFE,0x4F,0xEB,0xF7,0x57,0x55,0x55,0x99,0x1E,0x1B,0xDB,0x7D,0xD3,0xC6,0xA6,0x5E,
+    0x9D,0x16,0x7A,0x0D,0x72,0xF8,0x2A,0xAA,0x2A,0xF6,0xE7,0xEE,0x32,0x0A,0x2C,0xE0,
+    0xCF,0xE1,0xC4,0x40,0x63,0xC5,0xC0,0xCA,0x8B,0x81,0x64,0xC6,0xA0,0xC6,0x8D,0x41,
+    0x9D,0x1D,0x03,0xC1,0x8F,0x5A,0xC2,0x97,0x2A,0xAB,0x0B,0x0F,0x6B,0x09,0x34,0x1C,
+    0x7B,0xE6,0xED,0x2B,0xD2,0xFD,0x40,0x07,0x35,0x5D,0x4F,0x3D,0x2C,0x55,0x00,0x62,
+    0xA3,0xFC,0x05,0x1F,0x7A,0x7C,0x4B,0xB7,0x5D,0x54,0x7B,0xBC,0x9C,0x79,0x38,0x0D,
+    0x66,0x51,0xCF,0x69,0x0D,0x83,0xBC,0xE5,0x6B,0xE9,0x74,0xB3,0xA4,0xD3,0xE2,0x53,
+    0x3F,0x9C,0x21,0xE2,0x1D,0x44,0xCC,0x4A,0xCF,0xD9,0xDA,0xEA,0x8A,0x48,0x56,0x11,
+    0x34,0xA1,0x72,0x36,0x81,0x6E,0xBB,0x6B,0x82,0x14,0x6A,0x87,0x5C,0x7F,0x12,0x47,
+    0x06,0xE9,0x3C,0x3A,0x0E,0x71,0x14,0x9F,0x45,0x29,0xDF,0x00,0x93,0xF1,0x3E,0x2C,
+    0xF7,0xC0,0x38,0xEB,0x4A,0xF7,0x3C,0x61,0xF8,0x27,0x65,0xF1,0xA7,0xE5,0x5C,0x36,
+    0xDE,0xAA,0xCA,0x63,0x56,0x95,0xBA,0xC6,0x7D,0x53,0xE4,0xF9,0x12,0x23,0x8F,0xFF,
+    0x94,0x27,0x09,0x31,0xF5,0x22,0x1E,0x95,0x53,0x79,0xA3,0x54,0x87,0xBE,0xB4,0xF0,
+    0x3E,0x55,0x42,0x41,0x54,0x49,0x5A,0xA4,0x51,0x96,0x43,0xDA,0xAF,0x46,0x4D,0x5A,
+    0x5A,0x05,0x88,0x87,0xE8,0x93,0xE8,0x7D,0x30,0x8A,0xE7,0x85,0x82,0xD4,0x13,0x2B,
+    0xD0,0x59,0x30,0x1A,0x31,0x25,0x30,0x94,0xF8,0x6E,0xF4,0x0D,0xE7,0xB1,0xDE,0x39,
+    0x4C,0xEB,0x6B,0x07,0xB0,0xA7,0x59,0x1E,0xFF,0x99,0xA5,0x25,0xBD,0x64,0x26,0xAE,
+    0xD9,0x0A,0xAE,0xB2,0x79,0xF9,0x22,0xCE,0x23,0xC6,0x20,0x1D,0xF6,0xAB,0xE0,0xF8,
+    0x7A,0x8F,0x60,0x5E,0x72,0x7C,0x77,0x90,0x24,0x57,0xEA,0x44,0x78,0xA4,0xA3,0x05,
+    0x44,0x0D,0x1E,0x06,0x4A,0xB3,0x52,0x3C,0xA0,0x36,0x5A,0x5B,0x6B,0x60,0xCE,0x3D,
+    0x31,0x3E,0xAB,0x0F,0x0F,0x77,0xF0,0xF1,0xCE,0x32,0x67,0x4F,0x9F,0x1E,0xA7,0xA7,
+    0x86,0x0F,0x4B,0x3C,0x72,0x97,0x8E,0x37,0x0A,0x21,0xAD,0x2E,0x9E,0xD2,0xD1,0x80,
+    0x83,0x08,0xE3,0x3C,0x4C,0xA2,0x56,0xE3,0xC8,0xCE,0xA7,0xDA,0x2C,0xD0,0x51,0xE7,
+    0x9E,0x89,0x5D,0x68,0x6A,0xD9,0x9C,0xC8,0xD4,0x74,0x02,0xC4,0xCE,0x84,0xD3,0x36,
+    0x7A,0xDA,0x6E,0xF4,0xB4,0x2A,0x4C,0xF0,0xA2,0x98,0x56,0x65,0x84,0x91,0xC8,0x8D,
+    0xE4,0xF0,0x52,0x36,0xB0,0xA1,0xD7,0x11,0x5E,0x59,0x93,0x73,0x6A,0x4E,0xCB,0xC2,
+    0xC8,0x7A,0x8D,0x26,0x21,0xA5,0x16,0xF2,0x66,0x0A,0xE8,0xE5,0x18,0xD2,0xE6,0xC5,
+    0x68,0xD5,0x8A,0x0D,0x1B,0x7B,0xC8,0xEE,0x2D,0xAA,0xE8,0xD2,0x38,0x54,0x7D,0x65,
+    0x7C,0x09,0xAC,0x19,0x34,0xBC,0xE7,0x18,0xA4,0xB2,0x00,0xA3,0xB5,0x22,0xDC,0x41,
+    0xBD,0x13,0xCD,0x28,0xC0,0x9B,0xC5,0x62,0x4B,0xDC,0x2D,0x2A,0x05,0x51,0x75,0x32,
+    0x30,0x70,0x26,0xF1,0x79,0x94,0x72,0x7C,0xA0,0x8F,0xA7,0xCC,0xF4,0xAB,0x19,0x56,
+    0x13,0x66,0xEA,0x78,0xA3,0xB8,0xAF,0xCA,0x22,0xDE,0xF6,0xB9,0x7D,0x96,0x72,0x14,
+    0x00,0xC2,0x02,0xCE,0xE7,0x42,0xBA,0x9C,0x13,0x47,0xE9,0x42,0xE9,0xD0,0x0F,0x2A,
+    0x51,0xC0,0x66,0x4A,0x28,0xF7,0x5C,0x04,0x1B,0xC9,0xE3,0x1F,0xBA,0x0C,0xA1,0x9B,
+    0xF8,0x15,0x45,0xD0,0x39,0x89,0x56,0x1E,0x8D,0x5A,0x3D,0xEB,0x36,0x2D,0xCE,0x67,
+    0x47,0xF3,0x18,0x30,0x3C,0x6D,0x94,0xDA,0x4B,0x4C,0xEC,0x25,0x70,0xCB,0xD1,0x5E,
+    0x60,0x68,0x2F,0x40,0xDE,0xEA,0x66,0x09,0x1C,0x35,0xD9,0x07,0x14,0x6E,0x6C,0x94,
+    0x10,0x27,0x69,0x7B,0xA6,0x66,0x6C,0x2C,0x71,0x4A,0x48,0x9A,0xC9,0xA6,0xF6,0x63,
+    0xAE,0x7D,0x55,0x11,0x23,0xD9,0x54,0xB6,0xB5,0xC8,0xCF,0xF7,0xE2,0xD4,0x5E,0xAD,
+    0x96,0x76,0xAD,0x27,0x66,0x79,0x41,0x56,0x28,0x50,0x43,0x6D,0x83,0xBE,0x51,0x0A,
+    0x23,0xCB,0x1B,0x6D,0x3D,0x50,0x41,0xF4,0x61,0x72,0x16,0xCC,0x74,0x1A,0xAD,0x63,
+    0x4F,0x1D,0x63,0xEA,0xFA,0xD5,0x79,0x25,0x01,0xCF,0xBA,0xA9,0x57,0x43,0xEA,0xD4,
+    0x36,0x6D,0x34,0x09,0x20,0x7C,0x06,0xCE,0x76,0x67,0xB7,0x56,0xA0,0x0A,0x9B,0x59,
+    0x50,0xAE,0xA8,0x15,0x60,0x85,0xA4,0xA7,0x2E,0x6C,0x24,0xD5,0xC6,0x5E,0xF4,0xFC,
+    0x0B,0x18,0x1A,0x6F,0x32,0x98,0x17,0x74,0x09,0xC7,0x6C,0x5E,0xDE,0x8D,0x7B,0xF1,
+    0xCC,0x96,0x78,0x26,0x94,0x6F,0xA3,0xB9,0x14,0x17,0xA7,0xD1,0xD5,0x71,0x15,0xDC,
+    0x55,0x1D,0xEE,0xCA,0x84,0x5B,0xA0,0xDA,0x10,0xD3,0xE3,0xBD,0x9F,0x07,0x58,0x48,
+    0x72,0xFF,0xA5,0xEF,0x5C,0x19,0x4A,0x8E,0x45,0x15,0xC2,0xE7,0x4B,0x17,0x2A,0x48,
+    0x56,0x79,0x8E,0xFB,0x5C,0x96,0x22,0x1D,0x0D,0xC4,0xB7,0x2D,0x16,0xCB,0xCB,0x11,
+    0x88,0xA6,0x7A,0x71,0xEA,0xBB,0xAC,0xD0,0x96,0xF3,0xD5,0xB4,0x93,0x4A,0x32,0xA9,
+    0x3A,0xE8,0x38,0x00,0x20,0xF9,0x4A,0x53,0x17,0x70,0x24,0x0F,0x1D,0xA3,0x71,0xCB,
+    0xEA,0xA7,0x57,0x71,0xA9,0x96,0x70,0x03,0x9E,0xB8,0x06,0x6F,0x27,0xE2,0xBC,0x6A,
+    0xBE,0xB8,0xE3,0x7A,0x0D,0x8A,0x79,0x14,0xE7,0xA8,0x5C,0x5F,0xEF,0x18,0x46,0xA3,
+    0x7B,0x95,0x64,0xAE,0x78,0xBB,0xBA,0x3D,0xC9,0xC5,0xB3,0x30,0x1B,0xC6,0x68,0x1E,
+    0x54,0x6D,0x79,0x77,0x94,0xDE,0xFF,0x4B,0x05,0x9F,0xE0,0xEC,0x5A,0x47,0x1F,0xDA,
+    0x04,0x9C,0x94,0x51,0x7C,0xCC,0xC4,0x5B,0x6D,0xA9,0x30,0xCA,0xAC,0x22,0xD6,0x64,
+    0x81,0x07,0x16,0xB1,0xA6,0xAF,0x90,0x96,0x15,0x6D,0xE9,0xB2,0x58,0xD5,0x6B,0xAC,
+    0x73,0x8B,0x44,0x9D,0x00,0xBF,0x93,0xAC,0xAB,0x51,0x6F,0x53,0x7F,0xF9,0x6A,0xEA,
+    0x0A,0x4B,0x80,0x57,0x92,0x56,0xA9,0xB9,0x85,0x0A,0x8B,0x4D,0x64,0x6C,0xAD,0x28,
+    0xB4,0xA4,0xF9,0x66,0xAD,0xA3,0x63,0x55,0x0D,0x17,0x42,0x73,0xF6,0x5D,0x04,0xE2,
+    0xD6,0xE7,0x4A,0xC4,0xAD,0x05,0x22,0xF1,0xF3,0x6C,0x35,0x55,0xBC,0xA8,0x56,0x0A,
+    0xC6,0xDF,0x6D,0x6A,0x63,0x55,0xF4,0x2C,0x1E,0xBD,0xCB,0x62,0x92,0x40,0x56,0xCD,
+    0x19,0xAD,0x8A,0x9E,0xC4,0xE0,0x86,0x3C,0xC5,0x67,0x88,0x71,0x3C,0xCB,0xA7,0x8D,
+    0xFC,0xA1,0xD1,0x1D,0x79,0x47,0x97,0x86,0x30,0x4D,0xEC,0xEB,0x4D,0x2E,0x11,0xEE,
+    0x55,0xC2,0x12,0x21,0x5F,0x9D,0x31,0xBC,0x31,0xBC,0x25,0xB2,0xD6,0xCB,0x86,0x6D,
+    0xA0,0xC6,0xDE,0xAB,0x5A,0x90,0xB3,0x79,0xD5,0x80,0xAE,0x3A,0xD1,0x53,0x25,0xD7,
+    0x94,0x25,0xB1,0x84,0x0D,0x27,0x68,0x08,0x91,0xCE,0x51,0x22,0x67,0x31,0xF7,0xDD,
+    0xC5,0xE9,0xB1,0x32,0xE3,0xFD,0x24,0x5A,0x5A,0x66,0x23,0xE8,0x26,0xC2,0x37,0xB5,
+    0x10,0x8E,0x8E,0x40,0x8F,0x54,0x01,0x19,0x5D,0xF2,0xAA,0x99,0xB1,0x18,0xB5,0x50,
+    0x8C,0x63,0xDF,0x39,0xA2,0x23,0x94,0xAA,0xD0,0xD6,0xCE,0xCE,0x0A,0xC5,0x8E,0x57,
+    0xB3,0x3F,0xCC,0xFE,0x54,0x01,0x22,0xCD,0xDE,0x2D,0xEC,0x8F,0x59,0xA8,0xDE,0xBB,
+    0x45,0xFD,0xB1,0x5B,0x37,0xCB,0xBA,0x63,0x8E,0xB5,0xBB,0x5A,0x77,0xCC,0x42,0xA2,
+    0x73,0x96,0xEE,0x2C,0x58,0x10,0x55,0x7F,0x82,0x5B,0xEB,0x56,0x83,0xF5,0xBB,0x77,
+    0xED,0xD6,0x32,0x3C,0x59,0x35,0x15,0xE6,0x99,0x81,0x73,0x74,0xDC,0xAF,0x6B,0x30,
+    0x0B,0xD4,0x96,0x1A,0x1C,0xDD,0xD0,0x70,0xBB,0xAE,0x92,0xCE,0xCF,0x0E,0x45,0x53,
+    0x4F,0x6A,0x7B,0xE8,0x95,0xEA,0x22,0x6F,0x67,0xB0,0x5D,0xE9,0x2D,0x4E,0xEC,0xD1,
+    0xFD,0x90,0xD8,0x69,0xBE,0x2E,0x41,0xA4,0x3F,0xA3,0x7B,0x17,0xE4,0xD7,0xC3,0x81,
+    0xA8,0x74,0x43,0x35,0x2B,0xCA,0x40,0xCE,0xA6,0xE9,0xBC,0x37,0x63,0xF7,0xCC,0xD3,
+    0xB8,0xD6,0x88,0x6D,0x71,0x1A,0xD7,0x54,0xDE,0xEA,0x41,0xA8,0x5A,0x81,0x7A,0x1C,
+    0x6A,0x3D,0x12,0x55,0x07,0x9D,0xD4,0x41,0x87,0x0B,0x41,0x87,0xC6,0xA9,0x1F,0x9A,
+    0x45,0x7E,0x10,0xE2,0x88,0xB5,0x5B,0x85,0xEF,0x07,0x94,0xA9,0x93,0x8F,0x22,0x96,
+    0x8A,0x6C,0x24,0xC9,0xD8,0xF7,0x3D,0x04,0x05,0x53,0x23,0xAB,0xA8,0x72,0x44,0xEA,
+    0xAD,0xEF,0xC6,0xDD,0x6E,0x8B,0xA8,0x77,0xB7,0xB3,0xBB,0xBB,0x4B,0x29,0x63,0x4E,
+    0xD9,0xDE,0xEE,0x6C,0x6F,0x6F,0x63,0x4A,0x57,0xA4,0xEC,0x74,0xF9,0x6B,0x4C,0x5F,
+    0xBB,0xAA,0x44,0xB7,0xCB,0x29,0x4F,0x54,0x89,0xB1,0x48,0x21,0x9E,0x10,0x8D,0x1C,
+    0xAF,0x62,0x06,0x13,0x15,0x66,0x87,0x41,0x69,0x0D,0xCC,0xAC,0x45,0x43,0xD6,0x6E,
+    0x15,0xA8,0xDF,0x57,0x48,0xC7,0x2B,0xE8,0x6E,0x05,0x4B,0x48,0x9F,0xB8,0x20,0x67,
+    0x9E,0x24,0x5F,0xD0,0xD8,0x66,0x77,0xF5,0xE6,0x0C,0x09,0x23,0x37,0x3E,0x69,0xA8,
+    0x62,0xB3,0xA5,0xFA,0x16,0x9B,0x2D,0x55,0x82,0xDC,0xFC,0xAC,0xC4,0x8C,0xAC,0x40,
+    0x0C,0x40,0xAB,0x42,0xA6,0x68,0x95,0xC8,0x24,0x55,0xCD,0xF1,0xDD,0x1C,0x0C,0xD5,
+    0x56,0xEE,0x67,0x61,0x89,0x6E,0xBE,0xA8,0xE1,0x69,0x93,0xF6,0x4A,0x96,0x63,0x09,
+    0x09,0xAB,0xDB,0x6A,0x8E,0xB9,0xDA,0x2D,0xAE,0x6D,0x16,0xD7,0xF7,0x8A,0x8F,0x8F,
+    0x6B,0x8F,0x47,0xE0,0x40,0x3E,0x3C,0xFF,0x28,0x0D,0xCD,0x77,0x07,0xA4,0x2E,0xA1,
+    0x85,0xFB,0x47,0x70,0x1E,0xF0,0x93,0x13,0xAD,0x02,0xAF,0x30,0x9A,0x27,0x99,0x93,
+    0x91,0x90,0x04,0xE1,0x36,0xCA,0xA2,0x02,0xAF,0x78,0x07,0x01,0x3A,0x9A,0x87,0x91,
+    0xBA,0x12,0x5E,0x5E,0x8B,0xCE,0x57,0x6E,0x69,0xF7,0xC3,0xB3,0xFB,0x44,0xBB,0xF4,
+    0x7E,0x14,0x9D,0x77,0xCA,0x6C,0xE3,0x2C,0x98,0xE7,0xD9,0x10,0x37,0xB9,0xB2,0x64,
+    0xBC,0x11,0xB4,0xD3,0x28,0x28,0xDB,0x65,0x1E,0x87,0xA7,0xED,0x32,0x6B,0x87,0x7C,
+    0x6A,0xB1,0xCD,0xCD,0xB7,0xB3,0x71,0x5B,0x56,0xD9,0x16,0x0D,0xB5,0x37,0x37,0x37,
+    0xD5,0xD5,0xF1,0x7C,0xD1,0x92,0xD2,0x7F,0xE0,0xD3,0x0D,0x7C,0x27,0xAD,0xDD,0x74,
+    0xEA,0x06,0xCE,0x5F,0x9C,0x14,0x29,0xC9,0xC3,0x1F,0xA4,0xA5,0xD1,0x88,0x47,0xB1,
+    0xB8,0x2F,0x4C,0xDE,0x35,0x3C,0x43,0x5D,0xAE,0x70,0x5C,0xF6,0xAA,0xE0,0xE9,0x4D,
+    0xF4,0x81,0x75,0xBD,0x35,0xD9,0x20,0x96,0xD0,0x5B,0xC4,0x6F,0x57,0xF7,0xC1,0xE8,
+    0x2E,0xB4,0xE2,0x5F,0x39,0x64,0x02,0x7E,0x2F,0xA1,0xED,0x2B,0xF4,0x4D,0xF0,0x95,
+    0xAA,0xE6,0xEE,0x98,0xA9,0xF3,0x5D,0x4C,0xA3,0x28,0x31,0x54,0x3E,0xBC,0x6A,0x3F,
+    0x4F,0x83,0xC4,0x76,0xBF,0x2B,0x28,0x7C,0xAF,0x2A,0x35,0xD8,0xDC,0xF2,0x92,0x76,
+    0x62,0xB5,0xAF,0x25,0x76,0x06,0xCC,0x1D,0x8F,0xB6,0x65,0xC7,0x43,0x25,0x6A,0x9B,
+    0x08,0x0D,0xDD,0xF6,0x3D,0xD5,0x5F,0xD0,0x1B,0x27,0xA8,0xC3,0x13,0xEE,0x24,0xEA,
+    0x12,0xBC,0x2D,0x1A,0xEF,0x63,0x8B,0x47,0x7C,0x1A,0x96,0xC6,0xB5,0xE2,0x88,0x85,
+    0x3B,0xCD,0x74,0x9A,0x59,0xAF,0xB7,0x2D,0xC8,0x17,0x76,0x40,0xCD,0xFC,0x8A,0xF5,
+    0x2C,0x73,0x8B,0x11,0x40,0xDD,0x2B,0x56,0x4B,0x6C,0xD8,0x97,0xE1,0xA5,0xB0,0xE0,
+    0x6A,0x80,0x9D,0xF0,0x52,0xDF,0x96,0x59,0x04,0x74,0xA5,0xD9,0x76,0xB9,0xB9,0xCB,
+    0x58,0x19,0x51,0xF2,0xE9,0x3D,0xA4,0xA5,0x10,0x75,0x0B,0xE8,0x7D,0x88,0x5E,0x42,
+    0x18,0xC2,0x33,0x27,0xBF,0xC5,0xAA,0x60,0xBC,0xD3,0xED,0x76,0x60,0xE9,0x47,0x48,
+    0x2D,0x72,0x43,0x75,0x75,0xA4,0x37,0xEC,0x08,0x3B,0x5E,0x34,0x8C,0xDE,0x36,0x1A,
+    0x29,0x14,0xC5,0x06,0x8E,0x65,0x7B,0x55,0x6E,0x0B,0xE5,0x36,0x72,0x93,0x40,0xB8,
+    0x11,0xA6,0x14,0x13,0xDC,0xFE,0xCA,0x97,0x9A,0x5A,0x1F,0x40,0x9F,0x2A,0x68,0x8F,
+    0x12,0xAF,0x69,0x48,0x27,0x09,0xFC,0x08,0x43,0xA8,0x56,0xDC,0xE4,0x4C,0xE3,0x7E,
+    0xCE,0xE9,0xC0,0xDD,0x17,0x3C,0x4A,0x61,0x58,0xDF,0x89,0x3C,0xB9,0x72,0x79,0xF1,
+    0x38,0x7D,0x59,0x30,0x59,0xCA,0xFE,0xFC,0xAA,0x1A,0x96,0x24,0x4A,0x45,0x7C,0x28,
+    0x8F,0xB7,0x4C,0xE8,0x98,0xD5,0xFA,0xA8,0x50,0xAC,0x92,0xFA,0x26,0x98,0xE6,0x14,
+    0xD0,0x41,0x55,0x32,0x89,0x39,0x6E,0x22,0x1A,0xF1,0x3B,0x18,0x49,0x16,0x9E,0xE2,
+    0x01,0xF3,0x48,0xB3,0xBE,0xF9,0xA6,0x8B,0xFB,0xF7,0x1B,0x95,0xD2,0x86,0xAA,0x2C,
+    0x81,0x6E,0x57,0x31,0xEE,0x81,0xDE,0xCB,0x87,0x9C,0xD8,0x97,0x8E,0x52,0x01,0x8E,
+    0xF5,0x22,0x6E,0x48,0xB2,0x00,0xFE,0xF9,0x0C,0x86,0x0A,0xC1,0x59,0xBD,0xA9,0xED,
+    0xDD,0xAE,0x9C,0x08,0x5B,0x83,0xC6,0xF0,0x82,0xB4,0x8C,0x55,0x2D,0x82,0x6C,0x54,
+    0x93,0xCB,0xC7,0x69,0x14,0x5D,0x3C,0xD6,0xCD,0x27,0xD8,0x1B,0xBD,0x03,0x46,0x41,
+    0xFB,0xA8,0x6F,0x1D,0xF9,0x4A,0x8D,0x57,0xCD,0xEA,0x9C,0x46,0xAB,0x1E,0x13,0x93,
+    0x8C,0x43,0xFA,0x66,0xBE,0xC0,0x45,0xDC,0xB0,0xC4,0x23,0x41,0x94,0xBF,0xA2,0x27,
+    0xB0,0xE1,0x96,0x58,0x26,0xC0,0xB7,0xBE,0x4C,0x82,0x6F,0xAD,0x24,0xC2,0xB7,0x4C,
+    0x19,0x6E,0xBA,0x04,0xAD,0xCB,0x6F,0xDD,0x31,0x26,0x39,0xD9,0x45,0xC2,0x79,0xB8,
+    0x4C,0x22,0xB0,0xE2,0x48,0x0B,0xAA,0x87,0x61,0xBF,0x2E,0xEA,0x69,0x1B,0x5A,0x70,
+    0x59,0x55,0xE9,0x0B,0xD6,0x43,0xB4,0x0B,0xD5,0xEA,0xAE,0xB5,0xEA,0x9A,0xB4,0xE5,
+    0x12,0xA2,0xCE,0x78,0xCE,0x1E,0xBA,0xDA,0x7A,0xCE,0x66,0x7F,0x81,0xEF,0x2C,0xBC,
+    0x54,0xEE,0x36,0xEA,0xC5,0x03,0x56,0x76,0xC2,0xAC,0x70,0xB5,0x01,0x63,0xFF,0x55,
+    0xD3,0x9A,0x2F,0x2D,0xBC,0xB2,0x96,0x2E,0xD4,0x3E,0x49,0xB3,0xF4,0x4A,0xBE,0x35,
+    0x49,0xD6,0x4C,0xA0,0xAB,0xEF,0xE6,0x2D,0xD4,0x3E,0xBE,0xD5,0x66,0x1E,0x4D,0xFB,
+    0xEA,0x7B,0x79,0x35,0x72,0xDC,0xFE,0x32,0x9A,0xDF,0x5E,0x89,0xE6,0xB7,0x3F,0x93,
+    0xE6,0xB1,0x51,0xD6,0x5F,0xF8,0x1B,0xAB,0x67,0x3D,0x86,0x1F,0xB9,0x51,0xF1,0x43,
+    0x38,0x61,0x78,0x33,0xE2,0xF0,0x4A,0x3E,0x5E,0x20,0x6E,0x9E,0x11,0x42,0x0F,0x6F,
+    0xA4,0x05,0xE5,0x00,0x18,0x45,0xEB,0x05,0x5F,0xEB,0xB2,0x98,0x7B,0x88,0x8E,0x02,
+    0xD0,0xE7,0xB7,0xDC,0xF6,0x95,0xEF,0xB4,0x2F,0x89,0x85,0x70,0xED,0xD8,0x40,0x83,
+    0xC7,0xE3,0x7B,0x5D,0x7E,0x8C,0xE9,0xC9,0x27,0xA1,0x36,0x81,0xA1,0xA3,0x6C,0x00,
+    0x7E,0x5E,0x6C,0xB1,0x0E,0xC5,0x37,0xF7,0xC7,0x74,0xC5,0x1C,0xBD,0x92,0x81,0xF7,
+    0x4D,0x4F,0xB3,0x0B,0x71,0xCF,0xB0,0xBA,0xFE,0x2D,0x89,0xCE,0xA1,0x80,0x9D,0x5F,
+    0xD5,0x9E,0x60,0x65,0x37,0x98,0x9B,0x82,0x56,0xA6,0x03,0xF5,0x49,0xDB,0x14,0x9C,
+    0xE2,0xF9,0xC2,0x35,0x65,0x59,0xAE,0xB4,0x5D,0x88,0xCD,0x7B,0x2B,0xF1,0xD1,0x92,
+    0xF0,0xBC,0x61,0x76,0x69,0x65,0x21,0x48,0x5F,0xA6,0x49,0xFE,0x90,0x5D,0x2E,0xD3,
+    0x23,0x97,0xC6,0xDF,0x41,0xD5,0xAF,0xE4,0x9E,0x8D,0x54,0x11,0x45,0xCA,0x1D,0x22,
+    0xE5,0x6E,0x8D,0xBA,0x5B,0xA6,0xB8,0x1A,0x3D,0x92,0xB1,0x45,0x55,0xBF,0xAA,0xF8,
+    0xB5,0x2A,0xAD,0x56,0x48,0xEA,0xB9,0x55,0x8C,0x99,0xDE,0xF6,0x9D,0xA4,0x1B,0xA2,
+    0x7A,0x75,0xD9,0x66,0x4E,0xCC,0x37,0x97,0x6C,0x30,0xD1,0xAB,0xCB,0x35,0x83,0x2A,
+    0x58,0xAC,0xD8,0x08,0xC5,0xBE,0xD1,0x67,0x40,0x2E,0xDD,0xE4,0x33,0x21,0xEB,0x1B,
+    0x7C,0xB9,0x24,0x89,0x26,0x68,0x2E,0x08,0xA3,0xC6,0xC7,0x72,0x4F,0x2F,0xD7,0xE8,
+    0xA6,0x26,0x23,0xF1,0x01,0x25,0x19,0x0D,0x97,0x6B,0x11,0x8B,0x16,0xD0,0x7F,0xE0,
+    0x12,0xCE,0xDD,0xB5,0xC3,0x8A,0x4D,0x5E,0xAC,0xD2,0xAD,0x85,0x26,0x78,0x26,0xAB,
+    0xFF,0x26,0x83,0x9D,0x6A,0x45,0xB1,0x09,0xF7,0x6A,0x69,0xD1,0x7F,0xE8,0x45,0x6B,
+    0x4C,0x20,0x05,0xCC,0x82,0x68,0xA0,0xDF,0x44,0x38,0x90,0x44,0xE9,0xF9,0x02,0xF0,
+    0x4D,0xBA,0xCA,0x53,0x76,0x49,0x14,0xBA,0x33,0xE5,0x7F,0x9E,0xCA,0x6A,0xE7,0x82,
+    0x25,0x0A,0x2B,0x10,0xC2,0x1D,0x36,0xAE,0x0D,0xB2,0xD9,0xFA,0x22,0x4A,0xDE,0x5A,
+    0x9D,0x94,0xB7,0xEE,0x40,0xCB,0x5B,0x16,0x62,0x5E,0xB4,0xFD,0xF7,0x6F,0xA7,0xF2,
+    0xA6,0x7E,0x69,0x6E,0x21,0x2F,0xD4,0x70,0x7F,0xD3,0x94,0x4A,0xB3,0x88,0x6B,0xB4,
+    0xDD,0xD6,0xAF,0x16,0x36,0xAB,0xF8,0x87,0xF7,0xF9,0xDB,0xB6,0xAB,0x2D,0x86,0xAB,
+    0x51,0x9B,0xDC,0xAD,0x2D,0x16,0xDB,0x45,0xA4,0xFC,0x88,0xF9,0x92,0xC7,0x02,0xA4,
+    0x9F,0x18,0xF4,0x12,0x4D,0xFD,0x90,0xBD,0x25,0x10,0xB9,0xC1,0x31,0x1E,0xDB,0x7C,
+    0xC8,0xF3,0x88,0x3C,0xC8,0x90,0xFA,0x17,0x7F,0xA7,0x4B,0xCE,0x62,0x1F,0xB5,0x9C,
+    0xEA,0x72,0x64,0x4B,0x65,0xB4,0x31,0xD8,0xF5,0xE9,0xFF,0x3C,0x7D,0x83,0x83,0x1C,
+    0xD5,0xEC,0x6E,0x96,0x4F,0xBE,0xFE,0x3D,0x8A,0x66,0xA8,0xB2,0x85,0xA7,0xA8,0x43,
+    0x4C,0xCB,0xB3,0xC4,0x79,0x86,0x0F,0xD2,0xFF,0x15,0x6C,0x61,0x7A,0x57,0x55,0x3C,
+    0xFE,0xCA,0xEF,0x74,0x1F,0x9E,0x4F,0x3E,0xE6,0x09,0x97,0x04,0xC4,0x88,0x57,0xD9,
+    0x8B,0x1F,0xAE,0x3E,0x04,0x93,0x37,0x01,0x3D,0x1E,0xCB,0x1E,0xC7,0x00,0x7A,0x78,
+    0x1E,0x39,0xAF,0x3E,0xFC,0xFC,0x7A,0x3F,0x4B,0x12,0x61,0x63,0xE0,0x8D,0x93,0xE1,
+    0x14,0x9F,0x16,0xBE,0x2A,0xE8,0x55,0xDD,0xAB,0x34,0xAC,0x1E,0x82,0x78,0xF1,0xF6,
+    0x67,0xE8,0x49,0x14,0xC9,0xB7,0x68,0x9D,0xB8,0x74,0xB2,0x34,0xB9,0xA2,0xAB,0xFB,
+    0xE4,0xED,0x88,0x18,0xE7,0x0E,0x8A,0x5D,0xC6,0x77,0xF2,0x21,0xE2,0x7F,0x78,0x7E,
+    0xF8,0xF2,0xE4,0xE5,0xEB,0x97,0x3F,0xBF,0x7C,0xF3,0xE1,0xD0,0x72,0xAA,0xE1,0x3D,
+    0x77,0x1D,0xBD,0x4D,0x87,0xBF,0xFC,0x04,0x3D,0x14,0x57,0xFA,0x39,0x1F,0xDF,0xBF,
+    0x66,0x38,0xA9,0x32,0xE6,0xD1,0xBF,0xE6,0x71,0xCE,0x6A,0xE3,0x45,0x96,0x9F,0x3A,
+    0x01,0x3F,0x97,0x87,0x1A,0xE4,0x61,0x30,0x0E,0xF2,0x98,0xFC,0x17,0xF1,0xDB,0x43,
+    0xE7,0x22,0x1A,0x9E,0xC7,0xD1,0x45,0x21,0x05,0x9E,0x22,0x40,0xA8,0xF4,0x90,0xAE,
+    0x8F,0xC8,0x41,0x49,0xCD,0xCB,0x20,0x46,0xB9,0x07,0xEA,0x1A,0x1D,0xF0,0xE0,0xE6,
+    0x0E,0xC6,0x18,0x7F,0x8C,0x4F,0xA3,0x91,0x9A,0x8A,0xFA,0x46,0xE0,0x84,0x09,0x16,
+    0x6F,0x93,0x33,0x16,0x5A,0x25,0x6D,0x3B,0x89,0x87,0x79,0x90,0x5F,0x09,0xAC,0xE1,
+    0x43,0x1A,0xA4,0xD6,0x4A,0x65,0x0F,0x91,0x2B,0x27,0xAB,0x0C,0x58,0x99,0x7A,0x20,
+    0x3B,0x7A,0x41,0xAF,0xBD,0x02,0xC2,0xE8,0x99,0x6B,0xD4,0xD6,0xE9,0x1D,0x75,0x42,
+    0x81,0xEC,0x6C,0x41,0x6C,0x10,0xE5,0x80,0x62,0x97,0x9D,0x93,0x57,0xF4,0xF8,0xAA,
+    0x42,0xD1,0x08,0xD5,0x7F,0x18,0x51,0xE1,0x71,0xDD,0x3F,0xE3,0x2D,0x94,0x71,0x3A,
+    0xCE,0x1C,0xF4,0x9B,0xA1,0x86,0x9E,0x67,0x50,0xFD,0x59,0x8F,0xB3,0xE5,0x36,0x02,
+    0xCC,0x6F,0x78,0x9A,0x81,0xCD,0x30,0x4E,0xB2,0x0B,0x7A,0x79,0xF7,0x5F,0xF3,0xA8,
+    0x20,0x0C,0x6C,0xE0,0xA5,0xB5,0x5B,0x4F,0xBA,0x3B,0x1B,0xC0,0xDD,0xF8,0x58,0x5E,
+    0x1B,0xF0,0xD7,0x2E,0xCE,0x27,0xED,0x71,0x9C,0x80,0x4A,0x4F,0x00,0x3B,0xDB,0x8F,
+    0xB6,0x1E,0x7F,0x27,0x7F,0x98,0x75,0x6B,0xCF,0xF9,0xFE,0x11,0x00,0xC5,0x15,0x1B,
+    0x71,0x9E,0x75,0xFE,0x80,0x3F,0x45,0x81,0x4F,0xE9,0x6E,0x3E,0xB9,0x1B,0xFC,0xA3,
+    0x9D,0x15,0xE1,0x67,0xA0,0x42,0x6E,0x3C,0x79,0x2A,0x65,0x06,0xC9,0x92,0x79,0x8E,
+    0xB7,0x71,0xDB,0xA9,0xCA,0x94,0x22,0x06,0xFF,0xB8,0x50,0x4E,0x7F,0xE6,0xFB,0x9E,
+    0x41,0xC2,0xE8,0x58,0x32,0x12,0xF0,0x62,0xF3,0x2C,0xA4,0xE7,0x9A,0x3B,0x36,0xA6,
+    0x73,0x5B,0x48,0x03,0x2D,0xF9,0x74,0xD9,0x61,0x1A,0x8F,0xC7,0xA4,0x77,0x02,0x89,
+    0xA5,0xA5,0xF6,0x46,0x1E,0x5F,0x6C,0x19,0x33,0xF5,0xB0,0x62,0x0A,0x44,0x3F,0x4F,
+    0x53,0xCC,0x67,0xBA,0xA9,0xD6,0x9F,0x79,0x40,0xCB,0x47,0x3A,0x82,0x29,0x4C,0x83,
+    0xF3,0x78,0x82,0x7B,0x4C,0x1D,0x2C,0xF5,0x7C,0xA2,0x82,0xDA,0x38,0x1E,0x4A,0x90,
+    0xDC,0xC0,0xD9,0xF8,0xA7,0xEB,0xEE,0xDD,0xA3,0x27,0x07,0xA2,0x6B,0x98,0xD8,0x3C,
+    0x8B,0x47,0x5E,0xC7,0x7B,0x50,0x10,0xC0,0x46,0xCC,0x0F,0x61,0xCD,0x03,0x4F,0x2F,
+    0x7D,0x40,0xB1,0x43,0x1B,0xF1,0xBB,0x69,0x96,0x46,0xD7,0xF1,0xBB,0x6C,0x04,0xFF,
+    0x04,0x23,0x2B,0x74,0x92,0x85,0xF2,0x8E,0x70,0xD1,0x35,0x99,0x62,0xC8,0x5B,0x57,
+    0xF5,0xE9,0xFA,0x9A,0x5B,0xF0,0xD0,0xA3,0x68,0x60,0x55,0xBC,0x0F,0xEE,0xFC,0x95,
+    0x9E,0x5D,0x90,0xD5,0xF0,0x4B,0x66,0x20,0xC5,0x51,0xEC,0x6E,0x6C,0xA0,0x0C,0x56,
+    0x59,0xD3,0xAC,0x28,0xF5,0xEF,0x19,0xA8,0x4E,0x29,0x0A,0x3D,0x2D,0xAD,0x88,0x82,
+    0x3C,0xC4,0x5D,0x3F,0x24,0x8D,0x1E,0xFE,0xBB,0x68,0xE5,0x22,0x95,0x48,0x3E,0xBE,
+    0x14,0xCA,0x4D,0x19,0xA9,0x38,0xF9,0x0E,0x0E,0x5E,0xCC,0x55,0x1E,0xB5,0x50,0xA2,
+    0x0A,0x51,0x43,0x09,0x24,0x88,0xE4,0x6B,0x8B,0xF4,0xD2,0xCF,0x28,0x82,0x1A,0xC8,
+    0x7F,0x29,0xDF,0xBF,0x01,0x82,0xED,0x70,0x93,0xFC,0x9F,0x61,0x19,0xD3,0xED,0xA8,
+    0xD9,0xD9,0x0C,0x70,0x8E,0x82,0x20,0x89,0x4F,0x23,0x69,0x41,0x56,0x6E,0x77,0x29,
+    0xAF,0xE7,0xB3,0x59,0x06,0xEB,0xF6,0xD9,0x3C,0x29,0x63,0x7C,0xB2,0x89,0x7B,0x52,
+    0xF0,0xA5,0xEE,0x94,0x1A,0xCA,0x3B,0x58,0x83,0x10,0x77,0x02,0x0D,0x2E,0x41,0xAD,
+    0x98,0x77,0x40,0x9A,0x66,0x0C,0x01,0x5C,0x29,0x80,0x2B,0x3B,0xC0,0xD4,0xD0,0xF5,
+    0x70,0x0D,0x0F,0xF2,0x3C,0xB8,0x42,0x41,0xF8,0x09,0xF1,0x76,0x03,0x43,0xC9,0xF2,
+    0x11,0x2F,0x55,0x51,0x00,0x5D,0xE6,0x12,0xF6,0xE5,0x9C,0x35,0xC7,0xE7,0x25,0x45,
+    0x85,0xE9,0x06,0x90,0x5F,0x6F,0x48,0x32,0xA9,0xF1,0xD0,0x7C,0x97,0x1F,0x9A,0xAF,
+    0x81,0xDA,0x9F,0x9B,0x27,0xEF,0xDE,0x6F,0x2A,0xE8,0x4E,0x41,0x1F,0xC5,0xC7,0x1D,
+    0xCD,0x0B,0x23,0x00,0xFF,0x61,0x07,0x64,0xF7,0x8C,0xF1,0xAC,0x42,0xE5,0xA9,0xA0,
+    0x0D,0xCC,0x11,0x9A,0x16,0xF0,0xCF,0x43,0xAC,0x03,0x7E,0xFD,0xC3,0x33,0x6E,0x6B,
+    0x27,0xF8,0x67,0x16,0xA3,0xDA,0x72,0x0D,0x51,0x5C,0x7F,0x45,0x4C,0xE7,0x2B,0x24,
+    0x29,0xA5,0x3C,0x54,0xEF,0x2F,0x15,0xC5,0x0F,0xB4,0x2B,0x74,0x58,0x5E,0x01,0x55,
+    0x58,0xB7,0x38,0x65,0x3B,0x40,0x5E,0x87,0xF1,0x9F,0x20,0x6F,0xF0,0x5C,0x23,0x15,
+    0x6A,0x43,0x52,0xCB,0x5F,0xD3,0x4F,0xE9,0xF5,0x9A,0x7B,0x4D,0xC8,0x8E,0xB3,0x4B,
+    0x07,0x84,0x68,0x3C,0xA2,0xC3,0x9C,0x3A,0x84,0x7C,0x43,0x5E,0xD3,0x13,0xF5,0xCE,
+    0xA9,0x48,0x3B,0x7C,0x3A,0xCF,0xD7,0x5C,0x9E,0xAC,0x2D,0xD6,0x7A,0x8A,0x40,0xD8,
+    0x5A,0x5B,0xAE,0x92,0xA4,0x88,0x55,0x2E,0x5A,0x75,0xE0,0x94,0xE3,0x64,0xCE,0x82,
+    0x99,0x5B,0x3D,0xAD,0x79,0x02,0xEB,0x80,0x39,0xFB,0xF8,0x4C,0x22,0xA6,0x1E,0x75,
+    0x8F,0xF5,0xD8,0x02,0x94,0x30,0x22,0x63,0xB3,0xFE,0x16,0x90,0x90,0x3E,0xD4,0x48,
+    0x46,0x31,0x02,0xE2,0xB8,0xEA,0x8D,0xD7,0xF9,0x03,0x68,0xD6,0x6D,0xF9,0x2D,0xAF,
+    0x3A,0xC6,0x5A,0x1F,0x2E,0x87,0x90,0x1A,0xA7,0x57,0x6F,0x7B,0x65,0x51,0xB6,0xCC,
+    0x07,0x5A,0xCD,0xAD,0x0B,0x2E,0x40,0xE8,0x5F,0x37,0x5E,0x1B,0x8D,0x45,0x90,0xC5,
+    0xBB,0x38,0x3C,0x8D,0x72,0x3E,0xC2,0x2A,0xCE,0xB3,0x56,0x27,0x59,0x85,0x87,0x66,
+    0x5B,0x46,0xA0,0x48,0xEF,0x8C,0x4A,0x20,0xC1,0xD1,0x13,0x0A,0xB0,0x96,0x04,0x56,
+    0xED,0x91,0xC0,0x98,0x70,0xCA,0xF4,0x9C,0x5D,0xFE,0xAE,0xC5,0xDA,0xE2,0x51,0x58,
+    0x74,0x4F,0x82,0x66,0x28,0x2A,0xD0,0xA8,0xC2,0xAC,0x59,0x23,0x28,0x15,0x82,0xA3,
+    0xF3,0x43,0xCF,0x79,0xC2,0x89,0x2C,0xC5,0x5E,0x19,0x59,0x48,0xFC,0x7A,0x11,0x58,
+    0xCB,0x9B,0x89,0xEF,0x90,0x2C,0x7B,0xBA,0xAD,0xD4,0xD5,0x8C,0xA0,0xEE,0x9A,0x76,
+    0xE6,0x98,0x24,0xEC,0x6B,0xA9,0xC7,0xF7,0x68,0x4F,0x41,0xCB,0x21,0xC7,0xA9,0x2A,
+    0x6E,0x6E,0x08,0xF4,0xEA,0x9B,0x51,0x7E,0xED,0x40,0xA7,0xDE,0x31,0x4E,0xFD,0x39,
+    0xC8,0x27,0x31,0x14,0xDC,0xDC,0x92,0xA8,0x10,0xAE,0x30,0x06,0x5D,0x93,0x77,0x3F,
+    0xE3,0xCC,0x1E,0xBE,0xDC,0x7F,0xFB,0xE6,0xC5,0xF3,0xF7,0xFF,0x38,0x79,0xF9,0x8B,
+    0x50,0x40,0x8E,0xD6,0xCF,0x32,0x58,0x37,0xF0,0x89,0xB4,0x75,0x58,0xCA,0x40,0x13,
+    0x84,0xAF,0x9F,0xF1,0xC1,0xB4,0x07,0x1B,0xC0,0x0E,0x65,0x36,0x0F,0xA7,0x2A,0xF3,
+    0x03,0x7E,0x55,0x99,0x54,0x72,0x3E,0xAB,0xCA,0x7D,0x9C,0x69,0xA5,0x40,0x2D,0xAD,
+    0x0A,0xBD,0x84,0x95,0xE7,0xC1,0x06,0x31,0x04,0x68,0x32,0x3F,0x60,0xD4,0x8F,0x5A,
+    0xA4,0xF0,0x78,0x47,0xC1,0x22,0x1E,0x48,0xCF,0xF9,0x78,0xA0,0xAD,0x5F,0x6B,0x95,
+    0xEB,0x57,0x5C,0xA3,0x46,0x8B,0xD9,0xBB,0x1C,0x16,0x83,0xB2,0x51,0x85,0xBA,0x78,
+    0x9D,0x2E,0x52,0x27,0xDD,0x38,0xE0,0x17,0x57,0xA8,0xAB,0x1B,0xD4,0x2F,0xE1,0x51,
+    0x8B,0xCE,0x69,0x7D,0x04,0x3D,0x18,0x81,0x8B,0x08,0x94,0xB8,0x42,0x7F,0x6E,0x57,
+    0xD4,0xFC,0x6B,0x1E,0xCC,0x40,0x93,0x46,0x45,0xE6,0xC1,0xDF,0xAA,0x77,0x77,0x35,
+    0xD1,0xA0,0x40,0x2B,0xF9,0x60,0x3E,0x92,0x6B,0xD6,0x64,0x4A,0x51,0xFE,0x4F,0xC1,
+    0x74,0xD0,0x0A,0x12,0x97,0x53,0xEB,0xDE,0x7D,0x75,0xB3,0xF8,0x4F,0x51,0x8A,0x41,
+    0x41,0x11,0xBE,0x1B,0x0D,0xBA,0xB7,0x73,0xF0,0xA2,0x7A,0x22,0x51,0x56,0x62,0x96,
+    0x20,0xDC,0xE1,0x65,0xE6,0xC3,0x48,0xB9,0xCE,0x27,0x8D,0x5A,0x18,0xFD,0xCA,0x7E,
+    0x00,0x85,0xA3,0x0C,0xEB,0xB7,0x17,0xCC,0x63,0x0C,0xF8,0xE1,0xB3,0x35,0x39,0x30,
+    0x45,0x76,0xE6,0xD2,0xAB,0x1A,0x5E,0xF5,0x92,0xF1,0xF6,0xAE,0xD7,0x29,0xE6,0x43,
+    0x16,0x40,0xEE,0x8E,0xD7,0x78,0x70,0x02,0x05,0x56,0x35,0x5C,0xC7,0xB3,0x61,0xA8,
+    0x73,0xC2,0x2F,0xF1,0x9D,0x9C,0x40,0x73,0x2A,0x53,0x56,0x65,0x2B,0xA0,0x5E,0xA9,
+    0x85,0x02,0x6F,0xE9,0xF9,0x9C,0x0E,0xDF,0xF2,0xAF,0xB7,0x05,0x7A,0x62,0x85,0xE7,
+    0xAA,0x84,0xB7,0x52,0xC5,0x1D,0xFD,0x19,0xE5,0x81,0x0D,0x76,0xB5,0x6A,0x84,0xB1,
+    0x66,0xBC,0xC8,0x48,0x29,0x36,0xB2,0xA0,0xC7,0x22,0x90,0x4C,0x59,0x5E,0xE5,0xEA,
+    0x02,0x05,0xFA,0x7C,0x89,0x39,0x1D,0x7A,0x99,0x50,0x7B,0x04,0x51,0x0B,0x99,0xCD,
+    0xB2,0x92,0xA4,0x56,0xE3,0xCA,0x09,0x07,0xAC,0x3C,0xE2,0xD7,0x17,0xD9,0x05,0x48,
+    0x0E,0xBD,0x89,0x7A,0x6C,0xA9,0x16,0x43,0x76,0xAB,0x81,0xB6,0xB5,0xBB,0x52,0xE1,
+    0x19,0x31,0x25,0x1A,0x5E,0xF4,0x43,0x16,0xDF,0xDA,0xDC,0xDC,0xFE,0x8E,0x7E,0x03,
+    0x10,0xDA,0x41,0xED,0x1D,0xB0,0x12,0xBB,0x4F,0x1E,0xEF,0x3E,0x6E,0x74,0x9E,0xF8,
+    0xB8,0xE0,0x13,0xD2,0x8B,0x7A,0x7F,0x53,0xC7,0x47,0x5C,0xBC,0xFA,0xDC,0xE3,0x1D,
+    0x7A,0x24,0x33,0x4A,0x5B,0x2D,0x98,0x99,0x3F,0x07,0x6A,0x27,0x42,0x8F,0xD2,0x67,
+    0xD1,0xEC,0xF4,0x0C,0x60,0xDB,0x34,0xB1,0x7E,0x65,0x9B,0x27,0x61,0x6B,0xE3,0x52,
+    0x18,0x17,0x31,0x98,0xE4,0xAD,0xFA,0x0C,0x81,0x0E,0x38,0x83,0x51,0xF4,0xCC,0xF1,
+    0xED,0x39,0xAD,0x38,0x4D,0xE2,0x34,0x6A,0x0F,0x71,0x2D,0x69,0x39,0xA8,0x96,0xD1,
+    0xAF,0x45,0x28,0x82,0xC9,0x1A,0xC7,0x79,0xA1,0x0B,0xD5,0x62,0x9A,0xCD,0x93,0x11,
+    0xBA,0x1B,0xA6,0x01,0xF9,0x59,0xAE,0xC4,0xF8,0x6B,0xD7,0xF1,0xF3,0xF0,0xC8,0x52,
+    0x41,0xAB,0xCB,0x6B,0x0C,0xA3,0x1A,0xE3,0x51,0xBD,0x97,0x5C,0xE1,0xEB,0x68,0x5C,
+    0x52,0x1F,0xF9,0xF3,0x43,0x36,0x6B,0x1D,0x53,0xB4,0x77,0x1D,0x63,0x37,0xFA,0x85,
+    0x55,0xC2,0x26,0x9C,0xBA,0x23,0x9F,0x97,0x45,0x81,0xE8,0x70,0x1A,0x27,0x23,0xE0,
+    0x2B,0x57,0x8A,0x2D,0xBF,0x62,0x06,0x5F,0xEB,0x8C,0xA7,0x5D,0x5F,0xD4,0xAF,0x1E,
+    0x2D,0x37,0x9C,0x21,0x1A,0xAF,0xF5,0xD6,0x1A,0x64,0x7D,0x16,0x81,0x0A,0x71,0x46,
+    0x64,0xFD,0xB7,0x5F,0xA3,0xE1,0xFB,0x68,0x2C,0x3C,0x62,0x1B,0x20,0x1D,0xDB,0x5C,
+    0x96,0x08,0xB4,0x1D,0xB4,0xC3,0x3C,0x2B,0x8A,0x36,0xCC,0x55,0x89,0x6F,0xC6,0xB6,
+    0x71,0xE7,0x73,0x14,0xE4,0xA3,0x76,0x11,0xA7,0x61,0xD4,0xBE,0x02,0xFB,0xB2,0xBD,
+    0xD5,0xED,0x76,0xDB,0x3B,0xC3,0xF1,0xE6,0xE3,0xAD,0x27,0x8F,0xC7,0xA3,0xED,0x27,
+    0xDA,0x4B,0xEA,0xAF,0xFB,0x2F,0xDE,0xF3,0xB3,0x18,0x49,0x54,0xA2,0xAD,0x27,0x26,
+    0xC5,0x41,0x3F,0x53,0x22,0x43,0xD1,0x40,0x11,0x84,0xD6,0xF2,0x2B,0x12,0xE7,0xCA,
+    0xAC,0xE3,0xB5,0xCE,0x67,0xFB,0x8F,0x9F,0xB6,0x08,0xE8,0x35,0x2F,0xF9,0xC0,0xC2,
+    0x06,0x8A,0x11,0x74,0x16,0x4C,0xA3,0x24,0x59,0x49,0x90,0x69,0x78,0x31,0x9E,0x21,
+    0xD3,0x92,0xDD,0xA8,0x29,0xCE,0x70,0x00,0xDF,0x6F,0x0A,0x41,0x66,0x44,0xA7,0x13,
+    0x8B,0xE2,0xCA,0x5C,0x13,0x76,0x3C,0xA5,0x59,0x4A,0xBB,0x5A,0x8D,0xD5,0x90,0xBD,
+    0xC4,0x45,0x98,0x73,0x04,0xA9,0xD8,0x9C,0x10,0x7E,0x34,0xDB,0x8A,0x48,0x6F,0x49,
+    0xA2,0xF3,0xAF,0x90,0x0D,0xA0,0x8F,0xA5,0x43,0xCE,0x60,0xDE,0x7D,0xDD,0x27,0x87,
+    0xDD,0x7B,0x98,0x47,0xB7,0xBE,0xFA,0xBE,0x43,0x6F,0x50,0x58,0xAA,0x27,0xED,0x87,
+    0x79,0x76,0x81,0xDE,0x96,0xA0,0x8A,0x95,0x10,0xE1,0x46,0xD0,0x6D,0x42,0xBA,0xD0,
+    0x9B,0x1B,0x35,0xBD,0x88,0x4A,0xAC,0x48,0xB8,0x6C,0x08,0x94,0x8C,0x6C,0x87,0x55,
+    0x14,0x4E,0xC0,0x2D,0x7A,0xF4,0xEC,0xE0,0xC4,0xD0,0x5D,0x1F,0xF4,0x4E,0x06,0x16,
+    0xF8,0x1F,0xD6,0xB0,0x8A,0xFF,0x11,0x8E,0xBE,0xF2,0xCA,0xAC,0xFE,0x80,0xA0,0xEB,
+    0x15,0xFA,0xE4,0x64,0xC4,0xF2,0xCC,0xE9,0x9A,0x3A,0x54,0xC3,0xD0,0x4C,0x9C,0x46,
+    0x8B,0x3A,0xA2,0x21,0x60,0x55,0x58,0x03,0xF9,0x85,0x8E,0x0F,0x9C,0x04,0x86,0x0F,
+    0x70,0x6C,0x54,0x97,0x67,0x74,0xD2,0x03,0x8B,0x77,0xD8,0xF3,0xF9,0x1B,0x39,0xE6,
+    0x11,0xE1,0x60,0x49,0x8F,0xCB,0x3A,0xF8,0x55,0x0D,0xFC,0x1F,0x15,0x38,0x98,0x61,
+    0xC6,0xBD,0x4E,0xE2,0x1C,0x14,0xF4,0xC9,0x38,0xFD,0x64,0xBC,0x27,0xC9,0x3A,0xE9,
+    0x08,0xD6,0xB5,0x4A,0x2B,0xC5,0x55,0x0E,0x94,0xCF,0x9E,0x15,0xBE,0x5A,0x4A,0x2A,
+    0x65,0x55,0x9C,0x64,0x6B,0x94,0x50,0x22,0x3B,0x2A,0x70,0xF6,0x07,0x06,0xBD,0xBA,
+    0xEC,0x68,0xE8,0x62,0x2D,0xB2,0x02,0x63,0xD6,0x75,0x89,0x29,0x6A,0xB8,0x07,0xEB,
+    0x06,0xBD,0xD4,0xD2,0x1C,0x8D,0xFC,0xAF,0xAE,0xB2,0x77,0x80,0xB1,0x5F,0x06,0xE1,
+    0x54,0x53,0x40,0x69,0x6E,0x17,0xD7,0x40,0x8B,0x84,0x74,0x33,0x82,0xC5,0x45,0xCC,
+    0xF9,0x3A,0x2E,0x4A,0x54,0x02,0x5D,0x41,0x18,0xCC,0x97,0x3E,0x58,0x8C,0xF4,0x16,
+    0xD1,0x79,0x24,0x9E,0x90,0x31,0x82,0xE3,0xCD,0xFF,0xEC,0x39,0x37,0x96,0x34,0xE3,
+    0xC9,0x4E,0xCB,0x74,0x59,0x8D,0x8F,0x25,0xD3,0x65,0xB5,0x47,0x6C,0x93,0x65,0x99,
+    0x9F,0x4D,0x6E,0x87,0x8A,0x58,0x07,0x70,0x5B,0x67,0x1B,0xF6,0xCE,0x92,0x8E,0x5A,
+    0x4C,0xA0,0x15,0xBB,0xB9,0x85,0xC5,0xB8,0x84,0xB5,0x97,0x5F,0x4E,0x16,0x8A,0x24,
+    0xF8,0x7D,0xEC,0xAF,0x41,0x15,0x37,0xAB,0x21,0xF4,0x66,0xAD,0xFE,0x26,0x91,0x7E,
+    0xA5,0x56,0x53,0xAB,0xBE,0x71,0xCF,0xC4,0xA5,0x17,0xBA,0x5D,0xC5,0xF8,0xAA,0xAB,
+    0xCD,0x7C,0x56,0xCC,0x08,0x36,0xC9,0x75,0x0F,0x1B,0x7A,0x6F,0x65,0x86,0xF0,0xE1,
+    0xAA,0xF7,0x98,0x2E,0x6B,0xBB,0xAE,0x22,0xF9,0xAA,0x91,0x5C,0x29,0x1E,0xEB,0xC5,
+    0xF9,0x64,0x1D,0xF1,0x43,0xF6,0x27,0xFA,0xEC,0x7B,0x8E,0xBB,0xAE,0x7A,0x57,0xF5,
+    0xB3,0xDD,0x46,0xA7,0x8F,0xAE,0x29,0x79,0xCA,0x15,0x24,0x53,0x8B,0xE7,0xE4,0x9C,
+    0x40,0xAD,0x48,0x2B,0x27,0x93,0x49,0x3D,0x6A,0x79,0x1E,0x3A,0xB7,0xAE,0xD0,0x81,
+    0x50,0x9F,0xD8,0x56,0xFB,0x22,0x1A,0x9E,0xC6,0x65,0xBB,0x0C,0x66,0xED,0x69,0x3C,
+    0x99,0xD2,0x56,0x62,0x9B,0x9C,0x2E,0xAD,0x9E,0xDA,0x3C,0x74,0xC4,0xFF,0x7B,0xFD,
+    0x86,0x2A,0x49,0x01,0x5E,0xA8,0x9C,0xE0,0x20,0x54,0xB4,0x17,0xB9,0xC9,0x5C,0xE5,
+    0x7F,0xE2,0xCE,0x5E,0x7A,0x5E,0xE5,0x30,0xAB,0x67,0x5E,0x79,0xC2,0x8B,0xD5,0x38,
+    0x00,0x77,0x11,0x27,0x09,0xBF,0xC0,0x04,0x1D,0x52,0xCD,0x35,0x3B,0x92,0xCD,0x7A,
+    0x95,0xC7,0xAB,0xCD,0xD8,0x6F,0x54,0x86,0xCB,0xC9,0x0A,0x60,0xC2,0x53,0xA5,0xE0,
+    0xAA,0x5D,0xF0,0x06,0xA8,0x74,0x62,0xAD,0x02,0x2B,0x95,0x0D,0x74,0xD9,0x0C,0x8B,
+    0x2C,0x99,0x97,0x4D,0xDD,0xDC,0xA2,0xBE,0xEB,0x7C,0x50,0x5D,0x52,0x87,0xFF,0x21,
+    0x69,0x82,0x8D,0x8A,0x54,0x05,0xA2,0x05,0x50,0x2B,0x2C,0x59,0xE4,0xBC,0x49,0xEA,
+    0x7E,0x72,0x2E,0x41,0x9F,0x3F,0x7D,0x05,0x2A,0x48,0xCF,0xB6,0xEB,0x74,0x23,0xB5,
+    0x5F,0xE6,0x08,0xCF,0xE8,0xF0,0x3D,0xAD,0x72,0xBE,0xA3,0x8B,0xA9,0x96,0x42,0x4A,
+    0x7D,0x8A,0xED,0x0F,0x41,0xEA,0xE0,0xAD,0xA9,0x7C,0xED,0x16,0x68,0x08,0x49,0xD2,
+    0x73,0xD6,0x53,0x60,0x46,0x9C,0x65,0xB0,0x7D,0xB3,0xD3,0xA8,0x4D,0xB8,0x5C,0xEF,
+    0xE1,0xDB,0xA9,0x9C,0x02,0x20,0xB8,0xF9,0xBC,0x0E,0xBC,0xFF,0x45,0x0D,0xE2,0x33,
+    0x96,0xB2,0x51,0x1E,0x06,0xFE,0xBE,0xA5,0xE1,0xF1,0x78,0x4C,0x0D,0x7B,0x2A,0xEE,
+    0x5A,0xF1,0x4D,0x47,0xA8,0x68,0x75,0x03,0x98,0x5B,0x68,0xE1,0xB0,0xD4,0x6C,0xD5,
+    0x7D,0x79,0x2A,0x76,0x4C,0x79,0x0D,0x69,0x72,0x74,0xD7,0x9B,0xC3,0x9D,0x04,0x26,
+    0xE4,0xD2,0x54,0x8E,0xCF,0x79,0x35,0x04,0x15,0x9F,0x0A,0xB7,0x09,0x2A,0x76,0x46,
+    0x1E,0x90,0xDD,0x24,0x85,0x92,0x96,0xD6,0x6F,0x80,0xF2,0x83,0x78,0x03,0xC7,0xD5,
+    0x4B,0xDE,0x33,0x9E,0x35,0x00,0x9C,0xEB,0x99,0x72,0x73,0x80,0x5D,0xAF,0x62,0x2F,
+    0xC3,0x53,0x76,0x2A,0x27,0x1F,0x69,0x25,0x8E,0x95,0xB9,0x1A,0xCA,0xDB,0x0D,0x2B,
+    0xB5,0x67,0xBC,0xF4,0x62,0x08,0x1D,0x56,0xC6,0xD9,0x40,0x19,0x0E,0xAC,0x31,0x5E,
+    0x53,0x97,0xA1,0x35,0x98,0xCB,0x1F,0x7D,0x9B,0xFC,0xC6,0xEC,0xA6,0x40,0xD6,0x2F,
+    0x26,0xB8,0xE5,0xB6,0x0B,0x0D,0x6B,0x46,0xEF,0xD4,0xA6,0xFE,0x60,0xF1,0xB1,0x7D,
+    0x5B,0xD9,0x9A,0x99,0xC3,0x81,0x76,0xBC,0x60,0x37,0x75,0x52,0xFD,0xE9,0xC6,0x55,
+    0x2E,0x12,0xD2,0x97,0x48,0x19,0x4C,0x89,0xE1,0x57,0x1D,0x52,0x0F,0xC4,0xDA,0x30,
+    0x20,0x6F,0xB2,0x71,0x3D,0x69,0xD5,0xCF,0xA3,0xFA,0x15,0x01,0xC7,0xF5,0xBB,0x2C,
+    0xAB,0xBA,0x85,0x41,0x25,0xB6,0x4E,0xC4,0x0A,0x34,0xAA,0xBD,0x7E,0xA1,0x2F,0x75,
+    0x96,0xC5,0xB9,0x21,0xA2,0xA4,0x0C,0x42,0x56,0x17,0x0D,0xF4,0x74,0x5C,0x01,0xB3,
+    0xFA,0x15,0x12,0xDD,0x25,0x96,0x79,0xB5,0x75,0x81,0x12,0x64,0x14,0x9F,0xAF,0xDB,
+    0x1A,0xD3,0xCA,0x1A,0x4B,0xF0,0xBA,0x62,0xBB,0x75,0xB5,0x5C,0x36,0x4B,0x7F,0xD2,
+    0x44,0x78,0x1E,0x25,0x74,0xD2,0xB1,0x75,0xDB,0xEA,0x41,0xDF,0xB7,0x2F,0x1C,0x9C,
+    0xD0,0x80,0xE3,0x7D,0x0A,0xB9,0xF1,0x50,0x5B,0x66,0x3C,0x8B,0xF3,0x8D,0xEC,0xBF,
+    0x08,0x43,0x57,0x86,0x13,0x76,0x68,0x83,0x61,0x59,0x20,0xE9,0x9A,0x6F,0x85,0x88,
+    0xEA,0xC1,0x94,0x9F,0x50,0x68,0x0B,0xE0,0x20,0xCC,0xD2,0x38,0xAC,0x36,0xBB,0xBE,
+    0x0B,0xC3,0xD0,0xD9,0xDA,0xF9,0x8B,0xEF,0xA0,0xDC,0x04,0x69,0xB5,0xD3,0xC5,0xDF,
+    0x98,0xDA,0x75,0x1E,0x57,0xE9,0xDE,0xBA,0xBF,0xB0,0x56,0xDE,0x81,0x68,0x3D,0x99,
+    0x5D,0x3A,0xF0,0xBF,0xD6,0x8D,0xBF,0xD0,0xCF,0xE3,0xE1,0x54,0xEB,0x47,0x73,0xE5,
+    0x24,0x2E,0x98,0x27,0xC9,0x7D,0xAB,0xCE,0xD7,0xC2,0x25,0x57,0xA9,0x0F,0x5D,0x5B,
+    0x0E,0xAB,0x0C,0xD6,0x2C,0x31,0xD1,0xEB,0x18,0x91,0xB5,0x6E,0x03,0x90,0x73,0xBC,
+    0x18,0xE2,0x6E,0xB3,0x5B,0x9F,0x30,0x7D,0x43,0xB3,0x85,0xAE,0x3B,0xBC,0x1D,0x76,
+    0x45,0x37,0x25,0xEA,0x8C,0xF8,0xB2,0x6C,0x36,0x23,0x35,0x11,0x09,0x05,0x3B,0x0B,
+    0xE5,0xE5,0xFC,0x7B,0x37,0xB6,0xF6,0xED,0x3B,0xBC,0xCD,0xC9,0x53,0xEB,0x2A,0x4E,
+    0xA0,0xD4,0x48,0xC5,0xCE,0x16,0x87,0x28,0xF4,0x74,0x41,0xD4,0x11,0x51,0x0B,0x6A,
+    0xC3,0xD7,0xB8,0xD2,0x93,0x17,0x53,0x3D,0x03,0xF4,0x18,0x5F,0xAE,0xA8,0x7A,0xBA,
+    0xE0,0xED,0x4B,0xED,0x6A,0x98,0xCE,0xA5,0x5F,0x45,0x1D,0xE2,0xF7,0x15,0x69,0x00,
+    0x7D,0xFC,0x57,0xD3,0x02,0x98,0xAA,0xEA,0x5A,0x40,0x93,0xA6,0x6C,0xB7,0xF5,0x36,
+    0x6D,0x8D,0x1F,0xB2,0x4B,0xAB,0xA1,0x21,0x17,0x44,0x5B,0xCC,0xE9,0xBF,0x69,0x35,
+    0xE4,0x15,0x5C,0xA9,0x0F,0xFC,0xD9,0x00,0xE0,0xAD,0x5C,0x2D,0x4A,0x3F,0xD7,0x76,
+    0x54,0xFE,0x17,0xAA,0x22,0x55,0xA0,0xDB,0x60,0x51,0x1C,0xE7,0xA2,0xB5,0xBF,0x1E,
+    0x72,0x22,0x42,0x3B,0xEB,0x1B,0xFE,0x32,0x0C,0x54,0x2E,0x43,0xB7,0xC7,0x26,0xF7,
+    0x35,0xFB,0x77,0x89,0xA2,0x40,0xAB,0xF9,0x87,0x86,0xB6,0xC0,0x47,0x24,0x45,0x16,
+    0xF1,0xB7,0xE9,0x49,0x6A,0x98,0x7B,0x1C,0xA8,0x69,0x86,0xBC,0x78,0x2A,0x4C,0x13,
+    0x9D,0x7C,0xEC,0x90,0x97,0xDB,0x83,0x22,0xC8,0x48,0x78,0x1C,0xD9,0xC1,0xD7,0x9A,
+    0xC6,0x65,0xD1,0x72,0x62,0x30,0xF5,0xB3,0x9C,0x77,0x30,0x32,0xF9,0x06,0xF2,0x5A,
+    0xD3,0xEF,0xA5,0x6F,0x9E,0xEB,0xA7,0x91,0x56,0x8A,0xB8,0xE9,0x37,0xFB,0x2F,0x9E,
+    0x00,0x16,0x67,0x36,0xE3,0x52,0x85,0x42,0xF9,0x78,0x4F,0x37,0x7A,0x30,0x85,0xBB,
+    0x93,0x1B,0x56,0x99,0x43,0x00,0x1F,0x51,0x18,0xE4,0x7C,0x36,0x92,0x67,0x9A,0x54,
+    0x98,0x6F,0xCD,0xD5,0x66,0x74,0xFA,0x9E,0xD8,0xA8,0xB1,0xBB,0x45,0x34,0x56,0xE9,
+    0x40,0x07,0x9E,0x57,0x14,0x64,0xD4,0xD2,0x18,0xCA,0xCD,0x2D,0x43,0x1B,0xC5,0xBC,
+    0x89,0xD2,0x18,0xA1,0x16,0x64,0x9F,0x5C,0x99,0xA3,0xE4,0x87,0xC2,0x83,0xD2,0x88,
+    0x9B,0xD2,0xFE,0x6B,0x5C,0xF2,0x6E,0x1B,0xC4,0x72,0xCD,0xD1,0xA2,0x41,0x8A,0x77,
+    0xD6,0x6E,0x3D,0x50,0x62,0xAB,0xC6,0xD4,0x2B,0x15,0x2D,0x5B,0x94,0x4B,0x1B,0xDE,
+    0x6E,0x4C,0x07,0x36,0xBA,0xA4,0xD0,0x7F,0x3D,0xA6,0xB0,0x5D,0x0A,0x47,0x53,0xB1,
+    0x8D,0xE8,0x04,0x27,0x8F,0x2D,0xE4,0x8C,0xF2,0x60,0x32,0x89,0xD3,0xC9,0x5A,0x0D,
+    0x33,0x4D,0x76,0x32,0x1C,0x7F,0x4D,0xE7,0xF1,0x9D,0xB0,0xF6,0x85,0x18,0xAB,0x8D,
+    0x35,0x91,0x94,0x40,0x22,0x75,0xC6,0xA2,0x1A,0x07,0xCE,0xE4,0xD3,0xA3,0xB1,0x0A,
+    0xC1,0xD1,0x23,0xC4,0x64,0x62,0xAB,0xA4,0x17,0xA5,0x23,0xB1,0xB9,0xB3,0xF6,0x39,
+    0x13,0xF1,0xBF,0x5F,0xCB,0x07,0xA4,0x2F,0x55,0x19,0xBF,0xAE,0xFA,0x6E,0x33,0x18,
+    0xBE,0x8A,0x12,0xBC,0xE2,0x30,0x5A,0xA8,0x7A,0xB6,0x96,0x29,0xA7,0x8B,0x21,0x96,
+    0x2B,0xA7,0x77,0xD0,0x0E,0x6D,0x90,0x9F,0x6E,0x57,0x64,0x51,0x29,0x1D,0x66,0x65,
+    0x99,0x9D,0x69,0x5A,0x69,0x81,0xEF,0x0B,0x2D,0x70,0x50,0x3F,0x74,0x5A,0x7E,0xCB,
+    0x79,0xB8,0x20,0x77,0x71,0x23,0x75,0xCD,0x17,0x37,0xAA,0xBC,0x9B,0xFA,0x5C,0x88,
+    0x45,0x9F,0x83,0xD3,0x97,0xAC,0xFB,0xCC,0x94,0xB8,0x6E,0x68,0x4C,0x8F,0x4B,0xFD,
+    0x2D,0xFA,0x82,0xBB,0x50,0x69,0x26,0x0F,0xBA,0xD2,0x9A,0x43,0x5D,0x5F,0x66,0xEF,
+    0x94,0x3C,0x1A,0x24,0xDE,0xA3,0xF8,0x26,0x6A,0xB4,0x08,0x42,0xD5,0x5A,0x3F,0xAE,
+    0x6B,0xD6,0x36,0x10,0x52,0xB6,0xFB,0x5F,0xCB,0x3C,0xE0,0xE1,0x9A,0xC2,0xB4,0x39,
+    0xE8,0x66,0xC8,0x1E,0x06,0x7F,0x7F,0x23,0x84,0x34,0x7A,0xB9,0x08,0x2D,0x16,0xC0,
+    0x86,0x25,0x22,0xC2,0xC9,0x5E,0x7D,0x7C,0x79,0xF2,0xD3,0xFB,0xE7,0x2F,0x0E,0x5E,
+    0xBE,0xF9,0x70,0xB2,0xFF,0xFA,0xED,0xFE,0xDF,0x7F,0x3D,0x38,0x7C,0xE9,0xE0,0xC9,
+    0x7F,0xD3,0x44,0x87,0xA5,0x0E,0xDA,0x8A,0x30,0x82,0xCD,0x77,0x12,0x30,0x28,0x40,
+    0x8B,0xFD,0xD7,0x3C,0x00,0x85,0x27,0x41,0x44,0x9E,0x51,0xD8,0x3F,0x7C,0x02,0x9C,
+    0x47,0x91,0x29,0x8D,0xDA,0x9F,0xBF,0xF9,0x70,0x70,0x6B,0x0B,0xAA,0x1E,0xAE,0x96,
+    0x9B,0xE0,0xE6,0x64,0xE3,0xAA,0x05,0xDD,0x0A,0xD2,0x2E,0xF9,0x59,0x60,0x07,0xD9,
+    0x8F,0xC6,0xAF,0x6C,0x09,0xDD,0x6A,0xCB,0xDC,0xF2,0xD6,0xC7,0xE7,0x9A,0x3D,0xD2,
+    0x96,0x59,0x60,0x6C,0xF0,0x0A,0x5F,0x5B,0xF3,0xBF,0x8E,0x49,0x71,0xEB,0xFD,0x1C,
+    0xBA,0x51,0x41,0xC3,0x22,0x5F,0xBA,0x35,0x5E,0xE8,0x36,0xEF,0x48,0xD3,0x2B,0x62,
+    0xF1,0x86,0x2C,0x5C,0x68,0x16,0x2F,0x30,0xE6,0xC2,0xD2,0xDA,0x69,0x64,0x5B,0x03,
+    0xC3,0xEB,0x71,0x37,0xFF,0x1E,0x8B,0x49,0x99,0x1A,0x78,0x1A,0x82,0xC2,0x23,0x0A,
+    0xA0,0xFE,0x1C,0x28,0xBF,0x09,0x5B,0x64,0x18,0x2B,0x73,0x11,0xA4,0x14,0x40,0x0A,
+    0x4B,0x71,0x96,0x73,0x0C,0x54,0x9C,0x02,0x9E,0x83,0x04,0x4F,0x76,0x85,0xA7,0x85,
+    0x93,0xCD,0x4B,0x75,0xD3,0x16,0x4E,0x0F,0x1E,0x7E,0x72,0x0A,0x7A,0x13,0xA5,0x71,
+    0x8D,0x81,0xD9,0xFB,0x7B,0xB7,0xDC,0xA1,0x65,0xB7,0x52,0xA0,0x6B,0x4C,0x40,0x18,
+    0x16,0xC2,0xDB,0xB1,0xB8,0xAD,0xE6,0x84,0x11,0x6E,0x3C,0x07,0xF0,0x8B,0xA3,0x47,
+    0xE4,0x25,0x38,0xC2,0x02,0xC4,0x23,0x22,0x78,0xB7,0x42,0x23,0x56,0xA5,0x16,0x4E,
+    0x45,0x35,0xAE,0x60,0xE1,0xFC,0xD7,0xF8,0xFC,0xAF,0xF1,0xF9,0xAD,0x8C,0xCF,0xDB,
+    0xEE,0x69,0xF9,0xAF,0xF9,0xF9,0x65,0x38,0xFB,0xAF,0x01,0xFA,0xD5,0x0C,0x50,0x42,
+    0xFB,0xB7,0x30,0x41,0xED,0x60,0xDF,0xCC,0x02,0x65,0x4D,0x64,0x1E,0x2D,0x1B,0x8A,
+    0xAE,0x7C,0x58,0xAD,0x40,0x23,0x80,0x24,0xCF,0x4A,0x10,0x8F,0xFF,0xD7,0xD5,0x42,
+    0x5C,0x8C,0xBB,0xDC,0x9E,0x76,0x29,0x4A,0x64,0x14,0x4D,0x2C,0x81,0x22,0xF5,0xCD,
+    0x91,0x15,0x6F,0xCF,0x5A,0xA0,0x6A,0xF7,0x96,0x68,0xC9,0x37,0x77,0xC4,0xD1,0xA1,
+    0x3A,0xEE,0xFF,0x45,0xA8,0xD2,0x07,0xD7,0xA2,0x0B,0x97,0x92,0x4A,0x4D,0xE7,0xD2,
+    0x78,0x9B,0x5F,0x11,0x15,0x7C,0x76,0x9C,0xB7,0xE7,0x7C,0x8E,0xD1,0x61,0x45,0xD6,
+    0x6B,0x35,0xFA,0xAE,0xA1,0x49,0x1D,0x40,0x92,0x61,0x18,0xCB,0x06,0xA5,0x80,0xBF,
+    0xDE,0x98,0xE8,0x4E,0x02,0x1B,0x58,0x36,0x0B,0xC2,0xB8,0x04,0x93,0x6A,0xD3,0xBC,
+    0x1F,0x82,0x06,0x73,0x97,0x99,0x60,0xDF,0xC4,0x97,0xF4,0x78,0xB5,0xED,0xAF,0xFF,
+    0xBA,0x0A,0xFE,0xEB,0x2A,0xF8,0x37,0xB8,0x0A,0xAA,0xA3,0x9E,0x74,0x74,0x09,0x2C,
+    0x5A,0x7C,0x48,0x95,0xFF,0x58,0xCE,0x98,0x09,0x6B,0x1A,0x32,0x7F,0x0C,0xF0,0x54,
+    0xD2,0x95,0x1E,0x86,0xEF,0xB2,0x84,0x90,0x87,0xC8,0x1A,0x71,0x29,0x5C,0x90,0x2E,
+    0x65,0x23,0xDB,0x61,0x88,0x87,0x6E,0xE8,0x26,0x8D,0x38,0x15,0x57,0xB2,0x49,0xDB,
+    0x85,0x20,0xEB,0x27,0xED,0xAC,0xD5,0xBD,0x87,0x65,0x47,0xBF,0xD2,0x80,0xC7,0x21,
+    0x6E,0x35,0x70,0x5B,0xC0,0xCA,0xAD,0x7A,0x18,0xFC,0x7B,0x3E,0xFC,0x24,0x1A,0x01,
+    0x35,0x3E,0xC3,0x88,0xF5,0xE8,0x6C,0x46,0x77,0x86,0xA4,0xD9,0x48,0xB7,0x04,0x0E,
+    0x80,0x51,0x6A,0xE8,0xB0,0xAD,0xD6,0x9F,0x28,0x42,0xAE,0x42,0x05,0x9F,0xDC,0x95,
+    0xCC,0x26,0x9A,0x22,0x0F,0x04,0xE0,0xBF,0xB1,0x76,0x0A,0x11,0xE0,0x6B,0x63,0x32,
+    0x3A,0xAD,0xDD,0x77,0x3D,0x07,0x0D,0x85,0x27,0xA9,0xA9,0xD0,0xB1,0x0B,0x22,0xC5,
+    0x6B,0x42,0x22,0xF1,0xB0,0x3A,0x85,0xF8,0x0B,0xEC,0x02,0x72,0x05,0x5E,0x70,0xFF,
+    0x93,0xF3,0x7A,0x15,0xE6,0xFE,0x35,0x8F,0xF2,0xAB,0xC3,0x08,0xCF,0x92,0x80,0xFA,
+    0x2F,0xA4,0x7D,0x23,0x26,0x59,0x56,0xDF,0x41,0x2D,0x29,0x1D,0xED,0xE3,0xA9,0x17,
+    0x97,0xBB,0x4D,0x87,0x1A,0x1A,0x25,0x44,0x1E,0x1D,0xFE,0xC2,0x55,0x46,0x56,0xB0,
+    0x4C,0x37,0x24,0x50,0x3A,0x4C,0x90,0x92,0x51,0xC0,0xB7,0xB9,0x28,0x8D,0x98,0x6E,
+    0x3B,0x91,0xFD,0xE6,0xAB,0x56,0x82,0xD1,0x55,0xCD,0x4A,0xD7,0x42,0x8D,0x21,0xF3,
+    0x10,0xD5,0x02,0x12,0x93,0xAD,0x24,0x0B,0x46,0xE2,0xA4,0x72,0xAD,0xAB,0x06,0x76,
+    0x17,0x75,0xCF,0x6A,0x86,0x2C,0x0E,0x75,0x6F,0x41,0xCF,0xF7,0x61,0xCC,0x98,0x06,
+    0x0D,0x47,0xA3,0x96,0xAF,0xB7,0xE3,0xDD,0x72,0xCE,0x48,0xF0,0x8C,0xE5,0xC0,0xD0,
+    0x73,0x79,0xE6,0x54,0x52,0xD7,0x58,0x70,0x24,0xFA,0x0D,0x52,0x30,0x69,0x63,0x9D,
+    0x81,0xAA,0xA3,0x87,0x78,0xD4,0x1C,0x5F,0x78,0x15,0xA7,0x57,0xCF,0xA2,0x72,0x9A,
+    0x8D,0x8A,0x35,0xF3,0xE8,0x26,0xDF,0x0E,0x03,0x35,0x80,0x79,0x1F,0xA3,0x5E,0x8E,
+    0x2A,0x7A,0x32,0xC7,0x83,0x65,0xC1,0x1C,0x0A,0xE4,0x74,0xEC,0x95,0x0F,0xC7,0xF2,
+    0x45,0x0F,0x41,0xD1,0x64,0xDB,0x35,0x9D,0x02,0x84,0xC0,0x30,0x8E,0x4D,0xD6,0x18,
+    0xAB,0xCA,0x93,0xE3,0x34,0x19,0xCD,0xA8,0xC8,0xAF,0x97,0xF6,0x74,0xE4,0x8C,0x46,
+    0xDA,0x25,0x2A,0xB8,0x09,0x60,0x1E,0xFE,0x2D,0xB3,0xCC,0xDA,0xB9,0x93,0x93,0x0A,
+    0xA6,0xD1,0xBD,0x5A,0x24,0xB6,0x51,0xD2,0xF0,0xBD,0x1E,0x18,0x67,0xD9,0xBF,0xE4,
+    0x14,0xAF,0xAA,0x64,0xD1,0x49,0xCD,0xC5,0x47,0x9B,0x56,0x3C,0xDE,0x4B,0xA7,0x91,
+    0x94,0x0F,0x54,0x7F,0x6B,0x45,0xE4,0x99,0x96,0x61,0xC3,0x51,0x43,0x30,0xE2,0x58,
+    0xF3,0xC0,0xF9,0x74,0xD3,0xC8,0xE3,0x85,0xE8,0xE5,0x12,0x88,0x11,0x4E,0x14,0x98,
+    0xBC,0xCB,0x60,0xE8,0x14,0xB0,0xB4,0xE4,0xEA,0xC7,0x79,0xAC,0x2E,0x5C,0xF3,0x46,
+    0x16,0x3D,0x07,0x84,0xDE,0x91,0xF6,0x6D,0x0C,0x59,0xAA,0x5D,0x8D,0x83,0x0D,0x94,
+    0xF1,0x8B,0xB8,0x06,0x41,0xDD,0xEE,0x40,0xD8,0x47,0xA6,0x67,0x9F,0x89,0x06,0xD4,
+    0xAF,0x1D,0x4C,0xA0,0x51,0xD4,0x5C,0x2C,0xDD,0xC6,0x51,0x2F,0xE4,0x48,0x74,0xA6,
+    0x89,0xDB,0x90,0x66,0x45,0x25,0x01,0x15,0x61,0xB6,0xC8,0x13,0x50,0x1A,0x8F,0xF4,
+    0x41,0xD9,0x97,0x97,0x61,0x34,0x2B,0x75,0xEF,0x21,0x74,0x4B,0xB3,0xB0,0x33,0x62,
+    0x25,0x3A,0x8D,0x87,0xDC,0xED,0x14,0xF8,0xAA,0x1E,0xF9,0x5B,0x80,0x51,0x0A,0xBC,
+    0xA9,0x89,0x5E,0x7B,0x80,0x1E,0xA0,0x8B,0x01,0x4F,0x2F,0xD1,0x1D,0x3F,0x7C,0xA8,
+    0xB1,0x31,0x10,0x12,0xA7,0x83,0x85,0x36,0x72,0x4D,0x3C,0x7E,0x12,0xF7,0x32,0x54,
+    0xC4,0xE6,0xDB,0x7C,0x11,0x85,0x0E,0xD1,0xA8,0x84,0xC3,0xD1,0x7A,0x46,0x70,0xDA,
+    0xCD,0xAA,0x87,0xBD,0x2B,0x4F,0xC7,0xED,0xE7,0xBC,0x2B,0xD8,0xAF,0x77,0xC4,0xDB,
+    0x52,0xA7,0xED,0x74,0xB7,0x02,0xD3,0x64,0xD9,0xBB,0x64,0x3E,0x04,0x71,0xAD,0x5D,
+    0x8C,0xF3,0xFC,0xDD,0x81,0xCC,0xE6,0x6B,0x80,0xB4,0x9B,0x80,0x50,0xF2,0x05,0x62,
+    0xCA,0x15,0xE5,0x54,0x1E,0x96,0x0A,0x5A,0xBB,0xA7,0xCE,0x49,0xA3,0x8B,0xAA,0x08,
+    0x90,0x4D,0x1D,0x8A,0xFD,0xAA,0x19,0x45,0xAA,0xA1,0x0F,0x9A,0xAF,0xE7,0xC1,0x44,
+    0x09,0xB9,0x71,0xDB,0x60,0x25,0x8F,0xE8,0x0A,0xA3,0x4A,0x73,0xC5,0x5B,0xCA,0xE2,
+    0x8C,0x4A,0xDD,0xE1,0x2E,0xDA,0x47,0xCB,0x9B,0x0E,0x90,0x76,0x61,0x56,0x45,0x92,
+    0x4E,0x30,0xF2,0xD2,0x9C,0x35,0x93,0x31,0xF6,0x69,0xC6,0x00,0x29,0x38,0x4A,0x3C,
+    0x3D,0xBE,0x5F,0xF3,0x9B,0xD2,0x62,0x5A,0xC0,0x1A,0x81,0x37,0x05,0xC7,0xC4,0x3A,
+    0x59,0x4A,0x40,0x7C,0x6A,0xC4,0x27,0xAF,0x3C,0x28,0x1F,0x20,0xE6,0x72,0x0D,0xA3,
+    0x7C,0x32,0x91,0x96,0x49,0xF6,0xCA,0x16,0x8B,0xD0,0xAD,0x1E,0xF9,0x89,0x2E,0x24,
+    0x12,0xB0,0x33,0x12,0x59,0x72,0xF8,0x34,0x16,0xA3,0x69,0xED,0xA4,0x7D,0x5D,0x56,
+    0x1C,0xA4,0x05,0x5E,0x6D,0xCF,0xAD,0xFD,0x8D,0xEF,0x2D,0xA4,0x5B,0xA0,0xF4,0x79,
+    0xA9,0x49,0xF8,0x4E,0x31,0x4B,0xE2,0x30,0x72,0x85,0x7D,0xD3,0xF5,0x55,0x8F,0x9A,
+    0x3A,0x32,0x23,0x98,0xCB,0x2D,0xA8,0x6D,0x81,0x94,0xAC,0xE6,0xD1,0x30,0x52,0x3B,
+    0x72,0xCA,0xE8,0x6F,0x5D,0x3E,0x42,0x9B,0x1F,0xD9,0xB5,0x2D,0x5C,0x81,0x2C,0x62,
+    0x60,0xFA,0xD3,0x28,0x8C,0x8A,0x22,0xC8,0xEB,0x0A,0x5E,0x25,0x88,0x9A,0x9A,0x9C,
+    0x94,0xB6,0xA4,0xF6,0xB9,0x9F,0x6C,0xE2,0xA5,0xD6,0x7E,0x4D,0x03,0xFD,0x11,0x1D,
+    0x91,0x92,0xCE,0x63,0x71,0x71,0xC7,0xC2,0x85,0xEB,0x2C,0x06,0x53,0x83,0x65,0x1C,
+    0x42,0xB7,0x2C,0x78,0xAD,0x54,0x37,0xC5,0xB2,0xDA,0x9D,0x82,0xE4,0xDF,0x94,0x6C,
+    0x5B,0xDD,0x4B,0x6D,0xA1,0xA4,0x1A,0x4F,0x36,0x59,0x71,0x05,0x5E,0xE4,0xC3,0x77,
+    0x0D,0x76,0xD4,0x93,0x5D,0x0B,0x2B,0xAA,0xA5,0xB6,0xC6,0x76,0x26,0x51,0x6D,0x7A,
+    0x47,0xDD,0xE3,0xC6,0xC1,0x63,0x3C,0x3F,0x73,0xD5,0x5C,0x8D,0xDA,0x6D,0xDE,0x24,
+    0x9A,0xA7,0x48,0xE8,0xC4,0x4A,0x4B,0x47,0x2F,0x57,0x8A,0x0E,0x17,0x70,0xFF,0x4B,
+    0xB6,0x6B,0xB6,0x4D,0x18,0xB1,0xAF,0xC2,0x18,0xBC,0x08,0x0A,0x31,0xB5,0x23,0x5F,
+    0x1D,0x22,0x37,0x20,0x40,0xE0,0x75,0x6B,0xBD,0x34,0x86,0x3E,0xD0,0xE7,0xBB,0x63,
+    0xA1,0x8C,0xD5,0x14,0x9C,0xC5,0x2C,0xC6,0xDD,0xB3,0x33,0x59,0xA4,0x31,0x17,0xC3,
+    0xB5,0xCC,0xB7,0x4C,0x97,0xF3,0xD6,0xE1,0xA2,0x4D,0x27,0x63,0xF7,0xEC,0x6B,0x70,
+    0x95,0x39,0x76,0x9D,0xB1,0x6A,0x39,0x36,0xDE,0xAA,0xF0,0x6B,0x32,0xD7,0x11,0xFB,
+    0x6E,0xFA,0x5F,0x4A,0x44,0x3A,0x0D,0xAD,0x2C,0xF9,0xC4,0xE1,0xF7,0x5B,0xA7,0x45,
+    0x8D,0xAF,0xE5,0x6B,0xCD,0xAC,0x28,0xFA,0x66,0x49,0x10,0xF2,0x0E,0xB2,0xBC,0x40,
+    0x41,0x5C,0x00,0xAD,0x07,0x53,0x98,0xFC,0xAC,0x66,0x4B,0x4A,0x59,0x52,0xB9,0xF1,
+    0xDA,0xC1,0x82,0x2E,0xA3,0x50,0xEA,0x4C,0x61,0xEA,0x33,0xAB,0x4D,0xE2,0xBE,0xB4,
+    0x26,0xF4,0xF9,0x13,0x89,0xAE,0xD9,0xA2,0x11,0xF0,0x7D,0x60,0x97,0x98,0x35,0x0B,
+    0xAD,0xA6,0xD9,0xD4,0xCB,0x9B,0x4A,0x4E,0x33,0xD7,0xE9,0xD6,0xD5,0x9B,0x8F,0x24,
+    0x09,0xC5,0x8C,0x35,0x76,0xC5,0x56,0x90,0x7B,0x0D,0x81,0xA7,0x64,0x6B,0x53,0xD6,
+    0x49,0x41,0x9E,0x25,0xA3,0xA5,0x32,0xB6,0x61,0x4A,0x0A,0x9B,0xBC,0x9A,0x19,0x2D,
+    0xCF,0xC4,0xE9,0x37,0xB0,0xBD,0x68,0x61,0xC0,0xDD,0x67,0x1B,0xEB,0x2F,0x10,0x5D,
+    0x8D,0x89,0xED,0xDF,0xC6,0x01,0x49,0x62,0x90,0x7F,0x61,0xBD,0xE6,0xE5,0xDD,0x7C,
+    0x08,0x8B,0xA5,0xA3,0xBB,0x07,0x84,0xF1,0x6C,0x53,0xEA,0x0D,0x29,0x16,0xA8,0x8B,
+    0x53,0x2A,0xCA,0xA4,0xAB,0xA9,0x53,0x93,0x43,0x15,0x77,0x44,0xD2,0x11,0xC5,0xBF,
+    0xDC,0xC2,0x43,0x76,0x48,0xC8,0x33,0x05,0xBF,0x1A,0xF0,0xAA,0xFA,0xB6,0xF3,0xA3,
+    0x72,0x0B,0xF3,0x05,0xC9,0xCA,0xF5,0xA6,0x2E,0x0D,0xA1,0x4D,0xEA,0xD5,0xF9,0x8A,
+    0x2E,0x59,0x55,0xDD,0x56,0x37,0x05,0x60,0xEF,0x7C,0xD5,0xF0,0x5D,0x6F,0x6E,0x51,
+    0x6E,0x07,0xCD,0x09,0x51,0x9B,0xF7,0x0A,0x07,0xE2,0x36,0x32,0x89,0x2D,0xDA,0x23,
+    0x17,0x97,0xD9,0x32,0x12,0xD5,0x25,0xA0,0xF5,0x7C,0x9D,0x56,0xDD,0x7B,0xCF,0x11,
+    0x0C,0xCF,0xCD,0xE3,0xDF,0x6A,0x14,0x78,0xA6,0xE4,0x48,0x7D,0xD1,0x25,0x25,0x2A,
+    0x6B,0xD1,0x3D,0x09,0x1F,0xAC,0x57,0x8A,0x08,0x56,0x61,0x4C,0x4B,0xD4,0xD4,0x60,
+    0xB8,0x7C,0x71,0xA4,0xAA,0x39,0xC6,0x3D,0x07,0x4B,0x2A,0xF2,0xA1,0xE7,0xF1,0xFB,
+    0xAB,0x0A,0xCD,0x96,0xC0,0x94,0x7D,0x14,0xC0,0x52,0x9F,0x6D,0x8A,0x11,0xE5,0x1B,
+    0x8C,0x30,0xDA,0x27,0x97,0x97,0xFB,0xB0,0xFF,0x40,0x60,0xB6,0x00,0x3B,0x16,0xCA,
+    0xCE,0xD3,0x32,0x4E,0xE8,0xC6,0x6E,0xF6,0x80,0xCA,0x70,0x9C,0x33,0x0A,0x7D,0x1A,
+    0x8D,0x2A,0xAA,0xA9,0xAD,0x67,0xC0,0xCC,0xA6,0x27,0x48,0x1B,0xC7,0xC2,0xA0,0xA4,
+    0x17,0xD1,0x78,0x1C,0x55,0x5D,0xE6,0x4E,0x18,0xB3,0x19,0xE4,0x93,0xB9,0xB8,0x79,
+    0x1C,0x35,0xCB,0x1A,0x25,0xA3,0x72,0xC4,0x34,0x6E,0x3B,0xD2,0x77,0x4B,0xAF,0x2C,
+    0xF3,0x0A,0xAD,0x15,0x8B,0xAF,0xBF,0x90,0x33,0x80,0xCE,0xF3,0xE4,0xCA,0xE5,0xEB,
+    0xA3,0xA8,0xC8,0xEA,0x37,0x5B,0xE0,0x64,0x25,0x11,0xDE,0xDB,0xBA,0x74,0xB6,0x56,
+    0xE9,0x7F,0x43,0x4A,0x37,0x02,0x54,0xEE,0x68,0xBE,0x2C,0x95,0x4F,0x3C,0xF9,0x7C,
+    0x41,0x7B,0x96,0xBA,0xDE,0x12,0x79,0xD5,0xBE,0xBB,0xC4,0xCA,0xF2,0x78,0x12,0x93,
+    0x73,0xA2,0xD1,0x09,0x3A,0xC1,0x8A,0x5D,0xBC,0x83,0xB8,0x1A,0x8F,0x0D,0x79,0x05,
+    0x9F,0x5F,0x2A,0xB0,0xFE,0x0D,0x92,0x83,0x0C,0x34,0xD1,0xB5,0xD7,0x7C,0xAB,0xAF,
+    0x20,0x81,0x86,0x60,0xB0,0x88,0x00,0xB5,0xA8,0xBD,0xCA,0xB2,0x53,0xB7,0x45,0xB0,
+    0xBD,0x0C,0x6F,0x3B,0xAD,0x24,0xA2,0x36,0xF4,0xBE,0x85,0x8D,0xF5,0xC6,0x6D,0x11,
+    0xF6,0x9F,0x8C,0xEE,0x49,0xC3,0xD1,0x48,0x23,0x7D,0xF7,0xED,0xB8,0x12,0x56,0x68,
+    0x51,0xF6,0x3F,0x83,0x2A,0xD1,0x28,0xBF,0x65,0x6D,0x24,0x19,0xCF,0xB4,0x89,0xBB,
+    0x19,0x50,0x60,0x75,0x0A,0x41,0x68,0x9D,0x44,0xE8,0x7B,0xD1,0xE4,0x2C,0xD5,0x03,
+    0x29,0xCE,0x10,0x64,0x00,0x71,0xA3,0xEF,0x24,0x11,0x2E,0x95,0x4A,0x6A,0x49,0x37,
+    0x76,0x5B,0xBE,0xCF,0x26,0xB6,0x2D,0xA6,0x71,0x12,0x81,0xFE,0x08,0xB9,0x60,0x43,
+    0xFF,0x95,0xB5,0x45,0xA8,0xE4,0x88,0xCA,0x1F,0xEB,0x35,0x70,0xD2,0x43,0x67,0xD3,
+    0x39,0x6E,0xAC,0xA0,0x35,0xE7,0x7C,0xC3,0x61,0xDF,0xBC,0xCE,0x90,0xD2,0xD5,0x76,
+    0x80,0x0E,0xDB,0x99,0x06,0xC5,0xDB,0x8B,0xF4,0x9D,0xB8,0x1B,0x4C,0xC7,0xC5,0x9E,
+    0x01,0xA8,0x4B,0xA0,0x5E,0x73,0x47,0x81,0xAF,0x3C,0xA3,0x59,0x31,0xD7,0x40,0x21,
+    0xC1,0x41,0xF3,0x10,0x77,0x93,0x99,0xB7,0x98,0x25,0xB4,0xD1,0xA7,0x5D,0x19,0x5E,
+    0xBB,0x8E,0x94,0x1F,0xF3,0x88,0xD3,0x31,0xBA,0x68,0x22,0x27,0xC9,0xE8,0x73,0xEC,
+    0x14,0x19,0xEE,0x81,0x51,0x95,0x69,0x25,0xAC,0x94,0x18,0x09,0x83,0x79,0x21,0x3C,
+    0x7B,0x05,0x5E,0xCF,0xAE,0xE8,0x65,0x18,0x89,0x48,0xBD,0x60,0x12,0x18,0xB7,0x13,
+    0x42,0x83,0x6E,0xD4,0x99,0x74,0xD0,0x6E,0x50,0xEF,0x9C,0x49,0x93,0x92,0xA2,0x76,
+    0x85,0xA7,0xA7,0xC7,0x1E,0xC4,0x8A,0xA7,0xD6,0x1A,0xA1,0xBA,0x1A,0xBA,0x9B,0xFC,
+    0xBE,0x08,0xA9,0xF6,0x00,0xBE,0x05,0xD2,0xA1,0x63,0x55,0x25,0x9A,0xEB,0x82,0xC1,
+    0xA5,0x4D,0xB1,0x34,0x4E,0x35,0xDD,0x7C,0x9C,0x8A,0x15,0x4E,0xDE,0xE5,0xC4,0x6B,
+    0x9C,0x65,0x45,0x5B,0x3C,0x84,0x06,0x5D,0xDC,0xDC,0x95,0xE9,0x9D,0x14,0x4F,0x15,
+    0xA0,0x1D,0x8B,0x77,0x16,0xA2,0x6B,0x29,0xCB,0xAB,0xF5,0x3F,0x8F,0x12,0x9D,0xC8,
+    0x94,0xBA,0x52,0xD7,0x52,0x2C,0x22,0xA3,0x8D,0x8A,0x90,0x43,0x97,0xF5,0x67,0x3A,
+    0x15,0xDE,0x59,0x88,0xE8,0x0E,0x44,0xE3,0x91,0x69,0x3D,0x7D,0x99,0x50,0xC1,0x78,
+    0x82,0xB5,0xFF,0x5F,0xB2,0xC4,0x6C,0xB6,0xB1,0x8B,0x67,0xD9,0xDB,0xD3,0xCB,0xB8,
+    0x7C,0x80,0x83,0x7C,0xDB,0x24,0x4D,0x05,0xC9,0x40,0xB2,0xEF,0x1C,0x69,0xD8,0x3E,
+    0xC6,0x8D,0x92,0x30,0x28,0x5D,0x1E,0x99,0xE9,0x08,0x77,0x17,0x2B,0x37,0xA8,0x10,
+    0x2F,0x57,0x7D,0xA4,0x62,0x6C,0x68,0x60,0x16,0x6B,0x6D,0x0E,0x1A,0x6D,0x5C,0x5E,
+    0xD5,0xF6,0xCA,0x97,0xF9,0x10,0xC4,0xA1,0xFE,0x9A,0x13,0x41,0xA6,0xA2,0x17,0x41,
+    0x1E,0xFB,0x6F,0x7A,0x81,0x94,0xEB,0x46,0x83,0x5A,0x4D,0x0D,0x2B,0xE2,0x3F,0xA3,
+    0xDB,0x1D,0xC7,0xF2,0x11,0x27,0xB4,0xC5,0xE9,0xF7,0x5D,0x1C,0xC7,0xD4,0x84,0xE1,
+    0x33,0xA6,0x14,0x11,0x38,0x6A,0x1D,0x8C,0x18,0x83,0xFB,0xC9,0x78,0x60,0x6F,0x65,
+    0xDD,0xB2,0xB0,0xC5,0x09,0x8B,0x9D,0x2D,0x75,0x28,0x82,0xF3,0xF2,0xEC,0x3C,0x46,
+    0x15,0x33,0x4E,0x9B,0x25,0x78,0xF3,0xAA,0xB8,0xD3,0x58,0xA3,0xB2,0x36,0x54,0x48,
+    0x70,0x17,0xF9,0xED,0x56,0xF7,0xAF,0x50,0x45,0xEE,0xC2,0x1D,0xE2,0xD5,0x9C,0xBF,
+    0xCB,0x90,0xB6,0xCF,0x46,0xFB,0x50,0x38,0xDC,0xB5,0xC8,0x2E,0xE7,0x42,0xDC,0x2C,
+    0x5E,0x99,0x41,0x22,0x22,0x08,0x83,0x3E,0x30,0x2C,0x85,0xD0,0x27,0xD0,0x8B,0x71,
+    0x36,0x4D,0x9D,0x5B,0x05,0x18,0xB5,0x05,0x96,0xE5,0xB7,0xAC,0x4A,0x1D,0xFD,0xD0,
+    0xBD,0x1C,0x32,0x08,0xE9,0x2E,0x2E,0x03,0x0E,0x03,0x32,0xFC,0x06,0x9C,0xA4,0x45,
+    0x11,0x35,0x67,0x23,0x4A,0xE8,0x2C,0x94,0x00,0xE8,0x2F,0xDF,0xB4,0xA1,0x31,0x0B,
+    0xBF,0x8D,0x55,0x04,0x1C,0xE0,0xF1,0x15,0xB4,0x2B,0x6A,0x81,0x32,0x36,0x52,0x15,
+    0xD7,0xBE,0xCB,0x7D,0x1C,0xDE,0x14,0xB4,0x20,0x10,0x33,0xDB,0xA6,0x9F,0xB3,0x09,
+    0x25,0x36,0x17,0xDB,0xF4,0xE4,0x68,0x21,0xDE,0x4E,0x99,0xFA,0x85,0x7F,0xEE,0x07,
+    0xDA,0x06,0x64,0x1A,0x25,0x85,0x00,0xBE,0x93,0x3B,0x46,0xDB,0x64,0x34,0x31,0xAC,
+    0x67,0xC8,0x8D,0x11,0xD1,0x99,0x65,0xC2,0xEA,0x76,0x3F,0xB3,0xF2,0x5B,0x6B,0x11,
+    0x25,0x0B,0xBC,0xD7,0xB7,0xC4,0x9C,0xD4,0x5C,0x70,0x7C,0x28,0x80,0xFB,0x28,0xF7,
+    0x06,0xAA,0x3E,0x2F,0x72,0x75,0x37,0x7C,0x78,0xB7,0x55,0xB0,0x8C,0xE3,0xC4,0x61,
+    0x1B,0x3E,0xFC,0x42,0x5A,0x6A,0xC0,0x4F,0x0A,0xA4,0x65,0x9E,0x25,0x92,0x33,0x1A,
+    0x93,0x5C,0xB2,0x36,0x21,0xB4,0x07,0xF8,0xB8,0x9B,0xFD,0x41,0xE7,0x0E,0x1A,0xB7,
+    0x21,0xD7,0x72,0xC4,0x65,0x5B,0x6C,0x1F,0x1F,0x8C,0x9A,0xBB,0xEB,0xE5,0x8A,0x27,
+    0xD9,0x1A,0x18,0xA7,0x13,0x1A,0x86,0xCF,0x53,0x6B,0x66,0x69,0xF8,0x9C,0xD1,0xEC,
+    0xF2,0x43,0x2A,0x8D,0x56,0xC5,0x0E,0xD0,0x17,0x36,0xAA,0x5F,0x75,0x7A,0x7B,0x9B,
+    0x51,0x3A,0xBA,0x4B,0x93,0x37,0xFD,0xDB,0x17,0x97,0xA5,0x37,0xF2,0xFB,0x8E,0x65,
+    0x6F,0xE7,0x76,0x7F,0x28,0xC7,0xC4,0x40,0x2E,0x95,0x16,0x21,0x32,0x35,0xD3,0x0A,
+    0x2F,0x63,0x16,0x70,0x20,0x58,0xF2,0x12,0xE3,0x86,0x8B,0xBA,0xDD,0x61,0x7A,0x2A,
+    0x18,0xDC,0x72,0x30,0x50,0x5E,0x8E,0x2C,0x00,0x16,0xF9,0xE8,0x3E,0xBC,0x7D,0xF1,
+    0xB6,0xE7,0xC4,0x67,0x33,0xB1,0x3E,0xA0,0xC1,0xB5,0x67,0x01,0x15,0x7B,0x93,0xBD,
+    0x05,0xCE,0x33,0x35,0xBA,0xA3,0x25,0x77,0x0E,0x7F,0xAA,0xE2,0xA4,0x7A,0xEA,0xF8,
+    0xB0,0x63,0xBD,0x68,0x60,0x51,0x11,0xBE,0xC5,0xC9,0xB9,0x71,0x8E,0x57,0x38,0xF5,
+    0x46,0x31,0x56,0xEA,0x74,0x44,0x78,0x25,0xEE,0x76,0x92,0x0A,0x0A,0xF7,0xD9,0xE2,
+    0x29,0xE1,0x19,0xD2,0x4B,0xDA,0xD1,0xC7,0x15,0xB0,0x9A,0xBA,0xD0,0xAB,0x68,0xE9,
+    0xFE,0xA2,0x01,0x0B,0x35,0xA8,0xB7,0xF4,0xE2,0xE6,0xEA,0x2E,0x3F,0x3C,0xD6,0x8B,
+    0x57,0xBE,0xB5,0x16,0x5D,0xC7,0xBC,0x92,0xDB,0xF2,0xE6,0xD6,0xBB,0xF4,0xCD,0x23,
+    0x17,0x7C,0xDC,0x42,0xE3,0x1C,0xC8,0x8A,0x47,0x3D,0x41,0xD6,0x78,0xB0,0x6A,0xC1,
+    0x6D,0xB4,0x44,0x45,0xF2,0x69,0x02,0x86,0x16,0x9F,0xF5,0x1E,0xE1,0xCD,0xA5,0x02,
+    0xB7,0xE6,0x39,0x09,0x32,0x3F,0x14,0x46,0x0F,0xEC,0x7B,0xDD,0x92,0xE1,0x3E,0xC6,
+    0xFB,0x5A,0xB8,0x28,0x1E,0x2F,0x0F,0xEB,0x11,0x65,0xF5,0x22,0x99,0xB2,0x0C,0x10,
+    0x5C,0x7C,0x19,0x9C,0xDC,0xC4,0x8E,0xD6,0x8C,0x2D,0xF6,0x9C,0xA3,0x01,0x65,0xCD,
+    0x3E,0xA9,0x9B,0xE3,0x5E,0x75,0x27,0x96,0x5F,0x9D,0x57,0x93,0xEE,0x40,0x63,0x89,
+    0xA8,0x82,0x8C,0xBE,0xDF,0xF4,0x7C,0x11,0x19,0xDE,0x53,0xF7,0x30,0xAB,0x83,0x20,
+    0x3A,0x4E,0xF8,0x28,0x81,0xE1,0x94,0x33,0xDE,0x35,0xB0,0xDC,0xB1,0x6C,0xC4,0xB6,
+    0x89,0xEB,0x95,0x1B,0x22,0xF2,0xD6,0xBB,0xD3,0x96,0xBD,0x13,0x25,0x89,0xFE,0x53,
+    0xFD,0xCD,0x27,0x8D,0x2A,0xC4,0x83,0x14,0x32,0x1D,0xC9,0x4A,0xBF,0x61,0x55,0x06,
+    0x19,0xB6,0x44,0x47,0x14,0xE0,0x99,0x78,0xF1,0x08,0x81,0x99,0xC2,0x9B,0x91,0xBE,
+    0xBF,0xCA,0x30,0x7F,0xE3,0x30,0x85,0x09,0xE3,0xF5,0xB5,0x17,0xAF,0xB0,0x1A,0x8D,
+    0xF6,0x20,0xA5,0xA2,0x35,0x8C,0x54,0x3B,0x8F,0xF2,0x82,0xDF,0x27,0x5C,0xDF,0xE9,
+    0xEC,0x74,0xB6,0xD6,0xFB,0x7C,0x10,0x9B,0xF6,0xCC,0x49,0xC1,0xFF,0x1B,0xA8,0x17,
+    0xC9,0x7C,0xB6,0xC1,0xC1,0xD9,0x6D,0x91,0xD5,0x07,0x6B,0x13,0x1F,0xFE,0xC4,0x2C,
+    0xB4,0x9E,0xC7,0xF1,0xA4,0xF3,0x47,0xA1,0x55,0x2C,0x43,0x14,0x64,0xDF,0xFA,0xF5,
+    0x3C,0x15,0xBA,0x6C,0x1B,0xA1,0x71,0xB7,0xB5,0x7A,0xE2,0xCD,0xD5,0x0F,0x3F,0x9A,
+    0x3C,0x33,0x8F,0x3B,0x78,0x77,0xC2,0xB4,0x6F,0xA6,0x29,0xAA,0xA6,0xA7,0x99,0x96,
+    0x3E,0x70,0x23,0x4A,0xA8,0x93,0xD8,0xEA,0x44,0x4F,0x0D,0x40,0x08,0xEF,0x41,0x25,
+    0x09,0x6B,0x00,0xBC,0x20,0x0C,0xD4,0xDA,0x50,0xCB,0xFE,0x21,0xBB,0xE4,0x4C,0xF8,
+    0xA1,0xC8,0xD9,0x83,0x01,0x61,0x00,0x10,0x20,0x67,0x4E,0x8F,0x40,0xBA,0xE2,0x27,
+    0x86,0x2A,0x8B,0xC3,0x34,0x1E,0xA6,0xC9,0x3C,0x2D,0x43,0xCC,0x34,0x2D,0xDA,0x34,
+    0xE3,0x6B,0xD5,0xE3,0x78,0x98,0x0C,0x09,0x04,0xF9,0xFF,0x00,0x04,0x40,0x2B,0xB6,
+    0xA2,0x13,0x01,0x00,
+};
+
+static const unsigned char data_js_iro_js_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "ed93c0ad1b78f6dc"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x64,0x39,0x33,0x63,0x30,0x61,0x64,0x31,
+    0x62,0x37,0x38,0x66,0x36,0x64,0x63,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_js_iro_js_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "ed93c0ad1b78f6dc"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x65,0x64,0x39,0x33,0x63,0x30,0x61,0x64,0x31,
+    0x62,0x37,0x38,0x66,0x36,0x64,0x63,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: application/javascript" (38 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
+    0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
+    0x72,0x69,0x70,0x74,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_js_iro_js_gz[] = {{
+    "\"ed93c0ad1b78f6dc\"",
+    data_js_iro_js_gz_304,
+    sizeof(data_js_iro_js_gz_304),
+    data_js_iro_js_gz_206,
+    sizeof(data_js_iro_js_gz_206),
+    269,
+}};
+
 static const unsigned char data_js_smoothie_min_js[] = {
 
     /* "/js/smoothie_min.js" (20 chars) */
     0x2F,0x6A,0x73,0x2F,0x73,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,0x5F,0x6D,0x69,0x6E,
     0x2E,0x6A,0x73,0x00,
 
-    /* "HTTP/1.0 200 OK" (17 chars) */
-    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x30,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
     0x0A,
 
     /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
@@ -16871,6 +20987,22 @@ static const unsigned char data_js_smoothie_min_js[] = {
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
     0x31,0x33,0x37,0x37,0x38,0x0D,0x0A,
 
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "09f0b371b3b4b7d9"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x30,0x39,0x66,0x30,0x62,0x33,0x37,0x31,0x62,
+    0x33,0x62,0x34,0x62,0x37,0x64,0x39,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
     /* "Content-Type: application/javascript" (40 chars) */
     0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
     0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
@@ -17741,12 +21873,447 @@ static const unsigned char data_js_smoothie_min_js[] = {
     0x29,0x3B,
 };
 
+static const unsigned char data_js_smoothie_min_js_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "09f0b371b3b4b7d9"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x30,0x39,0x66,0x30,0x62,0x33,0x37,0x31,0x62,
+    0x33,0x62,0x34,0x62,0x37,0x64,0x39,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_js_smoothie_min_js_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "09f0b371b3b4b7d9"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x30,0x39,0x66,0x30,0x62,0x33,0x37,0x31,0x62,
+    0x33,0x62,0x34,0x62,0x37,0x64,0x39,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: application/javascript" (38 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
+    0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
+    0x72,0x69,0x70,0x74,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_js_smoothie_min_js[] = {{
+    "\"09f0b371b3b4b7d9\"",
+    data_js_smoothie_min_js_304,
+    sizeof(data_js_smoothie_min_js_304),
+    data_js_smoothie_min_js_206,
+    sizeof(data_js_smoothie_min_js_206),
+    245,
+}};
+
+static const unsigned char data_js_smoothie_min_js_gz[] = {
+
+    /* "/js/smoothie_min.js" (20 chars) */
+    0x2F,0x6A,0x73,0x2F,0x73,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x65,0x5F,0x6D,0x69,0x6E,
+    0x2E,0x6A,0x73,0x00,
+
+    /* "HTTP/1.1 200 OK" (17 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x30,0x20,0x4F,0x4B,0x0D,
+    0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Length: 3667" (22 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x4C,0x65,0x6E,0x67,0x74,0x68,0x3A,0x20,
+    0x33,0x36,0x36,0x37,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "75a12dec81e19d75"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x37,0x35,0x61,0x31,0x32,0x64,0x65,0x63,0x38,
+    0x31,0x65,0x31,0x39,0x64,0x37,0x35,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Accept-Ranges: bytes" (22 chars) */
+    0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x52,0x61,0x6E,0x67,0x65,0x73,0x3A,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x0D,0x0A,
+
+    /* "Content-Type: application/javascript" (40 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
+    0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
+    0x72,0x69,0x70,0x74,0x0D,0x0A,0x0D,0x0A,
+
+    /* gzip file data (3667 bytes) */
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xCD,0x1B,0x6B,0x73,0xDB,0x36,
+    0xF2,0x7B,0x7F,0x05,0x93,0x9B,0xB3,0xC8,0x88,0x92,0x25,0xF7,0x71,0x33,0xA4,0xE9,
+    0x4C,0x9B,0x4C,0xA6,0xB9,0xC9,0x6B,0x62,0xF7,0xDA,0x4E,0xC6,0x1F,0x20,0x11,0x92,
+    0x70,0xA1,0x08,0x1E,0x09,0xD9,0x52,0x24,0xFE,0xF7,0x5B,0x3C,0x48,0x02,0x24,0x44,
+    0x29,0xB9,0xFB,0x50,0x4F,0xA7,0x0E,0xB1,0x8B,0x7D,0x63,0x77,0xB1,0xA4,0x2F,0x2F,
+    0x9D,0xB7,0xAF,0xEF,0x9C,0x37,0x64,0x8E,0xD3,0x02,0x07,0xDF,0x5D,0x5E,0xC2,0x7F,
+    0xCE,0x0B,0x9A,0xED,0x72,0xB2,0x5C,0x31,0xC7,0x9D,0x7B,0xCE,0xD5,0x64,0x3A,0x19,
+    0xC1,0xFF,0xBE,0xF7,0x9D,0x7F,0x52,0xEC,0xFC,0x8E,0x92,0x14,0x17,0x1C,0xCD,0xFC,
+    0xE1,0x18,0x1C,0xED,0x07,0xDF,0x79,0x99,0xE3,0x47,0xE7,0x1D,0x45,0x9F,0x05,0x1E,
+    0x47,0xFD,0x80,0xF3,0x35,0x29,0x0A,0x42,0x53,0x87,0x14,0xCE,0x0A,0xE7,0x78,0xB6,
+    0x73,0x96,0x39,0x4A,0x19,0x8E,0x7D,0x67,0x91,0x63,0xEC,0xD0,0x85,0x33,0x5F,0xA1,
+    0x7C,0x89,0x7D,0x87,0x51,0x07,0xA5,0x3B,0x27,0xC3,0x79,0x01,0x1B,0xE8,0x8C,0x21,
+    0x92,0x92,0x74,0xE9,0x20,0x67,0x0E,0x92,0x71,0x7A,0x80,0xCC,0x56,0x40,0xA9,0xA0,
+    0x0B,0xF6,0x88,0x72,0x0C,0xF8,0xB1,0x83,0x8A,0x82,0xCE,0x09,0x02,0x92,0x4E,0x4C,
+    0xE7,0x9B,0x35,0x4E,0x19,0x62,0x9C,0xE5,0x82,0x24,0xB8,0x70,0x5C,0xB6,0xC2,0xCE,
+    0xD3,0x5B,0xB5,0xE3,0xA9,0x27,0xF8,0xC4,0x18,0x25,0x9C,0x20,0x49,0x1D,0x0E,0xAE,
+    0xA0,0xCE,0x23,0x61,0x2B,0xBA,0x61,0x4E,0x8E,0x0B,0x96,0x93,0x39,0x27,0xE3,0x03,
+    0xD2,0x3C,0xD9,0xC4,0x5C,0x92,0x0A,0x9C,0x90,0x35,0x51,0x4C,0xF8,0x76,0x61,0x34,
+    0x61,0x1B,0x20,0xBD,0x29,0x40,0x15,0x2E,0xB0,0xEF,0xAC,0x69,0x4C,0x16,0xFC,0x37,
+    0x16,0xFA,0x65,0x9B,0x59,0x42,0x8A,0x95,0xEF,0xC4,0x84,0x53,0x9F,0x6D,0x18,0x2C,
+    0x16,0x7C,0x51,0xB8,0xC1,0xE7,0xDA,0x5C,0xD2,0xDC,0x29,0x70,0x22,0x84,0x03,0x22,
+    0x04,0x14,0x10,0x4A,0x37,0x32,0x0A,0x34,0xCE,0x28,0xE3,0xC6,0x65,0xCA,0x5C,0x05,
+    0x5F,0x79,0x5C,0xD1,0xB5,0xA9,0x0F,0x11,0x52,0x2D,0x36,0x79,0x0A,0x8C,0xB1,0xD8,
+    0x16,0x53,0x30,0x9F,0xE0,0xFB,0x6F,0x3C,0x67,0x7C,0x85,0xEF,0x58,0xD0,0x24,0xA1,
+    0x8F,0x5C,0xC7,0x39,0x4D,0x63,0xC2,0x55,0x2B,0xAA,0xB8,0xB8,0x03,0x38,0x9A,0xD1,
+    0x07,0x2C,0xD4,0x92,0x11,0x92,0x52,0x06,0x52,0x4B,0x51,0xB8,0x47,0xB2,0xC6,0xD3,
+    0x0A,0x54,0xAC,0x50,0x92,0x38,0x33,0xAC,0xCC,0x07,0xCC,0x49,0xCA,0xA9,0xF1,0xD5,
+    0x4A,0xB3,0x9C,0x8B,0x51,0x30,0x88,0x07,0x82,0x12,0x27,0xA3,0xB9,0xE0,0xDB,0xD6,
+    0x78,0xFC,0x5D,0xE8,0x2E,0x36,0xA9,0xF0,0x86,0x8B,0xB7,0x1C,0xAD,0xF0,0xF6,0x0F,
+    0x28,0x77,0x7E,0x63,0x24,0x89,0xF6,0x78,0xCB,0x70,0x1A,0x07,0x35,0x8A,0xB7,0x87,
+    0x78,0x12,0x71,0x50,0x7C,0x9A,0xDC,0x47,0xFA,0xC3,0xE1,0xB0,0x2F,0xC3,0x05,0xCD,
+    0x5D,0xBE,0x9B,0x44,0xD3,0x90,0x5C,0xD7,0xE0,0x71,0x82,0xD3,0x25,0x5B,0x85,0x64,
+    0x18,0x4D,0xBD,0x7D,0x85,0xF4,0x19,0xEF,0x78,0x94,0x34,0x44,0xC8,0xBD,0xB7,0x27,
+    0x0B,0x57,0x5F,0x18,0xAF,0x50,0xF1,0xFE,0x31,0xFD,0x90,0x53,0x30,0x03,0xDB,0xB9,
+    0xB0,0xC7,0x13,0x48,0x6C,0x97,0x61,0x6A,0xE2,0x7E,0x02,0xE0,0xBD,0x17,0x45,0xD1,
+    0x80,0x0A,0x07,0x0C,0x3A,0xD4,0x04,0x06,0x49,0xB9,0x59,0xE6,0xB0,0xDB,0xF9,0x39,
+    0xCF,0xD1,0xCE,0xD4,0x49,0xA0,0x44,0x9D,0x4D,0x25,0x4E,0x0A,0x6C,0x41,0xE4,0x66,
+    0x1A,0x4B,0x2B,0xB9,0x1D,0xA8,0xDF,0x95,0xAE,0x3C,0x46,0xA8,0xCB,0x11,0x7E,0x72,
+    0xCC,0x20,0xBE,0x1C,0x1D,0xBB,0x04,0x23,0x2B,0x6F,0x38,0x77,0x64,0x8D,0x6F,0x71,
+    0x0E,0xFE,0x76,0x69,0x26,0xFC,0xEB,0xED,0x79,0xC8,0x8C,0xD5,0x93,0x21,0xDD,0xBE,
+    0xF4,0x1B,0xFC,0x71,0x8C,0x17,0x68,0x93,0xB0,0xF7,0x12,0xD1,0xAF,0xB6,0x87,0x62,
+    0xFB,0x3C,0xC1,0x28,0x77,0xBD,0xF2,0x28,0x7E,0xB4,0x87,0x53,0x8C,0xD9,0x2F,0x74,
+    0x93,0xC6,0xC5,0x6B,0x48,0x39,0xF9,0x03,0x4A,0x82,0xEF,0x27,0x93,0x89,0xAF,0x01,
+    0x02,0x96,0x6F,0x70,0x19,0x6A,0x54,0xB2,0x9C,0x32,0xCA,0x3D,0x27,0x59,0x44,0x5A,
+    0x5C,0x09,0xC6,0x31,0x62,0x28,0xFA,0x74,0x2F,0xA5,0x58,0xA3,0xED,0xBF,0x50,0xB2,
+    0xC1,0xD1,0xBB,0xCD,0x7A,0x86,0xF3,0xF1,0x3B,0xF4,0x4E,0x01,0x48,0xDA,0x01,0x1C,
+    0x61,0xA3,0x49,0xA3,0x33,0xE3,0xF1,0x53,0xF1,0x53,0xB1,0xA9,0x24,0xA8,0x99,0xD6,
+    0x70,0xEE,0xA1,0xE9,0x7D,0x8B,0x73,0x1B,0x6A,0xC6,0x7D,0x9B,0xB6,0x8A,0x7B,0x8E,
+    0xF0,0xD0,0xDA,0x4E,0xC4,0x76,0x90,0x47,0x00,0x6E,0x0C,0x19,0xDA,0x22,0x09,0x94,
+    0xB2,0xC2,0xBD,0x36,0x24,0xAA,0x70,0x2B,0x01,0x25,0xAE,0x8A,0xB6,0xAF,0x36,0x67,
+    0x79,0xC4,0x9C,0x28,0xCB,0x20,0x94,0x1A,0x4B,0x32,0x40,0x82,0xC3,0xB4,0xCE,0x7C,
+    0xC1,0xCF,0x2F,0x36,0xEB,0x8F,0x38,0xC3,0xBC,0x60,0x88,0xFD,0x1C,0x24,0x68,0xAB,
+    0xA4,0x42,0xA2,0xB6,0x69,0x46,0xD3,0xF0,0x71,0x05,0xC5,0xC4,0x25,0x37,0xD1,0xE4,
+    0xE2,0xC2,0x30,0xCC,0xE4,0xFE,0xA6,0x66,0x00,0x3E,0x1B,0x45,0x53,0xAE,0x3C,0x81,
+    0x03,0x3E,0x9A,0x6A,0x01,0x33,0x2E,0x32,0x9E,0xE6,0xDD,0x89,0x3F,0xF1,0x3F,0xB5,
+    0x24,0x82,0x03,0xC7,0x2D,0xE0,0x58,0x1C,0x7E,0xD3,0x65,0x07,0x94,0x75,0x86,0x0B,
+    0xB7,0x4F,0x9F,0x96,0x0F,0x87,0xD2,0xE4,0xA1,0xD5,0xC1,0x9A,0x1B,0x9A,0xC5,0xCA,
+    0x47,0x95,0x80,0xDD,0xB8,0xB1,0xAA,0x49,0x86,0xD3,0xE3,0x8A,0x6A,0xE8,0xD9,0xA6,
+    0x58,0xB9,0x16,0x34,0x33,0x18,0x48,0x01,0xEE,0x76,0xCD,0xB0,0x7B,0x2E,0x50,0x83,
+    0xB7,0x88,0xAD,0xF8,0xA2,0x09,0x95,0x74,0xBC,0x56,0xE8,0xE8,0x64,0xAA,0x88,0x34,
+    0xC8,0x90,0xD4,0x84,0x2A,0x32,0x47,0xE2,0x2C,0x86,0x74,0xFF,0x3E,0x89,0x5F,0xF2,
+    0x74,0x50,0x07,0x1B,0x4D,0x62,0x50,0x05,0x76,0x13,0xE1,0x0C,0x1F,0x24,0xE2,0x08,
+    0xB7,0x98,0xBD,0x51,0x27,0x98,0x87,0x58,0x8E,0xD7,0x50,0x4E,0x5F,0xC0,0x91,0x67,
+    0xD1,0x44,0xC5,0x56,0xC7,0xAE,0x1A,0xD2,0x4D,0xD4,0xA6,0xA3,0x87,0x85,0x86,0x38,
+    0x9C,0xF2,0x10,0xB9,0x6E,0x49,0xE1,0xED,0x75,0x14,0x19,0xA1,0xDA,0xCA,0x93,0x28,
+    0x9A,0x58,0x43,0x55,0xC3,0xF1,0xF4,0x94,0x7E,0xBB,0xA6,0x14,0xD0,0xF1,0x0B,0x68,
+    0xDC,0xD8,0x79,0x59,0xDD,0xD8,0x52,0x25,0x6A,0xF1,0x60,0xCF,0xEE,0x85,0xB0,0x36,
+    0xA8,0x5B,0x67,0xDA,0xF9,0x26,0xCF,0xA1,0xBC,0x08,0xC7,0x7C,0x44,0xE9,0x12,0x43,
+    0x16,0x33,0x00,0xA4,0x78,0x5B,0x79,0x7A,0x22,0x21,0x09,0x2A,0xD8,0x47,0x10,0x00,
+    0xE7,0xDC,0x0A,0x6F,0x49,0x02,0xED,0x57,0x34,0x29,0x4F,0xCA,0x12,0xED,0xD7,0x02,
+    0x17,0xDA,0xD7,0x0F,0x64,0x8B,0x93,0xE0,0x6A,0xE2,0xE3,0x14,0xCD,0x12,0xFC,0x32,
+    0x23,0xB7,0x73,0x30,0x6B,0xBA,0x14,0x75,0xC3,0xDF,0x01,0xCB,0x57,0x34,0x5F,0x23,
+    0x06,0xE5,0xA5,0xE9,0x40,0x20,0x80,0xFC,0x2C,0xC7,0x73,0xC2,0x1B,0x22,0x6E,0x7D,
+    0x51,0x21,0x33,0x94,0x17,0xF8,0x55,0x42,0x11,0xE3,0x08,0xDE,0x98,0xD1,0x57,0x40,
+    0x3D,0x76,0x1B,0xCC,0x12,0x08,0xA2,0xAD,0x8D,0x20,0xDA,0x9E,0x20,0x88,0xB6,0x76,
+    0x82,0xD5,0x91,0xE0,0x62,0xE3,0x60,0xEA,0x57,0xB1,0x5D,0x3D,0x13,0x5E,0x18,0x33,
+    0x9A,0x88,0x6E,0x36,0x18,0xCC,0xF0,0x17,0x82,0xF3,0x81,0x5F,0x70,0xB0,0x32,0x14,
+    0x28,0x3B,0x19,0x4F,0xAF,0x7E,0xEC,0x04,0x73,0x70,0x05,0x78,0x39,0x74,0x8E,0xBF,
+    0xA0,0xF9,0x67,0xE8,0xD4,0xA0,0x9A,0x2E,0x10,0x1C,0x70,0x7F,0x99,0x93,0x38,0xD8,
+    0x43,0xFF,0x9D,0xDC,0xB2,0x1D,0xB0,0x19,0xFC,0x6D,0x22,0x7E,0x80,0x2E,0xCB,0xE9,
+    0x67,0x5C,0xAD,0xFE,0x43,0xFC,0x0C,0x7C,0x30,0x28,0xFE,0x9D,0xC4,0x40,0x71,0xEA,
+    0x43,0xDF,0x98,0x67,0x6F,0x60,0xA1,0x22,0x56,0xFB,0x82,0x2F,0x06,0x53,0x5E,0xBF,
+    0x1F,0xA0,0xCD,0x22,0x20,0xE1,0x2D,0x9E,0xCB,0x4E,0xF5,0xCA,0x9F,0xD1,0x1C,0xFC,
+    0x0C,0x41,0x40,0xC0,0x4D,0xB2,0xA8,0xFB,0x09,0x9A,0x41,0xBE,0x31,0x05,0x59,0x88,
+    0x9F,0x81,0x0F,0x3D,0x38,0x77,0x68,0xAC,0x98,0x2C,0x68,0xCA,0x6E,0xC9,0x17,0x4E,
+    0x5F,0xFC,0xFB,0x15,0x02,0xB6,0xBB,0x60,0xB0,0xA6,0x29,0x2D,0x32,0x34,0xC7,0x83,
+    0xC6,0xFE,0xC1,0x55,0xE9,0xAF,0x68,0x4E,0xBE,0x00,0x1E,0x4A,0xA4,0xA8,0x9F,0xEE,
+    0xCB,0xD0,0x8C,0xAB,0x9F,0x53,0x02,0x5E,0x84,0xD3,0xB3,0xCE,0xC0,0xB6,0x33,0x92,
+    0x10,0xB6,0x8B,0x5C,0xAD,0xBE,0xCB,0x44,0xF0,0x1F,0xC8,0xD3,0x4C,0xE2,0xC2,0xF2,
+    0xAB,0x1C,0xAD,0x71,0x93,0x4D,0x40,0xC5,0x64,0x06,0xB6,0xF5,0x71,0x82,0x79,0x6F,
+    0xD5,0xB7,0x09,0x9A,0xF7,0x98,0x3E,0x8E,0xAD,0xC0,0xC3,0x41,0x41,0x1F,0xF1,0xEC,
+    0x33,0x81,0x33,0xD1,0x87,0xB3,0xA6,0x5F,0xFA,0x11,0xE8,0x89,0xFD,0xC5,0x11,0x78,
+    0x47,0xAD,0x3A,0x90,0xD5,0x4E,0x68,0x83,0xF8,0x41,0x85,0x1B,0x96,0x6E,0xA7,0x0A,
+    0xDB,0x4D,0xE1,0x7A,0x09,0xF1,0x87,0x5D,0x6F,0xBC,0x94,0x98,0xAE,0x07,0x11,0x3E,
+    0xFD,0x09,0x32,0xB4,0x22,0x64,0xD5,0x7E,0xCC,0x29,0xB8,0x92,0x87,0xDF,0x31,0x69,
+    0x09,0x4B,0xD0,0x68,0x27,0xC7,0x7C,0x40,0x62,0x69,0x75,0x2B,0x96,0x12,0xDC,0x06,
+    0xD3,0xF4,0xE5,0x24,0x44,0x2F,0x59,0x69,0x07,0x0B,0xB5,0xC8,0xB6,0xBD,0x86,0xC4,
+    0x1A,0xF2,0xDE,0xAA,0x5F,0x60,0x5D,0xB5,0xAA,0x15,0xD8,0x16,0xCB,0xD2,0x73,0xBD,
+    0xD0,0x9A,0x15,0x65,0xD1,0xFB,0xC0,0x3B,0x54,0x75,0xAB,0xAE,0x53,0xA4,0x71,0x66,
+    0x8D,0x53,0xAD,0x8E,0x58,0xFB,0x40,0x68,0x1D,0x5A,0x1C,0x37,0x15,0xD5,0x6C,0xD4,
+    0xE4,0x9A,0x6F,0xD6,0x94,0xBA,0x18,0xC8,0x7E,0x61,0xDF,0x20,0x06,0xDD,0x3D,0xC1,
+    0x39,0x95,0xE7,0xA8,0x5E,0x35,0xE7,0xD2,0xE3,0x0D,0x6F,0x43,0xBE,0x2A,0x6C,0x7A,
+    0xB7,0x0E,0x45,0xB8,0x17,0x5E,0x5D,0x3A,0x6E,0x78,0x79,0x6D,0x30,0x35,0x0C,0x6E,
+    0x86,0xFC,0x75,0x1C,0xC1,0x42,0x85,0xAC,0x87,0xBE,0x7D,0x13,0x5C,0x7A,0xFC,0xF3,
+    0x18,0xF3,0xAA,0x7D,0xCC,0x09,0xB2,0xB8,0xF7,0xFB,0x41,0x46,0x7E,0xBA,0x59,0x2B,
+    0x94,0x96,0x37,0xD4,0xC5,0xA1,0xB9,0x57,0x4C,0xE0,0x5E,0x51,0x63,0xAB,0x0B,0x45,
+    0xD5,0xD5,0xD6,0xDB,0xF8,0x85,0xB9,0x61,0xA1,0xDA,0xD9,0x8A,0x5F,0x8B,0x43,0xD5,
+    0x4E,0xFA,0x53,0x2F,0x9C,0xE5,0x18,0x7D,0x2E,0x4B,0xD3,0x2B,0x5D,0x5B,0xAA,0xA3,
+    0x56,0x9B,0xB3,0x1F,0xB9,0xC7,0x40,0x2A,0xC7,0xC8,0xBD,0x55,0xD8,0xFF,0x25,0x8C,
+    0xA4,0x32,0x47,0x77,0x87,0x0A,0x85,0xB2,0x47,0xAB,0x59,0x0E,0xF5,0xFC,0x8E,0xBE,
+    0xCA,0xA1,0x78,0xFD,0x35,0xB4,0xE1,0x74,0xC0,0x2F,0x51,0x8F,0xEB,0x6D,0x59,0x00,
+    0xB6,0x40,0xAB,0x5B,0x87,0xC5,0x71,0x8D,0x21,0x39,0x61,0xB4,0xBE,0xA3,0x7A,0x59,
+    0x4D,0x1F,0x50,0xE1,0xC7,0x38,0x41,0x3B,0xD9,0x15,0xAA,0xC0,0x93,0x80,0x48,0xFE,
+    0x92,0x5C,0x05,0x52,0xA4,0xA1,0x2A,0x61,0x18,0x6F,0x7D,0xBD,0xBE,0xE3,0x55,0x40,
+    0x3B,0xD1,0xBA,0xCF,0x3F,0xD1,0x5B,0xE4,0x71,0xBB,0xA5,0x3C,0x1C,0x9E,0xC8,0x94,
+    0x5F,0x97,0xD2,0x18,0x3F,0x80,0x0D,0x44,0x0F,0xFA,0x91,0x67,0x29,0xB0,0xDC,0xB4,
+    0x72,0x7F,0xC9,0xED,0x16,0x67,0x79,0x74,0x04,0x37,0xE4,0xF0,0x47,0x9E,0xA0,0x23,
+    0xD1,0x27,0xC2,0x81,0x70,0x35,0x25,0x79,0x78,0xFF,0xCC,0xD4,0x18,0xD2,0x1D,0x08,
+    0xC4,0x81,0xE7,0x89,0x5D,0x2B,0xCC,0x67,0x7C,0xE7,0x6C,0x93,0x98,0x7C,0x5F,0xA3,
+    0x5D,0x4E,0x96,0x24,0x45,0x89,0xA8,0x0D,0x87,0x83,0x2B,0xAE,0x56,0x8B,0x84,0x42,
+    0xC4,0x74,0xE1,0xCF,0x40,0x01,0x0F,0xEE,0x1F,0x82,0xBD,0x57,0x5D,0x21,0x74,0x0C,
+    0x09,0x0A,0x75,0x11,0x0A,0x8B,0xE4,0xBE,0xCE,0xE7,0xB1,0x26,0xCD,0x7B,0xE2,0x5B,
+    0xC6,0x43,0x1E,0x5A,0x05,0x93,0x08,0x2F,0x56,0xE3,0xC7,0x86,0xC5,0x70,0x90,0x6D,
+    0x07,0x61,0x4B,0xD5,0x17,0x70,0x4A,0xA0,0x94,0xB8,0x83,0xAB,0x78,0xE0,0x8D,0x45,
+    0x53,0xEC,0x02,0x5D,0x9F,0xD3,0x2E,0x3B,0x2A,0xFF,0x2A,0xAC,0xD1,0xA3,0xB3,0x44,
+    0xA8,0x94,0x96,0xC6,0x6B,0x6B,0x2D,0x71,0x14,0xB0,0x47,0x6F,0x65,0x7A,0x43,0xF1,
+    0x55,0x43,0xFF,0x94,0xE6,0x2B,0x9D,0xCD,0xD7,0xEB,0xDE,0x77,0xDC,0xE0,0xD9,0x36,
+    0xC7,0x5A,0xF0,0x5E,0xC3,0x88,0x5E,0x24,0x5B,0xE4,0xCE,0x84,0x4D,0x60,0x46,0xA7,
+    0xDB,0x69,0x7B,0xB3,0xEB,0xB6,0xC9,0xE5,0xE2,0x0A,0x08,0x2D,0x8E,0xE2,0x07,0xC7,
+    0x76,0x3C,0x83,0x43,0x23,0xC4,0xF2,0x8C,0x07,0x0D,0xA5,0x47,0x41,0x9A,0xF5,0xE8,
+    0x77,0x86,0xD8,0xB6,0x26,0x4C,0xA7,0x11,0x42,0xBA,0xC1,0x0C,0x3B,0xCD,0x52,0x8F,
+    0xBD,0x37,0x19,0x5C,0xDA,0xB1,0x76,0x2D,0x6E,0x5D,0x31,0xE6,0xFA,0xC5,0x56,0xCF,
+    0x3F,0xBE,0x80,0xBC,0xED,0x4E,0xDC,0x14,0xC0,0x32,0xC0,0xAC,0xD2,0x7E,0x0C,0x69,
+    0x3F,0xBE,0xB6,0x97,0x86,0xB8,0x1E,0x23,0x6A,0x19,0xBF,0x55,0x0E,0x62,0xBD,0x1C,
+    0x88,0xD4,0xA1,0x66,0x33,0x4D,0xAD,0xAE,0x07,0x3D,0x50,0xCF,0x0D,0x39,0x15,0xAA,
+    0xB1,0xE8,0x3D,0xAF,0xE7,0x40,0xC6,0xBA,0x6F,0x23,0x18,0x58,0x16,0x4B,0xBB,0x0C,
+    0xD5,0x94,0xA8,0x92,0xA1,0x32,0x89,0x21,0x43,0x3D,0x4A,0xAA,0x87,0x48,0xC6,0xBA,
+    0x6F,0x23,0x18,0x58,0x16,0x45,0x6B,0xA3,0x7B,0xAB,0x96,0xEE,0x49,0x94,0x6E,0x92,
+    0xA4,0x6D,0x08,0x2B,0xAA,0x1C,0xB0,0x19,0x88,0xCF,0xEC,0x98,0x62,0x00,0xD0,0x65,
+    0xA9,0x84,0x31,0x59,0x56,0x7A,0x5B,0x51,0x75,0x96,0x6A,0x69,0x14,0x09,0x5B,0xA0,
+    0x59,0x61,0xDA,0xE2,0x99,0x95,0x80,0x90,0x64,0x64,0x1A,0xB3,0xAC,0x4E,0x55,0x55,
+    0x2C,0x77,0x22,0xB8,0x5F,0xA9,0xD8,0x56,0x17,0x61,0x11,0xEF,0x3D,0x68,0xEE,0x1E,
+    0x78,0x04,0xA6,0x3B,0x40,0xFF,0xC0,0xB0,0x0F,0x74,0xFA,0xA6,0x96,0x82,0x2C,0x97,
+    0x2E,0x34,0x0D,0xAE,0xD6,0xD1,0x56,0x8B,0x16,0x33,0x0C,0x2F,0x2E,0xAC,0x91,0xA1,
+    0x8E,0x03,0x7F,0xCB,0xA9,0xCF,0xAF,0x8C,0xBD,0xA6,0xFE,0x61,0x3D,0x86,0x17,0xA8,
+    0x2F,0xC9,0x62,0x11,0xB9,0x6D,0x02,0x23,0xFB,0x5C,0x4C,0xD6,0xF0,0xCA,0xB8,0x72,
+    0xAB,0xE9,0x9D,0x23,0x63,0x33,0x55,0x26,0x48,0xA1,0x32,0x53,0xBA,0x14,0x9E,0x69,
+    0x7C,0x69,0x0A,0xE4,0xDD,0x4C,0xC6,0xD3,0xC3,0xA1,0x86,0xEA,0x1C,0x05,0xEC,0xC8,
+    0xDC,0x6E,0x68,0x86,0x91,0x39,0x69,0x7A,0x66,0xF2,0x38,0x36,0xE1,0xEB,0xA7,0xA1,
+    0x4B,0x22,0x47,0xC9,0x0D,0xD5,0xE8,0xAC,0x90,0xE8,0xEB,0xEB,0x78,0x31,0xE9,0xF4,
+    0x92,0x4C,0x8C,0x59,0x45,0xEB,0x4C,0x1F,0xD5,0xA4,0xD1,0x36,0xAF,0x68,0xFA,0xA4,
+    0xB6,0x99,0xE5,0x6E,0x10,0xE5,0x75,0x9C,0x54,0xB3,0xCA,0x3A,0xA3,0xF0,0xA9,0xD7,
+    0xE5,0x4F,0xBE,0x11,0xEA,0xE6,0x8C,0x52,0x50,0xAE,0x79,0x8F,0x8E,0xCE,0x3F,0xAF,
+    0x0D,0x0E,0x75,0x39,0x2E,0x55,0xA5,0xE4,0x4D,0xAB,0xEB,0xF5,0x8C,0x4F,0x6B,0x16,
+    0xA1,0xD1,0x2C,0x1F,0x0E,0x5A,0xF7,0x10,0x72,0x6B,0x88,0x1E,0xFF,0x70,0x68,0x44,
+    0x72,0x9B,0x7E,0xFA,0x70,0x98,0x78,0x02,0x69,0x24,0xB0,0xFE,0xDE,0xA3,0x97,0x08,
+    0xE6,0xB9,0x6C,0x45,0xA2,0x23,0xCD,0x89,0x7F,0xBC,0xC6,0xC5,0x40,0x3E,0x2D,0xE4,
+    0xC4,0x02,0xEA,0x76,0x30,0xF1,0x13,0xBC,0x60,0xF0,0x4B,0xF4,0x7C,0x81,0x22,0x38,
+    0x4F,0x08,0xC4,0x97,0xE8,0x37,0x7D,0xD9,0x11,0x99,0x10,0xD9,0x93,0x95,0x7E,0x6B,
+    0xAE,0x2E,0x84,0x1F,0xB9,0x0D,0x0F,0xD9,0x4F,0xB6,0xB3,0x9C,0xE1,0x26,0xF9,0x4E,
+    0xE1,0x8E,0xFE,0x29,0x1E,0x9B,0x38,0x92,0xAF,0x1A,0x44,0x0C,0xD0,0xC5,0x82,0xDF,
+    0x87,0x1E,0xFA,0xCE,0x6A,0xA8,0xDF,0x01,0xBB,0xA3,0xF1,0x28,0x9A,0x3C,0xD7,0xC4,
+    0x52,0x3A,0x75,0x56,0x46,0xB2,0x79,0xCC,0xF9,0x95,0xD8,0x75,0x25,0xDF,0xCB,0x23,
+    0x59,0xE5,0x59,0x67,0xB7,0xD9,0x3A,0x89,0x23,0x70,0x47,0xFF,0x68,0xE9,0xC5,0x44,
+    0x83,0xD4,0x3A,0xAD,0xC6,0xCC,0xB8,0xBE,0xCF,0xEA,0xB2,0x08,0xCB,0x32,0xEF,0xB2,
+    0xCF,0x94,0x65,0x77,0x5F,0xDB,0x15,0xA3,0xF3,0x28,0x41,0xB7,0x27,0xB4,0x6E,0xF7,
+    0x52,0x70,0x12,0x54,0xE8,0x8D,0xF9,0x50,0xD8,0x4C,0x3A,0x72,0xBA,0x3C,0xAE,0x26,
+    0xC7,0xBC,0x87,0x76,0x06,0xC3,0x63,0x28,0x72,0xA0,0x5C,0x93,0x2B,0xD0,0x83,0x4E,
+    0x9D,0x41,0x6D,0x29,0x12,0x9E,0x2B,0x34,0x0D,0x78,0xA4,0x6A,0x01,0x0C,0x0D,0x7D,
+    0xD6,0xEC,0x98,0x61,0xB8,0x2D,0x7C,0x00,0xCD,0x35,0x2A,0x39,0x9E,0x33,0xF1,0x86,
+    0xB1,0x6D,0x06,0xBF,0xEB,0xBB,0x7A,0x13,0x44,0x78,0xA6,0xD1,0x68,0x09,0x56,0x8F,
+    0xCE,0x4D,0xDD,0xF9,0x80,0xBF,0x81,0x69,0xB4,0x30,0xCA,0x3F,0x7E,0x8B,0x14,0x9C,
+    0xD6,0x37,0x6D,0xE4,0x5F,0xEA,0xD0,0x1C,0x1F,0xD7,0xA0,0x9E,0x53,0x5A,0x34,0xA8,
+    0x61,0xCD,0xE6,0x66,0x92,0x69,0xC1,0xD7,0xA0,0x61,0x3B,0xAA,0x05,0x82,0xF1,0xAE,
+    0x82,0x8F,0xFD,0x6C,0xEE,0xAA,0xBA,0x68,0xA6,0xF2,0x87,0x48,0x81,0x27,0x68,0x41,
+    0xBA,0xBC,0x89,0x5A,0xE9,0x27,0x64,0xA3,0xE8,0xD4,0x36,0x91,0x50,0x96,0xDB,0x48,
+    0x3F,0x9C,0x70,0x26,0xED,0xD2,0x37,0xAF,0x5E,0xBC,0xFD,0x72,0x3B,0x8A,0x26,0xE3,
+    0x1F,0xCB,0x4A,0x01,0x31,0x2C,0xA4,0xEE,0x72,0xEB,0x4F,0x4C,0xDB,0xCA,0xC5,0xAE,
+    0x87,0x4A,0xD3,0xA4,0xAE,0x1E,0x71,0xB4,0xC0,0xD2,0x16,0x65,0x65,0x8B,0x87,0x68,
+    0x1A,0x3E,0x5C,0x77,0x45,0x6A,0xBF,0xE9,0x09,0x1F,0xEA,0xEB,0xC5,0x72,0x17,0x69,
+    0x27,0xFF,0xA1,0x9B,0x9F,0x2E,0x4F,0x93,0x3B,0xC7,0x10,0x3B,0xD3,0x10,0xB6,0x83,
+    0xA7,0x8C,0x33,0xF1,0x97,0xBB,0x8E,0x71,0x3A,0xC1,0xAC,0xE3,0xF4,0xDA,0xC6,0x2A,
+    0x9A,0xF1,0x9E,0xCB,0x1E,0x5F,0x26,0xF1,0x8F,0xDF,0x96,0x14,0x1A,0x31,0xBA,0x27,
+    0xAD,0x2D,0x58,0xEB,0x65,0xD8,0xC5,0x45,0x1F,0xB4,0xFE,0x94,0xA5,0x72,0xFD,0x2A,
+    0x81,0xDB,0xE4,0x2A,0xB9,0x3E,0x63,0x13,0xA0,0xD5,0xEE,0xE7,0xE6,0x8D,0xFA,0xF6,
+    0x7C,0x5A,0x25,0xF7,0xFE,0x2A,0x31,0xA3,0x44,0x2F,0xBE,0x2E,0x27,0x21,0x5B,0x43,
+    0xCF,0x1B,0x81,0x8F,0xAD,0x59,0x40,0x20,0xCD,0x69,0x42,0xF3,0xC3,0xA1,0x7E,0xB7,
+    0x61,0xC9,0x2E,0x02,0xAF,0x7E,0x3C,0x1C,0xA6,0xE1,0x59,0x11,0x03,0x02,0x9E,0x0E,
+    0x19,0x03,0xA9,0x37,0x66,0xCA,0xF3,0xAF,0xE8,0xAD,0x7C,0xF9,0x15,0x37,0x76,0x3F,
+    0x96,0x6F,0x81,0xB5,0x31,0xAE,0xF8,0x72,0xC0,0x2F,0x8C,0x59,0x79,0x97,0x84,0xEA,
+    0xCA,0x42,0x7D,0x5F,0xF3,0x15,0x45,0xE7,0xE3,0x89,0xF6,0xBD,0xD5,0xFC,0x92,0xC2,
+    0xE2,0x03,0x83,0xFF,0x89,0xEC,0x6E,0xE2,0xEA,0x99,0xDD,0xE6,0x37,0x6E,0x9D,0x05,
+    0xC9,0x0B,0xF6,0x47,0x04,0x2D,0x24,0x6A,0x7E,0xFF,0x09,0x76,0x36,0xA7,0xE1,0xCA,
+    0x38,0xCA,0xD8,0x17,0x17,0xE6,0xF3,0x93,0x88,0x7F,0x7D,0x55,0x47,0x71,0x2B,0x33,
+    0x2B,0x5C,0xF9,0xA5,0x8F,0xE7,0xEF,0x22,0x33,0x60,0x35,0xF0,0xF4,0x5E,0x9C,0x43,
+    0xFE,0xA1,0x11,0x94,0x19,0x25,0xDA,0xB6,0x1D,0x5F,0x5B,0x7F,0xA7,0xBE,0xB9,0x29,
+    0x1E,0x09,0x9B,0xAF,0xCC,0x73,0x6B,0xBC,0xFB,0xE7,0x2F,0x5A,0x0B,0xEC,0x3C,0xE5,
+    0x56,0x43,0xF9,0xD3,0xA0,0x79,0x7A,0x1A,0xEC,0x5B,0x01,0xCA,0xC9,0xAA,0xC1,0xBB,
+    0x44,0x93,0x9F,0x0D,0x3C,0x0D,0xD4,0xEB,0xB5,0x40,0xCB,0x4B,0x1C,0xF0,0x62,0x93,
+    0x0B,0x71,0xF4,0x0E,0x4F,0x18,0x71,0xB8,0xF5,0x2E,0xAF,0x3C,0x69,0x48,0xDF,0x06,
+    0x05,0xB0,0xBF,0xF3,0x3B,0xFC,0x0A,0x86,0x33,0x9B,0x58,0x82,0x50,0xE7,0x3C,0x69,
+    0xDB,0xCB,0x52,0x3A,0x6F,0x1B,0x4A,0xE7,0xED,0x78,0x96,0x35,0x3D,0x74,0x23,0xDF,
+    0x60,0x98,0xF1,0x51,0xF7,0x3A,0xDE,0xFE,0xC4,0x61,0x1D,0x1E,0x09,0xC2,0xE1,0xF4,
+    0x88,0x74,0x5F,0x41,0xA0,0x93,0xB1,0x8F,0xE3,0x76,0xD8,0xC8,0x10,0x39,0x9F,0x84,
+    0xAD,0x07,0x3C,0x62,0x13,0x03,0x53,0x16,0xAE,0xA3,0xA7,0xEB,0xE2,0xE2,0x28,0x08,
+    0x8E,0xC6,0x20,0xA5,0x29,0x1E,0x68,0xB9,0x49,0xE5,0xBA,0xF2,0xAC,0xC2,0x24,0xE6,
+    0x32,0xB6,0x06,0xBC,0xFA,0xD8,0xA3,0x9E,0xCF,0xB4,0x86,0x02,0xFC,0x8E,0xED,0x1D,
+    0x07,0xA2,0xAD,0x57,0xDF,0xCE,0xE5,0xC4,0x4A,0x0C,0xD6,0xCD,0xEA,0x63,0x7C,0xB9,
+    0x63,0xA3,0xE1,0xDB,0x24,0x6B,0x3E,0xD5,0x69,0xBE,0xCC,0xB1,0x12,0xD7,0xBE,0x33,
+    0xB2,0x49,0x7F,0x92,0x38,0xDA,0xBE,0xE1,0x8B,0x1F,0x68,0x11,0xF5,0x5D,0xC6,0x9E,
+    0x4F,0x82,0xCE,0x1D,0xAA,0xCE,0x29,0x18,0x15,0x9B,0x1C,0xDF,0xF1,0x7B,0xB7,0x69,
+    0x09,0x4F,0x61,0x5E,0x71,0x25,0xFE,0xBF,0x7C,0x0C,0xA3,0xD4,0x7C,0x4E,0xDD,0x4F,
+    0xAA,0x8B,0x97,0x35,0x42,0x2D,0x0A,0xE8,0xF6,0xF1,0xFB,0x6E,0x79,0x9E,0x85,0x92,
+    0x21,0xA2,0x6E,0x81,0xEE,0x61,0x1B,0x5D,0x75,0xDB,0xBA,0xFA,0xEB,0xC7,0xDA,0xC1,
+    0xAD,0x06,0xCA,0x7E,0xB3,0x10,0xF5,0x1A,0xF8,0xFF,0x96,0x32,0x92,0xFC,0xD1,0x6F,
+    0xEC,0xB3,0x2D,0xFB,0x3F,0x38,0x65,0xF8,0xC3,0x5F,0xE5,0x62,0xD3,0xCA,0x01,0x2D,
+    0x63,0x5C,0x5C,0x2C,0xB7,0xD7,0x8D,0xE1,0xBC,0xC3,0xC1,0x3D,0x85,0x7E,0xA3,0xA1,
+    0x2B,0xC3,0x6F,0x9B,0xE9,0x1E,0xF3,0x7C,0xD6,0x0A,0xF6,0xAE,0x4B,0x5D,0xB6,0xE5,
+    0x68,0xEA,0x22,0x6A,0xB1,0x29,0x2B,0x94,0x1D,0xC3,0x73,0x9D,0xBA,0xDC,0x0E,0x15,
+    0xC1,0xE1,0x55,0x00,0xD7,0x35,0xF5,0xF0,0x0D,0x87,0xE3,0xE4,0x80,0xA6,0x13,0xF3,
+    0xAC,0xF0,0x6D,0x97,0x3E,0x1E,0xDE,0xF2,0x6D,0x80,0x75,0x43,0x25,0xA2,0x7D,0x23,
+    0xFC,0x74,0xAF,0x1A,0xED,0x41,0x2C,0xB7,0x6C,0x6D,0xD4,0x66,0xCA,0xC4,0xC7,0x36,
+    0xD0,0x05,0x55,0x1F,0xA8,0x66,0x28,0xBE,0x72,0x53,0xF1,0xDE,0xAA,0x9A,0x2E,0xA9,
+    0xC7,0xEB,0xE9,0xE4,0xF9,0x60,0x32,0x08,0x06,0x03,0x6F,0x28,0x57,0xCA,0xFA,0x63,
+    0x4A,0xD8,0xC3,0xE9,0xF0,0xF1,0xE2,0xAF,0x74,0x93,0x17,0xAE,0xE7,0x0D,0x01,0x73,
+    0x68,0x40,0x20,0x11,0x6F,0x18,0xB6,0xC3,0xE0,0x56,0x49,0xC5,0xF7,0x39,0x5E,0x19,
+    0xAA,0xBF,0x53,0x19,0x6B,0x1F,0xD8,0x34,0xFF,0xAC,0xA1,0x86,0x72,0xE6,0x1B,0xCF,
+    0xD2,0x53,0x7F,0x3E,0xE2,0x28,0x64,0xFE,0x37,0x23,0xD0,0x1B,0xE1,0x05,0x84,0x7F,
+    0x3C,0x78,0xCE,0x8B,0x40,0x50,0xFD,0x35,0x4C,0xF8,0x5F,0xEE,0x7D,0xDE,0x8B,0xD2,
+    0x35,0x00,0x00,
+};
+
+static const unsigned char data_js_smoothie_min_js_gz_304[] = {
+
+    /* "HTTP/1.1 304 Not Modified" (27 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x33,0x30,0x34,0x20,0x4E,0x6F,0x74,
+    0x20,0x4D,0x6F,0x64,0x69,0x66,0x69,0x65,0x64,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "75a12dec81e19d75"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x37,0x35,0x61,0x31,0x32,0x64,0x65,0x63,0x38,
+    0x31,0x65,0x31,0x39,0x64,0x37,0x35,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (32 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,0x0D,0x0A,
+};
+
+static const unsigned char data_js_smoothie_min_js_gz_206[] = {
+
+    /* "HTTP/1.1 206 Partial Content" (30 chars) */
+    0x48,0x54,0x54,0x50,0x2F,0x31,0x2E,0x31,0x20,0x32,0x30,0x36,0x20,0x50,0x61,0x72,
+    0x74,0x69,0x61,0x6C,0x20,0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x0D,0x0A,
+
+    /* "Server: lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)" (64 chars) */
+    0x53,0x65,0x72,0x76,0x65,0x72,0x3A,0x20,0x6C,0x77,0x49,0x50,0x2F,0x32,0x2E,0x32,
+    0x2E,0x30,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3A,0x2F,0x2F,0x73,0x61,0x76,0x61,
+    0x6E,0x6E,0x61,0x68,0x2E,0x6E,0x6F,0x6E,0x67,0x6E,0x75,0x2E,0x6F,0x72,0x67,0x2F,
+    0x70,0x72,0x6F,0x6A,0x65,0x63,0x74,0x73,0x2F,0x6C,0x77,0x69,0x70,0x29,0x0D,0x0A,
+
+    /* "Content-Encoding: gzip" (24 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x45,0x6E,0x63,0x6F,0x64,0x69,0x6E,0x67,
+    0x3A,0x20,0x67,0x7A,0x69,0x70,0x0D,0x0A,
+
+    /* "Vary: Accept-Encoding" (23 chars) */
+    0x56,0x61,0x72,0x79,0x3A,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2D,0x45,0x6E,0x63,
+    0x6F,0x64,0x69,0x6E,0x67,0x0D,0x0A,
+
+    /* "ETag: "75a12dec81e19d75"" (26 chars) */
+    0x45,0x54,0x61,0x67,0x3A,0x20,0x22,0x37,0x35,0x61,0x31,0x32,0x64,0x65,0x63,0x38,
+    0x31,0x65,0x31,0x39,0x64,0x37,0x35,0x22,0x0D,0x0A,
+
+    /* "Cache-Control: max-age=86400" (30 chars) */
+    0x43,0x61,0x63,0x68,0x65,0x2D,0x43,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x3A,0x20,0x6D,
+    0x61,0x78,0x2D,0x61,0x67,0x65,0x3D,0x38,0x36,0x34,0x30,0x30,0x0D,0x0A,
+
+    /* "Content-Type: application/javascript" (38 chars) */
+    0x43,0x6F,0x6E,0x74,0x65,0x6E,0x74,0x2D,0x54,0x79,0x70,0x65,0x3A,0x20,0x61,0x70,
+    0x70,0x6C,0x69,0x63,0x61,0x74,0x69,0x6F,0x6E,0x2F,0x6A,0x61,0x76,0x61,0x73,0x63,
+    0x72,0x69,0x70,0x74,0x0D,0x0A,
+};
+
+static const struct fsdata_etag etag_js_smoothie_min_js_gz[] = {{
+    "\"75a12dec81e19d75\"",
+    data_js_smoothie_min_js_gz_304,
+    sizeof(data_js_smoothie_min_js_gz_304),
+    data_js_smoothie_min_js_gz_206,
+    sizeof(data_js_smoothie_min_js_gz_206),
+    268,
+}};
+
+const struct fsdata_file file_complete_html_gz[] = {{
+    NULL,
+    data_complete_html_gz,
+    data_complete_html_gz + 16,
+    sizeof(data_complete_html_gz) - 16,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_complete_html_gz,
+    NULL,
+}};
+
 const struct fsdata_file file_complete_html[] = {{
     NULL,
     data_complete_html,
     data_complete_html + 16,
     sizeof(data_complete_html) - 16,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_complete_html_gz,
+    etag_complete_html,
+    NULL,
+}};
+
+const struct fsdata_file file_config_html_gz[] = {{
+    NULL,
+    data_config_html_gz,
+    data_config_html_gz + 16,
+    sizeof(data_config_html_gz) - 16,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_config_html_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_config_html[] = {{
@@ -17755,6 +22322,20 @@ const struct fsdata_file file_config_html[] = {{
     data_config_html + 16,
     sizeof(data_config_html) - 16,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_config_html_gz,
+    etag_config_html,
+    NULL,
+}};
+
+const struct fsdata_file file_error_html_gz[] = {{
+    NULL,
+    data_error_html_gz,
+    data_error_html_gz + 12,
+    sizeof(data_error_html_gz) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_error_html_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_error_html[] = {{
@@ -17763,6 +22344,20 @@ const struct fsdata_file file_error_html[] = {{
     data_error_html + 12,
     sizeof(data_error_html) - 12,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_error_html_gz,
+    etag_error_html,
+    NULL,
+}};
+
+const struct fsdata_file file_index_html_gz[] = {{
+    NULL,
+    data_index_html_gz,
+    data_index_html_gz + 12,
+    sizeof(data_index_html_gz) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_index_html_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_index_html[] = {{
@@ -17771,14 +22366,42 @@ const struct fsdata_file file_index_html[] = {{
     data_index_html + 12,
     sizeof(data_index_html) - 12,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_index_html_gz,
+    etag_index_html,
+    NULL,
 }};
 
-const struct fsdata_file file_css_common_css[] = {{
+const struct fsdata_file file_status_shtml[] = {{
     file_index_html,
+    data_status_shtml,
+    data_status_shtml + 16,
+    sizeof(data_status_shtml) - 16,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_SSI,
+    NULL,
+    NULL,
+    ssi_status_shtml,
+}};
+
+const struct fsdata_file file_css_common_css[] = {{
+    file_status_shtml,
     data_css_common_css,
     data_css_common_css + 16,
     sizeof(data_css_common_css) - 16,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_css_common_css,
+    NULL,
+}};
+
+const struct fsdata_file file_css_fonts_css_gz[] = {{
+    NULL,
+    data_css_fonts_css_gz,
+    data_css_fonts_css_gz + 16,
+    sizeof(data_css_fonts_css_gz) - 16,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_css_fonts_css_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_css_fonts_css[] = {{
@@ -17787,6 +22410,20 @@ const struct fsdata_file file_css_fonts_css[] = {{
     data_css_fonts_css + 16,
     sizeof(data_css_fonts_css) - 16,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_css_fonts_css_gz,
+    etag_css_fonts_css,
+    NULL,
+}};
+
+const struct fsdata_file file_css_siimple_min_ice_css_gz[] = {{
+    NULL,
+    data_css_siimple_min_ice_css_gz,
+    data_css_siimple_min_ice_css_gz + 28,
+    sizeof(data_css_siimple_min_ice_css_gz) - 28,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_css_siimple_min_ice_css_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_css_siimple_min_ice_css[] = {{
@@ -17795,6 +22432,20 @@ const struct fsdata_file file_css_siimple_min_ice_css[] = {{
     data_css_siimple_min_ice_css + 28,
     sizeof(data_css_siimple_min_ice_css) - 28,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_css_siimple_min_ice_css_gz,
+    etag_css_siimple_min_ice_css,
+    NULL,
+}};
+
+const struct fsdata_file file_css_style_css_gz[] = {{
+    NULL,
+    data_css_style_css_gz,
+    data_css_style_css_gz + 16,
+    sizeof(data_css_style_css_gz) - 16,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_css_style_css_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_css_style_css[] = {{
@@ -17803,6 +22454,9 @@ const struct fsdata_file file_css_style_css[] = {{
     data_css_style_css + 16,
     sizeof(data_css_style_css) - 16,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_css_style_css_gz,
+    etag_css_style_css,
+    NULL,
 }};
 
 const struct fsdata_file file_font_latin_woff2[] = {{
@@ -17811,6 +22465,9 @@ const struct fsdata_file file_font_latin_woff2[] = {{
     data_font_latin_woff2 + 20,
     sizeof(data_font_latin_woff2) - 20,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_font_latin_woff2,
+    NULL,
 }};
 
 const struct fsdata_file file_font_latin_ext_woff2[] = {{
@@ -17819,6 +22476,9 @@ const struct fsdata_file file_font_latin_ext_woff2[] = {{
     data_font_latin_ext_woff2 + 24,
     sizeof(data_font_latin_ext_woff2) - 24,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_font_latin_ext_woff2,
+    NULL,
 }};
 
 const struct fsdata_file file_img_favicon_png[] = {{
@@ -17827,6 +22487,20 @@ const struct fsdata_file file_img_favicon_png[] = {{
     data_img_favicon_png + 20,
     sizeof(data_img_favicon_png) - 20,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_img_favicon_png,
+    NULL,
+}};
+
+const struct fsdata_file file_js_iro_js_gz[] = {{
+    NULL,
+    data_js_iro_js_gz,
+    data_js_iro_js_gz + 12,
+    sizeof(data_js_iro_js_gz) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_js_iro_js_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_js_iro_js[] = {{
@@ -17835,6 +22509,20 @@ const struct fsdata_file file_js_iro_js[] = {{
     data_js_iro_js + 12,
     sizeof(data_js_iro_js) - 12,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_js_iro_js_gz,
+    etag_js_iro_js,
+    NULL,
+}};
+
+const struct fsdata_file file_js_smoothie_min_js_gz[] = {{
+    NULL,
+    data_js_smoothie_min_js_gz,
+    data_js_smoothie_min_js_gz + 20,
+    sizeof(data_js_smoothie_min_js_gz) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    NULL,
+    etag_js_smoothie_min_js_gz,
+    NULL,
 }};
 
 const struct fsdata_file file_js_smoothie_min_js[] = {{
@@ -17843,7 +22531,34 @@ const struct fsdata_file file_js_smoothie_min_js[] = {{
     data_js_smoothie_min_js + 20,
     sizeof(data_js_smoothie_min_js) - 20,
     FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+    file_js_smoothie_min_js_gz,
+    etag_js_smoothie_min_js,
+    NULL,
 }};
 
 #define FS_ROOT file_js_smoothie_min_js
-#define FS_NUMFILES 13
+#define FS_NUMFILES 14
+
+#define FS_HASH_SIZE 14
+
+static const u16_t fs_hash_seed[FS_HASH_SIZE] = {
+    1, 0, 0, 1, 1, 1, 4, 1,
+    0, 0, 5, 26, 0, 2,
+};
+
+static const struct fsdata_file * const fs_hash_table[FS_HASH_SIZE] = {
+    file_css_common_css,
+    file_index_html,
+    file_status_shtml,
+    file_css_siimple_min_ice_css,
+    file_font_latin_ext_woff2,
+    file_complete_html,
+    file_js_iro_js,
+    file_css_fonts_css,
+    file_error_html,
+    file_css_style_css,
+    file_font_latin_woff2,
+    file_js_smoothie_min_js,
+    file_img_favicon_png,
+    file_config_html,
+};
@@ -1,6 +1,8 @@
 #!/usr/bin/env python3
 import os
 import sys
+import gzip
+import hashlib
 import argparse
 from pathlib import Path
 
@@ -30,17 +32,149 @@ file_types = {
 }
 
 response_types = {
-  200: "HTTP/1.0 200 OK",
-  400: "HTTP/1.0 400 Bad Request",
-  404: "HTTP/1.0 404 File not found",
-  501: "HTTP/1.0 501 Not Implemented",
+  200: "HTTP/1.1 200 OK",
+  400: "HTTP/1.1 400 Bad Request",
+  404: "HTTP/1.1 404 File not found",
+  501: "HTTP/1.1 501 Not Implemented",
 }
 
+NOT_MODIFIED_RESPONSE = "HTTP/1.1 304 Not Modified"
+PARTIAL_CONTENT_RESPONSE = "HTTP/1.1 206 Partial Content"
+
+# Pages are revalidated on every load, the rest is cached for a while
+cache_control_types = {
+    "html": "no-cache",
+    "htm":  "no-cache",
+    "css":  "max-age=86400",
+    "js":   "max-age=86400",
+    "png":  "max-age=604800",
+    "ico":  "max-age=604800",
+    "woff2": "max-age=604800",
+}
+CACHE_CONTROL_DEFAULT = "max-age=3600"
+
 PAYLOAD_ALIGNMENT = 4
 HTTPD_SERVER_AGENT = "lwIP/2.2.0d (http://savannah.nongnu.org/projects/lwip)"
 LWIP_HTTPD_SSI_EXTENSIONS = [".shtml", ".shtm", ".ssi", ".xml", ".json"]
+# Store the gzip variant only if it saves at least this part of the file
+GZIP_MIN_SAVING = 0.1
+
+# Must match the SSI tag markers and LWIP_HTTPD_MAX_TAG_NAME_LEN of http/daemon/httpd.c
+SSI_TAG_LEAD_IN = b"<!--#"
+SSI_TAG_LEAD_OUT = b"-->"
+SSI_MAX_TAG_NAME_LEN = 8
+
+FS_HASH_FNV_BASIS = 0x811C9DC5
+FS_HASH_FNV_PRIME = 0x01000193
+FS_HASH_MAX_SEED = 0xFFFF
+
+# Must match fs_hash_name() in http/daemon/fs.c
+def fs_hash_name(name):
+    h = FS_HASH_FNV_BASIS
+    for b in name:
+        h = ((h ^ b) * FS_HASH_FNV_PRIME) & 0xFFFFFFFF
+    return h
 
-def process_file(input_dir, file):
+# Must match fs_hash_mix() in http/daemon/fs.c
+def fs_hash_mix(h, seed):
+    h ^= seed
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+# Builds a minimal perfect hash (hash and displace): the name hash selects
+# a bucket, the bucket seed is mixed into the same hash to select the slot.
+# Returns the seed per bucket and the file index per slot.
+def make_perfect_hash(names):
+    size = len(names)
+    hashes = [fs_hash_name(name) for name in names]
+    if len(set(hashes)) != size:
+        raise RuntimeError("File name hash collision, rename one of the files")
+
+    buckets = [[] for _ in range(size)]
+    for index, h in enumerate(hashes):
+        buckets[h % size].append(index)
+
+    seeds = [0] * size
+    slots = [None] * size
+    # Place the largest buckets first while most of the slots are free
+    for bucket in sorted(range(size), key=lambda b: len(buckets[b]), reverse=True):
+        if not buckets[bucket]:
+            break
+        for seed in range(1, FS_HASH_MAX_SEED + 1):
+            taken = [fs_hash_mix(hashes[index], seed) % size for index in buckets[bucket]]
+            if len(set(taken)) == len(taken) and all(slots[slot] is None for slot in taken):
+                break
+        else:
+            raise RuntimeError("Perfect hash seed not found")
+        seeds[bucket] = seed
+        for index, slot in zip(buckets[bucket], taken):
+            slots[slot] = index
+    return seeds, slots
+
+# Finds the SSI tags exactly like the tag state machine of http_send_data_ssi()
+# does at runtime. Returns the offset of the lead-in, the offset following the
+# lead-out and the name of every tag.
+def make_ssi_tags(data):
+    tags = []
+    state = "none"
+    index = 0
+    for offset, c in enumerate(data):
+        if state == "none":
+            if c == SSI_TAG_LEAD_IN[0]:
+                state = "leadin"
+                index = 1
+                start = offset
+        elif state == "leadin":
+            if c == SSI_TAG_LEAD_IN[index]:
+                index += 1
+                if index == len(SSI_TAG_LEAD_IN):
+                    state = "found"
+                    name = b""
+            else:
+                state = "none"
+        elif state == "found":
+            if not name and c in b" \t\n\r":
+                continue
+            if c == SSI_TAG_LEAD_OUT[0] or c in b" \t\n\r":
+                if not name:
+                    state = "none"
+                else:
+                    state = "leadout"
+                    index = 1 if c == SSI_TAG_LEAD_OUT[0] else 0
+            elif len(name) < SSI_MAX_TAG_NAME_LEN:
+                name += bytes([c])
+            else:
+                state = "none"
+        elif state == "leadout":
+            if index == 0 and c in b" \t\n\r":
+                continue
+            if c != SSI_TAG_LEAD_OUT[index]:
+                state = "none"
+            elif index == len(SSI_TAG_LEAD_OUT) - 1:
+                tags.append((start, offset + 1, name.decode("ascii")))
+                state = "none"
+            else:
+                index += 1
+    return tags
+
+def get_response_type(file):
+    for response_id in response_types:
+        if file.name.startswith(f"{response_id}."):
+            return response_id
+    return 200
+
+def get_cache_control(file):
+    return cache_control_types.get(file.suffix[1:].lower(), CACHE_CONTROL_DEFAULT)
+
+# Strong entity tag of the bytes sent, so each encoding gets its own tag
+def make_etag(contents):
+    return f"\"{hashlib.sha1(contents).hexdigest()[:16]}\""
+
+def process_file(input_dir, file, contents, encoding=None, vary=False, etag=None):
     results = []
 
     # Check content type
@@ -58,11 +192,7 @@ def process_file(input_dir, file):
     results.append({'data': bytes(data, "utf-8"), 'comment': comment});
 
     # Header
-    response_type = 200
-    for response_id in response_types:
-        if file.name.startswith(f"{response_id}."):
-            response_type = response_id
-            break
+    response_type = get_response_type(file)
     data = f"{response_types[response_type]}\r\n"
     comment = f"\"{response_types[response_type]}\" ({len(data)} chars)"
     results.append({'data': bytes(data, "utf-8"), 'comment': comment});
@@ -74,23 +204,176 @@ def process_file(input_dir, file):
 
     if file.suffix not in LWIP_HTTPD_SSI_EXTENSIONS:
         # content length
-        file_size = file.stat().st_size
+        file_size = len(contents)
         data = f"Content-Length: {file_size}\r\n"
         comment = f"\"Content-Length: {file_size}\" ({len(data)} chars)"
         results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+        # no Connection header: the length delimits the response, httpd
+        # adds "Connection: close" when the connection does not persist
+
+    if encoding is not None:
+        data = f"Content-Encoding: {encoding}\r\n"
+        comment = f"\"Content-Encoding: {encoding}\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    if vary:
+        data = "Vary: Accept-Encoding\r\n"
+        comment = f"\"Vary: Accept-Encoding\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    if etag is not None:
+        # validators
+        data = f"ETag: {etag}\r\n"
+        comment = f"\"ETag: {etag}\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+        cache_control = get_cache_control(file)
+        data = f"Cache-Control: {cache_control}\r\n"
+        comment = f"\"Cache-Control: {cache_control}\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+        # validated files can be resumed
+        data = "Accept-Ranges: bytes\r\n"
+        comment = f"\"Accept-Ranges: bytes\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
 
     # content type
-    data = f"Content-Type: {content_type}\r\n\r\n"
+    data = f"Content-Type: {content_type}\r\n"
+    if file.suffix not in LWIP_HTTPD_SSI_EXTENSIONS:
+        data += "\r\n"
     comment = f"\"Content-Type: {content_type}\" ({len(data)} chars)"
     results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+    if file.suffix in LWIP_HTTPD_SSI_EXTENSIONS:
+        # SSI output has no known length, closing the connection ends it.
+        # httpd replaces this last line to send HTTP/1.1 responses in chunks.
+        data = "Connection: close\r\n\r\n"
+        comment = f"\"Connection: close\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
 
     # file contents
-    data = file.read_bytes()
-    comment = f"raw file data ({len(data)} bytes)"
-    results.append({'data': data, 'comment': comment});
+    if encoding is None:
+        comment = f"raw file data ({len(contents)} bytes)"
+    else:
+        comment = f"{encoding} file data ({len(contents)} bytes)"
+    results.append({'data': contents, 'comment': comment});
+
+    return results;
+
+# The 304 response repeats the validators and caching headers of the 200 one
+def process_not_modified(file, etag, vary):
+    results = []
+
+    data = f"{NOT_MODIFIED_RESPONSE}\r\n"
+    comment = f"\"{NOT_MODIFIED_RESPONSE}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    data = f"Server: {HTTPD_SERVER_AGENT}\r\n"
+    comment = f"\"Server: {HTTPD_SERVER_AGENT}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    if vary:
+        data = "Vary: Accept-Encoding\r\n"
+        comment = f"\"Vary: Accept-Encoding\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    data = f"ETag: {etag}\r\n"
+    comment = f"\"ETag: {etag}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    cache_control = get_cache_control(file)
+    data = f"Cache-Control: {cache_control}\r\n\r\n"
+    comment = f"\"Cache-Control: {cache_control}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
 
     return results;
 
+# The 206 response carries the headers of the 200 one, httpd appends the
+# Content-Range and Content-Length of the requested range
+def process_partial(file, etag, vary, encoding=None):
+    results = []
+
+    data = f"{PARTIAL_CONTENT_RESPONSE}\r\n"
+    comment = f"\"{PARTIAL_CONTENT_RESPONSE}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    data = f"Server: {HTTPD_SERVER_AGENT}\r\n"
+    comment = f"\"Server: {HTTPD_SERVER_AGENT}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    if encoding is not None:
+        data = f"Content-Encoding: {encoding}\r\n"
+        comment = f"\"Content-Encoding: {encoding}\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    if vary:
+        data = "Vary: Accept-Encoding\r\n"
+        comment = f"\"Vary: Accept-Encoding\" ({len(data)} chars)"
+        results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    data = f"ETag: {etag}\r\n"
+    comment = f"\"ETag: {etag}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    cache_control = get_cache_control(file)
+    data = f"Cache-Control: {cache_control}\r\n"
+    comment = f"\"Cache-Control: {cache_control}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    data = f"Content-Type: {file_types.get(file.suffix[1:].lower())}\r\n"
+    comment = f"\"{data[:-2]}\" ({len(data)} chars)"
+    results.append({'data': bytes(data, "utf-8"), 'comment': comment});
+
+    return results;
+
+def write_data(fd, data_var, results):
+    fd.write(f"static const unsigned char {data_var}[] = {{\n")
+    for entry in results:
+        fd.write(f"\n    /* {entry['comment']} */\n")
+        byte_count = 0;
+        for b in entry['data']:
+            if byte_count % 16 == 0:
+                fd.write("    ")
+            byte_count += 1
+            fd.write(f"0x{b:02X},")
+            if byte_count % 16 == 0:
+                fd.write("\n")
+        if byte_count % 16 != 0:
+             fd.write("\n")
+    fd.write(f"}};\n\n")
+
+def write_etag(fd, etag_var, data_var, partial_var, body_offset, etag):
+    literal = etag.replace("\"", "\\\"")
+    fd.write(f"static const struct fsdata_etag {etag_var}[] = {{{{\n")
+    fd.write(f"    \"{literal}\",\n")
+    fd.write(f"    {data_var},\n")
+    fd.write(f"    sizeof({data_var}),\n")
+    fd.write(f"    {partial_var},\n")
+    fd.write(f"    sizeof({partial_var}),\n")
+    fd.write(f"    {body_offset},\n")
+    fd.write(f"}}}};\n\n")
+
+# Offset of the file contents in the response, the name is not part of the file data
+def body_offset(results):
+    return sum(len(entry['data']) for entry in results[1:-1])
+
+# The tag list ends with an entry at the end of the file without a name
+def write_ssi_tags(fd, ssi_var, tags, size):
+    fd.write(f"static const struct fsdata_ssi_tag {ssi_var}[] = {{\n")
+    for start, end, name in tags:
+        fd.write(f"    {{{start}, {end}, \"{name}\"}},\n")
+    fd.write(f"    {{{size}, {size}, NULL}},\n")
+    fd.write(f"}};\n\n")
+
+def write_file(fd, file_var, next_var, data_var, name_size, flags, gzip_var, etag_var, ssi_var):
+    fd.write(f"const struct fsdata_file {file_var}[] = {{{{\n")
+    fd.write(f"    {next_var},\n")
+    fd.write(f"    {data_var},\n")
+    fd.write(f"    {data_var} + {name_size},\n")
+    fd.write(f"    sizeof({data_var}) - {name_size},\n")
+    fd.write(f"    {flags},\n")
+    fd.write(f"    {gzip_var},\n")
+    fd.write(f"    {etag_var},\n")
+    fd.write(f"    {ssi_var},\n")
+    fd.write(f"}}}};\n\n")
+
 def process_file_list(fd, input):
     data = []
     fd.write("#include \"fsdata.h\"\n")
@@ -104,7 +387,21 @@ def process_file_list(fd, input):
         # Take the input directory from the first file
         if input_dir is None:
             input_dir = file.parent
-        results = process_file(input_dir, file)
+        contents = file.read_bytes()
+
+        # Compressed variant, SSI files are parsed at runtime so stay raw
+        compressed = None
+        if file.suffix not in LWIP_HTTPD_SSI_EXTENSIONS:
+            compressed = gzip.compress(contents, compresslevel=9, mtime=0)
+            if len(compressed) > len(contents) * (1 - GZIP_MIN_SAVING):
+                compressed = None
+
+        # Dynamic (SSI) and error pages are never validated
+        cacheable = (file.suffix not in LWIP_HTTPD_SSI_EXTENSIONS) and (get_response_type(file) == 200)
+        vary = compressed is not None
+        etag = make_etag(contents) if cacheable else None
+
+        results = process_file(input_dir, file, contents, vary=vary, etag=etag)
 
         # make a variable name
         var_name = str(file.relative_to(input_dir))
@@ -115,20 +412,28 @@ def process_file_list(fd, input):
         file_var = f"file_{var_name}"
 
         # variable containing the raw data
-        fd.write(f"static const unsigned char {data_var}[] = {{\n")
-        for entry in results:
-            fd.write(f"\n    /* {entry['comment']} */\n")
-            byte_count = 0;
-            for b in entry['data']:
-                if byte_count % 16 == 0:
-                    fd.write("    ")
-                byte_count += 1
-                fd.write(f"0x{b:02X},")
-                if byte_count % 16 == 0:
-                    fd.write("\n")
-            if byte_count % 16 != 0:
-                 fd.write("\n")
-        fd.write(f"}};\n\n")
+        write_data(fd, data_var, results)
+        if etag is not None:
+            write_data(fd, f"{data_var}_304", process_not_modified(file, etag, vary))
+            write_data(fd, f"{data_var}_206", process_partial(file, etag, vary))
+            write_etag(fd, f"etag_{var_name}", f"{data_var}_304", f"{data_var}_206", body_offset(results), etag)
+        if compressed is not None:
+            gzip_etag = make_etag(compressed) if cacheable else None
+            gzip_results = process_file(input_dir, file, compressed, "gzip", True, gzip_etag)
+            write_data(fd, f"{data_var}_gz", gzip_results)
+            if gzip_etag is not None:
+                write_data(fd, f"{data_var}_gz_304", process_not_modified(file, gzip_etag, vary))
+                write_data(fd, f"{data_var}_gz_206", process_partial(file, gzip_etag, vary, "gzip"))
+                write_etag(fd, f"etag_{var_name}_gz", f"{data_var}_gz_304", f"{data_var}_gz_206",
+                           body_offset(gzip_results), gzip_etag)
+
+        # SSI tags are found here once instead of on every request, the
+        # offsets are relative to the file data following the name
+        ssi_var = "NULL"
+        if file.suffix in LWIP_HTTPD_SSI_EXTENSIONS:
+            ssi_var = f"ssi_{var_name}"
+            response = b"".join(entry['data'] for entry in results[1:])
+            write_ssi_tags(fd, ssi_var, make_ssi_tags(response), len(response))
 
         # set the flags
         flags = "FS_FILE_FLAGS_HEADER_INCLUDED"
@@ -138,22 +443,41 @@ def process_file_list(fd, input):
             flags += " | FS_FILE_FLAGS_SSI"
 
         # add variable details to the list
-        data.append({'data_var': data_var, 'file_var': file_var, 'name_size': len(results[0]['data']), 'flags': flags})
+        data.append({'data_var': data_var, 'file_var': file_var, 'name_size': len(results[0]['data']), 'flags': flags,
+                     'name': results[0]['data'].rstrip(b"\x00"), 'gzip': compressed is not None,
+                     'etag_var': f"etag_{var_name}" if etag is not None else "NULL", 'ssi_var': ssi_var})
 
     # generate the page details
     last_var = "NULL"
     for entry in data:
-        fd.write(f"const struct fsdata_file {entry['file_var']}[] = {{{{\n")
-        fd.write(f"    {last_var},\n")
-        fd.write(f"    {entry['data_var']},\n")
-        fd.write(f"    {entry['data_var']} + {entry['name_size']},\n")
-        fd.write(f"    sizeof({entry['data_var']}) - {entry['name_size']},\n")
-        fd.write(f"    {entry['flags']},\n")
-        fd.write(f"}}}};\n\n")
+        gzip_var = "NULL"
+        if entry['gzip']:
+            # The variant is reachable through its file only, not by name
+            gzip_var = f"{entry['file_var']}_gz"
+            gzip_etag_var = f"{entry['etag_var']}_gz" if entry['etag_var'] != "NULL" else "NULL"
+            write_file(fd, gzip_var, "NULL", f"{entry['data_var']}_gz", entry['name_size'], entry['flags'], "NULL",
+                       gzip_etag_var, "NULL")
+        write_file(fd, entry['file_var'], last_var, entry['data_var'], entry['name_size'], entry['flags'], gzip_var,
+                   entry['etag_var'], entry['ssi_var'])
         last_var = entry['file_var']
     fd.write(f"#define FS_ROOT {last_var}\n")
     fd.write(f"#define FS_NUMFILES {len(data)}\n")
 
+    # generate the file name index
+    seeds, slots = make_perfect_hash([entry['name'] for entry in data])
+    fd.write("\n")
+    fd.write(f"#define FS_HASH_SIZE {len(data)}\n")
+    fd.write("\n")
+    fd.write("static const u16_t fs_hash_seed[FS_HASH_SIZE] = {\n")
+    for i in range(0, len(seeds), 8):
+        fd.write("    " + " ".join(f"{seed}," for seed in seeds[i:i + 8]) + "\n")
+    fd.write("};\n")
+    fd.write("\n")
+    fd.write("static const struct fsdata_file * const fs_hash_table[FS_HASH_SIZE] = {\n")
+    for index in slots:
+        fd.write(f"    {data[index]['file_var']},\n")
+    fd.write("};\n")
+
 def run_tool():
     input = []
     output = ''
@@ -178,7 +502,9 @@ def run_tool():
         walk_dir = os.path.join(os.path.dirname(os.path.abspath(sys.argv[0])), 'fs')
         print('Use default input path = ' + walk_dir)
         for root, subdirs, files in os.walk(walk_dir):
-            for file_name in files:
+            # Keep the output stable between the hosts
+            subdirs.sort()
+            for file_name in sorted(files):
                 file_path = os.path.join(root, file_name)
                 input.append(file_path)
                 print('\t- file %s (full path: %s)' % (file_name, file_path))
@@ -11,6 +11,7 @@
 #include "esp_log.h"
 
 #include "types.h"
+#include "lwip/timeouts.h"
 #include "httpd.h"
 #include "wifi_task.h"
 #include "led_task.h"
@@ -20,6 +21,9 @@
 
 #define HTTPS_LOG  1
 
+/* Period of the status frames sent to the /stream clients */
+#define STATUS_INTERVAL_MS  2000
+
 #if (1 == HTTPS_LOG)
 static const char * gTAG = "HTTPS";
 #    define HTTPS_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
@@ -37,12 +41,14 @@ enum
 {
     SSI_UPTIME,
     SSI_FREE_HEAP,
-    SSI_LED_STATE
+    SSI_LED_STATE,
+    SSI_CONNECTIONS
 };
 
 //-------------------------------------------------------------------------------------------------
 
 static bool gConfig = false;
+static bool gStatusBroadcast = false;
 
 //-------------------------------------------------------------------------------------------------
 
@@ -59,6 +65,14 @@ static int32_t ssi_handler(int32_t iIndex, char * pcInsert, int32_t iInsertLen)
         case SSI_LED_STATE:
             snprintf(pcInsert, iInsertLen, "Off"); // gpio_get_level(LED_PIN) ? "Off" : "On");
             break;
+        case SSI_CONNECTIONS:
+        {
+            struct httpd_pool_stats stats;
+            httpd_get_pool_stats(&stats, NULL);
+            snprintf(pcInsert, iInsertLen, "%d/%d (peak %d, evicted %u, failed %u)",
+                     stats.used, stats.size, stats.peak, (unsigned)stats.evictions, (unsigned)stats.failures);
+            break;
+        }
         default:
             snprintf(pcInsert, iInsertLen, "N/A");
             break;
@@ -112,37 +126,38 @@ static char * websocket_cgi_handler(int iIndex, int iNumParams, char * pcParam[]
 
 //-------------------------------------------------------------------------------------------------
 
-static void vWebSocket_Task(void * pvParameter)
+/**
+ * Renders the status once and sends it to every /stream client. Runs on the
+ * TCP thread as an lwIP timer while there are clients.
+ */
+static void websocket_status_broadcast(void * arg)
 {
-    struct tcp_pcb * pcb = (struct tcp_pcb *) pvParameter;
-
-    for (;;)
+    int uptime = xTaskGetTickCount() * portTICK_PERIOD_MS / 1000;
+    int heap = 35000; //(int) xPortGetFreeHeapSize();
+    int led = 0; //!gpio_read(LED_PIN);
+    struct httpd_pool_stats conns;
+    httpd_get_pool_stats(&conns, NULL);
+
+    /* Generate response in JSON format */
+    char response[192];
+    int len = snprintf(response, sizeof (response),
+            "{\"uptime\" : \"%d\","
+            " \"heap\" : \"%d\","
+            " \"led\" : \"%d\","
+            " \"conns\" : \"%d\","
+            " \"conns_peak\" : \"%d\","
+            " \"evictions\" : \"%u\","
+            " \"alloc_failures\" : \"%u\"}", uptime, heap, led,
+            conns.used, conns.peak, (unsigned)conns.evictions, (unsigned)conns.failures);
+    if ((len < sizeof (response)) &&
+        (0 == websocket_broadcast((unsigned char *) response, len, WS_TEXT_MODE)))
     {
-        if (pcb == NULL || pcb->state != ESTABLISHED)
-        {
-            HTTPS_LOGI("Connection closed, deleting task");
-            break;
-        }
-
-        int uptime = xTaskGetTickCount() * portTICK_PERIOD_MS / 1000;
-        int heap = 35000; //(int) xPortGetFreeHeapSize();
-        int led = 0; //!gpio_read(LED_PIN);
-
-        /* Generate response in JSON format */
-        char response[64];
-        int len = snprintf(response, sizeof (response),
-                "{\"uptime\" : \"%d\","
-                " \"heap\" : \"%d\","
-                " \"led\" : \"%d\"}", uptime, heap, led);
-        if (len < sizeof (response))
-        {
-            websocket_write(pcb, (unsigned char *) response, len, WS_TEXT_MODE);
-        }
-
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
+        HTTPS_LOGI("No stream clients left, stopping status broadcast");
+        gStatusBroadcast = false;
+        return;
     }
 
-    vTaskDelete(NULL);
+    sys_timeout(STATUS_INTERVAL_MS, websocket_status_broadcast, NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -195,6 +210,7 @@ static void websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len
         CMD_SET_COLOR                 = 0x03,
         CMD_SET_SUN_IMITATION_MODE    = 0x04,
         CMD_GET_STATUS                = 0x05,
+        CMD_SET_PIXELS_COUNT          = 0x06,
         SUCCESS                       = 0x00,
         ERROR                         = 0xFF,
         ON                            = 0x01,
@@ -214,6 +230,7 @@ static void websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len
     time_t         now               = 0;
     struct tm      datetime          = {0};
     bool           result            = true;
+    uint16_t       count             = 0;
 
     response[0] = CMD_UNKNOWN;
     response[1] = ERROR;
@@ -308,6 +325,18 @@ static void websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len
             response[6] = offset;
             len = (offset + 7);
             break;
+        case CMD_SET_PIXELS_COUNT:
+            if (3 > data_len) break;
+            count = (data[1] | (data[2] << 8));
+            HTTPS_LOGI("The pixels count received: %d", count);
+            /* The LED task stores the new strip length, applied after restart.
+             * The flash is not written from the tcpip thread */
+            if (true == LED_Task_SavePixelsCount(count))
+            {
+                response[0] = CMD_SET_PIXELS_COUNT;
+                response[1] = SUCCESS;
+            }
+            break;
         case 'A': // ADC
             /* This should be done on a separate thread in 'real' applications */
             //rnd = esp_random();
@@ -333,7 +362,7 @@ static void websocket_cb(struct tcp_pcb * pcb, uint8_t * data, uint16_t data_len
 //-------------------------------------------------------------------------------------------------
 /**
  * This function is called when new websocket is open and
- * creates a new websocket_task if requested URI equals '/stream'.
+ * subscribes it to the status broadcast if requested URI equals '/stream'.
  */
 static void websocket_open_cb(struct tcp_pcb * pcb, const char * uri)
 {
@@ -341,7 +370,11 @@ static void websocket_open_cb(struct tcp_pcb * pcb, const char * uri)
     if (!strcmp(uri, "/stream"))
     {
         HTTPS_LOGI("Request for streaming");
-        xTaskCreate(&vWebSocket_Task, "WebSocket Task", 1024, (void *)pcb, 2, NULL);
+        if ((ERR_OK == websocket_subscribe(pcb)) && (false == gStatusBroadcast))
+        {
+            gStatusBroadcast = true;
+            sys_timeout(STATUS_INTERVAL_MS, websocket_status_broadcast, NULL);
+        }
     }
 }
 
@@ -360,7 +393,8 @@ static void vHTTP_Server_Task(void * pvParameters)
     {
         "uptime", // SSI_UPTIME
         "heap",   // SSI_FREE_HEAP
-        "led"     // SSI_LED_STATE
+        "led",    // SSI_LED_STATE
+        "conns"   // SSI_CONNECTIONS
     };
 
     /* register handlers and start the server */
@@ -0,0 +1,27 @@
+#ifndef __LED_COLOR_H__
+#define __LED_COLOR_H__
+
+#include <stdint.h>
+#include "led_strip.h"
+
+/* Unsigned Q16.16 fixed point: 1.0 is represented as LED_COLOR_Q16_ONE */
+#define LED_COLOR_Q16_ONE  (0x10000UL)
+#define LED_COLOR_Q16_HALF (0x08000UL)
+
+typedef struct
+{
+    uint32_t h; /* Q16.16, 0 .. 1.0 is a full turn */
+    uint32_t s; /* Q16.16, 0 .. 1.0 */
+    uint32_t v; /* Q16.16, 0 .. 1.0 */
+} led_hsv_t;
+
+uint32_t LED_Color_Progress(uint32_t duration, uint32_t interval);
+uint32_t LED_Color_Sine(uint32_t prgs);
+void     LED_Color_Lerp16(led_color_t * p_a, led_color_t * p_b, uint32_t prgs, led_color16_t * p_r);
+void     LED_Color_RGBtoHSV(led_color_t * p_color, led_hsv_t * p_hsv);
+void     LED_Color_HSVtoRGB(led_hsv_t * p_hsv, led_color_t * p_color);
+void     LED_Color_HSVtoRGB16(led_hsv_t * p_hsv, led_color16_t * p_color);
+void     LED_Color_Expand(led_color_t * p_color, led_color16_t * p_color16);
+void     LED_Color_Reduce(led_color16_t * p_color16, led_color_t * p_color);
+
+#endif /* __LED_COLOR_H__ */
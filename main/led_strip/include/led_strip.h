@@ -2,6 +2,7 @@
 #define __LED_STRIP_H__
 
 #include <stdint.h>
+#include <stdbool.h>
 
 typedef union
 {
@@ -16,12 +17,24 @@ typedef union
     uint32_t dword;
 } led_color_t;
 
-void LED_Strip_Init(uint8_t * leds, uint16_t count);
+/* Color with 8.8 fixed point channels, the 8-bit value v is equal to (v << 8) */
+typedef struct
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+} led_color16_t;
+
+bool LED_Strip_Init(uint16_t count);
 void LED_Strip_Update(void);
+void LED_Strip_Refresh(void);
 void LED_Strip_SetPixelColor(uint16_t pixel, led_color_t * p_color);
+void LED_Strip_SetPixelColor16(uint16_t pixel, led_color16_t * p_color);
 void LED_Strip_Rotate(bool direction);
 void LED_Strip_Clear(void);
 void LED_Strip_SetColor(led_color_t * p_color);
+void LED_Strip_SetColor16(led_color16_t * p_color);
 void LED_Strip_GetAverageColor(led_color_t * p_color);
+bool LED_Strip_Test(void);
 
 #endif /* __LED_STRIP_H__ */
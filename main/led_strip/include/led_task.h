@@ -2,6 +2,7 @@
 #define __LED_TASK_H__
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "led_strip.h"
 
 typedef enum
@@ -15,6 +16,7 @@ typedef enum
     LED_CMD_INDICATE_RAINBOW,
     LED_CMD_INDICATE_SINE,
     LED_CMD_SWITCH_OFF,
+    LED_CMD_SAVE_PIXELS_COUNT, /* interval holds the count to store in NVS */
 } led_command_t;
 
 typedef struct
@@ -26,11 +28,14 @@ typedef struct
     uint32_t      duration;
 } led_message_t;
 
+/* The default strip length, the actual one is stored in NVS */
 #define LED_TASK_PIXELS_COUNT (16)
+#define LED_TASK_PIXELS_MAX   (300)
 
 void LED_Task_Init(void);
 void LED_Task_SendMsg(led_message_t * p_msg);
 void LED_Task_DetermineColor(led_message_t * p_msg, led_color_t * p_color);
+bool LED_Task_SavePixelsCount(uint16_t count);
 void LED_Task_GetCurrentColor(led_color_t * p_color);
 void LED_Task_Test(void);
 
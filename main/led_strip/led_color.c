@@ -0,0 +1,227 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "led_color.h"
+
+//-------------------------------------------------------------------------------------------------
+
+#define LED_COLOR_SINE_STEPS (64)
+#define LED_COLOR_SINE_SHIFT (9)
+
+//-------------------------------------------------------------------------------------------------
+
+/* sin(x) for x = 0 .. PI/2 in LED_COLOR_SINE_STEPS steps, Q16.16 */
+static const uint32_t gSine[LED_COLOR_SINE_STEPS + 1] =
+{
+        0,  1608,  3216,  4821,  6424,  8022,  9616, 11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+    36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+    46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+    54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+    64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+    65536,
+};
+
+//-------------------------------------------------------------------------------------------------
+
+static inline uint32_t led_MulQ16(uint32_t a, uint32_t b)
+{
+    /* Both operands may be equal to 1.0, so the product needs 33 bits */
+    return (uint32_t)(((uint64_t)a * b) >> 16);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static inline uint8_t led_Q16ToByte(uint32_t value)
+{
+    if (LED_COLOR_Q16_ONE < value) value = LED_COLOR_Q16_ONE;
+    /* Truncate like the former (uint8_t)(value * 255) cast */
+    return (uint8_t)((value * UINT8_MAX) >> 16);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static inline uint16_t led_Q16ToWord(uint32_t value)
+{
+    if (LED_COLOR_Q16_ONE < value) value = LED_COLOR_Q16_ONE;
+    /* Keep 8 fractional bits - the high byte is equal to led_Q16ToByte() */
+    return (uint16_t)((value * UINT8_MAX) >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void led_HSVtoQ16(led_hsv_t * p_hsv, uint32_t * p_r, uint32_t * p_g, uint32_t * p_b)
+{
+    uint32_t sector = (p_hsv->h * 6);
+    uint32_t i      = (sector >> 16);
+    uint32_t f      = (sector & (LED_COLOR_Q16_ONE - 1));
+    uint32_t v      = p_hsv->v;
+    uint32_t p      = led_MulQ16(v, LED_COLOR_Q16_ONE - p_hsv->s);
+    uint32_t q      = led_MulQ16(v, LED_COLOR_Q16_ONE - led_MulQ16(f, p_hsv->s));
+    uint32_t t      = led_MulQ16(v, LED_COLOR_Q16_ONE - led_MulQ16(LED_COLOR_Q16_ONE - f, p_hsv->s));
+
+    switch(i % 6)
+    {
+        case 0: *p_r = v, *p_g = t, *p_b = p; break;
+        case 1: *p_r = q, *p_g = v, *p_b = p; break;
+        case 2: *p_r = p, *p_g = v, *p_b = t; break;
+        case 3: *p_r = p, *p_g = q, *p_b = v; break;
+        case 4: *p_r = t, *p_g = p, *p_b = v; break;
+        case 5: *p_r = v, *p_g = p, *p_b = q; break;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Converts the elapsed time to the Q16.16 progress value clamped to 0 .. 1.0
+uint32_t LED_Color_Progress(uint32_t duration, uint32_t interval)
+{
+    if ((0 == interval) || (interval <= duration))
+    {
+        return LED_COLOR_Q16_ONE;
+    }
+    /* Sun transitions last for hours, so the shifted duration does not fit 32 bits */
+    if (duration < (UINT32_MAX >> 16))
+    {
+        return ((duration << 16) / interval);
+    }
+    return (uint32_t)(((uint64_t)duration << 16) / interval);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Calculates sin(prgs * PI) for the Q16.16 progress value in range 0 .. 1.0
+uint32_t LED_Color_Sine(uint32_t prgs)
+{
+    uint32_t index, frac;
+
+    if (LED_COLOR_Q16_ONE < prgs) prgs = LED_COLOR_Q16_ONE;
+
+    /* The half wave is symmetric around PI/2 */
+    if (LED_COLOR_Q16_HALF < prgs)
+    {
+        prgs = (LED_COLOR_Q16_ONE - prgs);
+    }
+
+    index = (prgs >> LED_COLOR_SINE_SHIFT);
+    if (LED_COLOR_SINE_STEPS <= index)
+    {
+        return gSine[LED_COLOR_SINE_STEPS];
+    }
+    frac = (prgs & ((1 << LED_COLOR_SINE_SHIFT) - 1));
+
+    return gSine[index] + (((gSine[index + 1] - gSine[index]) * frac) >> LED_COLOR_SINE_SHIFT);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Performs linear interpolation between two RGB colors, prgs is Q16.16 in range 0 .. 1.0.
+// The result keeps 8 fractional bits.
+void LED_Color_Lerp16(led_color_t * p_a, led_color_t * p_b, uint32_t prgs, led_color16_t * p_r)
+{
+    uint32_t rest;
+
+    if (LED_COLOR_Q16_ONE < prgs) prgs = LED_COLOR_Q16_ONE;
+    rest = (LED_COLOR_Q16_ONE - prgs);
+
+    p_r->r = (uint16_t)((p_a->r * rest + p_b->r * prgs) >> 8);
+    p_r->g = (uint16_t)((p_a->g * rest + p_b->g * prgs) >> 8);
+    p_r->b = (uint16_t)((p_a->b * rest + p_b->b * prgs) >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Color_RGBtoHSV(led_color_t * p_color, led_hsv_t * p_hsv)
+{
+    int32_t min, max, delta, hue;
+
+    min = (p_color->r < p_color->g) ? p_color->r : p_color->g;
+    min = (min < p_color->b) ? min : p_color->b;
+
+    max = (p_color->r > p_color->g) ? p_color->r : p_color->g;
+    max = (max > p_color->b) ? max : p_color->b;
+
+    /* Value */
+    p_hsv->v = (((uint32_t)max << 16) / UINT8_MAX);
+
+    delta = max - min;
+
+    if ((0 == max) || (0 == delta))
+    {
+        /* r = g = b - the hue is undefined */
+        p_hsv->s = 0;
+        p_hsv->h = 0;
+        return;
+    }
+
+    /* Saturation */
+    p_hsv->s = (((uint32_t)delta << 16) / max);
+
+    /* Hue in sixths of the turn multiplied by delta */
+    if (p_color->r == max)
+    {
+        hue = (p_color->g - p_color->b);
+        if (hue < 0)
+        {
+            hue += (6 * delta);
+        }
+    }
+    else if (p_color->g == max)
+    {
+        hue = (2 * delta) + (p_color->b - p_color->r);
+    }
+    else
+    {
+        hue = (4 * delta) + (p_color->r - p_color->g);
+    }
+    p_hsv->h = (((uint32_t)hue << 16) / (6 * delta));
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Color_HSVtoRGB(led_hsv_t * p_hsv, led_color_t * p_color)
+{
+    uint32_t r = 0, g = 0, b = 0;
+
+    led_HSVtoQ16(p_hsv, &r, &g, &b);
+
+    p_color->r = led_Q16ToByte(r);
+    p_color->g = led_Q16ToByte(g);
+    p_color->b = led_Q16ToByte(b);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Color_HSVtoRGB16(led_hsv_t * p_hsv, led_color16_t * p_color)
+{
+    uint32_t r = 0, g = 0, b = 0;
+
+    led_HSVtoQ16(p_hsv, &r, &g, &b);
+
+    p_color->r = led_Q16ToWord(r);
+    p_color->g = led_Q16ToWord(g);
+    p_color->b = led_Q16ToWord(b);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Color_Expand(led_color_t * p_color, led_color16_t * p_color16)
+{
+    p_color16->r = (uint16_t)(p_color->r << 8);
+    p_color16->g = (uint16_t)(p_color->g << 8);
+    p_color16->b = (uint16_t)(p_color->b << 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Color_Reduce(led_color16_t * p_color16, led_color_t * p_color)
+{
+    /* Truncate the fractional part like the 8-bit calculations do */
+    p_color->r = (uint8_t)(p_color16->r >> 8);
+    p_color->g = (uint8_t)(p_color16->g >> 8);
+    p_color->b = (uint8_t)(p_color16->b >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -1,7 +1,9 @@
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "freertos/event_groups.h"
 
 #include "esp_attr.h"
@@ -16,26 +18,104 @@
 #include "rom/ets_sys.h"
 #include "driver/uart.h"
 #include "driver/uart_select.h"
+#include "esp_log.h"
 
 #include "led_strip.h"
 
+#define LEDS_LOG 0
+
+/* The self-test reports through ESP_LOG regardless of LEDS_LOG */
+static const char * gTAG = "LEDS";
+
+#if (1 == LEDS_LOG)
+#    define LEDS_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
+#    define LEDS_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
+#else
+#    define LEDS_LOGI(...)
+#    define LEDS_LOGE(...)
+#endif
+
 #define LEDS_ENTER_CRITICAL()      portENTER_CRITICAL()
 #define LEDS_EXIT_CRITICAL()       portEXIT_CRITICAL()
 /* 800kHz, 4 serial bytes per NeoByte */
 #define LEDS_UART_BAUDRATE              (3200000)
 #define LEDS_UART_EMPTY_THRESH_DEFAULT  (80)
 #define LEDS_EVT_COMPLETE               (BIT0)
+/* WS2812 reset (latch) time, the newer chips require more than 280 us */
+#define LEDS_LATCH_US                   (300)
+/* Output stage between the pixels buffer and the wire */
+#define LEDS_GAMMA_CORRECTION           (1)
+#define LEDS_DITHERING                  (1)
+/* White balance - scale of the every channel at the full brightness */
+#define LEDS_WHITE_BALANCE_R            (255)
+#define LEDS_WHITE_BALANCE_G            (255)
+#define LEDS_WHITE_BALANCE_B            (255)
 
 /* DRAM_ATTR is required to avoid UART array placed in flash,
    due to accessed from ISR */
 static DRAM_ATTR uart_dev_t * const gUART        = &uart0;
-static uint8_t *                    gLeds        = NULL;
+/* Back buffer of the 8.8 fixed point subpixels - owned by the animation engine */
+static uint16_t *                   gLeds        = NULL;
+/* Front buffer - owned by the UART IRQ handler while the frame is on the wire */
+static uint8_t *                    gFrame       = NULL;
+/* Residuals of the temporal dithering - the sub-LSB part of every subpixel */
+static uint8_t *                    gDither      = NULL;
+static bool                         gDithering   = false;
+/* Number of subpixels */
 static uint16_t                     gLedsCount   = 0;
 static EventGroupHandle_t           gLedsEvents  = NULL;
+static TickType_t                   gLatchTick   = 0;
 
 static uint8_t *                    gStart       = NULL;
 static uint8_t *                    gEnd         = NULL;
 
+// Remember: UARTs send less significant bit (LSB) first so
+//      pushing ABCDEF byte will generate a 0FEDCBA1 signal,
+//      including a LOW(0) start & a HIGH(1) stop bits.
+// Also, we have configured UART to invert logic levels, so:
+//      0b110111 - On wire: 1 000 100 0 [Neopixel reads 00]
+//      0b000111 - On wire: 1 000 111 0 [Neopixel reads 01]
+//      0b110100 - On wire: 1 110 100 0 [Neopixel reads 10]
+//      0b000100 - On wire: 1 110 111 0 [NeoPixel reads 11]
+// The four UART bytes of a subpixel are packed in the send order, LSB first.
+#define LEDS_LUT_4(f,v)             f(v),                  f((v) + 1),                 \
+                                    f((v) + 2),            f((v) + 3)
+#define LEDS_LUT_16(f,v)            LEDS_LUT_4(f,v),       LEDS_LUT_4(f,(v) + 4),      \
+                                    LEDS_LUT_4(f,(v) + 8), LEDS_LUT_4(f,(v) + 12)
+#define LEDS_LUT_64(f,v)            LEDS_LUT_16(f,v),      LEDS_LUT_16(f,(v) + 16),    \
+                                    LEDS_LUT_16(f,(v) + 32), LEDS_LUT_16(f,(v) + 48)
+#define LEDS_LUT_256(f)             LEDS_LUT_64(f,0),      LEDS_LUT_64(f,64),          \
+                                    LEDS_LUT_64(f,128),    LEDS_LUT_64(f,192)
+#define LEDS_UART_DATA(v)           ((0x04340737UL >> (((v) & 0x3) * 8)) & 0xFF)
+#define LEDS_SYMBOL(v)              ( LEDS_UART_DATA((v) >> 6)        | \
+                                     (LEDS_UART_DATA((v) >> 4) <<  8) | \
+                                     (LEDS_UART_DATA((v) >> 2) << 16) | \
+                                     (LEDS_UART_DATA((v)     ) << 24) )
+
+/* NeoPixel symbols of every subpixel value, one 32-bit load per subpixel in the ISR */
+static DRAM_ATTR const uint32_t     gSymbols[256] =
+{
+    LEDS_LUT_256(LEDS_SYMBOL)
+};
+
+/* Gamma 2.2 approximation 0.8 * x^2 + 0.2 * x^3 in Q8.8 format */
+#if (1 == LEDS_GAMMA_CORRECTION)
+#    define LEDS_GAMMA(v)           (((v) * (v) * (52020ULL + 51 * (v)) * 256 + 8290687) / 16581375)
+#else
+#    define LEDS_GAMMA(v)           ((v) << 8)
+#endif
+#define LEDS_GAMMA_R(v)             ((uint16_t)((LEDS_GAMMA(v) * LEDS_WHITE_BALANCE_R) / 255))
+#define LEDS_GAMMA_G(v)             ((uint16_t)((LEDS_GAMMA(v) * LEDS_WHITE_BALANCE_G) / 255))
+#define LEDS_GAMMA_B(v)             ((uint16_t)((LEDS_GAMMA(v) * LEDS_WHITE_BALANCE_B) / 255))
+
+/* Output levels of every subpixel value in the GRB order of the buffer, Q8.8 */
+static const uint16_t               gGamma[3][256] =
+{
+    {LEDS_LUT_256(LEDS_GAMMA_G)},
+    {LEDS_LUT_256(LEDS_GAMMA_R)},
+    {LEDS_LUT_256(LEDS_GAMMA_B)},
+};
+
 //-------------------------------------------------------------------------------------------------
 
 static EventBits_t leds_WaitFor(EventBits_t events, TickType_t timeout)
@@ -59,17 +139,6 @@ static EventBits_t leds_WaitFor(EventBits_t events, TickType_t timeout)
 
 uint8_t * IRAM_ATTR ledstrip_FillUartFifo(uint8_t * leds, uint8_t * end)
 {
-    // Remember: UARTs send less significant bit (LSB) first so
-    //      pushing ABCDEF byte will generate a 0FEDCBA1 signal,
-    //      including a LOW(0) start & a HIGH(1) stop bits.
-    // Also, we have configured UART to invert logic levels, so:
-    const uint8_t _uartData[4] =
-    {
-        0b110111, // On wire: 1 000 100 0 [Neopixel reads 00]
-        0b000111, // On wire: 1 000 111 0 [Neopixel reads 01]
-        0b110100, // On wire: 1 110 100 0 [Neopixel reads 10]
-        0b000100, // On wire: 1 110 111 0 [NeoPixel reads 11]
-    };
     uint8_t avail = (UART_FIFO_LEN - gUART->status.txfifo_cnt) / 4;
     if (end - leds > avail)
     {
@@ -77,11 +146,11 @@ uint8_t * IRAM_ATTR ledstrip_FillUartFifo(uint8_t * leds, uint8_t * end)
     }
     while (leds < end)
     {
-        uint8_t subpix = *leds++;
-        gUART->fifo.rw_byte = _uartData[(subpix >> 6) & 0x3];
-        gUART->fifo.rw_byte = _uartData[(subpix >> 4) & 0x3];
-        gUART->fifo.rw_byte = _uartData[(subpix >> 2) & 0x3];
-        gUART->fifo.rw_byte = _uartData[ subpix       & 0x3];
+        uint32_t symbol = gSymbols[*leds++];
+        gUART->fifo.rw_byte = (uint8_t)(symbol);
+        gUART->fifo.rw_byte = (uint8_t)(symbol >> 8);
+        gUART->fifo.rw_byte = (uint8_t)(symbol >> 16);
+        gUART->fifo.rw_byte = (uint8_t)(symbol >> 24);
     }
     return leds;
 }
@@ -100,13 +169,23 @@ static void ledstrip_UartIrqHandler(void * param)
             /* Clear the interrupt flag */
             gUART->int_clr.txfifo_empty = 1;
 
-            /* Fill the FIFO with new data */
-            gStart = ledstrip_FillUartFifo(gStart, gEnd);
+            if (gStart != gEnd)
+            {
+                /* Fill the FIFO with new data */
+                gStart = ledstrip_FillUartFifo(gStart, gEnd);
 
-            /* Disable TX interrupt when done */
-            if (gStart == gEnd)
+                /* The last data is in FIFO - get the IRQ again when it is drained */
+                if (gStart == gEnd)
+                {
+                    gUART->conf1.txfifo_empty_thrhd = 1;
+                }
+            }
+            else
             {
-                gUART->int_ena.txfifo_empty = 0;
+                /* The line is idle - the latch time starts now */
+                gUART->int_ena.txfifo_empty     = 0;
+                gUART->conf1.txfifo_empty_thrhd = LEDS_UART_EMPTY_THRESH_DEFAULT;
+                gLatchTick = xTaskGetTickCountFromISR();
                 /* Set event */
                 /* xHigherPriorityTaskWoken must be initialised to pdFALSE */
                 xHigherPriorityTaskWoken = pdFALSE;
@@ -200,12 +279,84 @@ static void ledstrip_InitializeUart(void)
 
 //-------------------------------------------------------------------------------------------------
 
+// Converts the 8.8 fixed point subpixel of the channel to the Q8.8 output level
+static inline uint32_t ledstrip_Level(uint32_t ch, uint16_t value)
+{
+    uint32_t index = (value >> 8);
+    uint32_t level = gGamma[ch][index];
+
+    if (UINT8_MAX > index)
+    {
+        /* The fractional part falls between two neighbouring entries */
+        level += (((gGamma[ch][index + 1] - level) * (value & 0xFF)) >> 8);
+    }
+    return level;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Converts the Q8.8 output level to the 8-bit frame value, diffusing the error over the frames
+static inline uint8_t ledstrip_Dither(uint32_t level, uint8_t * p_residual)
+{
+#if (1 == LEDS_DITHERING)
+    level += *p_residual;
+    *p_residual = (uint8_t)level;
+#else
+    (void)p_residual;
+    level += 0x80;
+#endif
+    return (uint8_t)(level >> 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+static void ledstrip_Publish(void)
+{
+    uint32_t pos      = 0;
+    uint32_t ch       = 0;
+    uint32_t level    = 0;
+    uint32_t fraction = 0;
+
+    for (pos = 0; pos < gLedsCount; pos += 3)
+    {
+        for (ch = 0; ch < 3; ch++)
+        {
+            level = ledstrip_Level(ch, gLeds[pos + ch]);
+#if (1 == LEDS_DITHERING)
+            /* An exact level has no error to diffuse - drop the one left by the previous levels */
+            if (0 == (level & 0xFF))
+            {
+                gDither[pos + ch] = 0;
+            }
+            fraction |= level;
+#endif
+            gFrame[pos + ch] = ledstrip_Dither(level, &gDither[pos + ch]);
+        }
+    }
+
+    /* The frames differ only when some subpixel is between two levels,
+       otherwise the strip settles on the frame just published */
+    gDithering = (0 != (fraction & 0xFF));
+}
+
+//-------------------------------------------------------------------------------------------------
+
 static void ledstrip_UpdateUart(void)
 {
-    gStart = gLeds;
-    gEnd   = gLeds + gLedsCount;
+    /* Wait until the previous frame leaves the front buffer */
+    (void)leds_WaitFor(LEDS_EVT_COMPLETE, portMAX_DELAY);
+
+    /* The tick resolution is too coarse - wait for the latch when the line
+       has been idle for less than one whole tick */
+    if (2 > (xTaskGetTickCount() - gLatchTick))
+    {
+        ets_delay_us(LEDS_LATCH_US);
+    }
 
-    vTaskDelay(10 / portTICK_RATE_MS);
+    /* Publish the back buffer so the next frame can be computed meanwhile */
+    ledstrip_Publish();
+    gStart = gFrame;
+    gEnd   = gFrame + gLedsCount;
 
     LEDS_ENTER_CRITICAL();
 
@@ -215,23 +366,32 @@ static void ledstrip_UpdateUart(void)
     gUART->int_ena.txfifo_empty = 1;
 
     LEDS_EXIT_CRITICAL();
-
-    (void)leds_WaitFor(LEDS_EVT_COMPLETE, portMAX_DELAY);
 }
 
 //-------------------------------------------------------------------------------------------------
 
-void LED_Strip_Init(uint8_t * leds, uint16_t count)
+bool LED_Strip_Init(uint16_t count)
 {
-    gLeds      = leds;
-    gLedsCount = count;
+    uint32_t size = (count * 3);
+
+    /* The back, the front and the dithering buffers */
+    gLeds = malloc((sizeof(uint16_t) + 1 + LEDS_DITHERING) * size);
+    if (NULL == gLeds) return false;
+
+    gFrame     = (uint8_t *)(gLeds + size);
+    gDither    = (gFrame + size);
+    gLedsCount = size;
 
     /* Clear all the pixels */
-    memset(gLeds, 0, gLedsCount);
+    memset(gLeds, 0, (sizeof(uint16_t) + 1 + LEDS_DITHERING) * size);
 
     ledstrip_InitializeUart();
 
+    /* The front buffer is free */
+    (void)xEventGroupSetBits(gLedsEvents, LEDS_EVT_COMPLETE);
     ledstrip_UpdateUart();
+
+    return true;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -243,12 +403,36 @@ void LED_Strip_Update(void)
 
 //-------------------------------------------------------------------------------------------------
 
+void LED_Strip_Refresh(void)
+{
+    /* Resend the same pixels while the dithering produces different frames */
+    if (true == gDithering)
+    {
+        ledstrip_UpdateUart();
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
 void LED_Strip_SetPixelColor(uint16_t pixel, led_color_t * p_color)
 {
     uint32_t pos = pixel * 3;
 
     if (gLedsCount <= (pos + 2)) return;
 
+    gLeds[pos++] = (p_color->g << 8);
+    gLeds[pos++] = (p_color->r << 8);
+    gLeds[pos++] = (p_color->b << 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_SetPixelColor16(uint16_t pixel, led_color16_t * p_color)
+{
+    uint32_t pos = pixel * 3;
+
+    if (gLedsCount <= (pos + 2)) return;
+
     gLeds[pos++] = p_color->g;
     gLeds[pos++] = p_color->r;
     gLeds[pos++] = p_color->b;
@@ -258,19 +442,19 @@ void LED_Strip_SetPixelColor(uint16_t pixel, led_color_t * p_color)
 
 void LED_Strip_Rotate(bool direction)
 {
-    uint8_t led[3];
+    uint16_t led[3];
 
     if (true == direction)
     {
-        memcpy(led, gLeds, 3);
-        memmove(gLeds, gLeds + 3, gLedsCount - 3);
-        memcpy(gLeds + gLedsCount - 3, led, 3);
+        memcpy(led, gLeds, sizeof(led));
+        memmove(gLeds, gLeds + 3, (gLedsCount - 3) * sizeof(uint16_t));
+        memcpy(gLeds + gLedsCount - 3, led, sizeof(led));
     }
     else
     {
-        memcpy(led, gLeds + gLedsCount - 3, 3);
-        memmove(gLeds + 3, gLeds, gLedsCount - 3);
-        memcpy(gLeds, led, 3);
+        memcpy(led, gLeds + gLedsCount - 3, sizeof(led));
+        memmove(gLeds + 3, gLeds, (gLedsCount - 3) * sizeof(uint16_t));
+        memcpy(gLeds, led, sizeof(led));
     }
 }
 
@@ -278,7 +462,7 @@ void LED_Strip_Rotate(bool direction)
 
 void LED_Strip_Clear(void)
 {
-    memset(gLeds, 0, gLedsCount);
+    memset(gLeds, 0, gLedsCount * sizeof(uint16_t));
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -287,6 +471,20 @@ void LED_Strip_SetColor(led_color_t * p_color)
 {
     uint32_t pos = 0;
 
+    for (pos = 0; pos < gLedsCount;)
+    {
+        gLeds[pos++] = (p_color->g << 8);
+        gLeds[pos++] = (p_color->r << 8);
+        gLeds[pos++] = (p_color->b << 8);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+void LED_Strip_SetColor16(led_color16_t * p_color)
+{
+    uint32_t pos = 0;
+
     for (pos = 0; pos < gLedsCount;)
     {
         gLeds[pos++] = p_color->g;
@@ -299,7 +497,7 @@ void LED_Strip_SetColor(led_color_t * p_color)
 
 void LED_Strip_GetAverageColor(led_color_t * p_color)
 {
-    uint16_t r = 0, g = 0, b = 0;
+    uint32_t r = 0, g = 0, b = 0;
     uint32_t pos = 0;
 
     for (pos = 0; pos < gLedsCount;)
@@ -311,9 +509,64 @@ void LED_Strip_GetAverageColor(led_color_t * p_color)
 
     pos = (gLedsCount / 3);
 
-    p_color->r = (uint8_t)(r / pos);
-    p_color->g = (uint8_t)(g / pos);
-    p_color->b = (uint8_t)(b / pos);
+    p_color->r = (uint8_t)((r / pos) >> 8);
+    p_color->g = (uint8_t)((g / pos) >> 8);
+    p_color->b = (uint8_t)((b / pos) >> 8);
 }
 
 //-------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+//--- Tests ---------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+
+bool LED_Strip_Test(void)
+{
+    enum
+    {
+        FRAMES_COUNT = 256,
+        /* Without the dithering every frame is rounded to the nearest level */
+        DEVIATION    = (1 == LEDS_DITHERING) ? 1 : 0x80,
+    };
+
+    /* 16-bit subpixels between the neighbouring 8-bit levels, the night blue included */
+    const uint16_t values[] = {0x0001, 0x0080, 0x0100, 0x05C0, 0x1234, 0x6180, 0x70FF, 0xEE55, 0xFF00};
+
+    uint8_t  residual = 0;
+    uint32_t level    = 0;
+    uint32_t sum      = 0;
+    uint32_t test     = 0;
+    uint32_t frame    = 0;
+    uint32_t ch       = 0;
+    uint32_t failed   = 0;
+
+    for (ch = 0; ch < 3; ch++)
+    {
+        for (test = 0; test < (sizeof(values) / sizeof(uint16_t)); test++)
+        {
+            level    = ledstrip_Level(ch, values[test]);
+            residual = 0;
+            sum      = 0;
+
+            for (frame = 0; frame < FRAMES_COUNT; frame++)
+            {
+                sum += ledstrip_Dither(level, &residual);
+            }
+
+            /* The average of the 8-bit frames must match the Q8.8 target */
+            if (DEVIATION >= abs((int32_t)(sum * 256 / FRAMES_COUNT) - (int32_t)level))
+            {
+                LEDS_LOGI("Dither %d.%d L:%5d A:%5d - PASS", ch, test, level, sum);
+            }
+            else
+            {
+                ESP_LOGE(gTAG, "Dither %d.%d L:%5d A:%5d - FAIL", ch, test, level, sum);
+                failed++;
+            }
+        }
+    }
+
+    ESP_LOGI(gTAG, "Dither test: %d of %d failed", failed, (int)(3 * (sizeof(values) / sizeof(uint16_t))));
+
+    return (0 == failed);
+}
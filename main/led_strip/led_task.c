@@ -1,5 +1,5 @@
+#include <stdlib.h>
 #include <string.h>
-#include <math.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -10,21 +10,17 @@
 #include "types.h"
 #include "led_task.h"
 #include "led_strip.h"
+#include "led_color.h"
 
 #include "esp_timer.h"
 #include "esp_log.h"
+#include "nvs.h"
+#include "nvs_flash.h"
 
 //-------------------------------------------------------------------------------------------------
 
 typedef void (* iterate_fp_t)(void);
 
-typedef struct
-{
-    double h;
-    double s;
-    double v;
-} hsv_t;
-
 typedef struct
 {
     uint16_t interval;
@@ -47,19 +43,25 @@ typedef struct
     led_time_t    time;
     uint16_t      offset;
     uint16_t      led;
-    hsv_t         hsv;
+    led_hsv_t     hsv;
     iterate_fp_t  fp_iterate;
-    uint8_t       buffer[LED_TASK_PIXELS_COUNT * 3];
+    uint16_t      count;
 } leds_t;
 
 //-------------------------------------------------------------------------------------------------
 
 #define LED_TASK_TICK_MS (10)
 
+/* The strip length is kept together with the connection parameters */
+#define LED_TASK_NVS_NAMESPACE "wifi"
+#define LED_TASK_NVS_PIXELS    "leds"
+
 #define LED_TASK_LOG 0
 
-#if (1 == LED_TASK_LOG)
+/* NVS errors and the self-tests report through ESP_LOG regardless of LED_TASK_LOG */
 static const char * gTAG = "LED";
+
+#if (1 == LED_TASK_LOG)
 #    define LED_LOGI(...)  ESP_LOGI(gTAG, __VA_ARGS__)
 #    define LED_LOGE(...)  ESP_LOGE(gTAG, __VA_ARGS__)
 #    define LED_LOGV(...)  ESP_LOGV(gTAG, __VA_ARGS__)
@@ -71,98 +73,15 @@ static const char * gTAG = "LED";
 
 //-------------------------------------------------------------------------------------------------
 
-static const double  gPi       = 3.1415926;
-
 static QueueHandle_t gLedQueue = {0};
 static leds_t        gLeds     = {0};
 
 //-------------------------------------------------------------------------------------------------
 
-static void led_RGBtoHSV(led_color_t * p_color, hsv_t * p_hsv)
+// Performs linear interpolation between two Q16.16 values, t is Q16.16 in range 0 .. 1.0
+static uint32_t led_LinearInterpolation(uint32_t a, uint32_t b, uint32_t t)
 {
-    double min, max, delta;
-
-    min = (p_color->r < p_color->g) ? p_color->r : p_color->g;
-    min = (min < p_color->b) ? min : p_color->b;
-
-    max = (p_color->r > p_color->g) ? p_color->r : p_color->g;
-    max = (max > p_color->b) ? max : p_color->b;
-
-    /* Value */
-    p_hsv->v = max / 255.0;
-
-    delta = max - min;
-
-    if (max != 0)
-    {
-        /* Saturation */
-        p_hsv->s = (1.0 * delta / max);
-    }
-    else
-    {
-        /* r = g = b = 0 */
-        /* s = 0, v is undefined */
-        p_hsv->s = 0;
-        p_hsv->h = 0;
-        return;
-    }
-
-    /* Hue */
-    if (p_color->r == max)
-    {
-        p_hsv->h = (p_color->g - p_color->b) / delta;
-    }
-    else if (p_color->g == max)
-    {
-        p_hsv->h = 2 + (p_color->b - p_color->r) / delta;
-    }
-    else
-    {
-        p_hsv->h = 4 + (p_color->r - p_color->g) / delta;
-    }
-
-    /* Convert hue to degrees and back */
-    p_hsv->h *= 60;
-    if (p_hsv->h < 0)
-    {
-        p_hsv->h += 360;
-    }
-    p_hsv->h /= 360;
-}
-
-//-------------------------------------------------------------------------------------------------
-
-static void led_HSVtoRGB(hsv_t * p_hsv, led_color_t * p_color)
-{
-    double r = 0, g = 0, b = 0;
-
-    int i = (int)(p_hsv->h * 6);
-    double f = p_hsv->h * 6 - i;
-    double p = p_hsv->v * (1 - p_hsv->s);
-    double q = p_hsv->v * (1 - f * p_hsv->s);
-    double t = p_hsv->v * (1 - (1 - f) * p_hsv->s);
-
-    switch(i % 6)
-    {
-        case 0: r = p_hsv->v, g = t, b = p; break;
-        case 1: r = q, g = p_hsv->v, b = p; break;
-        case 2: r = p, g = p_hsv->v, b = t; break;
-        case 3: r = p, g = q, b = p_hsv->v; break;
-        case 4: r = t, g = p, b = p_hsv->v; break;
-        case 5: r = p_hsv->v, g = p, b = q; break;
-    }
-
-    p_color->r = (uint8_t)(r * 255);
-    p_color->g = (uint8_t)(g * 255);
-    p_color->b = (uint8_t)(b * 255);
-}
-
-//-------------------------------------------------------------------------------------------------
-
-// Performs linear interpolation between two values
-static double led_LinearInterpolation(double a, double b, double t)
-{
-    return a + (b - a) * t;
+    return (uint32_t)(((uint64_t)a * (LED_COLOR_Q16_ONE - t) + (uint64_t)b * t) >> 16);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -172,18 +91,12 @@ static void led_SmoothColorTransition
 (
     led_color_t * p_a,
     led_color_t * p_b,
-    double prgs,
-    led_color_t * p_r
+    uint32_t prgs,
+    led_color16_t * p_r
 )
 {
-    // Clamp progress value between 0 and 1
-    if (prgs < 0) prgs = 0;
-    if (prgs > 1) prgs = 1;
-
-    // Interpolate each RGB component separately
-    p_r->r = (uint8_t)led_LinearInterpolation(p_a->r, p_b->r, prgs);
-    p_r->g = (uint8_t)led_LinearInterpolation(p_a->g, p_b->g, prgs);
-    p_r->b = (uint8_t)led_LinearInterpolation(p_a->b, p_b->b, prgs);
+    /* Progress is clamped to 0 .. 1.0 inside */
+    LED_Color_Lerp16(p_a, p_b, prgs, p_r);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -193,38 +106,40 @@ static void led_RainbowColorTransition
 (
     led_color_t * p_a,
     led_color_t * p_b,
-    double prgs,
-    led_color_t * p_r
+    uint32_t prgs,
+    led_color16_t * p_r
 )
 {
-    hsv_t       src_hsv = {0};
-    hsv_t       dst_hsv = {0};
-    hsv_t       hsv     = {0};
+    led_hsv_t   src_hsv = {0};
+    led_hsv_t   dst_hsv = {0};
+    led_hsv_t   hsv     = {0};
+
+    if (LED_COLOR_Q16_ONE < prgs) prgs = LED_COLOR_Q16_ONE;
 
     /* Determine the SRC/DST HSVs */
-    led_RGBtoHSV(p_a, &src_hsv);
-    led_RGBtoHSV(p_b, &dst_hsv);
+    LED_Color_RGBtoHSV(p_a, &src_hsv);
+    LED_Color_RGBtoHSV(p_b, &dst_hsv);
 
     /* Calculate Hue */
     if ((1 == p_b->a) && (dst_hsv.h < src_hsv.h))
     {
-        dst_hsv.h += 1.0;
+        dst_hsv.h += LED_COLOR_Q16_ONE;
     }
     if ((0 == p_b->a) && (src_hsv.h < dst_hsv.h))
     {
-        src_hsv.h += 1.0;
+        src_hsv.h += LED_COLOR_Q16_ONE;
     }
-    hsv.h = ((dst_hsv.h - src_hsv.h) * prgs + src_hsv.h);
-    if (1.0 < hsv.h)
+    hsv.h = led_LinearInterpolation(src_hsv.h, dst_hsv.h, prgs);
+    if (LED_COLOR_Q16_ONE < hsv.h)
     {
-        hsv.h -= 1.0;
+        hsv.h -= LED_COLOR_Q16_ONE;
     }
 
     /* Calculate Value */
-    hsv.v = ((dst_hsv.v - src_hsv.v) * prgs + src_hsv.v);
+    hsv.v = led_LinearInterpolation(src_hsv.v, dst_hsv.v, prgs);
     /* Calculate Saturation */
-    hsv.s = ((dst_hsv.s - src_hsv.s) * prgs + src_hsv.s);
-    led_HSVtoRGB(&hsv, p_r);
+    hsv.s = led_LinearInterpolation(src_hsv.s, dst_hsv.s, prgs);
+    LED_Color_HSVtoRGB16(&hsv, p_r);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -233,8 +148,8 @@ static void led_RainbowColorTransition
 
 static void led_IterateIndication_Color(void)
 {
-    led_color_t result  = {0};
-    double      percent = (1.0 * gLeds.time.duration / gLeds.time.interval);
+    led_color16_t result  = {0};
+    uint32_t      percent = LED_Color_Progress(gLeds.time.duration, gLeds.time.interval);
 
     if ((gLeds.dst_color.dword != gLeds.src_color.dword) &&
         (gLeds.time.duration < gLeds.time.interval))
@@ -244,14 +159,14 @@ static void led_IterateIndication_Color(void)
     }
     else
     {
-        result.dword          = gLeds.dst_color.dword;
+        LED_Color_Expand(&gLeds.dst_color, &result);
         gLeds.src_color.dword = gLeds.dst_color.dword;
         gLeds.command         = LED_CMD_EMPTY;
     }
-    LED_Strip_SetColor(&result);
+    LED_Strip_SetColor16(&result);
     LED_Strip_Update();
 
-    LED_LOGI("C(%d.%d.%d)-P:%d", result.r, result.g, result.b, (uint32_t)(100 * percent));
+    LED_LOGI("C(%d.%d.%d)-P:%d", result.r >> 8, result.g >> 8, result.b >> 8, ((100 * percent) >> 16));
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -313,7 +228,7 @@ static void led_IterateIndication_RgbCirculation(void)
     LED_Strip_Rotate(false);
     if (UINT16_MAX != gLeds.led)
     {
-        gLeds.led = ((gLeds.led + 1) % (sizeof(gLeds.buffer) / 3));
+        gLeds.led = ((gLeds.led + 1) % gLeds.count);
         /* Switch the color R -> G -> B */
         if (0 == gLeds.led)
         {
@@ -368,7 +283,7 @@ static void led_IterateIndication_Fade(void)
         MAX_FADE_LEVEL = 30,
     };
 
-    led_HSVtoRGB(&gLeds.hsv, &gLeds.dst_color);
+    LED_Color_HSVtoRGB(&gLeds.hsv, &gLeds.dst_color);
     LED_Strip_SetColor(&gLeds.dst_color);
     LED_Strip_Update();
 
@@ -380,11 +295,11 @@ static void led_IterateIndication_Fade(void)
     }
     if (0 == gLeds.offset)
     {
-        gLeds.hsv.v = (gLeds.led * 0.02);
+        gLeds.hsv.v = (gLeds.led * LED_COLOR_Q16_ONE / 50);
     }
     else
     {
-        gLeds.hsv.v = ((MAX_FADE_LEVEL - gLeds.led - 1) * 0.02);
+        gLeds.hsv.v = ((MAX_FADE_LEVEL - gLeds.led - 1) * LED_COLOR_Q16_ONE / 50);
     }
 }
 
@@ -399,8 +314,8 @@ static void led_SetIndication_Fade(led_message_t * p_msg)
     gLeds.dst_color.g     = p_msg->dst_color.g;
     gLeds.dst_color.b     = p_msg->dst_color.b;
 
-    led_RGBtoHSV(&gLeds.dst_color, &gLeds.hsv);
-    gLeds.hsv.v         = 0.0;
+    LED_Color_RGBtoHSV(&gLeds.dst_color, &gLeds.hsv);
+    gLeds.hsv.v         = 0;
     gLeds.offset        = 0;
     gLeds.led           = 0;
     /* Set the default tick interval to 30 ms */
@@ -420,7 +335,7 @@ static void led_IterateIndication_PingPong(void)
     LED_Strip_Rotate(0 == gLeds.offset);
 
     gLeds.led++;
-    if ((sizeof(gLeds.buffer) / 3) == gLeds.led)
+    if (gLeds.count == gLeds.led)
     {
         gLeds.led    = 0;
         gLeds.offset = ((gLeds.offset + 1) % 2);
@@ -461,7 +376,7 @@ static void led_IterateIndication_RainbowCirculation(void)
 
 static void led_SetIndication_RainbowCirculation(led_message_t * p_msg)
 {
-    double max = 0.0;
+    uint32_t max = 0;
 
     gLeds.dst_color.dword = 0;
     gLeds.dst_color.r     = p_msg->dst_color.r;
@@ -471,7 +386,7 @@ static void led_SetIndication_RainbowCirculation(led_message_t * p_msg)
     if (0 == gLeds.dst_color.dword)
     {
         /* Running Rainbow */
-        max = 0.222;
+        max = (222 * LED_COLOR_Q16_ONE / 1000);
         /* Set the default tick interval to 60 ms */
         gLeds.tick.interval = 5;
         gLeds.tick.counter  = gLeds.tick.interval;
@@ -482,7 +397,7 @@ static void led_SetIndication_RainbowCirculation(led_message_t * p_msg)
         /* Static Rainbow */
         max = (gLeds.dst_color.r > gLeds.dst_color.g) ? gLeds.dst_color.r : gLeds.dst_color.g;
         max = (max > gLeds.dst_color.b) ? max : gLeds.dst_color.b;
-        max /= 255.0;
+        max = ((max << 16) / UINT8_MAX);
         /* Disable iteration */
         gLeds.command       = LED_CMD_EMPTY;
         gLeds.tick.interval = 0;
@@ -491,12 +406,12 @@ static void led_SetIndication_RainbowCirculation(led_message_t * p_msg)
     }
 
     /* Draw the Rainbow */
-    gLeds.hsv.s = 1.0;
+    gLeds.hsv.s = LED_COLOR_Q16_ONE;
     gLeds.hsv.v = max;
-    for (gLeds.led = 0; gLeds.led < (sizeof(gLeds.buffer) / 3); gLeds.led++)
+    for (gLeds.led = 0; gLeds.led < gLeds.count; gLeds.led++)
     {
-        gLeds.hsv.h = ((gLeds.led + 0.5) * 1.0 / (sizeof(gLeds.buffer) / 3));
-        led_HSVtoRGB(&gLeds.hsv, &gLeds.dst_color);
+        gLeds.hsv.h = (((2 * gLeds.led + 1) * LED_COLOR_Q16_HALF) / gLeds.count);
+        LED_Color_HSVtoRGB(&gLeds.hsv, &gLeds.dst_color);
         LED_Strip_SetPixelColor(gLeds.led, &gLeds.dst_color);
     }
     LED_Strip_Update();
@@ -506,8 +421,8 @@ static void led_SetIndication_RainbowCirculation(led_message_t * p_msg)
 
 static void led_IterateIndication_Rainbow(void)
 {
-    led_color_t result  = {0};
-    double      percent = (1.0 * gLeds.time.duration / gLeds.time.interval);
+    led_color16_t result  = {0};
+    uint32_t      percent = LED_Color_Progress(gLeds.time.duration, gLeds.time.interval);
 
     if ((gLeds.dst_color.dword != gLeds.src_color.dword) &&
         (gLeds.time.duration < gLeds.time.interval))
@@ -517,15 +432,15 @@ static void led_IterateIndication_Rainbow(void)
     }
     else
     {
-        result.dword          = gLeds.dst_color.dword;
+        LED_Color_Expand(&gLeds.dst_color, &result);
         gLeds.src_color.dword = gLeds.dst_color.dword;
         gLeds.command         = LED_CMD_EMPTY;
     }
 
-    LED_Strip_SetColor(&result);
+    LED_Strip_SetColor16(&result);
     LED_Strip_Update();
 
-    LED_LOGI("C(%d.%d.%d)-P:%d", result.r, result.g, result.b, (uint32_t)(100 * percent));
+    LED_LOGI("C(%d.%d.%d)-P:%d", result.r >> 8, result.g >> 8, result.b >> 8, ((100 * percent) >> 16));
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -579,26 +494,26 @@ static void led_SetIndication_Rainbow(led_message_t * p_msg)
 
 static void led_IterateIndication_Sine(void)
 {
-    led_color_t  result  = {0};
-    double       percent = (1.0 * gLeds.time.duration / gLeds.time.interval);
+    led_color16_t result  = {0};
+    uint32_t      percent = LED_Color_Progress(gLeds.time.duration, gLeds.time.interval);
 
     if ((gLeds.dst_color.dword != gLeds.src_color.dword) &&
         (gLeds.time.duration < gLeds.time.interval))
     {
-        percent = sin(percent * gPi);
+        percent = LED_Color_Sine(percent);
         led_SmoothColorTransition(&gLeds.src_color, &gLeds.dst_color, percent, &result);
         gLeds.time.duration += gLeds.time.delta;
     }
     else
     {
-        result.dword          = gLeds.src_color.dword;
+        LED_Color_Expand(&gLeds.src_color, &result);
         gLeds.dst_color.dword = gLeds.src_color.dword;
         gLeds.command         = LED_CMD_EMPTY;
     }
-    LED_Strip_SetColor(&result);
+    LED_Strip_SetColor16(&result);
     LED_Strip_Update();
 
-    LED_LOGI("C(%d.%d.%d)-P:%d", result.r, result.g, result.b, (uint32_t)(100 * percent));
+    LED_LOGI("C(%d.%d.%d)-P:%d", result.r >> 8, result.g >> 8, result.b >> 8, ((100 * percent) >> 16));
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -652,8 +567,43 @@ static void led_SetIndication_Sine(led_message_t * p_msg)
 
 //-------------------------------------------------------------------------------------------------
 
+static void led_SavePixelsCount(uint16_t count)
+{
+    nvs_handle h_nvs  = 0;
+    esp_err_t  status = ESP_OK;
+
+    status = nvs_open(LED_TASK_NVS_NAMESPACE, NVS_READWRITE, &h_nvs);
+    if (ESP_OK == status)
+    {
+        status = nvs_set_u16(h_nvs, LED_TASK_NVS_PIXELS, count);
+        if (ESP_OK == status)
+        {
+            status = nvs_commit(h_nvs);
+        }
+        nvs_close(h_nvs);
+    }
+
+    if (ESP_OK == status)
+    {
+        LED_LOGI("Stored pixels count: %d", count);
+    }
+    else
+    {
+        ESP_LOGE(gTAG, "Pixels count %d not stored: %d", count, status);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
 static void led_ProcessMsg(led_message_t * p_msg)
 {
+    if (LED_CMD_SAVE_PIXELS_COUNT == p_msg->command)
+    {
+        /* Not an indication: the running animation goes on */
+        led_SavePixelsCount((uint16_t)p_msg->interval);
+        return;
+    }
+
     gLeds.command = p_msg->command;
     switch (gLeds.command)
     {
@@ -691,17 +641,52 @@ static void led_ProcessMsg(led_message_t * p_msg)
 
 static void led_Process(void)
 {
-    if (LED_CMD_EMPTY == gLeds.command) return;
+    if (LED_CMD_EMPTY != gLeds.command)
+    {
+        gLeds.tick.counter--;
+        if (0 == gLeds.tick.counter)
+        {
+            if (NULL != gLeds.fp_iterate)
+            {
+                gLeds.fp_iterate();
+            }
+            gLeds.tick.counter = gLeds.tick.interval;
+            return;
+        }
+    }
+
+    /* Keep the temporal dithering running between the animation frames */
+    LED_Strip_Refresh();
+}
+
+//-------------------------------------------------------------------------------------------------
 
-    gLeds.tick.counter--;
-    if (0 == gLeds.tick.counter)
+static uint16_t led_LoadPixelsCount(void)
+{
+    nvs_handle h_nvs  = 0;
+    esp_err_t  status = ESP_OK;
+    uint16_t   count  = LED_TASK_PIXELS_COUNT;
+
+    /* The WiFi task owns the partition and recovers it, a failure here only
+     * leaves the default length until the next start */
+    status = nvs_flash_init();
+    if (ESP_OK != status)
+    {
+        ESP_LOGE(gTAG, "NVS not available: %d", status);
+    }
+    else if (ESP_OK == nvs_open(LED_TASK_NVS_NAMESPACE, NVS_READONLY, &h_nvs))
     {
-        if (NULL != gLeds.fp_iterate)
+        status = nvs_get_u16(h_nvs, LED_TASK_NVS_PIXELS, &count);
+        if ((ESP_OK != status) || (0 == count) || (LED_TASK_PIXELS_MAX < count))
         {
-            gLeds.fp_iterate();
+            count = LED_TASK_PIXELS_COUNT;
         }
-        gLeds.tick.counter = gLeds.tick.interval;
+        nvs_close(h_nvs);
     }
+
+    LED_LOGI("Pixels count: %d", count);
+
+    return count;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -710,10 +695,19 @@ static void led_Task(void * pvParameters)
 {
     BaseType_t    status = pdFAIL;
     led_message_t msg    = {0};
+    bool          init   = false;
 
     LED_LOGI("LED Task started...");
 
-    LED_Strip_Init(gLeds.buffer, sizeof(gLeds.buffer));
+    /* The strip allocates its buffers for the length read by LED_Task_Init */
+    if (false == LED_Strip_Init(gLeds.count))
+    {
+        LED_LOGE("No memory for %d pixels", gLeds.count);
+        gLeds.count = LED_TASK_PIXELS_COUNT;
+        init = LED_Strip_Init(gLeds.count);
+        configASSERT(true == init);
+        (void)init;
+    }
     vTaskDelay(30 / portTICK_RATE_MS);
     LED_Strip_Clear();
     LED_Strip_Update();
@@ -742,7 +736,11 @@ void LED_Task_Init(void)
 {
     gLedQueue = xQueueCreate(20, sizeof(led_message_t));
 
-    (void)xTaskCreate(led_Task, "LED_Task", 1024, NULL, 10, NULL);
+    /* Read on the calling task, before the WiFi task starts using the partition */
+    gLeds.count = led_LoadPixelsCount();
+
+    /* The NVS writes of LED_Task_SavePixelsCount need the larger stack */
+    (void)xTaskCreate(led_Task, "LED_Task", 2048, NULL, 10, NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -765,7 +763,8 @@ void LED_Task_SendMsg(led_message_t * p_msg)
 
 void LED_Task_DetermineColor(led_message_t * p_msg, led_color_t * p_color)
 {
-    double percent = (1.0 * p_msg->duration / p_msg->interval);
+    led_color16_t color   = {0};
+    uint32_t      percent = LED_Color_Progress(p_msg->duration, p_msg->interval);
 
     p_color->dword = 0;
 
@@ -774,21 +773,38 @@ void LED_Task_DetermineColor(led_message_t * p_msg, led_color_t * p_color)
         switch (p_msg->command)
         {
             case LED_CMD_INDICATE_RAINBOW:
-                led_RainbowColorTransition(&p_msg->src_color, &p_msg->dst_color, percent, p_color);
+                led_RainbowColorTransition(&p_msg->src_color, &p_msg->dst_color, percent, &color);
                 break;
             case LED_CMD_INDICATE_SINE:
-                percent = sin(percent * gPi);
-                led_SmoothColorTransition(&p_msg->src_color, &p_msg->dst_color, percent, p_color);
+                percent = LED_Color_Sine(percent);
+                led_SmoothColorTransition(&p_msg->src_color, &p_msg->dst_color, percent, &color);
                 break;
             default:
-                led_SmoothColorTransition(&p_msg->src_color, &p_msg->dst_color, percent, p_color);
+                led_SmoothColorTransition(&p_msg->src_color, &p_msg->dst_color, percent, &color);
                 break;
         }
+        LED_Color_Reduce(&color, p_color);
     }
 }
 
 //-------------------------------------------------------------------------------------------------
 
+bool LED_Task_SavePixelsCount(uint16_t count)
+{
+    led_message_t msg = {0};
+
+    if ((0 == count) || (LED_TASK_PIXELS_MAX < count)) return false;
+
+    /* The LED task writes the flash, the caller may be the tcpip thread.
+     * The new length is applied after restart */
+    msg.command  = LED_CMD_SAVE_PIXELS_COUNT;
+    msg.interval = count;
+
+    return (pdTRUE == xQueueSendToBack(gLedQueue, (void *)&msg, (TickType_t)0));
+}
+
+//-------------------------------------------------------------------------------------------------
+
 void LED_Task_GetCurrentColor(led_color_t * p_color)
 {
     /* This call is not thread safe but this is acceptable */
@@ -1151,8 +1167,140 @@ static void led_Test_DayNight(void)
 
 //-------------------------------------------------------------------------------------------------
 
+static bool led_Test_ColorMath(void)
+{
+    #define RGBA(rv,gv,bv,av) {.r=rv,.g=gv,.b=bv,.a=av}
+
+    enum
+    {
+        MAX_DEVIATION    = 1,
+        BENCH_ITERATIONS = 1000,
+    };
+
+    typedef struct
+    {
+        led_command_t cmd;
+        led_color_t   src;
+        led_color_t   dst;
+        uint32_t      interval;
+        uint32_t      duration;
+        led_color_t   result;
+    } color_vector_t;
+
+    /* Reference results are produced by the former double precision implementation */
+    const color_vector_t vectors[] =
+    {
+        {LED_CMD_INDICATE_COLOR,   RGBA(  0,   0,  32, 1), RGBA(  0,   0,  44, 1), 25740000,  8580000, RGBA(  0,   0,  36, 0)},
+        {LED_CMD_INDICATE_COLOR,   RGBA(  0,   0,  32, 1), RGBA(  0,   0,  44, 1), 25740000, 12870000, RGBA(  0,   0,  38, 0)},
+        {LED_CMD_INDICATE_COLOR,   RGBA(  0,   0, 255, 1), RGBA(255,   0,   0, 1),     8000,     4000, RGBA(127,   0, 127, 0)},
+        {LED_CMD_INDICATE_COLOR,   RGBA(160,   0, 130, 1), RGBA(  0, 255,   0, 1),     3000,     1000, RGBA(106,  85,  86, 0)},
+        {LED_CMD_INDICATE_RAINBOW, RGBA(  0,   0,  44, 0), RGBA( 64,   0,  56, 1),   780000,   390000, RGBA( 30,   0,  54, 0)},
+        {LED_CMD_INDICATE_RAINBOW, RGBA( 64,   0,  56, 0), RGBA(220, 220,   0, 1),  3780000,   945000, RGBA(103,   0,  41, 0)},
+        {LED_CMD_INDICATE_RAINBOW, RGBA( 64,   0,  56, 0), RGBA(220, 220,   0, 1),  3780000,  2835000, RGBA(181,  96,   0, 0)},
+        {LED_CMD_INDICATE_RAINBOW, RGBA(220, 220,   0, 1), RGBA( 64,   0,  56, 0),  3840000,  1920000, RGBA(142,   8,   0, 0)},
+        {LED_CMD_INDICATE_RAINBOW, RGBA( 64,   0,  56, 1), RGBA(  0,   0,  44, 0),   780000,   520000, RGBA( 19,   0,  50, 0)},
+        {LED_CMD_INDICATE_RAINBOW, RGBA(  0, 255,   0, 1), RGBA(255,   0,   0, 0),    15000,     5000, RGBA(170, 255,   0, 0)},
+        {LED_CMD_INDICATE_SINE,    RGBA(220, 220,   0, 1), RGBA(255, 255, 255, 1), 34260000,  8565000, RGBA(244, 244, 180, 0)},
+        {LED_CMD_INDICATE_SINE,    RGBA(220, 220,   0, 1), RGBA(255, 255, 255, 1), 34260000, 17130000, RGBA(255, 255, 254, 0)},
+        {LED_CMD_INDICATE_SINE,    RGBA(255,   0,   0, 1), RGBA(  0, 255,   0, 1),     6000,     5400, RGBA(176,  78,   0, 0)},
+    };
+
+    /* Running rainbow of LED_TASK_PIXELS_COUNT pixels with the 0.222 brightness */
+    const led_color_t rainbow[16] =
+    {
+        RGBA( 56,  10,   0, 0), RGBA( 56,  31,   0, 0), RGBA( 56,  53,   0, 0), RGBA( 38,  56,   0, 0),
+        RGBA( 17,  56,   0, 0), RGBA(  0,  56,   3, 0), RGBA(  0,  56,  24, 0), RGBA(  0,  56,  45, 0),
+        RGBA(  0,  45,  56, 0), RGBA(  0,  24,  56, 0), RGBA(  0,   3,  56, 0), RGBA( 17,   0,  56, 0),
+        RGBA( 38,   0,  56, 0), RGBA( 56,   0,  53, 0), RGBA( 56,   0,  31, 0), RGBA( 56,   0,  10, 0),
+    };
+
+    led_message_t led_msg = {0};
+    led_color_t   color   = {0};
+    led_hsv_t     hsv     = {0};
+    uint32_t      test    = 0;
+    uint32_t      pass    = 0;
+    uint32_t      ch      = 0;
+    uint32_t      failed  = 0;
+    int64_t       start   = 0;
+
+    for (test = 0; test < (sizeof(vectors) / sizeof(color_vector_t)); test++)
+    {
+        memset(&led_msg, 0, sizeof(led_msg));
+        led_msg.command         = vectors[test].cmd;
+        led_msg.src_color.dword = vectors[test].src.dword;
+        led_msg.dst_color.dword = vectors[test].dst.dword;
+        led_msg.interval        = vectors[test].interval;
+        led_msg.duration        = vectors[test].duration;
+        LED_Task_DetermineColor(&led_msg, &color);
+
+        for (ch = 0, pass = 1; ch < 3; ch++)
+        {
+            if (MAX_DEVIATION < abs(color.bytes[ch] - vectors[test].result.bytes[ch]))
+            {
+                pass = 0;
+            }
+        }
+        if (pass)
+        {
+            LED_LOGI("Color math %2d C(%3d.%3d.%3d) - PASS", test, color.r, color.g, color.b);
+        }
+        else
+        {
+            ESP_LOGE(gTAG, "Color math %2d C(%3d.%3d.%3d) - FAIL", test, color.r, color.g, color.b);
+            failed++;
+        }
+    }
+
+    hsv.s = LED_COLOR_Q16_ONE;
+    hsv.v = (222 * LED_COLOR_Q16_ONE / 1000);
+    for (test = 0, pass = 1; test < (sizeof(rainbow) / sizeof(led_color_t)); test++)
+    {
+        hsv.h = (((2 * test + 1) * LED_COLOR_Q16_HALF) / (sizeof(rainbow) / sizeof(led_color_t)));
+        LED_Color_HSVtoRGB(&hsv, &color);
+        for (ch = 0; ch < 3; ch++)
+        {
+            if (MAX_DEVIATION < abs(color.bytes[ch] - rainbow[test].bytes[ch]))
+            {
+                pass = 0;
+            }
+        }
+    }
+    if (pass)
+    {
+        LED_LOGI("Rainbow HSV                 - PASS");
+    }
+    else
+    {
+        ESP_LOGE(gTAG, "Rainbow HSV                 - FAIL");
+        failed++;
+    }
+
+    /* Cost of the heaviest per frame calculation */
+    memset(&led_msg, 0, sizeof(led_msg));
+    led_msg.command         = LED_CMD_INDICATE_RAINBOW;
+    led_msg.src_color.dword = vectors[5].src.dword;
+    led_msg.dst_color.dword = vectors[5].dst.dword;
+    led_msg.interval        = vectors[5].interval;
+    start = esp_timer_get_time();
+    for (test = 0; test < BENCH_ITERATIONS; test++)
+    {
+        led_msg.duration = (test * (led_msg.interval / BENCH_ITERATIONS));
+        LED_Task_DetermineColor(&led_msg, &color);
+    }
+    start = ((esp_timer_get_time() - start) * 1000 / BENCH_ITERATIONS);
+
+    ESP_LOGI(gTAG, "Color math test: %d of %d failed, rainbow transition %d ns", failed,
+             (int)((sizeof(vectors) / sizeof(color_vector_t)) + 1), (uint32_t)start);
+
+    return (0 == failed);
+}
+
+//-------------------------------------------------------------------------------------------------
+
 void LED_Task_Test(void)
 {
+    (void)led_Test_ColorMath();
+    (void)LED_Strip_Test();
     led_Test_Color();
     led_Test_RgbCirculation();
     led_Test_Fade();
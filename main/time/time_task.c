@@ -63,25 +63,26 @@ static QueueHandle_t  gTimeQueue = {0};
 static time_command_t gCommand   = TIME_CMD_EMPTY;
 static time_t         gAlarm     = LONG_MAX;
 
-/* Start             -    0 minutes - RGB(  0,   0,  32) - RGB(  0,   0,  44) - Smooth      */
-/* MorningBlueHour   -  429 minutes - RGB(  0,   0,  44) - RGB( 64,   0,  56) - Rainbow CW  */
-/* MorningGoldenHour -  442 minutes - RGB( 64,   0,  56) - RGB(220, 220,   0) - Rainbow CW  */
+/* The strip output is gamma corrected - the values are perceptual, not linear */
+/* Start             -    0 minutes - RGB(  0,   0,  97) - RGB(  0,   0, 112) - Smooth      */
+/* MorningBlueHour   -  429 minutes - RGB(  0,   0, 112) - RGB(134,   0, 126) - Rainbow CW  */
+/* MorningGoldenHour -  442 minutes - RGB(134,   0, 126) - RGB(238, 238,   0) - Rainbow CW  */
 /* Rise              -  461 minutes                                                         */
-/* Day               -  505 minutes - RGB(220, 220,   0) - RGB(255, 255, 255) - Sine        */
+/* Day               -  505 minutes - RGB(238, 238,   0) - RGB(255, 255, 255) - Sine        */
 /* Noon              -  791 minutes                                                         */
-/* EveningGoldenHour - 1076 minutes - RGB(220, 220,   0) - RGB( 64,   0,  56) - Rainbow CCW */
+/* EveningGoldenHour - 1076 minutes - RGB(238, 238,   0) - RGB(134,   0, 126) - Rainbow CCW */
 /* Set               - 1120 minutes                                                         */
-/* EveningBlueHour   - 1140 minutes - RGB( 64,   0,  56) - RGB(  0,   0,  44) - Rainbow CCW */
-/* Night             - 1153 minutes - RGB(  0,   0,  44) - RGB(  0,   0,  32) - None        */
+/* EveningBlueHour   - 1140 minutes - RGB(134,   0, 126) - RGB(  0,   0, 112) - Rainbow CCW */
+/* Night             - 1153 minutes - RGB(  0,   0, 112) - RGB(  0,   0,  97) - None        */
 static time_point_t gPoints[TIME_POINT_COUNT] =
 {
-    {0, 0, RGBA(  0,   0,  32, 1), RGBA(  0,   0,  44, 1), LED_CMD_INDICATE_COLOR,   0},
-    {0, 0, RGBA(  0,   0,  44, 0), RGBA( 64,   0,  56, 1), LED_CMD_INDICATE_RAINBOW, 0},
-    {0, 0, RGBA( 64,   0,  56, 0), RGBA(220, 220,   0, 1), LED_CMD_INDICATE_RAINBOW, 0},
-    {0, 0, RGBA(220, 220,   0, 1), RGBA(255, 255, 255, 1), LED_CMD_INDICATE_SINE,    0},
-    {0, 0, RGBA(220, 220,   0, 1), RGBA( 64,   0,  56, 0), LED_CMD_INDICATE_RAINBOW, 0},
-    {0, 0, RGBA( 64,   0,  56, 1), RGBA(  0,   0,  44, 0), LED_CMD_INDICATE_RAINBOW, 0},
-    {0, 0, RGBA(  0,   0,  44, 1), RGBA(  0,   0,  32, 1), LED_CMD_INDICATE_COLOR,   0},
+    {0, 0, RGBA(  0,   0,  97, 1), RGBA(  0,   0, 112, 1), LED_CMD_INDICATE_COLOR,   0},
+    {0, 0, RGBA(  0,   0, 112, 0), RGBA(134,   0, 126, 1), LED_CMD_INDICATE_RAINBOW, 0},
+    {0, 0, RGBA(134,   0, 126, 0), RGBA(238, 238,   0, 1), LED_CMD_INDICATE_RAINBOW, 0},
+    {0, 0, RGBA(238, 238,   0, 1), RGBA(255, 255, 255, 1), LED_CMD_INDICATE_SINE,    0},
+    {0, 0, RGBA(238, 238,   0, 1), RGBA(134,   0, 126, 0), LED_CMD_INDICATE_RAINBOW, 0},
+    {0, 0, RGBA(134,   0, 126, 1), RGBA(  0,   0, 112, 0), LED_CMD_INDICATE_RAINBOW, 0},
+    {0, 0, RGBA(  0,   0, 112, 1), RGBA(  0,   0,  97, 1), LED_CMD_INDICATE_COLOR,   0},
 };
 
 //-------------------------------------------------------------------------------------------------
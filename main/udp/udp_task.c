@@ -49,7 +49,6 @@ static const char *       TAG              = "UDP";
 static EventGroupHandle_t gUdpEvents       = NULL;
 static uint32_t           gIpAddr          = 0;
 static uint8_t            gUdpBuffer[1024] = {0};
-static uint8_t            gLedStrip[16*3]  = {0};
 
 //-------------------------------------------------------------------------------------------------
 
@@ -180,6 +179,7 @@ static void vUDP_Task(void * pvParameters)
     int addr_family;
     int ip_protocol;
     uint32_t ip;
+    led_color_t color = {0};
 //    TickType_t xLastWakeTime;
 //    const TickType_t xPeriod = 20;
 //    int len = 0;
@@ -291,12 +291,10 @@ static void vUDP_Task(void * pvParameters)
 
                 ESP_LOGI(TAG, "Received %d bytes from %s", len, addr_str);
 
-                for (uint8_t idx = 0; idx < sizeof(gLedStrip); idx += 3)
-                {
-                    gLedStrip[idx + 0] = packet->r;
-                    gLedStrip[idx + 1] = packet->g;
-                    gLedStrip[idx + 2] = packet->b;
-                }
+                color.r = packet->r;
+                color.g = packet->g;
+                color.b = packet->b;
+                LED_Strip_SetColor(&color);
                 LED_Strip_Update();
             }
 
@@ -358,7 +356,7 @@ void UDP_Task_Init(void)
     /* Create the events group for UDP task */
     gUdpEvents = xEventGroupCreate();
 
-    LED_Strip_Init(gLedStrip, sizeof(gLedStrip));
+    /* The strip is drawn here but owned by the LED task, which sizes it from NVS */
 
     xTaskCreate(vUDP_Task, "UDP", 4096, NULL, 5, NULL);
 }
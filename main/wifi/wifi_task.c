@@ -459,6 +459,16 @@ static bool wifi_LoadParams(wifi_params_t * p_params)
     bool          result                     = false;
 
     status = nvs_flash_init();
+    if ((ESP_ERR_NVS_NO_FREE_PAGES == status) || (ESP_ERR_NVS_NEW_VERSION_FOUND == status))
+    {
+        /* The partition is full or has a newer layout: erase it and start over */
+        ESP_LOGE(TAG, "NVS partition erased: %d", status);
+        status = nvs_flash_erase();
+        if (ESP_OK == status)
+        {
+            status = nvs_flash_init();
+        }
+    }
     ESP_ERROR_CHECK(status);
 
     status = nvs_open("wifi", NVS_READONLY, &h_nvs);
@@ -0,0 +1,194 @@
+/* Task notifications and queues of include/FreeRTOS.h on POSIX threads, a
+ * tick is a millisecond */
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+struct host_task
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  wake;
+    uint32_t        count;
+};
+
+struct host_queue
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+    UBaseType_t     length;
+    UBaseType_t     item_size;
+    UBaseType_t     count;
+    UBaseType_t     head;
+    char *          items;
+};
+
+__thread int            host_in_isr;
+long                    host_notifies;
+static __thread struct host_task * current_task;
+
+/* The tick count: FreeRTOS reads a variable, the coarse clock is as cheap */
+static double now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/* Waits on the condition until the deadline of ticks from now */
+static int wait(pthread_cond_t * cond, pthread_mutex_t * lock, TickType_t ticks)
+{
+    struct timespec ts;
+
+    if (ticks == portMAX_DELAY)
+    {
+        return pthread_cond_wait(cond, lock);
+    }
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += ticks / 1000;
+    ts.tv_nsec += (long)(ticks % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000)
+    {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+    return pthread_cond_timedwait(cond, lock, &ts);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (current_task == NULL)
+    {
+        /* Lives as long as the process, as the tasks of the firmware do */
+        current_task = calloc(1, sizeof(*current_task));
+        pthread_mutex_init(&current_task->lock, NULL);
+        pthread_cond_init(&current_task->wake, NULL);
+    }
+    return current_task;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    __atomic_fetch_add(&host_notifies, 1, __ATOMIC_RELAXED);
+    pthread_mutex_lock(&task->lock);
+    task->count++;
+    pthread_cond_signal(&task->wake);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t * woken)
+{
+    (void)xTaskNotifyGive(task);
+    *woken = pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    struct host_task * task = xTaskGetCurrentTaskHandle();
+    uint32_t           count;
+
+    pthread_mutex_lock(&task->lock);
+    while ((task->count == 0) && (wait(&task->wake, &task->lock, ticks) != ETIMEDOUT))
+    {
+    }
+    count = task->count;
+    if (count != 0)
+    {
+        task->count = clear ? 0 : count - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+    return count;
+}
+
+void vTaskSetTimeOutState(TimeOut_t * timeout)
+{
+    timeout->start_ms = now_ms();
+}
+
+BaseType_t xTaskCheckForTimeOut(TimeOut_t * timeout, TickType_t * ticks)
+{
+    double elapsed = now_ms() - timeout->start_ms;
+
+    if (*ticks == portMAX_DELAY)
+    {
+        return pdFALSE;
+    }
+    if (elapsed >= *ticks)
+    {
+        *ticks = 0;
+        return pdTRUE;
+    }
+    *ticks -= (TickType_t)elapsed;
+    vTaskSetTimeOutState(timeout);
+    return pdFALSE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct host_queue * queue = calloc(1, sizeof(*queue));
+
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+    queue->length    = length;
+    queue->item_size = item_size;
+    queue->items     = malloc((size_t)length * item_size);
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->changed);
+    free(queue->items);
+    free(queue);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void * item, TickType_t ticks)
+{
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->count == queue->length) && (ticks != 0) &&
+           (wait(&queue->changed, &queue->lock, ticks) != ETIMEDOUT))
+    {
+    }
+    if (queue->count == queue->length)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return pdFAIL;
+    }
+    memcpy(queue->items + ((queue->head + queue->count) % queue->length) * queue->item_size, item, queue->item_size);
+    queue->count++;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
+
+BaseType_t xQueueSendToBackFromISR(QueueHandle_t queue, const void * item, BaseType_t * woken)
+{
+    *woken = pdFALSE;
+    return xQueueSendToBack(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void * item, TickType_t ticks)
+{
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->count == 0) && (ticks != 0) && (wait(&queue->changed, &queue->lock, ticks) != ETIMEDOUT))
+    {
+    }
+    if (queue->count == 0)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return pdFAIL;
+    }
+    memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return pdPASS;
+}
@@ -0,0 +1,28 @@
+/* The FreeRTOS types and the task notifications block_queue.c uses, on
+ * POSIX threads: freertos_host.c has the implementation */
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define portBASE_TYPE    int
+#define portMAX_DELAY    ((TickType_t)0xFFFFFFFF)
+#define portTICK_RATE_MS 1
+#define pdFALSE          0
+#define pdTRUE           1
+#define pdPASS           1
+#define pdFAIL           0
+
+/* Non zero in the threads that play an interrupt handler */
+extern __thread int host_in_isr;
+
+static inline BaseType_t xPortInIsrContext(void)
+{
+    return host_in_isr;
+}
+
+#endif /* HOST_FREERTOS_H */
@@ -0,0 +1,21 @@
+/* Included ahead of every source: what newlib has and glibc does not */
+#ifndef HOST_COMPAT_H
+#define HOST_COMPAT_H
+
+#include <string.h>
+
+static inline size_t host_strlcpy(char * dst, const char * src, size_t size)
+{
+    size_t len = strlen(src);
+
+    if (size)
+    {
+        size_t n = (len >= size) ? size - 1 : len;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#define strlcpy host_strlcpy
+
+#endif /* HOST_COMPAT_H */
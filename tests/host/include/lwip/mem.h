@@ -0,0 +1,9 @@
+#ifndef HOST_LWIP_MEM_H
+#define HOST_LWIP_MEM_H
+
+#include "lwip/opt.h"
+
+void * mem_malloc(mem_size_t size);
+void   mem_free(void * mem);
+
+#endif /* HOST_LWIP_MEM_H */
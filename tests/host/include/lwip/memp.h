@@ -0,0 +1 @@
+#include "lwip/opt.h"
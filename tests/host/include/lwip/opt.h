@@ -0,0 +1,75 @@
+/* Host stand-in for the lwIP options and types httpd uses */
+#ifndef HOST_LWIP_OPT_H
+#define HOST_LWIP_OPT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <stdio.h>
+
+typedef uint8_t   u8_t;
+typedef int8_t    s8_t;
+typedef uint16_t  u16_t;
+typedef int16_t   s16_t;
+typedef uint32_t  u32_t;
+typedef int32_t   s32_t;
+typedef s8_t      err_t;
+typedef u16_t     mem_size_t;
+typedef uintptr_t mem_ptr_t;
+
+#define U16_F "u"
+#define S16_F "d"
+#define U32_F "u"
+#define S32_F "d"
+#define X16_F "x"
+
+#define LWIP_TCP                1
+#define LWIP_DBG_ON             0x80
+#define LWIP_DBG_TRACE          0x40
+#define LWIP_DEBUGF(debug, msg)
+#define LWIP_ASSERT(msg, cond)  assert(cond)
+#define LWIP_UNUSED_ARG(x)      (void)(x)
+#define LWIP_MIN(a, b)          ((a) < (b) ? (a) : (b))
+#define LWIP_MAX(a, b)          ((a) > (b) ? (a) : (b))
+#define MEMCPY(dst, src, len)   memcpy(dst, src, len)
+
+#define PBUF_POOL_BUFSIZE       512
+#define TCP_PRIO_MIN            1
+#ifndef TCP_SND_QUEUELEN
+#define TCP_SND_QUEUELEN        32
+#endif
+#ifndef TCP_WND
+#define TCP_WND                 5744
+#endif
+
+#define TCP_WRITE_FLAG_COPY     0x01
+#define TCP_WRITE_FLAG_MORE     0x02
+
+typedef struct
+{
+    u32_t addr;
+} ip_addr_t;
+#define IP_ADDR_ANY NULL
+
+#define ERR_OK          0
+#define ERR_MEM        -1
+#define ERR_BUF        -2
+#define ERR_TIMEOUT    -3
+#define ERR_RTE        -4
+#define ERR_INPROGRESS -5
+#define ERR_VAL        -6
+#define ERR_WOULDBLOCK -7
+#define ERR_USE        -8
+#define ERR_ALREADY    -9
+#define ERR_ISCONN     -10
+#define ERR_CONN       -11
+#define ERR_IF         -12
+#define ERR_ABRT       -13
+#define ERR_RST        -14
+#define ERR_CLSD       -15
+#define ERR_ARG        -16
+
+const char * lwip_strerr(err_t err);
+
+#endif /* HOST_LWIP_OPT_H */
@@ -0,0 +1,44 @@
+#ifndef HOST_LWIP_PBUF_H
+#define HOST_LWIP_PBUF_H
+
+#include "lwip/opt.h"
+
+typedef enum
+{
+    PBUF_TRANSPORT,
+    PBUF_IP,
+    PBUF_LINK,
+    PBUF_RAW_TX,
+    PBUF_RAW
+} pbuf_layer;
+
+typedef enum
+{
+    PBUF_RAM,
+    PBUF_ROM,
+    PBUF_REF,
+    PBUF_POOL
+} pbuf_type;
+
+struct pbuf
+{
+    struct pbuf * next;
+    void *        payload;
+    u16_t         tot_len;
+    u16_t         len;
+    u16_t         ref;
+    u8_t *        mem;
+};
+
+struct pbuf * pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type);
+u8_t          pbuf_free(struct pbuf * p);
+void          pbuf_ref(struct pbuf * p);
+void          pbuf_cat(struct pbuf * head, struct pbuf * tail);
+u16_t         pbuf_clen(const struct pbuf * p);
+u16_t         pbuf_copy_partial(const struct pbuf * p, void * dataptr, u16_t len, u16_t offset);
+u8_t          pbuf_header(struct pbuf * p, s16_t header_size);
+struct pbuf * pbuf_coalesce(struct pbuf * p, pbuf_layer layer);
+u8_t          pbuf_get_at(const struct pbuf * p, u16_t offset);
+struct pbuf * pbuf_skip(struct pbuf * in, u16_t in_offset, u16_t * out_offset);
+
+#endif /* HOST_LWIP_PBUF_H */
@@ -0,0 +1,108 @@
+/* Host stand-in for the raw TCP API, implemented by sim_tcp.c */
+#ifndef HOST_LWIP_TCP_H
+#define HOST_LWIP_TCP_H
+
+#include "lwip/opt.h"
+#include "lwip/pbuf.h"
+#include "lwip/mem.h"
+
+struct tcp_pcb;
+
+typedef err_t (*tcp_recv_fn)(void * arg, struct tcp_pcb * tpcb, struct pbuf * p, err_t err);
+typedef err_t (*tcp_sent_fn)(void * arg, struct tcp_pcb * tpcb, u16_t len);
+typedef err_t (*tcp_poll_fn)(void * arg, struct tcp_pcb * tpcb);
+typedef void  (*tcp_err_fn)(void * arg, err_t err);
+typedef err_t (*tcp_accept_fn)(void * arg, struct tcp_pcb * newpcb, err_t err);
+
+enum tcp_state
+{
+    CLOSED,
+    LISTEN,
+    ESTABLISHED,
+    CLOSE_WAIT
+};
+
+#define SIM_MAX_SEGS 1024
+
+struct tcp_pcb
+{
+    enum tcp_state state;
+    void *         callback_arg;
+    tcp_recv_fn    recv;
+    tcp_sent_fn    sent;
+    tcp_poll_fn    poll;
+    tcp_err_fn     errf;
+    tcp_accept_fn  accept;
+    u16_t          snd_buf;
+    u16_t          mss;
+    u16_t          snd_queuelen;
+    u16_t          unacked;
+    u8_t           flags;
+    int            closed;
+    int            aborted;
+
+    /* Everything the server wrote */
+    unsigned char * out;
+    size_t          out_len;
+    size_t          out_cap;
+    unsigned        writes;
+    long            copied;
+
+    /* Segments the way lwIP packs them: queued, then in flight */
+    u32_t snd_lbb;
+    u32_t snd_nxt;
+    u16_t useg[SIM_MAX_SEGS];
+    u8_t  useg_psh[SIM_MAX_SEGS];
+    u8_t  useg_pbufs[SIM_MAX_SEGS];
+    int   nuseg;
+    int   fl_segs;
+    int   fl_pbufs;
+    u32_t fl_bytes;
+    long  tr_segs;
+    long  tr_short;
+    long  tr_psh;
+    long  tr_delack;
+    long  tr_bytes;
+
+    /* Receive side: what the client has not sent yet because the window
+     * is closed, and the pbuf the server refused */
+    unsigned char * rx;
+    size_t          rx_len;
+    size_t          rx_cap;
+    long            rx_delivered;
+    long            rx_recved;
+    struct pbuf *   refused;
+};
+
+struct tcp_pcb_listen
+{
+    struct tcp_pcb pcb;
+};
+
+#define TF_NODELAY               0x40
+#define tcp_nagle_disable(pcb)   ((pcb)->flags |= TF_NODELAY)
+#define tcp_nagle_enable(pcb)    ((pcb)->flags &= (u8_t)~TF_NODELAY)
+#define tcp_sndbuf(pcb)          ((pcb)->snd_buf)
+#define tcp_mss(pcb)             ((pcb)->mss)
+#define tcp_sndqueuelen(pcb)     ((pcb)->snd_queuelen)
+
+struct tcp_pcb * tcp_new(void);
+err_t            tcp_bind(struct tcp_pcb * pcb, const ip_addr_t * ipaddr, u16_t port);
+struct tcp_pcb * tcp_listen(struct tcp_pcb * pcb);
+void             tcp_arg(struct tcp_pcb * pcb, void * arg);
+void             tcp_accept(struct tcp_pcb * pcb, tcp_accept_fn accept);
+void             tcp_recv(struct tcp_pcb * pcb, tcp_recv_fn recv);
+void             tcp_sent(struct tcp_pcb * pcb, tcp_sent_fn sent);
+void             tcp_poll(struct tcp_pcb * pcb, tcp_poll_fn poll, u8_t interval);
+void             tcp_err(struct tcp_pcb * pcb, tcp_err_fn err);
+void             tcp_accepted(void * lpcb);
+void             tcp_setprio(struct tcp_pcb * pcb, u8_t prio);
+err_t            tcp_write(struct tcp_pcb * pcb, const void * dataptr, u16_t len, u8_t apiflags);
+err_t            tcp_output(struct tcp_pcb * pcb);
+void             tcp_recved(struct tcp_pcb * pcb, u16_t len);
+err_t            tcp_close(struct tcp_pcb * pcb);
+err_t            tcp_shutdown(struct tcp_pcb * pcb, int shut_rx, int shut_tx);
+void             tcp_abort(struct tcp_pcb * pcb);
+const char *     tcp_debug_state_str(enum tcp_state s);
+
+#endif /* HOST_LWIP_TCP_H */
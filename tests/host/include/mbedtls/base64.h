@@ -0,0 +1,3 @@
+#include <stddef.h>
+
+int mbedtls_base64_encode(unsigned char * dst, size_t dlen, unsigned int * olen, const unsigned char * src, size_t slen);
@@ -0,0 +1,16 @@
+#ifndef HOST_QUEUE_H
+#define HOST_QUEUE_H
+
+#include "task.h"
+
+/* A queue of items copied in and out under a lock, as FreeRTOS does in a
+ * critical section */
+typedef struct host_queue * QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void          vQueueDelete(QueueHandle_t queue);
+BaseType_t    xQueueSendToBack(QueueHandle_t queue, const void * item, TickType_t ticks);
+BaseType_t    xQueueSendToBackFromISR(QueueHandle_t queue, const void * item, BaseType_t * woken);
+BaseType_t    xQueueReceive(QueueHandle_t queue, void * item, TickType_t ticks);
+
+#endif /* HOST_QUEUE_H */
@@ -0,0 +1,26 @@
+#ifndef HOST_TASK_H
+#define HOST_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef struct host_task * TaskHandle_t;
+
+typedef struct
+{
+    double start_ms;
+} TimeOut_t;
+
+/* Every thread is a task, its handle is made on the first use */
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t   xTaskNotifyGive(TaskHandle_t task);
+void         vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t * woken);
+uint32_t     ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+void         vTaskSetTimeOutState(TimeOut_t * timeout);
+BaseType_t   xTaskCheckForTimeOut(TimeOut_t * timeout, TickType_t * ticks);
+
+#define taskYIELD() do { } while (0)
+
+/* Calls of the notification functions, to see what a test costs */
+extern long host_notifies;
+
+#endif /* HOST_TASK_H */
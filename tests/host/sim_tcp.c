@@ -0,0 +1,647 @@
+/* Minimal fake lwIP TCP/pbuf layer to drive httpd.c on the host */
+#include <string.h>
+#include <stdlib.h>
+#include "lwip/tcp.h"
+#include "mbedtls/sha1.h"
+#include "mbedtls/base64.h"
+#include "sim_tcp.h"
+
+long   sim_mallocs;
+long   sim_frees;
+long   sim_pbufs;
+long   sim_pbuf_bytes;
+u16_t  sim_snd_buf = 5744;
+u16_t  sim_mss     = 1436;
+u16_t  sim_rx_seg  = 1460;
+int    sim_trace_print;
+char * sim_stack_low;
+
+static struct tcp_pcb * listen_pcb;
+
+const char * lwip_strerr(err_t err)
+{
+    static char buf[16];
+
+    snprintf(buf, sizeof(buf), "%d", err);
+    return buf;
+}
+
+void * mem_malloc(mem_size_t size)
+{
+    sim_mallocs++;
+    return malloc(size);
+}
+
+void mem_free(void * mem)
+{
+    if (mem)
+    {
+        sim_frees++;
+    }
+    free(mem);
+}
+
+/* pbufs */
+
+struct pbuf * pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type)
+{
+    struct pbuf * p = calloc(1, sizeof(*p));
+
+    (void)layer;
+    (void)type;
+    p->mem     = malloc(length ? length : 1);
+    p->payload = p->mem;
+    p->len     = length;
+    p->tot_len = length;
+    p->ref     = 1;
+    sim_pbufs++;
+    sim_pbuf_bytes += length;
+    return p;
+}
+
+u8_t pbuf_free(struct pbuf * p)
+{
+    u8_t count = 0;
+
+    while (p != NULL)
+    {
+        struct pbuf * next = p->next;
+        if (--p->ref)
+        {
+            break;
+        }
+        free(p->mem);
+        free(p);
+        sim_pbufs--;
+        count++;
+        p = next;
+    }
+    return count;
+}
+
+void pbuf_ref(struct pbuf * p)
+{
+    p->ref++;
+}
+
+void pbuf_cat(struct pbuf * head, struct pbuf * tail)
+{
+    struct pbuf * p;
+
+    for (p = head; p->next != NULL; p = p->next)
+    {
+        p->tot_len += tail->tot_len;
+    }
+    p->tot_len += tail->tot_len;
+    p->next = tail;
+}
+
+u16_t pbuf_clen(const struct pbuf * p)
+{
+    u16_t count = 0;
+
+    for (; p != NULL; p = p->next)
+    {
+        count++;
+    }
+    return count;
+}
+
+u16_t pbuf_copy_partial(const struct pbuf * p, void * dataptr, u16_t len, u16_t offset)
+{
+    u16_t done = 0;
+
+    for (; (p != NULL) && len; p = p->next)
+    {
+        u16_t n;
+        if (offset >= p->len)
+        {
+            offset -= p->len;
+            continue;
+        }
+        n = LWIP_MIN((u16_t)(p->len - offset), len);
+        memcpy((u8_t *)dataptr + done, (u8_t *)p->payload + offset, n);
+        done += n;
+        len -= n;
+        offset = 0;
+    }
+    return done;
+}
+
+u8_t pbuf_header(struct pbuf * p, s16_t header_size)
+{
+    if ((header_size > 0) || (-header_size > p->len))
+    {
+        return 1;
+    }
+    p->payload = (u8_t *)p->payload - header_size;
+    p->len += header_size;
+    p->tot_len += header_size;
+    return 0;
+}
+
+struct pbuf * pbuf_coalesce(struct pbuf * p, pbuf_layer layer)
+{
+    struct pbuf * q;
+
+    if (p->next == NULL)
+    {
+        return p;
+    }
+    q = pbuf_alloc(layer, p->tot_len, PBUF_RAM);
+    pbuf_copy_partial(p, q->payload, p->tot_len, 0);
+    pbuf_free(p);
+    return q;
+}
+
+u8_t pbuf_get_at(const struct pbuf * p, u16_t offset)
+{
+    u8_t byte = 0;
+
+    pbuf_copy_partial(p, &byte, 1, offset);
+    return byte;
+}
+
+struct pbuf * pbuf_skip(struct pbuf * in, u16_t in_offset, u16_t * out_offset)
+{
+    while ((in != NULL) && (in_offset >= in->len))
+    {
+        in_offset -= in->len;
+        in = in->next;
+    }
+    if (out_offset)
+    {
+        *out_offset = in_offset;
+    }
+    return in;
+}
+
+/* Raw TCP API */
+
+struct tcp_pcb * tcp_new(void)
+{
+    struct tcp_pcb * pcb = calloc(1, sizeof(*pcb));
+
+    pcb->snd_buf = sim_snd_buf;
+    pcb->mss     = sim_mss;
+    return pcb;
+}
+
+err_t tcp_bind(struct tcp_pcb * pcb, const ip_addr_t * ipaddr, u16_t port)
+{
+    (void)pcb;
+    (void)ipaddr;
+    (void)port;
+    return ERR_OK;
+}
+
+struct tcp_pcb * tcp_listen(struct tcp_pcb * pcb)
+{
+    pcb->state = LISTEN;
+    listen_pcb = pcb;
+    return pcb;
+}
+
+void tcp_arg(struct tcp_pcb * pcb, void * arg)                     { pcb->callback_arg = arg; }
+void tcp_accept(struct tcp_pcb * pcb, tcp_accept_fn accept)        { pcb->accept = accept; }
+void tcp_recv(struct tcp_pcb * pcb, tcp_recv_fn recv)              { pcb->recv = recv; }
+void tcp_sent(struct tcp_pcb * pcb, tcp_sent_fn sent)              { pcb->sent = sent; }
+void tcp_poll(struct tcp_pcb * pcb, tcp_poll_fn poll, u8_t interval) { (void)interval; pcb->poll = poll; }
+void tcp_err(struct tcp_pcb * pcb, tcp_err_fn err)                 { pcb->errf = err; }
+void tcp_accepted(void * lpcb)                                     { (void)lpcb; }
+void tcp_setprio(struct tcp_pcb * pcb, u8_t prio)                  { (void)pcb; (void)prio; }
+const char * tcp_debug_state_str(enum tcp_state s)                 { (void)s; return "?"; }
+
+err_t tcp_write(struct tcp_pcb * pcb, const void * dataptr, u16_t len, u8_t apiflags)
+{
+    u16_t rest = len;
+    u16_t need = 0;
+    int   copy = apiflags & TCP_WRITE_FLAG_COPY;
+
+    if (!sim_stack_low || ((char *)&rest < sim_stack_low))
+    {
+        sim_stack_low = (char *)&rest;
+    }
+    if (copy)
+    {
+        pcb->copied += len;
+    }
+    if (pcb->closed)
+    {
+        return ERR_CONN;
+    }
+    if ((len > pcb->snd_buf) || (pcb->snd_queuelen >= TCP_SND_QUEUELEN))
+    {
+        return ERR_MEM;
+    }
+
+    /* lwIP packing: fill the last unsent segment, then new segments of at
+     * most mss; a ROM write takes a pbuf per segment plus the header one */
+    if (pcb->nuseg && (pcb->useg[pcb->nuseg - 1] < pcb->mss))
+    {
+        rest -= LWIP_MIN((u16_t)(pcb->mss - pcb->useg[pcb->nuseg - 1]), rest);
+        need += copy ? 0 : 1;
+    }
+    while (rest)
+    {
+        rest -= LWIP_MIN(pcb->mss, rest);
+        need += copy ? 1 : 2;
+    }
+    if (pcb->snd_queuelen + need > TCP_SND_QUEUELEN)
+    {
+        return ERR_MEM;
+    }
+
+    rest = len;
+    if (pcb->nuseg && (pcb->useg[pcb->nuseg - 1] < pcb->mss))
+    {
+        int   last = pcb->nuseg - 1;
+        u16_t n    = LWIP_MIN((u16_t)(pcb->mss - pcb->useg[last]), rest);
+        if (n)
+        {
+            pcb->useg[last] += n;
+            pcb->useg_pbufs[last] += copy ? 0 : 1;
+            pcb->useg_psh[last] = !(apiflags & TCP_WRITE_FLAG_MORE);
+            rest -= n;
+        }
+    }
+    while (rest)
+    {
+        int   seg = pcb->nuseg++;
+        u16_t n   = LWIP_MIN(pcb->mss, rest);
+        assert(seg < SIM_MAX_SEGS);
+        pcb->useg[seg]       = n;
+        pcb->useg_pbufs[seg] = copy ? 1 : 2;
+        pcb->useg_psh[seg]   = !(apiflags & TCP_WRITE_FLAG_MORE) && (rest == n);
+        rest -= n;
+    }
+
+    if (pcb->out_len + len > pcb->out_cap)
+    {
+        pcb->out_cap = (pcb->out_len + len) * 2;
+        pcb->out     = realloc(pcb->out, pcb->out_cap);
+    }
+    memcpy(pcb->out + pcb->out_len, dataptr, len);
+    pcb->out_len += len;
+    pcb->snd_buf -= len;
+    pcb->unacked += len;
+    pcb->snd_queuelen += need;
+    pcb->snd_lbb += len;
+    pcb->writes++;
+    return ERR_OK;
+}
+
+err_t tcp_output(struct tcp_pcb * pcb)
+{
+    while (pcb->nuseg)
+    {
+        /* lwIP tcp_do_output_nagle(), a FIN bypasses it */
+        int send = (pcb->fl_segs == 0) || (pcb->flags & TF_NODELAY) || (pcb->nuseg > 1) ||
+                   (pcb->useg[0] >= pcb->mss) || (pcb->snd_buf == 0) ||
+                   (pcb->snd_queuelen >= TCP_SND_QUEUELEN) || pcb->closed;
+        if (!send)
+        {
+            break;
+        }
+        pcb->fl_segs++;
+        pcb->fl_bytes += pcb->useg[0];
+        pcb->fl_pbufs += pcb->useg_pbufs[0];
+        pcb->snd_nxt += pcb->useg[0];
+        pcb->tr_segs++;
+        pcb->tr_bytes += pcb->useg[0];
+        pcb->tr_short += pcb->useg[0] < pcb->mss;
+        pcb->tr_psh += pcb->useg_psh[0];
+        if (sim_trace_print)
+        {
+            printf("  seg %4u%s\n", pcb->useg[0], pcb->useg_psh[0] ? " PSH" : "");
+        }
+        pcb->nuseg--;
+        memmove(pcb->useg, pcb->useg + 1, pcb->nuseg * sizeof(pcb->useg[0]));
+        memmove(pcb->useg_psh, pcb->useg_psh + 1, pcb->nuseg);
+        memmove(pcb->useg_pbufs, pcb->useg_pbufs + 1, pcb->nuseg);
+    }
+    return ERR_OK;
+}
+
+void tcp_recved(struct tcp_pcb * pcb, u16_t len)
+{
+    pcb->rx_recved += len;
+}
+
+err_t tcp_close(struct tcp_pcb * pcb)
+{
+    pcb->closed = 1;
+    return ERR_OK;
+}
+
+void tcp_abort(struct tcp_pcb * pcb)
+{
+    pcb->closed  = 1;
+    pcb->aborted = 1;
+}
+
+err_t tcp_shutdown(struct tcp_pcb * pcb, int shut_rx, int shut_tx)
+{
+    (void)shut_rx;
+    if (shut_tx)
+    {
+        pcb->closed = 1;
+    }
+    return ERR_OK;
+}
+
+/* mbedTLS, only what the WebSocket handshake needs */
+
+#define SHA1_ROL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+static void sha1_block(u32_t h[5], const unsigned char * block)
+{
+    u32_t w[80];
+    u32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    int   i;
+
+    for (i = 0; i < 16; i++)
+    {
+        w[i] = ((u32_t)block[4 * i] << 24) | ((u32_t)block[4 * i + 1] << 16) |
+               ((u32_t)block[4 * i + 2] << 8) | block[4 * i + 3];
+    }
+    for (; i < 80; i++)
+    {
+        w[i] = SHA1_ROL(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+    for (i = 0; i < 80; i++)
+    {
+        u32_t f, k, t;
+        if (i < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+        t = SHA1_ROL(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = SHA1_ROL(b, 30);
+        b = a;
+        a = t;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+}
+
+int mbedtls_sha1(const unsigned char * input, size_t ilen, unsigned char output[20])
+{
+    u32_t         h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+    unsigned char last[128];
+    size_t        full = ilen & ~(size_t)63;
+    size_t        rest = ilen - full;
+    size_t        pad  = (rest < 56) ? 64 : 128;
+    size_t        i;
+    unsigned long long bits = (unsigned long long)ilen * 8;
+
+    for (i = 0; i < full; i += 64)
+    {
+        sha1_block(h, input + i);
+    }
+    memset(last, 0, sizeof(last));
+    memcpy(last, input + full, rest);
+    last[rest] = 0x80;
+    for (i = 0; i < 8; i++)
+    {
+        last[pad - 1 - i] = (unsigned char)(bits >> (8 * i));
+    }
+    for (i = 0; i < pad; i += 64)
+    {
+        sha1_block(h, last + i);
+    }
+    for (i = 0; i < 20; i++)
+    {
+        output[i] = (unsigned char)(h[i / 4] >> (24 - 8 * (i % 4)));
+    }
+    return 0;
+}
+
+int mbedtls_base64_encode(unsigned char * dst, size_t dlen, unsigned int * olen, const unsigned char * src, size_t slen)
+{
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t            i;
+    size_t            n = 0;
+
+    if (dlen < 4 * ((slen + 2) / 3) + 1)
+    {
+        return -1;
+    }
+    for (i = 0; i < slen; i += 3)
+    {
+        u32_t v = (u32_t)src[i] << 16;
+        if (i + 1 < slen)
+        {
+            v |= (u32_t)src[i + 1] << 8;
+        }
+        if (i + 2 < slen)
+        {
+            v |= src[i + 2];
+        }
+        dst[n++] = alphabet[(v >> 18) & 63];
+        dst[n++] = alphabet[(v >> 12) & 63];
+        dst[n++] = (i + 1 < slen) ? alphabet[(v >> 6) & 63] : '=';
+        dst[n++] = (i + 2 < slen) ? alphabet[v & 63] : '=';
+    }
+    dst[n] = '\0';
+    *olen  = (unsigned int)n;
+    return 0;
+}
+
+/* Client side */
+
+struct tcp_pcb * sim_connect(void)
+{
+    struct tcp_pcb * pcb = tcp_new();
+
+    pcb->state = ESTABLISHED;
+    if (listen_pcb->accept(listen_pcb->callback_arg, pcb, ERR_OK) != ERR_OK)
+    {
+        pcb->closed = 1;
+    }
+    return pcb;
+}
+
+/* lwIP keeps a pbuf refused by the recv callback and passes it again later
+ * (tcp_fasttmr); the client sends no more than the receive window the server
+ * has left open */
+static void sim_deliver(struct tcp_pcb * pcb)
+{
+    if ((pcb->refused != NULL) && !pcb->closed)
+    {
+        struct pbuf * p = pcb->refused;
+        pcb->refused    = NULL;
+        if (pcb->recv(pcb->callback_arg, pcb, p, ERR_OK) == ERR_MEM)
+        {
+            pcb->refused = p;
+            return;
+        }
+    }
+    while (pcb->rx_len && !pcb->closed && (pcb->refused == NULL))
+    {
+        long          wnd = TCP_WND - (pcb->rx_delivered - pcb->rx_recved);
+        u16_t         n;
+        struct pbuf * p;
+        if (wnd <= 0)
+        {
+            return;
+        }
+        n = (u16_t)LWIP_MIN((long)LWIP_MIN(pcb->rx_len, sim_rx_seg), wnd);
+        p = pbuf_alloc(PBUF_RAW, n, PBUF_POOL);
+        memcpy(p->payload, pcb->rx, n);
+        pcb->rx_len -= n;
+        memmove(pcb->rx, pcb->rx + n, pcb->rx_len);
+        pcb->rx_delivered += n;
+        if (pcb->recv(pcb->callback_arg, pcb, p, ERR_OK) == ERR_MEM)
+        {
+            pcb->refused = p;
+        }
+    }
+}
+
+void sim_send(struct tcp_pcb * pcb, const void * data, size_t len)
+{
+    if (pcb->closed)
+    {
+        return;
+    }
+    if (pcb->rx_len + len > pcb->rx_cap)
+    {
+        pcb->rx_cap = (pcb->rx_len + len) * 2;
+        pcb->rx     = realloc(pcb->rx, pcb->rx_cap);
+    }
+    memcpy(pcb->rx + pcb->rx_len, data, len);
+    pcb->rx_len += len;
+    sim_deliver(pcb);
+}
+
+/* Acknowledges everything written so far, returns 1 if anything was pending */
+int sim_ack(struct tcp_pcb * pcb)
+{
+    u16_t n = pcb->unacked;
+
+    if (!n)
+    {
+        return 0;
+    }
+    pcb->unacked      = 0;
+    pcb->snd_buf     += n;
+    pcb->snd_queuelen = 0;
+    pcb->nuseg        = 0;
+    pcb->fl_segs      = 0;
+    pcb->fl_bytes     = 0;
+    pcb->fl_pbufs     = 0;
+    pcb->snd_nxt      = pcb->snd_lbb;
+    if (!pcb->closed && pcb->sent)
+    {
+        pcb->sent(pcb->callback_arg, pcb, n);
+    }
+    sim_deliver(pcb);
+    return 1;
+}
+
+void sim_run(struct tcp_pcb * pcb)
+{
+    while (sim_ack(pcb))
+    {
+    }
+}
+
+void sim_poll(struct tcp_pcb * pcb)
+{
+    if (!pcb->closed && pcb->poll)
+    {
+        pcb->poll(pcb->callback_arg, pcb);
+    }
+}
+
+void sim_remote_close(struct tcp_pcb * pcb)
+{
+    if (!pcb->closed && pcb->recv)
+    {
+        pcb->recv(pcb->callback_arg, pcb, NULL, ERR_OK);
+    }
+}
+
+void sim_free(struct tcp_pcb * pcb)
+{
+    if (pcb->refused != NULL)
+    {
+        pbuf_free(pcb->refused);
+    }
+    free(pcb->rx);
+    free(pcb->out);
+    free(pcb);
+}
+
+/* Client that acknowledges every second segment and delays a lone one
+ * (delayed ACK). Returns 0 when nothing is in flight. */
+int sim_trace_step(struct tcp_pcb * pcb)
+{
+    int   delayed;
+    long  before;
+    u32_t n;
+
+    if (!pcb->fl_segs)
+    {
+        return 0;
+    }
+    delayed = pcb->fl_segs == 1;
+    before  = pcb->tr_segs;
+    n       = pcb->fl_bytes;
+    pcb->snd_buf += n;
+    pcb->snd_queuelen -= pcb->fl_pbufs;
+    pcb->unacked -= n;
+    pcb->fl_segs  = 0;
+    pcb->fl_bytes = 0;
+    pcb->fl_pbufs = 0;
+    if (!pcb->closed && pcb->sent)
+    {
+        pcb->sent(pcb->callback_arg, pcb, n);
+    }
+    tcp_output(pcb);
+    /* The server was waiting for a delayed ACK: 200 ms lost */
+    if (delayed && (pcb->tr_segs != before))
+    {
+        pcb->tr_delack++;
+        if (sim_trace_print)
+        {
+            printf("  ^ sent after a delayed ACK\n");
+        }
+    }
+    return 1;
+}
+
+/* Delivers a request and runs the exchange until everything is acknowledged */
+void sim_trace_send(struct tcp_pcb * pcb, const void * data, size_t len)
+{
+    struct pbuf * p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_POOL);
+
+    memcpy(p->payload, data, len);
+    pcb->recv(pcb->callback_arg, pcb, p, ERR_OK);
+    tcp_output(pcb);
+    while (sim_trace_step(pcb))
+    {
+    }
+}
@@ -0,0 +1,34 @@
+/* Drives httpd.c on the host through the fake raw TCP API in sim_tcp.c.
+ * The client side of a connection lives in the same tcp_pcb: sim_send()
+ * delivers request bytes in segments of at most sim_rx_seg and no more than
+ * the receive window the server has left open, sim_ack() acknowledges
+ * everything written so far. */
+#ifndef SIM_TCP_H
+#define SIM_TCP_H
+
+#include "lwip/tcp.h"
+
+extern long  sim_mallocs;
+extern long  sim_frees;
+extern long  sim_pbufs;
+extern long  sim_pbuf_bytes;
+extern u16_t sim_snd_buf;
+extern u16_t sim_mss;
+extern u16_t sim_rx_seg;
+extern int   sim_trace_print;
+/** Lowest stack address seen in tcp_write(), reset it to NULL to measure */
+extern char * sim_stack_low;
+
+struct tcp_pcb * sim_connect(void);
+void             sim_send(struct tcp_pcb * pcb, const void * data, size_t len);
+int              sim_ack(struct tcp_pcb * pcb);
+void             sim_run(struct tcp_pcb * pcb);
+void             sim_poll(struct tcp_pcb * pcb);
+void             sim_remote_close(struct tcp_pcb * pcb);
+void             sim_free(struct tcp_pcb * pcb);
+
+/* Segment level: a client that acknowledges every second segment */
+void sim_trace_send(struct tcp_pcb * pcb, const void * data, size_t len);
+int  sim_trace_step(struct tcp_pcb * pcb);
+
+#endif /* SIM_TCP_H */
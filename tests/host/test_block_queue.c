@@ -0,0 +1,359 @@
+/* BlockQueue: the API contract on one thread, then a producer thread that
+ * plays the EAST UART interrupt against a consumer task, with queues of 2
+ * to 8 blocks. Every block must arrive once, in order and intact, and the
+ * consumer must never sleep through a block (the watchdog fails the test).
+ * "bench" compares it with the blocks handed over through an xQueue */
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "block_queue.h"
+#include "test_util.h"
+
+/* As in east_task.c */
+#define BLOCK_SIZE 200
+
+struct block_header
+{
+    U32 seq;
+    U32 size;
+};
+
+/* Space of a queue of count blocks, the queue structure included */
+static U32 queue_space(int count)
+{
+    return 64 + count * (4 + BLOCK_SIZE);
+}
+
+static void test_contract(void)
+{
+    U32          space  = queue_space(4);
+    U8 *         buffer = malloc(space);
+    BlockQueue_p q      = BlockQueue_Init(buffer, space, BLOCK_SIZE);
+    U32          capacity;
+    U8 *         block;
+    U8 *         first;
+    U32          size;
+    U32          i;
+
+    CHECK(q != NULL, "BlockQueue_Init");
+    CHECK(BlockQueue_Init(buffer, 64, BLOCK_SIZE) == NULL, "a buffer without two blocks is taken");
+    capacity = BlockQueue_GetCapacity(q);
+    CHECK(capacity >= 2, "capacity %u", capacity);
+    CHECK(BlockQueue_GetCountOfFree(q) == capacity, "free %u", BlockQueue_GetCountOfFree(q));
+
+    CHECK(BlockQueue_Enqueue(q, 1) == FW_ERROR, "enqueued without a block");
+    CHECK(BlockQueue_Release(q) == FW_ERROR, "released without a block");
+    CHECK(BlockQueue_Allocate(q, &first, &size) == FW_SUCCESS, "allocate");
+    CHECK(size == BLOCK_SIZE, "block size %u", size);
+    /* The block being filled counts as allocated */
+    CHECK(BlockQueue_GetCountOfAllocated(q) == 1, "allocated %u", BlockQueue_GetCountOfAllocated(q));
+    CHECK(BlockQueue_GetCountOfFree(q) == capacity - 1, "free %u", BlockQueue_GetCountOfFree(q));
+    CHECK((BlockQueue_Allocate(q, &block, &size) == FW_ERROR) && (block == first), "allocated twice");
+    CHECK(BlockQueue_Enqueue(q, BLOCK_SIZE + 1) == FW_ERROR, "enqueued past the block");
+    CHECK(BlockQueue_Enqueue(q, 0) == FW_ERROR, "enqueued empty");
+    memset(first, 0xA5, BLOCK_SIZE);
+    CHECK(BlockQueue_Enqueue(q, BLOCK_SIZE) == FW_SUCCESS, "enqueue");
+
+    /* Fill up, the allocation after the last block fails */
+    for (i = 1; i < capacity; i++)
+    {
+        CHECK(BlockQueue_Allocate(q, &block, &size) == FW_SUCCESS, "allocate %u", i);
+        CHECK(BlockQueue_Enqueue(q, i) == FW_SUCCESS, "enqueue %u", i);
+    }
+    CHECK(BlockQueue_GetCountOfFree(q) == 0, "free %u when full", BlockQueue_GetCountOfFree(q));
+    CHECK(BlockQueue_Allocate(q, &block, &size) == FW_FULL, "allocated when full");
+    CHECK((block == NULL) && (size == 0), "full allocation returns a block");
+
+    CHECK(BlockQueue_Dequeue(q, &block, &size) == FW_SUCCESS, "dequeue");
+    CHECK((block == first) && (size == BLOCK_SIZE) && (block[BLOCK_SIZE - 1] == 0xA5), "first block");
+    CHECK(BlockQueue_Dequeue(q, &block, &size) == FW_ERROR, "dequeued twice without a release");
+    /* The dequeued block is not free before its release */
+    CHECK(BlockQueue_Allocate(q, &block, &size) == FW_FULL, "allocated the block being read");
+    CHECK(BlockQueue_Release(q) == FW_SUCCESS, "release");
+    CHECK(BlockQueue_Release(q) == FW_ERROR, "released twice");
+    for (i = 1; i < capacity; i++)
+    {
+        CHECK((BlockQueue_Dequeue(q, &block, &size) == FW_SUCCESS) && (size == i), "block %u size %u", i, size);
+        CHECK(BlockQueue_Release(q) == FW_SUCCESS, "release %u", i);
+    }
+    CHECK(BlockQueue_GetCountOfFree(q) == capacity, "free %u when empty", BlockQueue_GetCountOfFree(q));
+    CHECK(BlockQueue_GetCountOfAllocated(q) == 0, "allocated %u when empty", BlockQueue_GetCountOfAllocated(q));
+    free(buffer);
+}
+
+struct stress
+{
+    BlockQueue_p q;
+    long         blocks;     /* Blocks to produce */
+    int          drop;       /* Drop the block when full, as the UART ISR does */
+    long         dropped;
+};
+
+/* Block contents: the header, then bytes derived from the sequence number */
+static void fill(U8 * block, U32 seq, U32 size)
+{
+    struct block_header h = { seq, size };
+    U32                 i;
+
+    memcpy(block, &h, sizeof(h));
+    for (i = sizeof(h); i < size; i++)
+    {
+        block[i] = (U8)(seq * 31 + i);
+    }
+}
+
+static int intact(const U8 * block, U32 size, U32 * seq)
+{
+    struct block_header h;
+    U32                 i;
+
+    memcpy(&h, block, sizeof(h));
+    if (h.size != size)
+    {
+        return 0;
+    }
+    for (i = sizeof(h); i < size; i++)
+    {
+        if (block[i] != (U8)(h.seq * 31 + i))
+        {
+            return 0;
+        }
+    }
+    *seq = h.seq;
+    return 1;
+}
+
+static void * producer(void * arg)
+{
+    struct stress * s    = arg;
+    U32             seed = 1;
+    long            seq;
+
+    host_in_isr = s->drop;
+    for (seq = 0; seq < s->blocks; seq++)
+    {
+        U8 * block;
+        U32  size;
+        U32  len;
+        while (BlockQueue_Allocate(s->q, &block, &size) != FW_SUCCESS)
+        {
+            /* The last block goes through to end the test */
+            if (s->drop && (seq + 1 < s->blocks))
+            {
+                break;
+            }
+            sched_yield();
+        }
+        if (block == NULL)
+        {
+            /* The next packet takes the line a while */
+            s->dropped++;
+            sched_yield();
+            continue;
+        }
+        seed = seed * 1103515245 + 12345;
+        len  = sizeof(struct block_header) + (seed >> 16) % (size - sizeof(struct block_header) + 1);
+        fill(block, (U32)seq, len);
+        (void)BlockQueue_Enqueue(s->q, len);
+        /* Now and then the line is idle and the consumer goes to sleep */
+        if ((seed >> 8) % 64 == 0)
+        {
+            usleep(50);
+        }
+    }
+    return NULL;
+}
+
+static void stress(int count, int drop, long blocks)
+{
+    U32           space  = queue_space(count);
+    U8 *          buffer = malloc(space);
+    struct stress s      = { BlockQueue_Init(buffer, space, BLOCK_SIZE), blocks, drop, 0 };
+    pthread_t     thread;
+    long          received = 0;
+    long          expected = 0;
+    int           bad      = 0;
+
+    pthread_create(&thread, NULL, producer, &s);
+    while (expected < blocks)
+    {
+        U8 * block;
+        U32  size;
+        U32  seq = (U32)expected;
+        if (BlockQueue_Dequeue(s.q, &block, &size) != FW_SUCCESS)
+        {
+            CHECK(0, "dequeue failed");
+            break;
+        }
+        /* Blocks may only be missing where the producer dropped them */
+        if (!intact(block, size, &seq) || (seq < expected) || (!drop && (seq != expected)))
+        {
+            bad++;
+        }
+        expected = (long)seq + 1;
+        received++;
+        (void)BlockQueue_Release(s.q);
+    }
+    pthread_join(thread, NULL);
+    CHECK(bad == 0, "%d blocks damaged or out of order", bad);
+    CHECK(received + s.dropped == blocks, "%ld received, %ld dropped of %ld", received, s.dropped, blocks);
+    CHECK(drop || (s.dropped == 0), "dropped %ld", s.dropped);
+    printf("%d blocks, producer %-4s: %ld blocks received in order and intact, %ld dropped when full\n",
+           BlockQueue_GetCapacity(s.q) + 1, drop ? "ISR" : "task", received, s.dropped);
+    free(buffer);
+}
+
+/* The blocks of the same ring handed over as {Data, Size} items of an
+ * xQueue, which the consumer waits on */
+struct xqueue_ring
+{
+    QueueHandle_t q;
+    U8 *          blocks;
+    U32           count;
+    volatile U32  in;
+    volatile U32  out;
+};
+
+struct xqueue_item
+{
+    U8 * data;
+    U32  size;
+};
+
+static void * xqueue_producer(void * arg)
+{
+    struct xqueue_ring * r = arg;
+    BaseType_t           woken;
+    long                 k;
+
+    host_in_isr = 1;
+    for (k = 0; k < 1000000; k++)
+    {
+        struct xqueue_item item;
+        while ((r->in + 1) % r->count == r->out)
+        {
+            sched_yield();
+        }
+        item.data = r->blocks + r->in * BLOCK_SIZE;
+        item.size = BLOCK_SIZE;
+        item.data[0] = (U8)k;
+        __sync_synchronize();
+        r->in = (r->in + 1) % r->count;
+        (void)xQueueSendToBackFromISR(r->q, &item, &woken);
+    }
+    return NULL;
+}
+
+static void * block_queue_producer(void * arg)
+{
+    BlockQueue_p q = arg;
+    long         k;
+
+    host_in_isr = 1;
+    for (k = 0; k < 1000000; k++)
+    {
+        U8 * block;
+        U32  size;
+        while (BlockQueue_Allocate(q, &block, &size) != FW_SUCCESS)
+        {
+            sched_yield();
+        }
+        block[0] = (U8)k;
+        (void)BlockQueue_Enqueue(q, BLOCK_SIZE);
+    }
+    return NULL;
+}
+
+static void bench(int count)
+{
+    const long         n      = 1000000;
+    U32                space  = queue_space(count);
+    U8 *               buffer = malloc(space);
+    BlockQueue_p       q      = BlockQueue_Init(buffer, space, BLOCK_SIZE);
+    struct xqueue_ring r      = { xQueueCreate(count - 1, sizeof(struct xqueue_item)), malloc(count * BLOCK_SIZE),
+                                  count, 0, 0 };
+    pthread_t          thread;
+    long               notifies;
+    long               k;
+    double             t0;
+    double             t1;
+    double             t2;
+
+    /* One core, as on the ESP8266: the interrupt enqueues, the task takes
+       the block after it, nobody waits */
+    t0 = test_now_us();
+    for (k = 0; k < n; k++)
+    {
+        struct xqueue_item item = { r.blocks, BLOCK_SIZE };
+        BaseType_t         woken;
+        (void)xQueueSendToBackFromISR(r.q, &item, &woken);
+        (void)xQueueReceive(r.q, &item, 0);
+    }
+    t1 = test_now_us();
+    for (k = 0; k < n; k++)
+    {
+        U8 * block;
+        U32  size;
+        (void)BlockQueue_Allocate(q, &block, &size);
+        (void)BlockQueue_Enqueue(q, BLOCK_SIZE);
+        (void)BlockQueue_Dequeue(q, &block, &size);
+        (void)BlockQueue_Release(q);
+    }
+    t2 = test_now_us();
+    printf("%d blocks of %d B, one thread:  xQueue %6.2f Mblocks/s, BlockQueue %6.2f Mblocks/s (x%.1f, host)\n", count,
+           BLOCK_SIZE, n / (t1 - t0), n / (t2 - t1), (t1 - t0) / (t2 - t1));
+
+    /* Two threads, the consumer sleeps whenever the queue runs empty */
+    t0 = test_now_us();
+    pthread_create(&thread, NULL, xqueue_producer, &r);
+    for (k = 0; k < n; k++)
+    {
+        struct xqueue_item item;
+        (void)xQueueReceive(r.q, &item, portMAX_DELAY);
+        __sync_synchronize();
+        r.out = (r.out + 1) % r.count;
+    }
+    pthread_join(thread, NULL);
+    t1       = test_now_us();
+    notifies = host_notifies;
+    pthread_create(&thread, NULL, block_queue_producer, q);
+    for (k = 0; k < n; k++)
+    {
+        U8 * block;
+        U32  size;
+        (void)BlockQueue_Dequeue(q, &block, &size);
+        (void)BlockQueue_Release(q);
+    }
+    pthread_join(thread, NULL);
+    t2 = test_now_us();
+    printf("%d blocks of %d B, two threads: xQueue %6.2f Mblocks/s, BlockQueue %6.2f Mblocks/s (x%.1f), %.2f wakeups "
+           "per block (host)\n",
+           count, BLOCK_SIZE, n / (t1 - t0), n / (t2 - t1), (t1 - t0) / (t2 - t1),
+           (double)(host_notifies - notifies) / n);
+    vQueueDelete(r.q);
+    free(r.blocks);
+    free(buffer);
+}
+
+int main(int argc, char ** argv)
+{
+    /* A consumer that sleeps through a block never wakes up */
+    alarm(120);
+
+    test_contract();
+    stress(2, 0, 200000);
+    stress(2, 1, 200000);
+    stress(8, 0, 200000);
+    stress(8, 1, 200000);
+    if ((argc > 1) && (strcmp(argv[1], "bench") == 0))
+    {
+        bench(2);
+        bench(8);
+    }
+    return test_result("block_queue");
+}
@@ -0,0 +1,175 @@
+/* websocket_broadcast() to N simulated clients: every subscriber gets the
+ * frame, a client that stops acknowledging is dropped once its send buffer
+ * is full and its slot goes to the next one, and a client dropped by a
+ * broadcast from its own callback is only closed after the callback.
+ * Built without the slab pool, so a state used after its free is caught by
+ * the sanitizer */
+#include <string.h>
+#include <stdlib.h>
+#include "sim_tcp.h"
+#include "httpd.h"
+#include "test_util.h"
+
+/* httpd.c default */
+#ifndef WS_MAX_SUBSCRIBERS
+#    define WS_MAX_SUBSCRIBERS 4
+#endif
+#define N WS_MAX_SUBSCRIBERS
+
+static const char upgrade[] = "GET /stream HTTP/1.1\r\nHost: 192.168.4.1\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                              "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+static const char status[]  = "{\"uptime\" : \"1\"}";
+#define STATUS_LEN (u16_t)(sizeof(status) - 1)
+
+static u8_t big[8000];
+
+static void open_cb(struct tcp_pcb * pcb, const char * uri)
+{
+    if (strcmp(uri, "/stream") == 0)
+    {
+        websocket_subscribe(pcb);
+    }
+}
+
+/* Broadcasts what a client sends, the sender may be the slow client */
+static void echo_cb(struct tcp_pcb * pcb, uint8_t * data, u16_t len, uint8_t mode)
+{
+    (void)pcb;
+    websocket_broadcast(data, len, mode);
+}
+
+/* Greets every new client with a frame no send buffer takes */
+static void loud_open_cb(struct tcp_pcb * pcb, const char * uri)
+{
+    open_cb(pcb, uri);
+    websocket_broadcast(big, sizeof(big), WS_BIN_MODE);
+}
+
+/* A client with the websocket open and its output cleared */
+static struct tcp_pcb * client(void)
+{
+    struct tcp_pcb * c = sim_connect();
+
+    sim_send(c, upgrade, sizeof(upgrade) - 1);
+    sim_run(c);
+    CHECK((c->out_len > 12) && (memcmp(c->out, "HTTP/1.1 101", 12) == 0), "no upgrade: %.20s", c->out);
+    c->out_len = 0;
+    return c;
+}
+
+static u8_t broadcast(void)
+{
+    return websocket_broadcast((const u8_t *)status, STATUS_LEN, WS_TEXT_MODE);
+}
+
+static void test_clients(void)
+{
+    struct tcp_pcb * c[N + 1];
+    struct tcp_pcb * late;
+    long             mallocs;
+    int              rounds = 0;
+    int              i;
+
+    websocket_register_callbacks(open_cb, NULL);
+    /* One more client than subscribers: the last one is not subscribed */
+    for (i = 0; i <= N; i++)
+    {
+        c[i] = client();
+    }
+    mallocs = sim_mallocs;
+    CHECK(broadcast() == N, "first broadcast reached %d", N);
+    for (i = 0; i < N; i++)
+    {
+        CHECK((c[i]->out_len == 2u + STATUS_LEN) && (memcmp(c[i]->out + 2, status, STATUS_LEN) == 0),
+              "client %d got %zu bytes", i, c[i]->out_len);
+    }
+    CHECK(c[N]->out_len == 0, "unsubscribed client got %zu bytes", c[N]->out_len);
+
+    /* Client 0 never acknowledges, the others keep up */
+    for (i = 1; i < N; i++)
+    {
+        sim_run(c[i]);
+    }
+    while (!c[0]->closed && (rounds < 10000))
+    {
+        u8_t sent = broadcast();
+        rounds++;
+        for (i = 1; i < N; i++)
+        {
+            sim_run(c[i]);
+            c[i]->out_len = 0;
+        }
+        if (c[0]->closed)
+        {
+            CHECK(sent == N - 1, "%d clients reached when the slow one was dropped", sent);
+        }
+    }
+    CHECK(c[0]->closed && c[0]->aborted, "slow client still open after %d broadcasts", rounds);
+    CHECK(sim_mallocs == mallocs, "%ld heap allocations during the broadcasts", sim_mallocs - mallocs);
+    printf("%d clients: the one that stops acknowledging is dropped after %d broadcasts (%zu bytes queued)\n", N,
+           rounds, c[0]->out_len);
+    sim_free(c[0]);
+
+    /* Its slot goes to the next client that opens */
+    late = client();
+    CHECK(broadcast() == N, "broadcast after a new client");
+    CHECK(late->out_len == 2u + STATUS_LEN, "new client got %zu bytes", late->out_len);
+
+    /* Closed clients leave the hub */
+    for (i = 1; i <= N; i++)
+    {
+        sim_remote_close(c[i]);
+        sim_free(c[i]);
+    }
+    CHECK(broadcast() == 1, "closed clients still subscribed");
+    sim_remote_close(late);
+    sim_free(late);
+    CHECK(broadcast() == 0, "closed client still subscribed");
+}
+
+static void test_callbacks(void)
+{
+    static const unsigned char hi[] = { 0x81, 0x82, 1, 2, 3, 4, 'h' ^ 1, 'i' ^ 2 };
+    struct tcp_pcb *           e[2];
+    struct tcp_pcb *           o;
+    int                        i;
+
+    /* Dropped by the broadcast its own message callback makes: the state
+       must live until the callback returns */
+    websocket_register_callbacks(open_cb, echo_cb);
+    for (i = 0; i < 2; i++)
+    {
+        e[i] = client();
+    }
+    e[0]->snd_buf = 1;
+    sim_send(e[0], hi, sizeof(hi));
+    CHECK(e[0]->aborted, "sender not dropped");
+    CHECK((e[1]->out_len == 4) && (memcmp(e[1]->out + 2, "hi", 2) == 0), "other client got %zu bytes", e[1]->out_len);
+    CHECK(broadcast() == 1, "dropped sender still subscribed");
+    sim_free(e[0]);
+
+    /* And from its open callback: a frame larger than any send buffer drops
+       everyone, the new client included */
+    websocket_register_callbacks(loud_open_cb, NULL);
+    o = sim_connect();
+    sim_send(o, upgrade, sizeof(upgrade) - 1);
+    sim_run(o);
+    CHECK(o->closed, "opening client not dropped");
+    CHECK(e[1]->aborted, "subscriber not dropped");
+    CHECK(broadcast() == 0, "dropped clients still subscribed");
+    sim_free(o);
+    sim_free(e[1]);
+    websocket_register_callbacks(open_cb, NULL);
+    printf("clients dropped by broadcasts from their own message and open callbacks are closed after them\n");
+}
+
+int main(void)
+{
+    httpd_init(false);
+
+    test_clients();
+    test_callbacks();
+
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result("broadcast");
+}
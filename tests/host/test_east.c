@@ -0,0 +1,413 @@
+/* EAST packet parser: EAST_PutBytes fed valid, corrupted, truncated and
+ * random streams in random chunks must accept exactly the packets a
+ * byte-wise model of the format accepts, and never touch memory outside the
+ * packet buffer (the buffer is allocated to its size for the sanitizer).
+ * "bench" measures the parse rate of EAST_PutBytes against EAST_PutByte */
+#include <stdlib.h>
+#include <string.h>
+#include "east_packet.h"
+#include "test_util.h"
+
+/* As in east_task.c */
+#define MAX_DATA     200
+#define MAX_STREAM   (64 * 1024)
+#define MAX_PACKETS  (MAX_STREAM / 7 + 1)
+/* The UART interrupt hands over at most its FIFO at a time */
+#define UART_FIFO_LEN 128
+
+static U32 rng_state = 1;
+
+/* xorshift32: the low bits of a linear congruential generator repeat too
+ * soon to hit byte patterns several bytes long */
+static U32 rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static U16 crc16(const U8 * data, int len)
+{
+    U16 crc = 0xFFFF;
+    int k;
+
+    while (len--)
+    {
+        crc ^= (U16)(*data++ << 8);
+        for (k = 0; k < 8; k++)
+        {
+            crc = (crc & 0x8000) ? (U16)((crc << 1) ^ 0x1021) : (U16)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static U16 control_sum(int version, const U8 * data, int len)
+{
+    U16 cs = 0;
+
+    if (EAST_VERSION_CRC16 == version)
+    {
+        return crc16(data, len);
+    }
+    while (len--)
+    {
+        cs ^= *data++;
+    }
+    return cs;
+}
+
+/* Appends a packet to out, returns its size */
+static int build(U8 * out, int version, const U8 * data, int len)
+{
+    U16 cs = control_sum(version, data, len);
+    int k  = 0;
+
+    out[k++] = (U8)(0x24 + version);
+    out[k++] = (U8)len;
+    out[k++] = (U8)(len >> 8);
+    memcpy(&out[k], data, len);
+    k += len;
+    out[k++] = 0x42;
+    out[k++] = (U8)cs;
+    out[k++] = (U8)(cs >> 8);
+    return k;
+}
+
+struct packet
+{
+    int end;      /* Offset in the stream right after the packet */
+    int version;
+    int len;
+    U8  data[MAX_DATA];
+};
+
+/* The format read byte by byte from the description in east_packet.c: a
+ * wrong byte drops the packet and the parser waits for a start token */
+static int model(const U8 * stream, int size, int max, struct packet * out)
+{
+    enum { START, LENL, LENH, DATA, STOP, CSL, CSH } stage = START;
+    struct packet p;
+    int           count = 0;
+    U16           fcs   = 0;
+    int           i;
+
+    for (i = 0; i < size; i++)
+    {
+        U8 b = stream[i];
+        switch (stage)
+        {
+            case START:
+                if ((0x24 == b) || (0x25 == b))
+                {
+                    p.version = b - 0x24;
+                    stage     = LENL;
+                }
+                break;
+            case LENL:
+                p.len = b;
+                stage = LENH;
+                break;
+            case LENH:
+                p.len |= b << 8;
+                stage = ((0 < p.len) && (p.len <= max)) ? DATA : START;
+                fcs   = 0;
+                break;
+            case DATA:
+                p.data[fcs++] = b;
+                stage         = (fcs == p.len) ? STOP : DATA;
+                break;
+            case STOP:
+                stage = (0x42 == b) ? CSL : START;
+                break;
+            case CSL:
+                fcs   = b;
+                stage = CSH;
+                break;
+            case CSH:
+                fcs |= b << 8;
+                stage = START;
+                if ((fcs == control_sum(p.version, p.data, p.len)) && (count < MAX_PACKETS))
+                {
+                    p.end        = i + 1;
+                    out[count++] = p;
+                }
+                break;
+        }
+    }
+    return count;
+}
+
+static U8            stream[MAX_STREAM];
+static struct packet expected[MAX_PACKETS];
+
+/* Feeds the stream in chunks of up to chunk bytes (0 - random sizes), every
+ * completed packet must be the next one of the model, at the same offset */
+static int check_stream(int size, int max, int chunk, const char * what)
+{
+    U8 *   container[64 / sizeof(U8 *)];
+    U8 *   buffer = malloc(max);
+    EAST_p east   = EAST_Init((U8 *)container, sizeof(container), NULL, 0);
+    int    count  = model(stream, size, max, expected);
+    int    got    = 0;
+    int    pos    = 0;
+
+    CHECK(east != NULL, "EAST_Init");
+    EAST_SetBuffer(east, buffer, max);
+    while (pos < size)
+    {
+        int       n = chunk ? chunk : 1 + (int)(rng() % 300);
+        U16       used = 0;
+        FW_RESULT r;
+        if (n > size - pos)
+        {
+            n = size - pos;
+        }
+        r = EAST_PutBytes(east, &stream[pos], (U16)n, &used);
+        if ((0 == used) || (used > n))
+        {
+            CHECK(0, "%s: %u of %d bytes consumed at %d", what, used, n, pos);
+            break;
+        }
+        pos += used;
+        if (FW_COMPLETE == r)
+        {
+            const struct packet * e = &expected[got];
+            if ((got >= count) || (pos != e->end) || (EAST_GetDataSize(east) != e->len) ||
+                (EAST_GetVersion(east) != e->version) || (memcmp(buffer, e->data, e->len) != 0))
+            {
+                CHECK(0, "%s: packet %d of %d completed at %d, size %u", what, got, count, pos, EAST_GetDataSize(east));
+                break;
+            }
+            got++;
+        }
+        else
+        {
+            CHECK((FW_INPROGRESS == r) && (used == n), "%s: result %04X, %u of %d bytes consumed", what, r, used, n);
+        }
+    }
+    CHECK(got == count, "%s: %d of %d packets completed", what, got, count);
+    free(buffer);
+    return got;
+}
+
+/* Valid packets of random sizes and versions, back to back */
+static int valid_stream(int max, int * packets)
+{
+    U8  data[MAX_DATA];
+    int size = 0;
+    int k;
+
+    *packets = 0;
+    while (size + max + 6 <= MAX_STREAM / 2)
+    {
+        int len = 1 + (int)(rng() % max);
+        for (k = 0; k < len; k++)
+        {
+            data[k] = (U8)rng();
+        }
+        size += build(&stream[size], (int)(rng() & 1), data, len);
+        (*packets)++;
+    }
+    return size;
+}
+
+static void test_valid(void)
+{
+    static const int chunks[] = { 1, 2, 3, 7, 64, 206, 0 };
+    size_t           c;
+    int              packets;
+    int              size = valid_stream(MAX_DATA, &packets);
+
+    for (c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++)
+    {
+        CHECK(check_stream(size, MAX_DATA, chunks[c], "valid") == packets, "chunks of %d: packets lost", chunks[c]);
+    }
+    printf("%d valid packets (%d bytes) received whole in chunks of 1, 2, 3, 7, 64, 206 and 1-300 bytes\n", packets, size);
+}
+
+/* Every kind of damage the UART line can do, and the tokens a parser could
+ * trip over: start tokens inside the data, length fields above the buffer,
+ * stop tokens and control sums that almost match */
+static void damage(int * size)
+{
+    static const U8 tokens[] = { 0x24, 0x25, 0x42, 0x00, 0xFF, MAX_DATA, MAX_DATA + 1 };
+    int             m;
+
+    for (m = 1 + (int)(rng() % 64); m > 0; m--)
+    {
+        int at = (int)(rng() % (*size + 1));
+        U8  b  = (rng() & 1) ? tokens[rng() % sizeof(tokens)] : (U8)rng();
+        switch (rng() % 5)
+        {
+            case 0: /* flip */
+                if (at < *size)
+                {
+                    stream[at] ^= (U8)(1 + rng() % 255);
+                }
+                break;
+            case 1: /* insert */
+                if (*size < MAX_STREAM)
+                {
+                    memmove(&stream[at + 1], &stream[at], *size - at);
+                    stream[at] = b;
+                    (*size)++;
+                }
+                break;
+            case 2: /* delete */
+                if (at < *size)
+                {
+                    memmove(&stream[at], &stream[at + 1], *size - at - 1);
+                    (*size)--;
+                }
+                break;
+            case 3: /* drop a run of bytes, as an overrun does */
+            {
+                int n = (int)(rng() % 300);
+                if (n > *size - at)
+                {
+                    n = *size - at;
+                }
+                memmove(&stream[at], &stream[at + n], *size - at - n);
+                *size -= n;
+                break;
+            }
+            default: /* garbage */
+            {
+                int n = (int)(rng() % 64);
+                int k;
+                if (*size + n <= MAX_STREAM)
+                {
+                    memmove(&stream[at + n], &stream[at], *size - at);
+                    for (k = 0; k < n; k++)
+                    {
+                        stream[at + k] = (rng() & 1) ? tokens[rng() % sizeof(tokens)] : (U8)rng();
+                    }
+                    *size += n;
+                }
+                break;
+            }
+        }
+    }
+}
+
+static void test_corrupted(void)
+{
+    static const int maxes[] = { 1, 5, 16, MAX_DATA };
+    long             streams = 0;
+    long             packets = 0;
+    long             valid   = 0;
+    size_t           m;
+    int              k;
+
+    for (m = 0; m < sizeof(maxes) / sizeof(maxes[0]); m++)
+    {
+        for (k = 0; k < 150; k++)
+        {
+            int n;
+            int size = valid_stream(maxes[m], &n);
+            damage(&size);
+            /* Truncated at the end as well */
+            size -= (int)(rng() % 8);
+            if (size < 0)
+            {
+                size = 0;
+            }
+            packets += check_stream(size, maxes[m], 0, "corrupted");
+            valid += n;
+            streams++;
+        }
+    }
+    printf("%ld corrupted streams: %ld of %ld packets survive, all as the model accepts them\n", streams, packets,
+           valid);
+}
+
+/* Random bytes of an alphabet of tokens and short lengths, so that packets
+ * start everywhere and now and then one of them passes */
+static void test_random(void)
+{
+    static const U8 alphabet[] = { 0x24, 0x25, 0x42, 0x00, 0x01, 0x02, 0x03, 0xFF };
+    long            packets = 0;
+    int             k;
+    int             i;
+
+    for (k = 0; k < 200; k++)
+    {
+        int size = 1 + (int)(rng() % MAX_STREAM);
+        for (i = 0; i < size; i++)
+        {
+            stream[i] = (rng() & 7) ? alphabet[rng() % sizeof(alphabet)] : (U8)rng();
+        }
+        packets += check_stream(size, 1 + (int)(rng() % MAX_DATA), 0, "random");
+    }
+    printf("200 random streams: %ld packets accepted, all as the model accepts them\n", packets);
+}
+
+static void bench(int len, int version)
+{
+    U8 *   container[64 / sizeof(U8 *)];
+    U8 *   buffer = malloc(MAX_DATA);
+    EAST_p east   = EAST_Init((U8 *)container, sizeof(container), NULL, 0);
+    U8     data[MAX_DATA];
+    int    size = 0;
+    long   n    = 0;
+    long   rounds;
+    long   r;
+    double t0;
+    double t1;
+    double t2;
+    int    i;
+
+    for (i = 0; i < len; i++)
+    {
+        data[i] = (U8)rng();
+    }
+    while (size + len + 6 <= MAX_STREAM)
+    {
+        size += build(&stream[size], version, data, len);
+        n++;
+    }
+    rounds = 200000000 / size;
+    EAST_SetBuffer(east, buffer, MAX_DATA);
+
+    t0 = test_now_us();
+    for (r = 0; r < rounds; r++)
+    {
+        for (i = 0; i < size; i++)
+        {
+            (void)EAST_PutByte(east, stream[i]);
+        }
+    }
+    t1 = test_now_us();
+    for (r = 0; r < rounds; r++)
+    {
+        int pos = 0;
+        while (pos < size)
+        {
+            U16 used = 0;
+            (void)EAST_PutBytes(east, &stream[pos], (U16)((size - pos < UART_FIFO_LEN) ? size - pos : UART_FIFO_LEN), &used);
+            pos += used;
+        }
+    }
+    t2 = test_now_us();
+    printf("%3d B %s packets: EAST_PutByte %6.2f Mpackets/s, EAST_PutBytes %6.2f Mpackets/s, %5.0f MB/s (x%.1f, host)\n",
+           len, version ? "CRC" : "XOR", n * rounds / (t1 - t0), n * rounds / (t2 - t1), rounds * (double)size / (t2 - t1),
+           (t1 - t0) / (t2 - t1));
+    free(buffer);
+}
+
+int main(int argc, char ** argv)
+{
+    test_valid();
+    test_corrupted();
+    test_random();
+    if ((argc > 1) && (strcmp(argv[1], "bench") == 0))
+    {
+        bench(8, EAST_VERSION_XOR);
+        bench(8, EAST_VERSION_CRC16);
+        bench(MAX_DATA, EAST_VERSION_XOR);
+        bench(MAX_DATA, EAST_VERSION_CRC16);
+    }
+    return test_result("east");
+}
@@ -0,0 +1,130 @@
+/* fs_open() name lookup through the perfect hash of makefsdata.py: every
+ * file of the image is found and names close to them are not, against the
+ * walk of the file list the hash replaced. Built on the image of the
+ * firmware and, as test_fs500, on a generated image of 500 files; "bench"
+ * times both lookups */
+#include "fs.c"
+#include "test_util.h"
+
+/* The lookup before the hash, kept for the images without one */
+static const struct fsdata_file * find_list(const char * name)
+{
+    const struct fsdata_file * f;
+
+    for (f = FS_ROOT; f != NULL; f = f->next)
+    {
+        if (!strcmp(name, (const char *)f->name))
+        {
+            return f;
+        }
+    }
+    return NULL;
+}
+
+static const char * names[FS_NUMFILES + 8];
+static int          name_count;
+
+/* The names of the image in list order, then a few it does not have */
+static void collect(void)
+{
+    static const char * const missing[] = { "/", "/missing.html", "/index.htm", "/index.shtml", "/INDEX.HTML", "" };
+    const struct fsdata_file * f;
+    size_t                     i;
+
+    for (f = FS_ROOT; f != NULL; f = f->next)
+    {
+        names[name_count++] = (const char *)f->name;
+    }
+    for (i = 0; i < sizeof(missing) / sizeof(missing[0]); i++)
+    {
+        names[name_count++] = missing[i];
+    }
+}
+
+static void test_lookup(void)
+{
+    const struct fsdata_file * f;
+    struct fs_file             file;
+    char                       name[256];
+    int                        files = 0;
+    int                        i;
+
+    for (f = FS_ROOT; f != NULL; f = f->next)
+    {
+        const char * n   = (const char *)f->name;
+        size_t       len = strlen(n);
+
+        files++;
+        CHECK(fs_find(n) == f, "%s not found", n);
+        CHECK((fs_open(&file, n) == ERR_OK) && (file.data == (const char *)f->data), "fs_open %s", n);
+        /* One character short, one more and one changed */
+        snprintf(name, sizeof(name), "%.*s", (int)len - 1, n);
+        CHECK(fs_find(name) == find_list(name), "%s found", name);
+        snprintf(name, sizeof(name), "%sx", n);
+        CHECK(fs_find(name) == NULL, "%s found", name);
+        snprintf(name, sizeof(name), "%s", n);
+        name[len - 1] ^= 1;
+        CHECK(fs_find(name) == find_list(name), "%s found", name);
+    }
+    CHECK(files == FS_NUMFILES, "%d files in the list, FS_NUMFILES %d", files, FS_NUMFILES);
+#ifdef FS_HASH_SIZE
+    /* Every file in one slot */
+    for (i = 0; i < FS_HASH_SIZE; i++)
+    {
+        CHECK(fs_find((const char *)fs_hash_table[i]->name) == fs_hash_table[i], "slot %d", i);
+    }
+#else  /* FS_HASH_SIZE */
+    CHECK(0, "image without the hash");
+#endif /* FS_HASH_SIZE */
+    for (i = files; i < name_count; i++)
+    {
+        CHECK(fs_find(names[i]) == NULL, "\"%s\" found", names[i]);
+        CHECK(fs_open(&file, names[i]) == ERR_VAL, "fs_open \"%s\"", names[i]);
+    }
+    printf("%d files found, %d names close to them and %d others not\n", files, files * 3, name_count - files);
+}
+
+static void bench(void)
+{
+    long   rounds = 20000000 / name_count;
+    long   found  = 0;
+    long   k;
+    int    i;
+    double t0;
+    double t1;
+    double t2;
+
+    t0 = test_now_us();
+    for (k = 0; k < rounds; k++)
+    {
+        for (i = 0; i < name_count; i++)
+        {
+            found += find_list(names[i]) != NULL;
+            __asm__ volatile("" ::: "memory");
+        }
+    }
+    t1 = test_now_us();
+    for (k = 0; k < rounds; k++)
+    {
+        for (i = 0; i < name_count; i++)
+        {
+            found -= fs_find(names[i]) != NULL;
+            __asm__ volatile("" ::: "memory");
+        }
+    }
+    t2 = test_now_us();
+    CHECK(found == 0, "the lookups disagree");
+    printf("%3d files: list walk %6.1f M lookups/s, hash %6.1f M lookups/s (x%.1f, host)\n", FS_NUMFILES,
+           rounds * name_count / (t1 - t0), rounds * name_count / (t2 - t1), (t1 - t0) / (t2 - t1));
+}
+
+int main(int argc, char ** argv)
+{
+    collect();
+    test_lookup();
+    if ((argc > 1) && (strcmp(argv[1], "bench") == 0))
+    {
+        bench();
+    }
+    return test_result(FS_NUMFILES > 100 ? "fs500" : "fs");
+}
@@ -0,0 +1,254 @@
+/* Persistent connections: the Connection header of every kind of static
+ * response, and a page load of the control portal over one persistent
+ * connection against one connection per asset */
+#include <string.h>
+#include <stdlib.h>
+#include "sim_tcp.h"
+#include "httpd.h"
+#include "test_util.h"
+
+/* index.html and what it references, then the other pages */
+static const char * const assets[] = {
+    "/index.html",     "/css/siimple.min.ice.css", "/css/fonts.css",        "/css/common.css",
+    "/css/style.css",  "/font/latin.woff2",        "/font/latin_ext.woff2", "/img/favicon.png",
+    "/js/iro.js",      "/js/smoothie_min.js",      "/config.html",          "/complete.html",
+    "/error.html",
+};
+#define ASSET_COUNT (int)(sizeof(assets) / sizeof(assets[0]))
+
+/* Headers of the first response in the output, NUL terminated */
+static char * headers(struct tcp_pcb * c, char * buf, size_t size)
+{
+    char * end = memmem(c->out, c->out_len, "\r\n\r\n", 4);
+    size_t len = end ? (size_t)(end + 4 - (char *)c->out) : 0;
+
+    if (len >= size)
+    {
+        len = 0;
+    }
+    memcpy(buf, c->out, len);
+    buf[len] = '\0';
+    return buf;
+}
+
+static int count(const char * s, const char * what)
+{
+    int n = 0;
+
+    while ((s = strstr(s, what)) != NULL)
+    {
+        n++;
+        s++;
+    }
+    return n;
+}
+
+/* Sends one request on a new connection, checks the Connection line of the
+ * response and whether the connection stays open */
+static void check_response(const char * request, const char * status, const char * line, int open)
+{
+    struct tcp_pcb * c = sim_connect();
+    char             hdr[1024];
+
+    sim_send(c, request, strlen(request));
+    sim_run(c);
+    headers(c, hdr, sizeof(hdr));
+    CHECK(strncmp(hdr, status, strlen(status)) == 0, "%s: status %.20s", request, hdr);
+    CHECK(count(hdr, "Connection:") == (line ? 1 : 0), "%s: %d Connection lines", request, count(hdr, "Connection:"));
+    if (line)
+    {
+        CHECK(strstr(hdr, line) != NULL, "%s: no \"%s\"", request, line);
+    }
+    CHECK(c->closed == !open, "%s: closed %d", request, c->closed);
+    if (open)
+    {
+        sim_remote_close(c);
+    }
+    sim_free(c);
+}
+
+static void test_connection_lines(void)
+{
+    char etag[64];
+    char request[256];
+
+    /* HTTP/1.1 persists unless told otherwise, HTTP/1.0 closes */
+    check_response("GET /css/common.css HTTP/1.1\r\n\r\n", "HTTP/1.1 200", NULL, 1);
+    check_response("GET /css/common.css HTTP/1.1\r\nConnection: close\r\n\r\n", "HTTP/1.1 200",
+                   "Connection: close\r\n", 0);
+    check_response("GET /css/common.css HTTP/1.0\r\n\r\n", "HTTP/1.1 200", NULL, 0);
+    check_response("GET /css/common.css HTTP/1.0\r\nConnection: keep-alive\r\n\r\n", "HTTP/1.1 200",
+                   "Connection: keep-alive\r\n", 1);
+    check_response("GET /error.html HTTP/1.1\r\nConnection: close\r\n\r\n", "HTTP/1.1 200",
+                   "Connection: close\r\n", 0);
+    /* The captive portal redirect is an HTTP/1.0 response */
+    check_response("GET /generate_204 HTTP/1.1\r\n\r\n", "HTTP/1.0 302", "Connection: keep-alive\r\n", 1);
+    check_response("GET /generate_204 HTTP/1.1\r\nConnection: close\r\n\r\n", "HTTP/1.0 302", NULL, 0);
+
+    /* 304 and 206 responses */
+    {
+        struct tcp_pcb * c = sim_connect();
+        char             hdr[1024];
+        char *           p;
+        sim_send(c, "GET /css/common.css HTTP/1.1\r\n\r\n", 32);
+        sim_run(c);
+        p = strstr(headers(c, hdr, sizeof(hdr)), "ETag: ");
+        CHECK(p != NULL, "no ETag");
+        snprintf(etag, sizeof(etag), "%.*s", p ? (int)strcspn(p + 6, "\r") : 0, p ? p + 6 : "");
+        sim_remote_close(c);
+        sim_free(c);
+    }
+    snprintf(request, sizeof(request), "GET /css/common.css HTTP/1.1\r\nIf-None-Match: %s\r\n\r\n", etag);
+    check_response(request, "HTTP/1.1 304", NULL, 1);
+    snprintf(request, sizeof(request), "GET /css/common.css HTTP/1.1\r\nIf-None-Match: %s\r\nConnection: close\r\n\r\n",
+             etag);
+    check_response(request, "HTTP/1.1 304", "Connection: close\r\n", 0);
+    check_response("GET /css/common.css HTTP/1.1\r\nRange: bytes=0-9\r\n\r\n", "HTTP/1.1 206", NULL, 1);
+    check_response("GET /css/common.css HTTP/1.1\r\nRange: bytes=0-9\r\nConnection: close\r\n\r\n", "HTTP/1.1 206",
+                   "Connection: close\r\n", 0);
+    check_response("GET /css/common.css HTTP/1.0\r\nRange: bytes=-5\r\nConnection: keep-alive\r\n\r\n",
+                   "HTTP/1.1 206", "Connection: keep-alive\r\n", 1);
+    check_response("GET /css/common.css HTTP/1.1\r\nRange: bytes=999999-\r\nConnection: close\r\n\r\n",
+                   "HTTP/1.1 416", "Connection: close\r\n", 0);
+
+    /* The body follows the moved empty line unchanged */
+    {
+        struct tcp_pcb * a = sim_connect();
+        struct tcp_pcb * b = sim_connect();
+        char *           body_a;
+        char *           body_b;
+        sim_send(a, "GET /js/iro.js HTTP/1.1\r\n\r\n", 27);
+        sim_send(b, "GET /js/iro.js HTTP/1.1\r\nConnection: close\r\n\r\n", 46);
+        sim_run(a);
+        sim_run(b);
+        body_a = (char *)memmem(a->out, a->out_len, "\r\n\r\n", 4) + 4;
+        body_b = (char *)memmem(b->out, b->out_len, "\r\n\r\n", 4) + 4;
+        CHECK((a->out + a->out_len - (unsigned char *)body_a) == (b->out + b->out_len - (unsigned char *)body_b) &&
+                  memcmp(body_a, body_b, a->out + a->out_len - (unsigned char *)body_a) == 0,
+              "bodies differ");
+        CHECK(b->out_len == a->out_len + strlen("Connection: close\r\n"), "%zu bytes, %zu without the line",
+              b->out_len, a->out_len);
+        sim_remote_close(a);
+        sim_free(a);
+        sim_free(b);
+    }
+}
+
+struct page_load
+{
+    int  connections;
+    int  round_trips;
+    int  responses;
+    long bytes;
+};
+
+/* Complete responses in the output from pos on, returns the end of the last */
+static size_t parse(struct tcp_pcb * c, size_t pos, struct page_load * load)
+{
+    for (;;)
+    {
+        char * hdr  = (char *)c->out + pos;
+        size_t left = c->out_len - pos;
+        char * end  = memmem(hdr, left, "\r\n\r\n", 4);
+        char * cl;
+        size_t total;
+        if (end == NULL)
+        {
+            return pos;
+        }
+        cl    = memmem(hdr, end - hdr, "Content-Length: ", 16);
+        total = (end + 4 - hdr) + (cl ? strtoul(cl + 16, NULL, 10) : 0);
+        if (left < total)
+        {
+            return pos;
+        }
+        pos += total;
+        load->responses++;
+    }
+}
+
+/* Loads every asset the way a browser does: on the open connection unless
+ * it was closed, a new connection costs a round trip for the handshake */
+static void page_load(struct page_load * load, int keepalive)
+{
+    struct tcp_pcb * c = NULL;
+    size_t           pos = 0;
+    int              i;
+
+    for (i = 0; i < ASSET_COUNT; i++)
+    {
+        char request[256];
+        if ((c == NULL) || c->closed)
+        {
+            if (c != NULL)
+            {
+                load->bytes += c->out_len;
+                sim_free(c);
+            }
+            c   = sim_connect();
+            pos = 0;
+            load->connections++;
+            load->round_trips++;
+        }
+        snprintf(request, sizeof(request),
+                 "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept: */*\r\nAccept-Encoding: gzip, deflate\r\n"
+                 "Connection: %s\r\n\r\n",
+                 assets[i], keepalive ? "keep-alive" : "close");
+        sim_send(c, request, strlen(request));
+        load->round_trips++;
+        while (sim_ack(c))
+        {
+            load->round_trips++;
+        }
+        pos = parse(c, pos, load);
+    }
+    load->bytes += c->out_len;
+    if (!c->closed)
+    {
+        sim_remote_close(c);
+    }
+    sim_free(c);
+}
+
+static void test_page_load(void)
+{
+    struct page_load load[2];
+    double           host_us[2];
+    int              keepalive;
+    int              k;
+
+    for (keepalive = 0; keepalive < 2; keepalive++)
+    {
+        struct page_load scratch;
+        memset(&load[keepalive], 0, sizeof(load[keepalive]));
+        page_load(&load[keepalive], keepalive);
+        host_us[keepalive] = test_now_us();
+        for (k = 0; k < 200; k++)
+        {
+            page_load(&scratch, keepalive);
+        }
+        host_us[keepalive] = (test_now_us() - host_us[keepalive]) / 200;
+        CHECK(load[keepalive].responses == ASSET_COUNT, "%d responses", load[keepalive].responses);
+        printf("page load, %-10s: %2d responses, %2d connections, %3d round trips, %6ld bytes, %.1f us host CPU\n",
+               keepalive ? "keep-alive" : "close", load[keepalive].responses, load[keepalive].connections,
+               load[keepalive].round_trips, load[keepalive].bytes, host_us[keepalive]);
+    }
+    CHECK(load[1].connections == 1, "%d connections with keep-alive", load[1].connections);
+    CHECK(load[0].connections == ASSET_COUNT, "%d connections with close", load[0].connections);
+    CHECK(load[1].round_trips == load[0].round_trips - (ASSET_COUNT - 1), "round trips %d, %d",
+          load[1].round_trips, load[0].round_trips);
+    /* The same bodies, the close responses carry a Connection line each */
+    CHECK(load[0].bytes == load[1].bytes + ASSET_COUNT * (long)strlen("Connection: close\r\n"), "bytes %ld, %ld",
+          load[0].bytes, load[1].bytes);
+}
+
+int main(void)
+{
+    httpd_init(false);
+
+    test_connection_lines();
+    test_page_load();
+
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result("keepalive");
+}
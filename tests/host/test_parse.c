@@ -0,0 +1,268 @@
+/* Request parser: every request of corpus/http must get the same response
+ * however it is split into segments, mutated requests must not crash it or
+ * leak pbufs, and "bench" measures parsed requests per second */
+#include <string.h>
+#include <stdlib.h>
+#include <glob.h>
+#include "sim_tcp.h"
+#include "httpd.h"
+#include "test_util.h"
+
+/* httpd.c default: a request arrives in at most this many pbufs */
+#ifndef LWIP_HTTPD_REQ_QUEUELEN
+#    define LWIP_HTTPD_REQ_QUEUELEN 5
+#endif
+
+#define MAX_REQUESTS 64
+#define MAX_REQ_LEN  2048
+
+struct request
+{
+    char   name[64];
+    char   data[MAX_REQ_LEN];
+    size_t len;
+};
+
+static struct request corpus[MAX_REQUESTS];
+static int            corpus_len;
+
+static void load_corpus(const char * pattern)
+{
+    glob_t files;
+    size_t i;
+
+    if (glob(pattern, 0, NULL, &files) != 0)
+    {
+        CHECK(0, "no corpus at %s", pattern);
+        return;
+    }
+    for (i = 0; (i < files.gl_pathc) && (corpus_len < MAX_REQUESTS); i++)
+    {
+        struct request * r = &corpus[corpus_len++];
+        FILE *           f = fopen(files.gl_pathv[i], "rb");
+        const char *     base = strrchr(files.gl_pathv[i], '/');
+        snprintf(r->name, sizeof(r->name), "%s", base ? base + 1 : files.gl_pathv[i]);
+        r->len = f ? fread(r->data, 1, sizeof(r->data), f) : 0;
+        if (f)
+        {
+            fclose(f);
+        }
+    }
+    globfree(&files);
+}
+
+static unsigned long fnv(const u8_t * data, size_t len)
+{
+    unsigned long h = 1469598103934665603UL;
+
+    while (len--)
+    {
+        h = (h ^ *data++) * 1099511628211UL;
+    }
+    return h;
+}
+
+/* Sends the request in pieces cut at the offsets in cuts[] (ascending),
+ * each piece in segments of at most seg bytes, returns a hash of the
+ * response and of whether the connection was closed */
+static unsigned long run(const char * req, size_t len, const size_t * cuts, int ncuts, u16_t seg)
+{
+    struct tcp_pcb * c   = sim_connect();
+    size_t           pos = 0;
+    unsigned long    h;
+    int              k;
+
+    sim_rx_seg = seg;
+    for (k = 0; (k <= ncuts) && !c->closed; k++)
+    {
+        size_t end = (k < ncuts) ? cuts[k] : len;
+        if (end > pos)
+        {
+            sim_send(c, req + pos, end - pos);
+            sim_run(c);
+        }
+        pos = end;
+    }
+    sim_run(c);
+    sim_rx_seg = 1460;
+    h          = fnv(c->out, c->out_len) ^ (unsigned long)c->closed;
+    sim_remote_close(c);
+    sim_free(c);
+    return h;
+}
+
+static void sort_cuts(size_t * cuts, int n)
+{
+    int x;
+    int y;
+
+    for (x = 0; x < n; x++)
+    {
+        for (y = x + 1; y < n; y++)
+        {
+            if (cuts[y] < cuts[x])
+            {
+                size_t t = cuts[x];
+                cuts[x]  = cuts[y];
+                cuts[y]  = t;
+            }
+        }
+    }
+}
+
+static void test_segmentation(void)
+{
+    long cases = 0;
+    int  i;
+
+    for (i = 0; i < corpus_len; i++)
+    {
+        const struct request * r      = &corpus[i];
+        unsigned long          whole  = run(r->data, r->len, NULL, 0, 1460);
+        int                    fails  = 0;
+        size_t                 a;
+        u16_t                  seg;
+        int                    k;
+
+        /* One cut at every byte boundary */
+        for (a = 0; a <= r->len; a++)
+        {
+            fails += run(r->data, r->len, &a, 1, 1460) != whole;
+            cases++;
+        }
+        /* Segments of every size the request queue takes */
+        for (seg = (u16_t)((r->len + LWIP_HTTPD_REQ_QUEUELEN - 1) / LWIP_HTTPD_REQ_QUEUELEN); seg < r->len; seg++)
+        {
+            fails += run(r->data, r->len, NULL, 0, seg) != whole;
+            cases++;
+        }
+        /* Up to 5 pieces at random */
+        for (k = 0; k < 300; k++)
+        {
+            size_t cuts[4];
+            int    n = rand() % 5;
+            int    j;
+            for (j = 0; j < n; j++)
+            {
+                cuts[j] = rand() % (r->len + 1);
+            }
+            sort_cuts(cuts, n);
+            fails += run(r->data, r->len, cuts, n, 1460) != whole;
+            cases++;
+        }
+        CHECK(fails == 0, "%s: %d segmentations differ from the whole request", r->name, fails);
+    }
+    printf("%ld segmentations of %d requests get the response of the whole request\n", cases, corpus_len);
+}
+
+static void test_mutations(long count)
+{
+    static const char alphabet[] = "\r\n :;,\"*GETgzipHTTP/1.0\t\x00\xff";
+    static char       buf[MAX_REQ_LEN + 1024];
+    long              k;
+
+    for (k = 0; k < count; k++)
+    {
+        const struct request * r   = &corpus[rand() % corpus_len];
+        size_t                 len = r->len;
+        size_t                 cuts[4];
+        int                    m;
+        int                    n;
+        int                    j;
+
+        memcpy(buf, r->data, len);
+        for (m = rand() % 8; m > 0; m--)
+        {
+            size_t at = rand() % (len + 1);
+            switch (rand() % 4)
+            {
+                case 0: /* replace */
+                    if (at < len)
+                    {
+                        buf[at] = alphabet[rand() % (sizeof(alphabet) - 1)];
+                    }
+                    break;
+                case 1: /* insert */
+                    if (len < sizeof(buf) - 1)
+                    {
+                        memmove(buf + at + 1, buf + at, len - at);
+                        buf[at] = alphabet[rand() % (sizeof(alphabet) - 1)];
+                        len++;
+                    }
+                    break;
+                case 2: /* delete */
+                    if (at < len)
+                    {
+                        memmove(buf + at, buf + at + 1, len - at - 1);
+                        len--;
+                    }
+                    break;
+                default: /* truncate */
+                    len = at;
+                    break;
+            }
+        }
+        n = rand() % 5;
+        for (j = 0; j < n; j++)
+        {
+            cuts[j] = rand() % (len + 1);
+        }
+        sort_cuts(cuts, n);
+        run(buf, len, cuts, n, (rand() % 4) ? 1460 : 1 + rand() % 16);
+    }
+    printf("%ld mutated requests in random segments\n", count);
+}
+
+/* Requests per second on one connection, the request whole or in pieces */
+static void bench(const struct request * r, int pieces)
+{
+    struct tcp_pcb * c = sim_connect();
+    const long       n = 200000;
+    double           t;
+    long             k;
+    int              p;
+
+    t = test_now_us();
+    for (k = 0; k < n; k++)
+    {
+        for (p = 0; p < pieces; p++)
+        {
+            sim_send(c, r->data + r->len * p / pieces, r->len * (p + 1) / pieces - r->len * p / pieces);
+        }
+        sim_run(c);
+        c->out_len = 0;
+        if (c->closed)
+        {
+            sim_free(c);
+            c = sim_connect();
+        }
+    }
+    t = test_now_us() - t;
+    printf("%-28s in %d piece%s: %8.0f requests/s (%.2f us each, host)\n", r->name, pieces, (pieces > 1) ? "s" : " ",
+           n / t * 1e6, t / n);
+    sim_remote_close(c);
+    sim_free(c);
+}
+
+int main(int argc, char ** argv)
+{
+    httpd_init(false);
+    srand(1);
+    load_corpus("corpus/http/*.req");
+    if (corpus_len == 0)
+    {
+        return test_result("parse");
+    }
+
+    test_segmentation();
+    test_mutations(20000);
+    if ((argc > 1) && (strcmp(argv[1], "bench") == 0))
+    {
+        bench(&corpus[0], 1);
+        bench(&corpus[0], 4);
+        bench(&corpus[1], 1);
+    }
+
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result("parse");
+}
@@ -0,0 +1,166 @@
+/* Pipelined requests: many requests in one segment, and a client that sends
+ * requests without reading the responses */
+#include <string.h>
+#include <stdlib.h>
+#include "sim_tcp.h"
+#include "httpd.h"
+#include "test_util.h"
+
+/* httpd.c defaults, the Makefile may override them for both */
+#ifndef LWIP_HTTPD_PIPELINE_QUEUELEN
+#    define LWIP_HTTPD_PIPELINE_QUEUELEN   8
+#endif
+#ifndef LWIP_HTTPD_SUPPORT_REQUESTLIST
+#    define LWIP_HTTPD_SUPPORT_REQUESTLIST 1
+#endif
+
+/* Number of complete responses in the output, all with the expected status */
+static int responses(struct tcp_pcb * c, const char * status)
+{
+    size_t pos   = 0;
+    int    count = 0;
+
+    while (pos < c->out_len)
+    {
+        char * hdr  = (char *)c->out + pos;
+        size_t left = c->out_len - pos;
+        char * end  = memmem(hdr, left, "\r\n\r\n", 4);
+        char * cl;
+        size_t total;
+        if ((end == NULL) || strncmp(hdr, status, strlen(status)))
+        {
+            return -1;
+        }
+        cl    = memmem(hdr, end - hdr, "Content-Length: ", 16);
+        total = (end + 4 - hdr) + (cl ? strtoul(cl + 16, NULL, 10) : 0);
+        if (left < total)
+        {
+            return -1;
+        }
+        pos += total;
+        count++;
+    }
+    return count;
+}
+
+static char * requests(const char * line, int count)
+{
+    size_t len = strlen(line);
+    char * buf = malloc(len * count + 1);
+    int    i;
+
+    for (i = 0; i < count; i++)
+    {
+        memcpy(buf + i * len, line, len);
+    }
+    buf[len * count] = '\0';
+    return buf;
+}
+
+/* Everything in one segment: the parsed requests are dropped from the pbuf,
+ * not copied */
+static void test_one_segment(void)
+{
+    const int        count = 150;
+    char *           buf   = requests("GET /img/favicon.png HTTP/1.1\r\n\r\n", count);
+    struct tcp_pcb * c;
+    long             before;
+    long             copied;
+    double           t;
+
+    sim_rx_seg = 65535;
+    c          = sim_connect();
+    before     = sim_pbuf_bytes;
+    t          = test_now_us();
+    sim_send(c, buf, strlen(buf));
+    sim_run(c);
+    t      = test_now_us() - t;
+    copied = sim_pbuf_bytes - before - (long)strlen(buf);
+    CHECK(responses(c, "HTTP/1.1 200") == count, "%d responses", responses(c, "HTTP/1.1 200"));
+    CHECK(copied == 0, "%ld bytes copied", copied);
+    printf("%d requests in one %zu byte segment: %d responses, %ld bytes copied into new pbufs, %.1f us\n",
+           count, strlen(buf), responses(c, "HTTP/1.1 200"), copied, t);
+    sim_remote_close(c);
+    sim_free(c);
+    free(buf);
+    sim_rx_seg = 1460;
+}
+
+/* The queue is served in a loop: the stack does not grow with it */
+static void test_stack_depth(void)
+{
+    const int counts[2] = { 2, 150 };
+    long      depth[2];
+    int       i;
+
+    sim_rx_seg = 65535;
+    for (i = 0; i < 2; i++)
+    {
+        char             here;
+        char *           buf = requests("GET /css/common.css HTTP/1.1\r\n\r\n", counts[i]);
+        struct tcp_pcb * c   = sim_connect();
+        sim_stack_low        = NULL;
+        sim_send(c, buf, strlen(buf));
+        sim_run(c);
+        depth[i] = &here - sim_stack_low;
+        CHECK(responses(c, "HTTP/1.1 200") == counts[i], "%d responses", responses(c, "HTTP/1.1 200"));
+        sim_remote_close(c);
+        sim_free(c);
+        free(buf);
+    }
+    CHECK(depth[1] < depth[0] + 512, "stack %ld bytes for %d requests, %ld for %d",
+          depth[0], counts[0], depth[1], counts[1]);
+    printf("stack below the test: %ld bytes for %d pipelined requests, %ld for %d\n",
+           depth[0], counts[0], depth[1], counts[1]);
+    sim_rx_seg = 1460;
+}
+
+/* A client that pipelines a lot without reading: the queue stays within the
+ * receive window and LWIP_HTTPD_PIPELINE_QUEUELEN pbufs, and everything is
+ * answered once it reads. Without the request list a request split across
+ * segments is refused, so only whole ones are sent then. */
+static void test_unread(u16_t seg)
+{
+    const int        count = 400;
+    char *           buf   = requests("GET /css/common.css HTTP/1.1\r\n\r\n", count);
+    struct tcp_pcb * c;
+    long             pbufs;
+    long             queued;
+    long             held;
+
+    sim_rx_seg = seg;
+    c          = sim_connect();
+    pbufs      = sim_pbufs;
+    sim_send(c, buf, strlen(buf));
+    queued = c->rx_delivered - c->rx_recved;
+    held   = sim_pbufs - pbufs;
+    CHECK(queued <= TCP_WND, "%ld bytes queued", queued);
+    CHECK(held <= LWIP_HTTPD_PIPELINE_QUEUELEN + 1, "%ld pbufs held", held);
+    printf("%4u byte segments, unread responses: %5ld bytes and %ld pbufs queued, client holds back %zu bytes\n",
+           seg, queued, held, c->rx_len);
+    sim_run(c);
+    CHECK(responses(c, "HTTP/1.1 200") == count, "%d responses", responses(c, "HTTP/1.1 200"));
+    CHECK((c->rx_len == 0) && (c->refused == NULL) && !c->closed, "rx %zu refused %p closed %d",
+          c->rx_len, (void *)c->refused, c->closed);
+    CHECK(c->rx_delivered == c->rx_recved, "window not reopened: %ld", c->rx_delivered - c->rx_recved);
+    sim_remote_close(c);
+    sim_free(c);
+    free(buf);
+    sim_rx_seg = 1460;
+}
+
+int main(void)
+{
+    httpd_init(false);
+
+    test_one_segment();
+    test_stack_depth();
+#if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    test_unread(7);
+    test_unread(29);
+#endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    test_unread(1460);
+
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result("pipeline");
+}
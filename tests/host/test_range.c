@@ -0,0 +1,243 @@
+/* Range requests: interrupted downloads resumed with Range and If-Range
+ * against restarted ones, then the responses http_check_range() must give
+ * for suffix ranges, ranges past the end, stale validators and the forms it
+ * does not serve */
+#include <string.h>
+#include <stdlib.h>
+#include "sim_tcp.h"
+#include "httpd.h"
+#include "test_util.h"
+
+static int starts(struct tcp_pcb * c, size_t at, const char * text)
+{
+    return (c->out_len >= at + strlen(text)) && (memcmp(c->out + at, text, strlen(text)) == 0);
+}
+
+static size_t header_len(struct tcp_pcb * c)
+{
+    char * end = memmem(c->out, c->out_len, "\r\n\r\n", 4);
+
+    return end ? (size_t)(end + 4 - (char *)c->out) : 0;
+}
+
+/* Value of a header of the first response, NULL when there is none */
+static const char * header(struct tcp_pcb * c, const char * name, char * buf, size_t size)
+{
+    size_t len = header_len(c);
+    char * p   = memmem(c->out, len, name, strlen(name));
+    char * end;
+
+    if (p == NULL)
+    {
+        return NULL;
+    }
+    p += strlen(name);
+    end = memmem(p, len - (p - (char *)c->out), "\r\n", 2);
+    snprintf(buf, size, "%.*s", (int)(end - p), p);
+    return buf;
+}
+
+/* Sends one request with the extra header lines on a new connection */
+static struct tcp_pcb * get(const char * uri, const char * extra, int gzip)
+{
+    struct tcp_pcb * c = sim_connect();
+    char             request[512];
+
+    snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\n%s%s\r\n", uri,
+             gzip ? "Accept-Encoding: gzip, deflate\r\n" : "", extra);
+    sim_send(c, request, strlen(request));
+    sim_run(c);
+    return c;
+}
+
+static void done(struct tcp_pcb * c)
+{
+    if (!c->closed)
+    {
+        sim_remote_close(c);
+    }
+    sim_free(c);
+}
+
+static long bytes_interrupted;
+static long bytes_resumed;
+static long bytes_restarted;
+
+/* The link drops after the fraction cut of the response, the client asks
+ * for the rest of the same representation */
+static void resume(const char * uri, int gzip, double cut)
+{
+    struct tcp_pcb * c = get(uri, "", gzip);
+    size_t           len = header_len(c);
+    size_t           body = c->out_len - len;
+    size_t           total = c->out_len;
+    size_t           got;
+    size_t           have;
+    unsigned char *  full = malloc(body);
+    char             etag[80];
+    char             value[128];
+    char             expect[128];
+    char             extra[256];
+
+    memcpy(full, c->out + len, body);
+    CHECK(starts(c, 0, "HTTP/1.1 200"), "%s: %.20s", uri, c->out);
+    CHECK(header(c, "Accept-Ranges: ", value, sizeof(value)) && (strcmp(value, "bytes") == 0), "%s: Accept-Ranges",
+          uri);
+    CHECK(header(c, "ETag: ", etag, sizeof(etag)) != NULL, "%s: no ETag", uri);
+    done(c);
+
+    got  = (size_t)(total * cut);
+    have = got - len;
+    snprintf(extra, sizeof(extra), "Range: bytes=%zu-\r\nIf-Range: %s\r\n", have, etag);
+    c   = get(uri, extra, gzip);
+    len = header_len(c);
+    CHECK(starts(c, 0, "HTTP/1.1 206 Partial Content\r\n"), "%s: %.20s", uri, c->out);
+    snprintf(expect, sizeof(expect), "bytes %zu-%zu/%zu", have, body - 1, body);
+    CHECK(header(c, "Content-Range: ", value, sizeof(value)) && (strcmp(value, expect) == 0), "%s: Content-Range %s",
+          uri, value);
+    CHECK(header(c, "Content-Length: ", value, sizeof(value)) && ((size_t)atol(value) == body - have),
+          "%s: Content-Length %s", uri, value);
+    CHECK(header(c, "ETag: ", value, sizeof(value)) && (strcmp(value, etag) == 0), "%s: ETag %s", uri, value);
+    CHECK((c->out_len - len == body - have) && (memcmp(c->out + len, full + have, body - have) == 0),
+          "%s: the rest of the body differs", uri);
+    CHECK(!c->closed, "%s: closed", uri);
+    printf("%-26s %s %6zu B, cut at %6zu: resumed with %6zu B, restarted with %6zu B\n", uri, gzip ? "gzip" : "    ",
+           body, got, c->out_len, total);
+    bytes_interrupted += got;
+    bytes_resumed += c->out_len;
+    bytes_restarted += total;
+    done(c);
+    free(full);
+}
+
+static void test_resume(void)
+{
+    static const char * const uris[] = {
+        "/font/latin.woff2", "/font/latin_ext.woff2",    "/js/iro.js",
+        "/js/smoothie_min.js", "/css/siimple.min.ice.css", "/img/favicon.png",
+    };
+    size_t i;
+    int    gzip;
+
+    for (i = 0; i < sizeof(uris) / sizeof(uris[0]); i++)
+    {
+        for (gzip = 0; gzip < 2; gzip++)
+        {
+            resume(uris[i], gzip, 0.6);
+        }
+    }
+    printf("interrupted after %ld B: resuming transfers %ld B, restarting %ld B (%.1f%% less in all)\n",
+           bytes_interrupted, bytes_resumed, bytes_restarted,
+           100.0 * (bytes_restarted - bytes_resumed) / (bytes_interrupted + bytes_restarted));
+    CHECK(bytes_resumed < bytes_restarted, "resuming costs more than restarting");
+}
+
+static void test_ranges(void)
+{
+    struct tcp_pcb * c;
+    char             value[128];
+    char             extra[256];
+    size_t           first;
+    size_t           i;
+    /* Served as the whole file: several ranges, bad syntax, other units,
+       validators of another representation and dates */
+    static const char * const whole[] = {
+        "Range: bytes=0-1,5-6\r\n",
+        "Range: bytes=5-1\r\n",
+        "Range: bytes=-\r\n",
+        "Range: items=0-1\r\n",
+        "Range: bytes=0-1\r\nIf-Range: \"0123456789abcdef\"\r\n",
+        "Range: bytes=0-1\r\nIf-Range: Wed, 21 Oct 2015 07:28:00 GMT\r\n",
+    };
+
+    /* First bytes, suffix and a last position past the end */
+    c = get("/css/style.css", "Range: bytes=0-9\r\n", 0);
+    CHECK(starts(c, 0, "HTTP/1.1 206"), "0-9: %.20s", c->out);
+    CHECK(c->out_len - header_len(c) == 10, "0-9: %zu bytes", c->out_len - header_len(c));
+    CHECK(header(c, "Content-Range: ", value, sizeof(value)) && (strncmp(value, "bytes 0-9/", 10) == 0),
+          "0-9: Content-Range %s", value);
+    done(c);
+    c = get("/css/style.css", "Range: bytes=-5 \r\n", 0);
+    CHECK(starts(c, 0, "HTTP/1.1 206"), "-5: %.20s", c->out);
+    CHECK(c->out_len - header_len(c) == 5, "-5: %zu bytes", c->out_len - header_len(c));
+    done(c);
+    c = get("/css/style.css", "Range: bytes=10-999999999999\r\n", 0);
+    CHECK(starts(c, 0, "HTTP/1.1 206"), "10-: %.20s", c->out);
+    done(c);
+
+    /* Past the end: 416 with the size, the connection stays */
+    c = get("/css/style.css", "Range: bytes=999999-\r\n", 0);
+    CHECK(starts(c, 0, "HTTP/1.1 416 Range Not Satisfiable\r\n"), "999999-: %.40s", c->out);
+    CHECK(header(c, "Content-Range: ", value, sizeof(value)) && (strncmp(value, "bytes */", 8) == 0),
+          "416: Content-Range %s", value);
+    CHECK(header(c, "Content-Length: ", value, sizeof(value)) && (strcmp(value, "0") == 0), "416: Content-Length %s",
+          value);
+    CHECK(c->out_len == header_len(c), "416 with a body");
+    CHECK(!c->closed, "416 closed the connection");
+    first = c->out_len;
+    sim_send(c, "GET /css/style.css HTTP/1.1\r\nRange: bytes=-0\r\n\r\n", 48);
+    sim_run(c);
+    CHECK(starts(c, first, "HTTP/1.1 416"), "-0: %.20s", c->out + first);
+    done(c);
+
+    for (i = 0; i < sizeof(whole) / sizeof(whole[0]); i++)
+    {
+        c = get("/css/style.css", whole[i], 0);
+        CHECK(starts(c, 0, "HTTP/1.1 200"), "%.*s: %.20s", (int)strcspn(whole[i], "\r"), whole[i], c->out);
+        done(c);
+    }
+
+    /* If-None-Match wins over Range */
+    c = get("/css/style.css", "", 0);
+    header(c, "ETag: ", value, sizeof(value));
+    done(c);
+    snprintf(extra, sizeof(extra), "If-None-Match: %s\r\nRange: bytes=0-1\r\n", value);
+    c = get("/css/style.css", extra, 0);
+    CHECK(starts(c, 0, "HTTP/1.1 304"), "If-None-Match and Range: %.20s", c->out);
+    done(c);
+
+    /* HTTP/1.0 clients get ranges too */
+    c = sim_connect();
+    sim_send(c, "GET /css/style.css HTTP/1.0\r\nRange: bytes=1-2\r\n\r\n", 49);
+    sim_run(c);
+    CHECK(starts(c, 0, "HTTP/1.1 206"), "HTTP/1.0: %.20s", c->out);
+    CHECK(c->out_len - header_len(c) == 2, "HTTP/1.0: %zu bytes", c->out_len - header_len(c));
+    CHECK(c->closed, "HTTP/1.0 kept open");
+    sim_free(c);
+
+    /* Pipelined ranges on one connection */
+    {
+        static const char pipe[] = "GET /js/iro.js HTTP/1.1\r\nRange: bytes=100-199\r\n\r\n"
+                                   "GET /js/iro.js HTTP/1.1\r\nRange: bytes=-50\r\n\r\n"
+                                   "GET /css/common.css HTTP/1.1\r\n\r\n";
+        c = sim_connect();
+        sim_send(c, pipe, sizeof(pipe) - 1);
+        sim_run(c);
+        CHECK(memmem(c->out, c->out_len, "Content-Range: bytes 100-199/", 29) != NULL, "pipelined 100-199");
+        CHECK(memmem(c->out, c->out_len, "Content-Length: 50\r\n", 20) != NULL, "pipelined -50");
+        CHECK(memmem(c->out, c->out_len, "HTTP/1.1 200", 12) != NULL, "pipelined whole file");
+        CHECK(!c->closed, "pipelined ranges closed the connection");
+        done(c);
+    }
+
+    /* No room for the 206 headers: the whole file instead */
+    {
+        u16_t snd_buf = sim_snd_buf;
+        sim_snd_buf   = 100;
+        c             = get("/css/style.css", "Range: bytes=0-9\r\n", 0);
+        CHECK(starts(c, 0, "HTTP/1.1 200"), "small send buffer: %.20s", c->out);
+        done(c);
+        sim_snd_buf = snd_buf;
+    }
+}
+
+int main(void)
+{
+    httpd_init(false);
+
+    test_resume();
+    test_ranges();
+
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result("range");
+}
@@ -0,0 +1,433 @@
+/* SSI files sent through the tag table of makefsdata.py, on an image of the
+ * files in ssi/: a tag at the very start and at the very end of the file,
+ * adjacent tags, whitespace in a tag, an unknown tag, names too long to be
+ * tags and an insert longer than the insert buffer. Every body must be the
+ * file with each insert after its tag, as the byte-wise scanner finds the
+ * tags, for send buffers from 1 byte up. Built with LWIP_HTTPD_SSI_MULTIPART
+ * as test_ssi_multipart the long insert comes in several parts.
+ * HTTP/1.1 clients get the same bodies chunked on a persistent connection,
+ * one after the other, pipelined and between static files */
+#include <string.h>
+#include <stdlib.h>
+#include "sim_tcp.h"
+#include "httpd.h"
+#include "fs.h"
+#include "test_util.h"
+
+/* httpd.c values */
+#define HTTPD_LAST_TAG_PART 0xFFFF
+#define UNKNOWN_TAG1_TEXT   "<b>***UNKNOWN TAG "
+#define UNKNOWN_TAG2_TEXT   "***</b>"
+
+static const char * tags[] = { "uptime", "heap", "led", "a", "b", "long", "eightchr" };
+#define TAG_COUNT (int)(sizeof(tags) / sizeof(tags[0]))
+
+static char  long_insert[600];
+static const char * inserts[TAG_COUNT] = { "123456", "40960", "on", "A", "", long_insert, "8" };
+static int   handler_calls;
+
+static u32_t handler(int index, char * insert, int insert_len
+#if LWIP_HTTPD_SSI_MULTIPART
+                     , u16_t part, u16_t * next_part
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+)
+{
+    size_t len    = strlen(inserts[index]);
+    size_t offset = 0;
+    size_t n;
+
+#if LWIP_HTTPD_SSI_MULTIPART
+    offset = (size_t)part * insert_len;
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+    n = LWIP_MIN(len - offset, (size_t)insert_len);
+    memcpy(insert, inserts[index] + offset, n);
+#if LWIP_HTTPD_SSI_MULTIPART
+    *next_part = (offset + n < len) ? part + 1 : HTTPD_LAST_TAG_PART;
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+    handler_calls++;
+    return (u32_t)n;
+}
+
+static int is_space(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+/* The file with the inserts the way the byte-wise scanner of httpd.c puts
+ * them: after the lead-out of every tag of up to LWIP_HTTPD_MAX_TAG_NAME_LEN
+ * characters. Returns the number of tags */
+static int expect(const char * uri, char * out, size_t * out_len)
+{
+    struct fs_file file;
+    const char *   data;
+    const char *   end;
+    const char *   p;
+    int            count = 0;
+
+    CHECK(fs_open(&file, uri) == ERR_OK, "%s not in the image", uri);
+    data = strstr(file.data, "\r\n\r\n") + 4;
+    end  = file.data + file.len;
+    *out_len = 0;
+    for (p = data; p < end;)
+    {
+        const char * name;
+        size_t       name_len;
+        int          i;
+
+        if ((end - p < 5) || (memcmp(p, "<!--#", 5) != 0))
+        {
+            out[(*out_len)++] = *p++;
+            continue;
+        }
+        memcpy(out + *out_len, p, 5);
+        *out_len += 5;
+        p += 5;
+        while ((p < end) && is_space(*p))
+        {
+            out[(*out_len)++] = *p++;
+        }
+        name = p;
+        while ((p < end) && !is_space(*p) && (*p != '-'))
+        {
+            out[(*out_len)++] = *p++;
+        }
+        name_len = p - name;
+        while ((p < end) && is_space(*p))
+        {
+            out[(*out_len)++] = *p++;
+        }
+        if ((name_len == 0) || (name_len > LWIP_HTTPD_MAX_TAG_NAME_LEN) || (end - p < 3) || (memcmp(p, "-->", 3) != 0))
+        {
+            continue;
+        }
+        memcpy(out + *out_len, p, 3);
+        *out_len += 3;
+        p += 3;
+        count++;
+        for (i = 0; i < TAG_COUNT; i++)
+        {
+            if ((strlen(tags[i]) == name_len) && (memcmp(tags[i], name, name_len) == 0))
+            {
+                break;
+            }
+        }
+        if (i == TAG_COUNT)
+        {
+            *out_len += sprintf(out + *out_len, UNKNOWN_TAG1_TEXT "%.*s" UNKNOWN_TAG2_TEXT, (int)name_len, name);
+        }
+        else
+        {
+            size_t len = strlen(inserts[i]);
+#if !LWIP_HTTPD_SSI_MULTIPART
+            len = LWIP_MIN(len, LWIP_HTTPD_MAX_TAG_INSERT_LEN);
+#endif /* !LWIP_HTTPD_SSI_MULTIPART */
+            memcpy(out + *out_len, inserts[i], len);
+            *out_len += len;
+        }
+    }
+    return count;
+}
+
+static char body[16384];
+static char ref[16384];
+
+/* The body of an HTTP/1.0 request, which ends when the connection closes */
+static size_t get(const char * uri)
+{
+    struct tcp_pcb * c = sim_connect();
+    char             request[128];
+    char *           end;
+    size_t           len = 0;
+
+    snprintf(request, sizeof(request), "GET %s HTTP/1.0\r\n\r\n", uri);
+    sim_send(c, request, strlen(request));
+    sim_run(c);
+    CHECK(c->closed, "%s: connection open", uri);
+    end = memmem(c->out, c->out_len, "\r\n\r\n", 4);
+    CHECK(end != NULL, "%s: no headers", uri);
+    if (end != NULL)
+    {
+        len = c->out_len - (end + 4 - (char *)c->out);
+        CHECK(len <= sizeof(body), "%s: %zu bytes", uri, len);
+        memcpy(body, end + 4, LWIP_MIN(len, sizeof(body)));
+    }
+    sim_free(c);
+    return len;
+}
+
+static void test_tags(void)
+{
+    static const u16_t bufs[] = { 1, 7, 64, 536, 1460, 5744 };
+    u16_t              snd_buf = sim_snd_buf;
+    size_t             ref_len;
+    size_t             len;
+    size_t             b;
+    int                count;
+    struct fs_file     file;
+
+    CHECK((fs_open(&file, "/tags.shtml") == ERR_OK) && (file.ssi_tags != NULL), "no tag table");
+    count = expect("/tags.shtml", ref, &ref_len);
+    CHECK(memcmp(ref, "<!--#uptime-->123456", 20) == 0, "first tag");
+    CHECK((ref_len > 13) && (memcmp(ref + ref_len - 13, "<!--#led-->on", 13) == 0), "last tag");
+    for (b = 0; b < sizeof(bufs) / sizeof(bufs[0]); b++)
+    {
+        sim_snd_buf   = bufs[b];
+        handler_calls = 0;
+        len           = get("/tags.shtml");
+        CHECK((len == ref_len) && (memcmp(body, ref, len) == 0), "send buffer %u: %zu bytes, %zu expected", bufs[b], len,
+              ref_len);
+#if LWIP_HTTPD_SSI_MULTIPART
+        /* The unknown tag does not reach the handler, the long one does once a part */
+        CHECK(handler_calls == count - 2 + (int)((strlen(long_insert) + LWIP_HTTPD_MAX_TAG_INSERT_LEN - 1) /
+                                                 LWIP_HTTPD_MAX_TAG_INSERT_LEN),
+              "send buffer %u: %d handler calls", bufs[b], handler_calls);
+#else  /* LWIP_HTTPD_SSI_MULTIPART */
+        /* The unknown tag does not reach the handler */
+        CHECK(handler_calls == count - 1, "send buffer %u: %d handler calls for %d tags", bufs[b], handler_calls, count);
+#endif /* LWIP_HTTPD_SSI_MULTIPART */
+    }
+    sim_snd_buf = snd_buf;
+    printf("tags.shtml: %d tags, the first at the start and the last at the end, %zu bytes with the inserts for "
+           "send buffers of 1 to 5744 bytes%s\n",
+           count, ref_len, LWIP_HTTPD_SSI_MULTIPART ? ", the long insert in parts" : "");
+}
+
+/* Decodes the response at pos into body: chunked or up to the end of the
+ * output. Returns the end of the response, 0 when it is incomplete or the
+ * chunk framing is broken */
+static size_t response(struct tcp_pcb * c, size_t pos, int * chunked, size_t * len)
+{
+    const char * start = (const char *)c->out + pos;
+    const char * end   = memmem(start, c->out_len - pos, "\r\n\r\n", 4);
+    size_t       p;
+
+    *len = 0;
+    if (end == NULL)
+    {
+        return 0;
+    }
+    p        = end + 4 - (const char *)c->out;
+    *chunked = memmem(start, p - pos, "Transfer-Encoding: chunked\r\n", 28) != NULL;
+    if (!*chunked)
+    {
+        /* Content-Length or up to the close */
+        const char * length = memmem(start, p - pos, "Content-Length: ", 16);
+
+        *len = length ? strtoul(length + 16, NULL, 10) : c->out_len - p;
+        if ((p + *len > c->out_len) || (*len > sizeof(body)))
+        {
+            return 0;
+        }
+        memcpy(body, c->out + p, *len);
+        return p + *len;
+    }
+    for (;;)
+    {
+        char *        size_end;
+        unsigned long size = strtoul((const char *)c->out + p, &size_end, 16);
+
+        if ((size_end == (char *)c->out + p) || (size_end + 2 > (char *)c->out + c->out_len) ||
+            (memcmp(size_end, "\r\n", 2) != 0))
+        {
+            return 0;
+        }
+        p = size_end + 2 - (char *)c->out;
+        if ((p + size + 2 > c->out_len) || (*len + size > sizeof(body)) || (memcmp(c->out + p + size, "\r\n", 2) != 0))
+        {
+            return 0;
+        }
+        if (size == 0)
+        {
+            return p + 2;
+        }
+        memcpy(body + *len, c->out + p, size);
+        *len += size;
+        p += size + 2;
+    }
+}
+
+static void send_text(struct tcp_pcb * c, const char * text)
+{
+    sim_send(c, text, strlen(text));
+}
+
+static const char * const dynamic[] = { "/tags.shtml", "/status.json" };
+#define DYNAMIC_COUNT (int)(sizeof(dynamic) / sizeof(dynamic[0]))
+
+static char   refs[DYNAMIC_COUNT][16384];
+static size_t ref_lens[DYNAMIC_COUNT];
+
+static int same(int f, size_t len)
+{
+    return (len == ref_lens[f]) && (memcmp(body, refs[f], len) == 0);
+}
+
+/* n polls on one connection, each after the previous response or all in
+ * one segment */
+static void polls(int n, int pipelined)
+{
+    static char      all[4096];
+    struct tcp_pcb * c      = sim_connect();
+    size_t           all_len = 0;
+    size_t           pos     = 0;
+    size_t           len;
+    int              chunked;
+    int              i;
+
+    for (i = 0; i < n; i++)
+    {
+        char * request = all + (pipelined ? all_len : 0);
+        size_t request_len;
+
+        request_len = sprintf(request, "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\n\r\n", dynamic[i % DYNAMIC_COUNT]);
+        all_len += request_len;
+        if (!pipelined)
+        {
+            sim_send(c, request, request_len);
+            sim_run(c);
+            pos = response(c, pos, &chunked, &len);
+            CHECK((pos == c->out_len) && chunked, "poll %d of %s: not one chunked response", i, dynamic[i % DYNAMIC_COUNT]);
+            CHECK(same(i % DYNAMIC_COUNT, len), "poll %d of %s: %zu bytes differ", i, dynamic[i % DYNAMIC_COUNT], len);
+        }
+    }
+    if (pipelined)
+    {
+        sim_send(c, all, all_len);
+        sim_run(c);
+        for (i = 0; i < n; i++)
+        {
+            pos = response(c, pos, &chunked, &len);
+            CHECK((pos != 0) && chunked && same(i % DYNAMIC_COUNT, len), "pipelined poll %d of %s", i,
+                  dynamic[i % DYNAMIC_COUNT]);
+            if (pos == 0)
+            {
+                break;
+            }
+        }
+        CHECK(pos == c->out_len, "%zu bytes after the pipelined responses", c->out_len - pos);
+    }
+    CHECK(!c->closed, "closed after %d polls", n);
+    sim_remote_close(c);
+    sim_free(c);
+}
+
+static void test_chunked(void)
+{
+    static const u16_t bufs[] = { 16, 64, 200, 536, 1460, 5744 };
+    static const u16_t msss[] = { 64, 1436 };
+    u16_t              snd_buf = sim_snd_buf;
+    u16_t              mss     = sim_mss;
+    struct tcp_pcb *   c;
+    size_t             pos;
+    size_t             len;
+    size_t             b;
+    size_t             m;
+    int                chunked;
+    int                f;
+
+    for (f = 0; f < DYNAMIC_COUNT; f++)
+    {
+        expect(dynamic[f], refs[f], &ref_lens[f]);
+    }
+    /* A small MSS fills the send queue first: chunks are written in pieces */
+    for (m = 0; m < sizeof(msss) / sizeof(msss[0]); m++)
+    {
+        for (b = 0; b < sizeof(bufs) / sizeof(bufs[0]); b++)
+        {
+            sim_mss     = msss[m];
+            sim_snd_buf = bufs[b];
+            polls(6, 0);
+            polls(6, 1);
+        }
+    }
+    sim_snd_buf = snd_buf;
+    sim_mss     = mss;
+
+    /* Between static files */
+    c = sim_connect();
+    send_text(c, "GET /status.json HTTP/1.1\r\n\r\nGET /style.css HTTP/1.1\r\n\r\nGET /tags.shtml HTTP/1.1\r\n\r\n");
+    sim_run(c);
+    pos = response(c, 0, &chunked, &len);
+    CHECK(pos && chunked && same(1, len), "status.json before a static file");
+    pos = pos ? response(c, pos, &chunked, &len) : 0;
+    CHECK(pos && !chunked && (len == 25), "static file between SSI files");
+    pos = pos ? response(c, pos, &chunked, &len) : 0;
+    CHECK((pos == c->out_len) && chunked && same(0, len), "tags.shtml after a static file");
+    CHECK(!c->closed, "closed after the mixed requests");
+    sim_remote_close(c);
+    sim_free(c);
+
+    /* Clients that cannot take chunks get the body up to the close */
+    c = sim_connect();
+    send_text(c, "GET /status.json HTTP/1.1\r\nConnection: close\r\n\r\n");
+    sim_run(c);
+    CHECK(c->closed && (response(c, 0, &chunked, &len) != 0) && !chunked && same(1, len), "Connection: close");
+    sim_free(c);
+    c = sim_connect();
+    send_text(c, "GET /status.json HTTP/1.0\r\nConnection: keep-alive\r\n\r\n");
+    sim_run(c);
+    CHECK(c->closed && (response(c, 0, &chunked, &len) != 0) && !chunked && same(1, len), "HTTP/1.0");
+    sim_free(c);
+    printf("chunked on one connection, one after the other and pipelined, for send buffers of 16 to 5744 bytes and "
+           "segments of 64 and 1436\n");
+}
+
+/* Status polls on one connection against a connection each */
+static void test_polling(void)
+{
+    enum
+    {
+        POLLS = 100
+    };
+    struct tcp_pcb * c = sim_connect();
+    long             bytes_kept;
+    long             bytes_closed = 0;
+    size_t           pos          = 0;
+    size_t           len;
+    int              chunked;
+    int              i;
+
+    for (i = 0; i < POLLS; i++)
+    {
+        send_text(c, "GET /status.json HTTP/1.1\r\nHost: 192.168.4.1\r\n\r\n");
+        sim_run(c);
+        pos = response(c, pos, &chunked, &len);
+        CHECK(pos && chunked && same(1, len), "poll %d", i);
+    }
+    CHECK(!c->closed, "closed after %d polls", POLLS);
+    bytes_kept = c->out_len;
+    sim_remote_close(c);
+    sim_free(c);
+    for (i = 0; i < POLLS; i++)
+    {
+        c = sim_connect();
+        send_text(c, "GET /status.json HTTP/1.1\r\nHost: 192.168.4.1\r\nConnection: close\r\n\r\n");
+        sim_run(c);
+        CHECK(c->closed, "poll %d with Connection: close kept open", i);
+        bytes_closed += c->out_len;
+        sim_free(c);
+    }
+    /* A chunk per span and insert: the framing costs more bytes than the
+       handshake and FIN of a connection per poll, which cost round trips */
+    printf("%d status.json polls: 1 connection and %ld bytes chunked, %d connections and %ld bytes closing\n", POLLS,
+           bytes_kept, POLLS, bytes_closed);
+}
+
+int main(void)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(long_insert) - 1; i++)
+    {
+        long_insert[i] = 'a' + (char)(i % 26);
+    }
+    http_set_ssi_handler((tSSIHandler)handler, tags, TAG_COUNT);
+    httpd_init(false);
+
+    test_tags();
+    test_chunked();
+    test_polling();
+
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result(LWIP_HTTPD_SSI_MULTIPART ? "ssi multipart" : "ssi");
+}
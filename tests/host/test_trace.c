@@ -0,0 +1,199 @@
+/* Packet trace of the control portal: the segments of every response the
+ * way lwIP packs them, against a client that delays the ACK of a lone
+ * segment. Each response is traced with Nagle off and on; built with
+ * HTTPD_SEND_PLANNER=0 the same trace shows the writes as they come.
+ * With the planner and Nagle off (the server default) a response may end
+ * in one short segment and never waits for a delayed ACK. "trace" prints
+ * every segment */
+#include <string.h>
+#include <stdlib.h>
+#include "sim_tcp.h"
+#include "httpd.h"
+#include "test_util.h"
+
+/* httpd.c default */
+#ifndef HTTPD_SEND_PLANNER
+#    define HTTPD_SEND_PLANNER 1
+#endif
+
+static const char * const assets[] = {
+    "/index.html",     "/css/siimple.min.ice.css", "/css/fonts.css",        "/css/common.css",
+    "/css/style.css",  "/font/latin.woff2",        "/font/latin_ext.woff2", "/img/favicon.png",
+    "/js/iro.js",      "/js/smoothie_min.js",      "/config.html",          "/complete.html",
+    "/error.html",
+};
+#define ASSET_COUNT (int)(sizeof(assets) / sizeof(assets[0]))
+
+struct trace
+{
+    long bytes;
+    long segs;
+    long shorts;
+    long stalls;
+};
+
+static void count(struct tcp_pcb * c, const struct trace * before, struct trace * t)
+{
+    t->bytes  = c->tr_bytes - before->bytes;
+    t->segs   = c->tr_segs - before->segs;
+    t->shorts = c->tr_short - before->shorts;
+    t->stalls = c->tr_delack - before->stalls;
+}
+
+static void mark(struct tcp_pcb * c, struct trace * t)
+{
+    t->bytes  = c->tr_bytes;
+    t->segs   = c->tr_segs;
+    t->shorts = c->tr_short;
+    t->stalls = c->tr_delack;
+}
+
+static struct tcp_pcb * connect_nagle(int nagle)
+{
+    struct tcp_pcb * c = sim_connect();
+
+    if (nagle)
+    {
+        tcp_nagle_enable(c);
+    }
+    else
+    {
+        tcp_nagle_disable(c);
+    }
+    return c;
+}
+
+/* Every asset one after the other on one connection (keep-alive) or on a
+ * connection each, the trace of each response in t[] */
+static void trace_page(int nagle, int keepalive, struct trace * t)
+{
+    struct tcp_pcb * c = NULL;
+    int              i;
+
+    for (i = 0; i < ASSET_COUNT; i++)
+    {
+        struct trace before;
+        char         request[256];
+        if ((c == NULL) || c->closed)
+        {
+            if (c != NULL)
+            {
+                sim_free(c);
+            }
+            c = connect_nagle(nagle);
+        }
+        snprintf(request, sizeof(request),
+                 "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: gzip\r\nConnection: %s\r\n\r\n", assets[i],
+                 keepalive ? "keep-alive" : "close");
+        if (sim_trace_print)
+        {
+            printf("%s, Nagle %s, %s\n", assets[i], nagle ? "on" : "off", keepalive ? "keep-alive" : "close");
+        }
+        mark(c, &before);
+        sim_trace_send(c, request, strlen(request));
+        count(c, &before, &t[i]);
+        CHECK(c->nuseg == 0, "%s: %d segments left unsent", assets[i], c->nuseg);
+    }
+    if (!c->closed)
+    {
+        sim_remote_close(c);
+    }
+    sim_free(c);
+}
+
+/* All requests in one segment, the responses back to back */
+static void trace_pipelined(int nagle, struct trace * t)
+{
+    static char      all[4096];
+    struct trace     before;
+    struct tcp_pcb * c   = connect_nagle(nagle);
+    size_t           len = 0;
+    int              i;
+
+    for (i = 0; i < ASSET_COUNT; i++)
+    {
+        len += snprintf(all + len, sizeof(all) - len, "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\n\r\n", assets[i]);
+    }
+    mark(c, &before);
+    sim_trace_send(c, all, len);
+    count(c, &before, t);
+    sim_remote_close(c);
+    sim_free(c);
+}
+
+static void sum(const struct trace * t, int n, struct trace * total)
+{
+    memset(total, 0, sizeof(*total));
+    while (n--)
+    {
+        total->bytes += t->bytes;
+        total->segs += t->segs;
+        total->shorts += t->shorts;
+        total->stalls += t->stalls;
+        t++;
+    }
+}
+
+static void test_trace(int keepalive)
+{
+    struct trace t[2][ASSET_COUNT];
+    struct trace total[2];
+    int          nagle;
+    int          i;
+
+    for (nagle = 0; nagle < 2; nagle++)
+    {
+        trace_page(nagle, keepalive, t[nagle]);
+        sum(t[nagle], ASSET_COUNT, &total[nagle]);
+    }
+    printf("planner %s, %-10s |       Nagle off: segs short stalls |       Nagle on:  segs short stalls\n",
+           HTTPD_SEND_PLANNER ? "on " : "off", keepalive ? "keep-alive" : "close");
+    for (i = 0; i <= ASSET_COUNT; i++)
+    {
+        const struct trace * off = (i < ASSET_COUNT) ? &t[0][i] : &total[0];
+        const struct trace * on  = (i < ASSET_COUNT) ? &t[1][i] : &total[1];
+        printf("%-32s | %7ld B %5ld %5ld %6ld | %7ld B %5ld %5ld %6ld\n", (i < ASSET_COUNT) ? assets[i] : "total",
+               off->bytes, off->segs, off->shorts, off->stalls, on->bytes, on->segs, on->shorts, on->stalls);
+        /* Nagle only decides when the segments go, not what they carry */
+        CHECK(off->bytes == on->bytes, "%s: %ld bytes with Nagle off, %ld on", (i < ASSET_COUNT) ? assets[i] : "total",
+              off->bytes, on->bytes);
+#if HTTPD_SEND_PLANNER
+        if (i < ASSET_COUNT)
+        {
+            CHECK(off->shorts <= 1, "%s: %ld short segments", assets[i], off->shorts);
+        }
+#endif /* HTTPD_SEND_PLANNER */
+    }
+#if HTTPD_SEND_PLANNER
+    CHECK(total[0].stalls == 0, "%ld responses waited for a delayed ACK", total[0].stalls);
+#endif /* HTTPD_SEND_PLANNER */
+}
+
+static void test_pipelined(void)
+{
+    struct trace t[2];
+    int          nagle;
+
+    for (nagle = 0; nagle < 2; nagle++)
+    {
+        trace_pipelined(nagle, &t[nagle]);
+    }
+    printf("planner %s, pipelined   | %7ld B %5ld %5ld %6ld | %7ld B %5ld %5ld %6ld\n", HTTPD_SEND_PLANNER ? "on " : "off",
+           t[0].bytes, t[0].segs, t[0].shorts, t[0].stalls, t[1].bytes, t[1].segs, t[1].shorts, t[1].stalls);
+#if HTTPD_SEND_PLANNER
+    CHECK(t[0].stalls == 0, "pipelined responses waited for %ld delayed ACKs", t[0].stalls);
+#endif /* HTTPD_SEND_PLANNER */
+}
+
+int main(int argc, char ** argv)
+{
+    sim_trace_print = (argc > 1) && (strcmp(argv[1], "trace") == 0);
+    httpd_init(false);
+
+    test_trace(1);
+    test_trace(0);
+    test_pipelined();
+
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result(HTTPD_SEND_PLANNER ? "trace" : "trace without the planner");
+}
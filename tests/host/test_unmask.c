@@ -0,0 +1,126 @@
+/* websocket_unmask() against the byte-wise definition of RFC 6455 5.3 for
+ * every alignment of the data, every position of a fragment in the payload
+ * and lengths across the word loop, then its throughput */
+#include "httpd.c"
+#include "test_util.h"
+
+/* Octet i of the payload is XORed with octet i MOD 4 of the key */
+static void unmask_reference(u8_t * data, u16_t len, const u8_t * mask, u32_t pos)
+{
+    u16_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        data[i] ^= mask[(pos + i) % 4];
+    }
+}
+
+static u32_t rng_state = 1;
+
+static u32_t rng(void)
+{
+    rng_state = rng_state * 1103515245 + 12345;
+    return rng_state >> 8;
+}
+
+/* Unmasks len bytes at buf + offset both ways, guard bytes around them must
+ * stay untouched */
+static int check_case(u8_t * a, u8_t * b, int offset, u16_t len, const u8_t * mask, u32_t pos)
+{
+    int i;
+
+    for (i = 0; i < offset + len + 16; i++)
+    {
+        a[i] = b[i] = (u8_t)rng();
+    }
+    websocket_unmask(a + offset, len, mask, pos);
+    unmask_reference(b + offset, len, mask, pos);
+    if (memcmp(a, b, offset + len + 16) != 0)
+    {
+        CHECK(0, "offset %d length %u position %u", offset, len, (unsigned int)pos);
+        return 0;
+    }
+    return 1;
+}
+
+static void test_property(void)
+{
+    static u8_t     a[4200];
+    static u8_t     b[4200];
+    static const u32_t positions[] = { 0, 1, 2, 3, 4, 5, 6, 7, 125, 65535, 65536, 0xFFFFFFFD, 0xFFFFFFFF };
+    u8_t            mask[4];
+    long            cases = 0;
+    int             offset;
+    int             len;
+    size_t          p;
+    int             i;
+
+    /* Exhaustive over the head and tail cases of the word loop */
+    for (offset = 0; offset < 8; offset++)
+    {
+        for (len = 0; len <= 64; len++)
+        {
+            for (p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+            {
+                for (i = 0; i < 4; i++)
+                {
+                    mask[i] = (u8_t)rng();
+                }
+                cases += check_case(a, b, offset, (u16_t)len, mask, positions[p]);
+            }
+        }
+    }
+    /* Long fragments anywhere in the payload */
+    for (i = 0; i < 20000; i++)
+    {
+        mask[0] = (u8_t)rng();
+        mask[1] = (u8_t)rng();
+        mask[2] = (u8_t)rng();
+        mask[3] = (u8_t)rng();
+        cases += check_case(a, b, (int)(rng() % 8), (u16_t)(rng() % 4096), mask, rng());
+    }
+    printf("%ld cases match the byte-wise unmasking (offsets 0-7, lengths 0-4095, any payload position)\n", cases);
+}
+
+static void bench(void)
+{
+    static u8_t           buf[1500];
+    static const u8_t     mask[4] = { 0x37, 0xfa, 0x21, 0x3d };
+    static const u16_t    sizes[] = { 8, 64, 1024, 1436 };
+    size_t                s;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        long   n = 100000000 / sizes[s];
+        long   k;
+        double t0;
+        double t1;
+        double t2;
+
+        t0 = test_now_us();
+        for (k = 0; k < n; k++)
+        {
+            unmask_reference(buf + 2, sizes[s], mask, 0);
+            __asm__ volatile("" ::: "memory");
+        }
+        t1 = test_now_us();
+        for (k = 0; k < n; k++)
+        {
+            websocket_unmask(buf + 2, sizes[s], mask, 0);
+            __asm__ volatile("" ::: "memory");
+        }
+        t2 = test_now_us();
+        printf("%5u B frames: byte-wise %5.0f MB/s, websocket_unmask %5.0f MB/s (x%.1f, host)\n", sizes[s],
+               n * (double)sizes[s] / (t1 - t0), n * (double)sizes[s] / (t2 - t1), (t1 - t0) / (t2 - t1));
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    test_property();
+    if ((argc > 1) && (strcmp(argv[1], "bench") == 0))
+    {
+        bench();
+    }
+    return test_result("unmask");
+}
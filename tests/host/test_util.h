@@ -0,0 +1,42 @@
+/* Shared by the host tests: failure counting and a monotonic clock */
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#include <stdio.h>
+#include <time.h>
+
+static int test_fails;
+
+#define CHECK(cond, ...)                                   \
+    do                                                     \
+    {                                                      \
+        if (!(cond))                                       \
+        {                                                  \
+            test_fails++;                                  \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);    \
+            printf(__VA_ARGS__);                           \
+            printf("\n");                                  \
+        }                                                  \
+    } while (0)
+
+static inline double test_now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/* Last line of every test, the Makefile only looks at the exit code */
+static inline int test_result(const char * name)
+{
+    if (test_fails)
+    {
+        printf("%s: FAILED %d\n", name, test_fails);
+        return 1;
+    }
+    printf("%s: PASS\n", name);
+    return 0;
+}
+
+#endif /* TEST_UTIL_H */
@@ -0,0 +1,169 @@
+/* websocket_write() against the frame the heap buffer version sent: the
+ * same bytes for every payload length class, no heap allocation, and a
+ * frame that does not fit queues nothing. "bench" counts frames/s for the
+ * 8 byte status frames and 1 KB frames, both ways */
+#include "httpd.c"
+#include "sim_tcp.h"
+#include "test_util.h"
+
+/* websocket_write() before the split write: the frame built in a heap
+ * buffer, then copied again by http_write() */
+static err_t websocket_write_copy(struct tcp_pcb * pcb, const uint8_t * data, uint16_t len, uint8_t mode)
+{
+    uint8_t * buf = mem_malloc(len + 4);
+    if (buf == NULL)
+    {
+        return ERR_MEM;
+    }
+
+    int offset = 2;
+    buf[0]     = 0x80 | mode;
+    if (len > 125)
+    {
+        offset = 4;
+        buf[1] = 126;
+        buf[2] = len >> 8;
+        buf[3] = len;
+    }
+    else
+    {
+        buf[1] = len;
+    }
+
+    memcpy(&buf[offset], data, len);
+    len += offset;
+
+    err_t retval = http_write(pcb, buf, &len, TCP_WRITE_FLAG_COPY);
+    mem_free(buf);
+
+    return retval;
+}
+
+typedef err_t (*write_fn)(struct tcp_pcb * pcb, const uint8_t * data, uint16_t len, uint8_t mode);
+
+static const char upgrade[] = "GET /stream HTTP/1.1\r\nHost: 192.168.4.1\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                              "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+
+static u8_t payload[4096];
+
+/* A connection with the websocket open and its output cleared */
+static struct tcp_pcb * client(void)
+{
+    struct tcp_pcb * c = sim_connect();
+
+    sim_send(c, upgrade, sizeof(upgrade) - 1);
+    sim_run(c);
+    CHECK((c->out_len > 12) && (memcmp(c->out, "HTTP/1.1 101", 12) == 0), "no upgrade: %.20s", c->out);
+    c->out_len = 0;
+    return c;
+}
+
+/* The client takes everything sent so far */
+static void drain(struct tcp_pcb * c)
+{
+    sim_ack(c);
+    c->out_len = 0;
+}
+
+static void test_frames(void)
+{
+    static const u16_t lens[] = { 0, 1, 8, 125, 126, 127, 1024, 1460, 1461, 4096 };
+    static u8_t        expect[4100];
+    struct tcp_pcb *   c = client();
+    size_t             expect_len;
+    long               mallocs;
+    size_t             i;
+    err_t              err;
+
+    for (i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (u8_t)(i * 7);
+    }
+    for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++)
+    {
+        CHECK(websocket_write_copy(c, payload, lens[i], WS_BIN_MODE) == ERR_OK, "%u B: heap buffer write", lens[i]);
+        expect_len = c->out_len;
+        memcpy(expect, c->out, expect_len);
+        drain(c);
+
+        mallocs = sim_mallocs;
+        err     = websocket_write(c, payload, lens[i], WS_BIN_MODE);
+        CHECK(err == ERR_OK, "%u B: error %d", lens[i], err);
+        CHECK((c->out_len == expect_len) && (memcmp(c->out, expect, expect_len) == 0), "%u B: %zu bytes differ",
+              lens[i], c->out_len);
+        CHECK(sim_mallocs == mallocs, "%u B: %ld heap allocations", lens[i], sim_mallocs - mallocs);
+        drain(c);
+    }
+
+    /* No room for the payload after the header: nothing goes */
+    c->snd_buf = 1024 + WS_EXTENDED_HEADER_LEN - 1;
+    CHECK(websocket_write(c, payload, 1024, WS_BIN_MODE) == ERR_MEM, "frame larger than the send buffer");
+    CHECK(c->out_len == 0, "%zu bytes of a frame that did not fit", c->out_len);
+    c->snd_buf      = sim_snd_buf;
+    c->snd_queuelen = TCP_SND_QUEUELEN - 1;
+    CHECK(websocket_write(c, payload, 1024, WS_BIN_MODE) == ERR_MEM, "frame longer than the send queue");
+    CHECK(c->out_len == 0, "%zu bytes of a frame that did not fit", c->out_len);
+    c->snd_queuelen = 0;
+
+    sim_remote_close(c);
+    sim_free(c);
+    printf("frames of 0 to 4096 B as the heap buffer version sent them, without a heap allocation\n");
+}
+
+/* Frames of len bytes written and taken by the client, per second */
+static double frames_per_s(struct tcp_pcb * c, write_fn write, u16_t len, long n, long * mallocs)
+{
+    long   start = sim_mallocs;
+    long   k;
+    double t0;
+    double t1;
+
+    t0 = test_now_us();
+    for (k = 0; k < n; k++)
+    {
+        if (write(c, payload, len, WS_BIN_MODE) != ERR_OK)
+        {
+            CHECK(0, "%u B frame %ld not sent", len, k);
+            break;
+        }
+        drain(c);
+    }
+    t1       = test_now_us();
+    *mallocs = sim_mallocs - start;
+    return n / (t1 - t0) * 1e6;
+}
+
+static void bench(void)
+{
+    static const u16_t sizes[] = { 8, 1024 };
+    struct tcp_pcb *   c       = client();
+    size_t             s;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        long   n = 2000000;
+        long   heap_mallocs;
+        long   mallocs;
+        double heap = frames_per_s(c, websocket_write_copy, sizes[s], n, &heap_mallocs);
+        double fps  = frames_per_s(c, websocket_write, sizes[s], n, &mallocs);
+
+        printf("%4u B frames: heap buffer %5.2f M frames/s (%ld allocations), websocket_write %5.2f M frames/s "
+               "(%ld allocations, x%.1f, host)\n",
+               sizes[s], heap / 1e6, heap_mallocs, fps / 1e6, mallocs, fps / heap);
+    }
+    sim_remote_close(c);
+    sim_free(c);
+}
+
+int main(int argc, char ** argv)
+{
+    httpd_init(false);
+
+    test_frames();
+    if ((argc > 1) && (strcmp(argv[1], "bench") == 0))
+    {
+        bench();
+    }
+    CHECK(sim_pbufs == 0, "pbufs leaked %ld", sim_pbufs);
+    return test_result("ws");
+}